@@ -47,6 +47,8 @@ static const uint8_t CPU_AFFINITY_COUNT_LOW = 1;
 static const int INTERFACE_RUNNING_CHECK_FREQUENCY_MS = 1000;
 #endif
 
+static const int BYTES_PER_MEGABYTES = 1024 * 1024;
+
 static const QStringList BAKEABLE_MODEL_EXTENSIONS = { "fbx" };
 static QStringList BAKEABLE_TEXTURE_EXTENSIONS;
 static const QStringList BAKEABLE_SCRIPT_EXTENSIONS = { };
@@ -327,8 +329,9 @@ AssetServer::AssetServer(ReceivedMessage& message) :
 
 void AssetServer::aboutToFinish() {
 
-    // remove pending transfer tasks
+    // remove pending transfer tasks and let the running ones finish while the content cache is still around
     _transferTaskPool.clear();
+    _transferTaskPool.waitForDone();
 
     // abort each of our still running bake tasks, remove pending bakes that were never put on the thread pool
     auto it = _pendingBakes.begin();
@@ -458,6 +461,12 @@ void AssetServer::completeSetup() {
         _filesizeLimit = assetsFilesizeLimit * BITS_PER_MEGABITS;
     }
 
+    // get the size of the in memory cache of hot assets
+    static const QString ASSETS_CACHE_SIZE_OPTION = "assets_cache_size";
+    auto assetsCacheSize = assetServerObject[ASSETS_CACHE_SIZE_OPTION].toInt(AssetContentCache::DEFAULT_MAX_SIZE / BYTES_PER_MEGABYTES);
+    _contentCache.setMaxSize((qint64)assetsCacheSize * BYTES_PER_MEGABYTES);
+    qCInfo(asset_server) << "Keeping up to" << assetsCacheSize << "MB of hot assets in memory";
+
     PathUtils::removeTemporaryApplicationDirs();
     PathUtils::removeTemporaryApplicationDirs("Oven");
 
@@ -541,6 +550,8 @@ void AssetServer::cleanupUnmappedFiles() {
                 if (removeableFile.remove()) {
                     qCDebug(asset_server) << "\tDeleted" << filename << "from asset files directory since it is unmapped.";
 
+                    _contentCache.remove(filename);
+
                     removeBakedPathsForDeletedAsset(filename);
                 } else {
                     qCDebug(asset_server) << "\tAttempt to delete unmapped file" << filename << "failed";
@@ -867,7 +878,7 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _contentCache);
     _transferTaskPool.start(task);
 }
 
@@ -957,6 +968,19 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    auto cacheStats = _contentCache.getStats();
+    auto cacheRequests = cacheStats.hits + cacheStats.misses;
+
+    QJsonObject transferStats;
+    transferStats["1. Bytes In Flight"] = (double)SendAssetTask::getBytesInFlight();
+    transferStats["2. Bytes Sent"] = (double)SendAssetTask::getBytesSent();
+    transferStats["3. Cache Hits"] = (double)cacheStats.hits;
+    transferStats["4. Cache Misses"] = (double)cacheStats.misses;
+    transferStats["5. Cache Hit Rate"] = cacheRequests > 0 ? (double)cacheStats.hits / cacheRequests : 0.0;
+    transferStats["6. Cached Assets"] = cacheStats.numEntries;
+    transferStats["7. Cache Size (MB)"] = (double)cacheStats.size / BYTES_PER_MEGABYTES;
+    serverStats["transfer_stats"] = transferStats;
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
@@ -1175,6 +1199,8 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
             if (removeableFile.remove()) {
                 qCDebug(asset_server) << "\tDeleted" << hash << "from asset files directory since it is now unmapped.";
 
+                _contentCache.remove(hash);
+
                 removeBakedPathsForDeletedAsset(hash);
             } else {
                 qCDebug(asset_server) << "\tAttempt to delete unmapped file" << hash << "failed";
@@ -16,6 +16,7 @@
 #include <QtCore/QThreadPool>
 #include <QRunnable>
 
+#include <AssetContentCache.h>
 #include <ThreadedAssignment.h>
 
 #include "AssetUtils.h"
@@ -153,6 +154,10 @@ private:
     QDir _resourcesDirectory;
     QDir _filesDirectory;
 
+    /// Contents of the hot asset files, shared by the send tasks.  Declared before the task pool so it outlives
+    /// the tasks the pool waits for when it is destroyed.
+    AssetContentCache _contentCache;
+
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
@@ -11,6 +11,7 @@
 
 #include "SendAssetTask.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <QFile>
@@ -21,20 +22,58 @@
 #include <NLPacketList.h>
 #include <NodeList.h>
 #include <udt/Packet.h>
+#include <AssetContentCache.h>
 
 #include "AssetUtils.h"
 #include "ByteRange.h"
 #include "ClientServerUtils.h"
 
-SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir) :
+std::atomic<qint64> SendAssetTask::_bytesInFlight { 0 };
+std::atomic<quint64> SendAssetTask::_bytesSent { 0 };
+
+SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                             AssetContentCache& contentCache) :
     QRunnable(),
     _message(message),
     _senderNode(sendToNode),
-    _resourcesDir(resourcesDir)
+    _resourcesDir(resourcesDir),
+    _contentCache(contentCache)
 {
     
 }
 
+void SendAssetTask::writeFileRange(QFile& file, qint64 offset, qint64 size, NLPacketList& packetList) {
+    // map the range so the packet segments are filled straight from the page cache
+    uchar* mapped = file.map(offset, size);
+    if (mapped) {
+        packetList.write(reinterpret_cast<const char*>(mapped), size);
+        file.unmap(mapped);
+        return;
+    }
+
+    // otherwise go through a small buffer rather than reading the whole range at once
+    static const qint64 READ_CHUNK_SIZE = 256 * 1024;
+    QByteArray chunk;
+    chunk.resize((int)std::min(size, READ_CHUNK_SIZE));
+
+    file.seek(offset);
+    while (size > 0) {
+        qint64 bytesRead = file.read(chunk.data(), std::min(size, (qint64)chunk.size()));
+        if (bytesRead <= 0) {
+            break;
+        }
+        packetList.write(chunk.constData(), bytesRead);
+        size -= bytesRead;
+    }
+
+    // the size was announced up front, pad the reply if the file shrank under us so the client sees bad data
+    // rather than a hung transfer
+    if (size > 0) {
+        qCDebug(networking) << "Short read of" << size << "bytes from" << file.fileName();
+        packetList.write(QByteArray((int)size, 0));
+    }
+}
+
 void SendAssetTask::run() {
     MessageID messageID;
     ByteRange byteRange;
@@ -60,6 +99,9 @@ void SendAssetTask::run() {
 
     replyPacketList->writePrimitive(messageID);
 
+    // asset bytes this task holds until its reply is handed to the connection
+    qint64 replyBytes = 0;
+
     if (!byteRange.isValid()) {
         replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
     } else {
@@ -67,14 +109,19 @@ void SendAssetTask::run() {
         
         QFile file { filePath };
 
-        if (file.open(QIODevice::ReadOnly)) {
+        // popular assets are served from memory, the others are only opened here
+        QByteArray contents = _contentCache.find(hexHash);
+        bool isCached = !contents.isNull();
+
+        if (isCached || file.open(QIODevice::ReadOnly)) {
+            qint64 fileSize = isCached ? contents.size() : file.size();
 
             // first fixup the range based on the now known file size
-            byteRange.fixupRange(file.size());
+            byteRange.fixupRange(fileSize);
 
             // check if we're being asked to read data that we just don't have
             // because of the file size
-            if (file.size() < byteRange.fromInclusive || file.size() < byteRange.toExclusive) {
+            if (fileSize < byteRange.fromInclusive || fileSize < byteRange.toExclusive) {
                 replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
                 qCDebug(networking) << "Bad byte range: " << hexHash << " "
                     << byteRange.fromInclusive << ":" << byteRange.toExclusive;
@@ -82,29 +129,36 @@ void SendAssetTask::run() {
                 // we have a valid byte range, handle it and send the asset
                 auto size = byteRange.size();
 
-                if (byteRange.fromInclusive >= 0) {
+                // a negative range is read back from the end of the file
+                qint64 offset = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : fileSize + byteRange.fromInclusive;
 
-                    // this range is positive, meaning we just need to seek into the file and then read from there
-                    file.seek(byteRange.fromInclusive);
-                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
-                    replyPacketList->writePrimitive(size);
-                    replyPacketList->write(file.read(size));
-                } else {
-                    // this range is negative, at least the first part of the read will be back into the end of the file
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacketList->writePrimitive(size);
 
-                    // seek to the part of the file where the negative range begins
-                    file.seek(file.size() + byteRange.fromInclusive);
+                replyBytes = size;
+                _bytesInFlight += replyBytes;
 
-                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
-                    replyPacketList->writePrimitive(size);
+                if (!isCached && _contentCache.shouldAdmit(hexHash, fileSize)) {
+                    // asked for again and small enough to keep, load it whole once for this and the next requests
+                    contents = file.readAll();
+                    if (contents.size() == fileSize) {
+                        _contentCache.insert(hexHash, contents);
+                        isCached = true;
+                    }
+                }
 
-                    // first write everything from the negative range to the end of the file
-                    replyPacketList->write(file.read(size));
+                if (isCached) {
+                    replyPacketList->write(contents.constData() + offset, size);
+                } else {
+                    writeFileRange(file, offset, size, *replyPacketList);
                 }
 
                 qCDebug(networking) << "Sending asset: " << hexHash;
             }
-            file.close();
+
+            if (file.isOpen()) {
+                file.close();
+            }
         } else {
             qCDebug(networking) << "Asset not found: " << filePath << "(" << hexHash << ")";
             replyPacketList->writePrimitive(AssetUtils::AssetServerError::AssetNotFound);
@@ -117,4 +171,7 @@ void SendAssetTask::run() {
     } else {
         nodeList->sendPacketList(std::move(replyPacketList), _message->getSenderSockAddr());
     }
+
+    _bytesInFlight -= replyBytes;
+    _bytesSent += replyBytes;
 }
@@ -12,6 +12,8 @@
 #ifndef hifi_SendAssetTask_h
 #define hifi_SendAssetTask_h
 
+#include <atomic>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QString>
@@ -21,18 +23,32 @@
 #include "AssetServer.h"
 #include "Node.h"
 
+class AssetContentCache;
 class NLPacket;
+class NLPacketList;
+class QFile;
 
 class SendAssetTask : public QRunnable {
 public:
-    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir);
+    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                  AssetContentCache& contentCache);
 
     void run() override;
 
+    /// Bytes of asset data the running tasks are currently reading and packing
+    static qint64 getBytesInFlight() { return _bytesInFlight; }
+    static quint64 getBytesSent() { return _bytesSent; }
+
 private:
+    void writeFileRange(QFile& file, qint64 offset, qint64 size, NLPacketList& packetList);
+
     QSharedPointer<ReceivedMessage> _message;
     SharedNodePointer _senderNode;
     QDir _resourcesDir;
+    AssetContentCache& _contentCache;
+
+    static std::atomic<qint64> _bytesInFlight;
+    static std::atomic<quint64> _bytesSent;
 };
 
 #endif
@@ -20,6 +20,7 @@
 #include <shared/QtHelpers.h>
 
 #include <LogHandler.h>
+#include <MetricRegistry.h>
 #include <NetworkAccessManager.h>
 #include <NodeList.h>
 #include <Node.h>
@@ -86,14 +87,13 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
     auto& packetReceiver = nodeList->getPacketReceiver();
 
     // packets whose consequences are limited to their own node can be parallelized
-    packetReceiver.registerListenerForTypes({
+    packetReceiver.registerHandlerForTypes({
             PacketType::MicrophoneAudioNoEcho,
             PacketType::MicrophoneAudioWithEcho,
             PacketType::InjectAudio,
             PacketType::AudioStreamStats,
             PacketType::SilentAudioFrame,
             PacketType::NegotiateAudioFormat,
-            PacketType::MuteEnvironment,
             PacketType::NodeIgnoreRequest,
             PacketType::RadiusIgnoreRequest,
             PacketType::RequestsDomainListData,
@@ -101,7 +101,9 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
             PacketType::InjectorGainSet,
             PacketType::AudioSoloRequest,
             PacketType::StopInjector },
-            this, "queueAudioPacket");
+            this, [this](QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
+                queueAudioPacket(message, node);
+            });
 
     // packets whose consequences are global should be processed on the main thread
     packetReceiver.registerListener(PacketType::MuteEnvironment, this, "handleMuteEnvironmentPacket");
@@ -125,8 +127,11 @@ void AudioMixer::aboutToFinish() {
 }
 
 void AudioMixer::queueAudioPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
+    static auto silentPacketsMetric = MetricRegistry::getInstance().counter("audio_mixer_silent_packets_total",
+                                                                            "Silent audio frames received");
     if (message->getType() == PacketType::SilentAudioFrame) {
         _numSilentPackets++;
+        silentPacketsMetric.increment();
     }
 
     getOrCreateClientData(node.data())->queuePacket(message, node);
@@ -327,6 +332,15 @@ void AudioMixer::sendStatsPacket() {
     mixStats["1_hrtf_resets"] = (int)(_stats.hrtfResets / (float)_numStatFrames);
     mixStats["1_hrtf_updates"] = (int)(_stats.hrtfUpdates / (float)_numStatFrames);
 
+    mixStats["1_clustered_streams"] = (int)(_stats.clusteredStreams / (float)_numStatFrames);
+    mixStats["1_cluster_mixes"] = (int)(_stats.clusterMixes / (float)_numStatFrames);
+    mixStats["1_cluster_renders"] = (int)(_stats.clusterRenders / (float)_numStatFrames);
+
+    mixStats["1_audience_groups"] = (int)(_stats.audienceGroups / (float)_numStatFrames);
+    mixStats["1_audience_listeners"] = (int)(_stats.audienceListeners / (float)_numStatFrames);
+    mixStats["1_audience_mixes_saved"] = (int)(_stats.audienceMixesSaved / (float)_numStatFrames);
+    mixStats["1_audience_us_saved"] = (qint64)(_stats.audienceMixTimeSaved / 1000 / _numStatFrames);
+
     mixStats["2_skipped_streams"] = (int)(_stats.skipped / (float)_numStatFrames);
     mixStats["2_inactive_streams"] = (int)(_stats.inactive / (float)_numStatFrames);
     mixStats["2_active_streams"] = (int)(_stats.active / (float)_numStatFrames);
@@ -372,6 +386,18 @@ void AudioMixer::sendStatsPacket() {
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(statsObject);
 }
 
+void AudioMixer::resetStatsInterval() {
+    // the timers keep their trailing history, the counters start over
+    uint64_t timing, trailing;
+    for (auto timer : { &_ticTiming, &_checkTimeTiming, &_sleepTiming, &_frameTiming, &_packetsTiming, &_mixTiming,
+                        &_eventsTiming }) {
+        timer->get(timing, trailing);
+    }
+
+    _numStatFrames = _numSilentPackets = 0;
+    _stats.reset();
+}
+
 void AudioMixer::run() {
 
     qCDebug(audio) << "Waiting for connection to domain to request settings from domain-server.";
@@ -385,6 +411,12 @@ void AudioMixer::run() {
 }
 
 AudioMixerClientData* AudioMixer::getOrCreateClientData(Node* node) {
+    // audio packets are queued from the receive thread while the main thread may create the same client data
+    QMutexLocker locker(&node->getMutex());
+    return createClientData(node);
+}
+
+AudioMixerClientData* AudioMixer::createClientData(Node* node) {
     auto clientData = dynamic_cast<AudioMixerClientData*>(node->getLinkedData());
 
     if (!clientData) {
@@ -404,7 +436,8 @@ void AudioMixer::start() {
         NodeType::Agent, NodeType::EntityScriptServer,
         NodeType::UpstreamAudioMixer, NodeType::DownstreamAudioMixer
     });
-    nodeList->linkedDataCreateCallback = [&](Node* node) { getOrCreateClientData(node); };
+    // LimitedNodeList holds the node mutex around this callback
+    nodeList->linkedDataCreateCallback = [&](Node* node) { createClientData(node); };
 
     // parse out any AudioMixer settings
     {
@@ -416,6 +449,10 @@ void AudioMixer::start() {
     // mix state
     unsigned int frame = 1;
 
+    const std::vector<int64_t> FRAME_DURATION_BUCKETS_US { 1000, 2500, 5000, 7500, 10000, 15000, 20000, 50000 };
+    auto frameDurationMetric = MetricRegistry::getInstance().histogram("audio_mixer_frame_duration_us",
+        "Time spent processing packets and mixing each frame, in microseconds", FRAME_DURATION_BUCKETS_US);
+
     while (!_isFinished) {
         auto ticTimer = _ticTiming.timer();
 
@@ -428,6 +465,7 @@ void AudioMixer::start() {
         }
 
         auto frameTimer = _frameTiming.timer();
+        auto frameStart = p_high_resolution_clock::now();
 
         // process (node-isolated) audio packets across slave threads
         {
@@ -461,6 +499,13 @@ void AudioMixer::start() {
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
             // mix across slave threads
             auto mixTimer = _mixTiming.timer();
+
+            // premix the clusters of voices that some listeners will hear from afar, once for all of them
+            _workerSharedData.sourceClusters.rebuild(cbegin, cend);
+
+            // and find the listeners of the audience zones that can share a single mix
+            _workerSharedData.audienceGroups.rebuild(cbegin, cend);
+
             _slavePool.mix(cbegin, cend, frame, numToRetain);
         });
 
@@ -473,6 +518,9 @@ void AudioMixer::start() {
         ++frame;
         ++_numStatFrames;
 
+        frameDurationMetric.record(
+            chrono::duration_cast<chrono::microseconds>(p_high_resolution_clock::now() - frameStart).count());
+
 
         if (_isFinished) {
             // alert qt eventing that this is finished
@@ -553,6 +601,7 @@ void AudioMixer::clearDomainSettings() {
     _audioZones.clear();
     _zoneSettings.clear();
     _zoneReverbSettings.clear();
+    _workerSharedData.audienceGroups.setZones({});
 }
 
 void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
@@ -588,6 +637,18 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
         }
 
         qCDebug(audio) << "Throttle Start:" << _throttleStartTarget << "Throttle Backoff:" << _throttleBackoffTarget;
+
+        const QString CLUSTER_DISTANT_SOURCES_KEY = "cluster_distant_sources";
+        const QString CLUSTER_DISTANCE_KEY = "cluster_distance";
+
+        auto& sourceClusters = _workerSharedData.sourceClusters;
+        sourceClusters.setEnabled(audioThreadingGroupObject[CLUSTER_DISTANT_SOURCES_KEY].toBool(false));
+        float clusterDistance = audioThreadingGroupObject[CLUSTER_DISTANCE_KEY].toDouble(AudioMixerSourceClusters::DEFAULT_MIN_DISTANCE);
+        sourceClusters.setMinDistance(clusterDistance > 0.0f ? clusterDistance : AudioMixerSourceClusters::DEFAULT_MIN_DISTANCE);
+
+        if (sourceClusters.isEnabled()) {
+            qCDebug(audio) << "Clustering sources further than" << sourceClusters.getMinDistance() << "m from a listener";
+        }
     }
 
     if (settingsObject.contains(AUDIO_BUFFER_GROUP_KEY)) {
@@ -804,6 +865,27 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
                 }
             }
         }
+
+        const QString AUDIENCE_ZONES = "audience_zones";
+        std::vector<AABox> audienceZones;
+        if (audioEnvGroupObject[AUDIENCE_ZONES].isArray()) {
+            const QJsonArray& audience = audioEnvGroupObject[AUDIENCE_ZONES].toArray();
+
+            const QString ZONE = "zone";
+            for (int i = 0; i < audience.count(); ++i) {
+                QJsonObject audienceObject = audience[i].toObject();
+
+                auto itZone = find_if(begin(_audioZones), end(_audioZones), [&](const ZoneDescription& description) {
+                    return description.name == audienceObject.value(ZONE).toString();
+                });
+
+                if (itZone != end(_audioZones)) {
+                    audienceZones.push_back(itZone->area);
+                    qCDebug(audio) << "Added Audience Zone:" << itZone->name;
+                }
+            }
+        }
+        _workerSharedData.audienceGroups.setZones(audienceZones);
     }
 }
 
@@ -12,6 +12,8 @@
 #ifndef hifi_AudioMixer_h
 #define hifi_AudioMixer_h
 
+#include <atomic>
+
 #include <AABox.h>
 #include <AudioHRTF.h>
 #include <AudioRingBuffer.h>
@@ -65,7 +67,10 @@ public:
     }
 
     virtual void aboutToFinish() override;
-    
+
+protected:
+    void resetStatsInterval() override;
+
 public slots:
     void run() override;
     void sendStatsPacket() override;
@@ -77,7 +82,6 @@ private slots:
     void handleNodeKilled(SharedNodePointer killedNode);
     void handleKillAvatarPacket(QSharedPointer<ReceivedMessage> packet, SharedNodePointer sendingNode);
 
-    void queueAudioPacket(QSharedPointer<ReceivedMessage> packet, SharedNodePointer sendingNode);
     void queueReplicatedAudioPacket(QSharedPointer<ReceivedMessage> packet);
     void removeHRTFsForFinishedInjector(const QUuid& streamID);
     void start();
@@ -87,7 +91,11 @@ private:
     std::chrono::microseconds timeFrame();
     void throttle(std::chrono::microseconds frameDuration, int frame);
 
+    // called on the receive thread, see PacketReceiver::registerHandler
+    void queueAudioPacket(QSharedPointer<ReceivedMessage> packet, SharedNodePointer sendingNode);
+
     AudioMixerClientData* getOrCreateClientData(Node* node);
+    AudioMixerClientData* createClientData(Node* node); // expects the node mutex to be held
 
     QString percentageForMixStats(int counter);
 
@@ -100,7 +108,7 @@ private:
     float _trailingMixRatio { 0.0f };
     float _throttlingRatio { 0.0f };
 
-    int _numSilentPackets { 0 };
+    std::atomic<int> _numSilentPackets { 0 };
 
     int _numStatFrames { 0 };
     AudioMixerStats _stats;
@@ -0,0 +1,124 @@
+//
+//  AudioMixerAudienceGroups.cpp
+//  assignment-client/src/audio
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerAudienceGroups.h"
+
+#include <algorithm>
+
+#include <AudioHRTF.h>
+
+#include "AudioMixerClientData.h"
+#include "AvatarAudioStream.h"
+
+namespace {
+    // The members' packets are the leader's encoding.  A codec that keeps state across frames can't be shared: the
+    // decoder of a member that leaves the group, or whose group gets a new leader, would go on from another encoder.
+    bool hasStatelessCodec(const QString& codecName) {
+        return codecName.isEmpty() || codecName == "pcm" || codecName == "zlib";
+    }
+
+    bool hasGainAdjustments(const AudioMixerClientData::MixableStreamsVector& streams) {
+        return std::any_of(streams.begin(), streams.end(), [](const AudioMixerClientData::MixableStream& stream) {
+            return stream.hrtf->getGainAdjustment() != HRTF_GAIN;
+        });
+    }
+
+    // anything that makes this listener's mix differ from its neighbours' but for its position
+    bool hasOwnMix(const Node& listener, AudioMixerClientData& listenerData, const AvatarAudioStream& listenerStream) {
+        // a member's own voice would be in the others' mix but not in its own
+        if (listenerStream.lastPopSucceeded() && listenerStream.getLastPopOutputLoudness() != 0.0f) {
+            return true;
+        }
+
+        if (!listener.getIgnoredNodeIDs().empty() || !listenerData.getIgnoringNodeIDs().empty() ||
+            !listenerData.getNewIgnoredNodeIDs().empty() || !listenerData.getNewIgnoringNodeIDs().empty() ||
+            !listenerData.getSoloedNodes().empty()) {
+            return true;
+        }
+
+        const auto& streams = listenerData.getStreams();
+        return hasGainAdjustments(streams.active) || hasGainAdjustments(streams.inactive) ||
+            hasGainAdjustments(streams.skipped);
+    }
+}
+
+void AudioMixerAudienceGroups::rebuild(ConstIter begin, ConstIter end) {
+    _groups.clear();
+    _listenerGroups.clear();
+
+    if (!isEnabled()) {
+        return;
+    }
+
+    std::vector<Key> keys;
+    std::vector<std::vector<const SharedNodePointer*>> members;
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        if (node->getType() != NodeType::Agent || !node->getActiveSocket() || node->isUpstream()) {
+            return;
+        }
+
+        auto nodeData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!nodeData) {
+            return;
+        }
+
+        auto listenerStream = nodeData->getAvatarAudioStream();
+        if (!listenerStream) {
+            return;
+        }
+
+        glm::vec3 position = listenerStream->getPosition();
+        auto zone = std::find_if(_zones.begin(), _zones.end(), [&](const AABox& box) { return box.contains(position); });
+        if (zone == _zones.end() || !hasStatelessCodec(nodeData->getCodecName()) ||
+            hasOwnMix(*node, *nodeData, *listenerStream)) {
+            return;
+        }
+
+        Key key { (int)(zone - _zones.begin()), nodeData->getCodecName(), nodeData->getMasterAvatarGain(),
+                  nodeData->getMasterInjectorGain(), listenerStream->isIgnoreBoxEnabled() };
+
+        auto it = std::find(keys.begin(), keys.end(), key);
+        if (it == keys.end()) {
+            keys.push_back(key);
+            members.emplace_back();
+            members.back().push_back(&node);
+        } else {
+            members[it - keys.begin()].push_back(&node);
+        }
+    });
+
+    for (const auto& groupMembers : members) {
+        // a listener alone in its group has nothing to share
+        if (groupMembers.size() < 2) {
+            continue;
+        }
+
+        // the lowest local ID keeps the same leader for as long as it stays in the group
+        auto leader = std::min_element(groupMembers.begin(), groupMembers.end(), [](const auto& a, const auto& b) {
+            return (*a)->getLocalID() < (*b)->getLocalID();
+        });
+
+        _groups.emplace_back(new Group);
+        auto group = _groups.back().get();
+        group->leader = **leader;
+        group->numMembers = (int)groupMembers.size();
+
+        for (const auto& member : groupMembers) {
+            _listenerGroups[(*member)->getLocalID()] = group;
+        }
+    }
+}
+
+AudioMixerAudienceGroups::Group* AudioMixerAudienceGroups::findGroup(Node::LocalID listenerID) const {
+    auto it = _listenerGroups.find(listenerID);
+    return it != _listenerGroups.end() ? it->second : nullptr;
+}
@@ -0,0 +1,77 @@
+//
+//  AudioMixerAudienceGroups.h
+//  assignment-client/src/audio
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerAudienceGroups_h
+#define hifi_AudioMixerAudienceGroups_h
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+
+#include <AABox.h>
+#include <NodeList.h>
+
+// Groups the listeners of an audience zone that would get the same mix: quiet, with no ignores, solo or per-avatar
+// gains of their own, the same master gains and the same codec, one without state between frames (pcm or zlib).
+// Each group is mixed and encoded once per frame, through the state of its leader, and the payload is sent to every
+// member, see AudioMixerSlave::mix.
+class AudioMixerAudienceGroups {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    struct Group {
+        SharedNodePointer leader; // the member with the lowest local ID, whose streams and encoder the mix goes through
+        int numMembers { 0 };
+
+        // filled by the first slave to reach one of the members this frame
+        std::mutex mutex;
+        bool isMixed { false };
+        bool hasPayload { false };
+        QByteArray payload;
+        uint64_t mixTime { 0 }; // nanoseconds
+    };
+
+    bool isEnabled() const { return !_zones.empty(); }
+    void setZones(std::vector<AABox> zones) { _zones = std::move(zones); }
+
+    // must be called once the streams have popped their frame, and before the slaves mix
+    void rebuild(ConstIter begin, ConstIter end);
+
+    // returns nullptr for listeners that get their own mix this frame
+    Group* findGroup(Node::LocalID listenerID) const;
+
+private:
+    struct Key {
+        int zone;
+        QString codecName;
+        float masterAvatarGain;
+        float masterInjectorGain;
+        bool isIgnoreBoxEnabled;
+
+        bool operator==(const Key& other) const {
+            return zone == other.zone && codecName == other.codecName &&
+                masterAvatarGain == other.masterAvatarGain && masterInjectorGain == other.masterInjectorGain &&
+                isIgnoreBoxEnabled == other.isIgnoreBoxEnabled;
+        }
+    };
+
+    std::vector<AABox> _zones;
+
+    std::vector<std::unique_ptr<Group>> _groups;
+    std::unordered_map<Node::LocalID, Group*> _listenerGroups;
+};
+
+#endif // hifi_AudioMixerAudienceGroups_h
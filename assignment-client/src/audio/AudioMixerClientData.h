@@ -12,6 +12,7 @@
 #ifndef hifi_AudioMixerClientData_h
 #define hifi_AudioMixerClientData_h
 
+#include <mutex>
 #include <queue>
 
 #include <tbb/concurrent_vector.h>
@@ -19,6 +20,7 @@
 #include <QtCore/QJsonObject>
 
 #include <AABox.h>
+#include <AudioFOA.h>
 #include <AudioHRTF.h>
 #include <AudioLimiter.h>
 #include <UUIDHasher.h>
@@ -89,6 +91,13 @@ public:
 
     AudioLimiter audioLimiter;
 
+    // decodes the ambisonic bed of the far away source clusters this listener hears
+    AudioFOA clusterDecoder;
+    bool hasClusterDecoderTail { false };
+
+    // set while this listener is sent its audience group's mix rather than one made through its own streams
+    bool mixedByAudienceGroup { false };
+
     void setupCodec(CodecPluginPointer codec, const QString& codecName);
     void cleanupCodec();
     void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) {
@@ -120,6 +129,7 @@ public:
         PositionalAudioStream* positionalStream;
         bool ignoredByListener { false };
         bool ignoringListener { false };
+        bool isClustered { false }; // heard through its source cluster rather than its own HRTF
 
         MixableStream(NodeIDStreamID nodeIDStreamID, PositionalAudioStream* positionalStream) :
             nodeStreamID(nodeIDStreamID), hrtf(new AudioHRTF), positionalStream(positionalStream) {};
@@ -173,6 +183,7 @@ private:
         QWeakPointer<Node> node;
     };
     PacketQueue _packetQueue;
+    std::mutex _packetQueueMutex; // packets are queued from the receive thread
 
     AudioStreamVector _audioStreams; // microphone stream from avatar has a null stream ID
 
@@ -52,6 +52,8 @@ void sendEnvironmentPacket(const SharedNodePointer& node, AudioMixerClientData&
 inline float approximateGain(const AvatarAudioStream& listeningNodeStream, const PositionalAudioStream& streamToAdd);
 inline float computeGain(float masterAvatarGain, float masterInjectorGain, const AvatarAudioStream& listeningNodeStream,
         const PositionalAudioStream& streamToAdd, const glm::vec3& relativePosition, float distance);
+inline float computeDistanceAttenuation(const AvatarAudioStream& listeningNodeStream, const glm::vec3& sourcePosition,
+        float distance);
 inline float computeAzimuth(const AvatarAudioStream& listeningNodeStream, const PositionalAudioStream& streamToAdd,
         const glm::vec3& relativePosition);
 
@@ -96,21 +98,14 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
     if (node->getType() == NodeType::Agent && node->getActiveSocket()) {
         ++stats.sumListeners;
 
-        // mix the audio
-        bool mixHasAudio = prepareMix(node);
+        // mix and encode the audio, once for all the members of an audience group
+        QByteArray encodedBuffer;
+        auto audienceGroup = _sharedData.audienceGroups.findGroup(node->getLocalID());
+        bool hasPayload = audienceGroup ? mixAudienceGroup(*audienceGroup, node, encodedBuffer)
+                                        : encodeMix(node, encodedBuffer);
 
         // send audio packet
-        if (mixHasAudio || data->shouldFlushEncoder()) {
-            QByteArray encodedBuffer;
-            if (mixHasAudio) {
-                // encode the audio
-                QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
-                data->encode(decodedBuffer, encodedBuffer);
-            } else {
-                // time to flush (resets shouldFlush until the next encode)
-                data->encodeFrameOfZeros(encodedBuffer);
-            }
-
+        if (hasPayload) {
             sendMixPacket(node, *data, encodedBuffer);
         } else {
             ++stats.sumListenersSilent;
@@ -320,6 +315,8 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
 
     addStreams(*listener, *listenerData);
 
+    prepareClusters(*listener, *listenerData, *listenerAudioStream, isSoloing);
+
     // Process skipped streams
     erase_if(streams.skipped, [&](MixableStream& stream) {
         if (shouldBeRemoved(stream, _sharedData)) {
@@ -378,7 +375,11 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         if (isThrottling) {
             // we're throttling, so we need to update the approximate volume for any un-skipped streams
             // unless this is simply for an echo (in which case the approx volume is 1.0)
-            stream.approximateVolume = approximateVolume(stream, listenerAudioStream);
+            //
+            // streams heard through their cluster don't need a render, so they leave the slots to the others
+            int clusterIndex = _sharedData.sourceClusters.findStreamCluster(stream.positionalStream);
+            bool isInUsedCluster = clusterIndex >= 0 && _useCluster[clusterIndex];
+            stream.approximateVolume = isInUsedCluster ? 0.0f : approximateVolume(stream, listenerAudioStream);
         } else {
             if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
                 addStream(stream, *listenerAudioStream, 0.0f, 0.0f, isSoloing);
@@ -387,8 +388,10 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
                 return true;
             }
 
-            addStream(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(), listenerData->getMasterInjectorGain(),
-                      isSoloing);
+            if (!mixThroughCluster(stream)) {
+                addStream(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
+                          listenerData->getMasterInjectorGain(), isSoloing);
+            }
 
             if (shouldBeInactive(stream)) {
                 // To reduce artifacts we still call render to flush the HRTF for every silent
@@ -423,8 +426,10 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
                 return true;
             }
 
-            addStream(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(), listenerData->getMasterInjectorGain(),
-                      isSoloing);
+            if (!mixThroughCluster(stream)) {
+                addStream(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
+                          listenerData->getMasterInjectorGain(), isSoloing);
+            }
 
             if (shouldBeInactive(stream)) {
                 // To reduce artifacts we still call render to flush the HRTF for every silent
@@ -442,7 +447,10 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             // sources on the first frame where the source becomes throttled
             // this ensures at least remove the tail from last mixed block
             // preventing excessive artifacts on the next first block
-            resetHRTFState(stream);
+            // (streams in a far away cluster are still heard through it)
+            if (!mixThroughCluster(stream)) {
+                resetHRTFState(stream);
+            }
 
             if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
                 streams.skipped.push_back(move(stream));
@@ -464,6 +472,8 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     stats.inactive += (int)streams.inactive.size();
     stats.active += (int)streams.active.size();
 
+    addClusters(*listenerData, *listenerAudioStream);
+
     // clear the newly ignored, un-ignored, ignoring, and un-ignoring streams now that we've processed them
     listenerData->clearStagedIgnoreChanges();
 
@@ -489,6 +499,81 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     return hasAudio;
 }
 
+bool AudioMixerSlave::encodeMix(const SharedNodePointer& listener, QByteArray& encodedBuffer) {
+    AudioMixerClientData* listenerData = static_cast<AudioMixerClientData*>(listener->getLinkedData());
+
+    if (listenerData->mixedByAudienceGroup) {
+        // the HRTFs didn't render while this listener shared a group's mix, drop what they held from back then
+        for (auto& stream : listenerData->getStreams().active) {
+            resetHRTFState(stream);
+        }
+        listenerData->mixedByAudienceGroup = false;
+    }
+
+    bool mixHasAudio = prepareMix(listener);
+
+    if (mixHasAudio) {
+        // encode the audio
+        QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
+        listenerData->encode(decodedBuffer, encodedBuffer);
+        return true;
+    } else if (listenerData->shouldFlushEncoder()) {
+        // time to flush (resets shouldFlush until the next encode)
+        listenerData->encodeFrameOfZeros(encodedBuffer);
+        return true;
+    }
+
+    return false;
+}
+
+bool AudioMixerSlave::mixAudienceGroup(AudioMixerAudienceGroups::Group& group, const SharedNodePointer& listener,
+                                       QByteArray& encodedBuffer) {
+    bool hasPayload;
+    {
+        // the members can be spread over slaves, the first one to get here mixes for all of them through the leader,
+        // which is only ever touched under this lock for the frame
+        std::lock_guard<std::mutex> lock(group.mutex);
+        if (!group.isMixed) {
+            auto mixStart = p_high_resolution_clock::now();
+            group.hasPayload = encodeMix(group.leader, group.payload);
+            auto mixEnd = p_high_resolution_clock::now();
+            group.mixTime = std::chrono::duration_cast<std::chrono::nanoseconds>(mixEnd - mixStart).count();
+            group.isMixed = true;
+
+            ++stats.audienceGroups;
+            stats.audienceListeners += group.numMembers;
+        } else {
+            ++stats.audienceMixesSaved;
+            stats.audienceMixTimeSaved += group.mixTime;
+        }
+
+        // implicitly shared, the members' packets are written from the same bytes
+        encodedBuffer = group.payload;
+        hasPayload = group.hasPayload;
+    }
+
+    if (listener != group.leader) {
+        skipMix(*listener, *static_cast<AudioMixerClientData*>(listener->getLinkedData()));
+    }
+
+    return hasPayload;
+}
+
+void AudioMixerSlave::skipMix(Node& listener, AudioMixerClientData& listenerData) {
+    addStreams(listener, listenerData);
+
+    auto& streams = listenerData.getStreams();
+    auto isRemoved = [&](const MixableStream& stream) {
+        return shouldBeRemoved(stream, _sharedData);
+    };
+    erase_if(streams.skipped, isRemoved);
+    erase_if(streams.inactive, isRemoved);
+    erase_if(streams.active, isRemoved);
+
+    listenerData.clearStagedIgnoreChanges();
+    listenerData.mixedByAudienceGroup = true;
+}
+
 void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStream,
                                 AvatarAudioStream& listeningNodeStream,
                                 float masterAvatarGain,
@@ -601,6 +686,136 @@ void AudioMixerSlave::resetHRTFState(AudioMixerClientData::MixableStream& mixabl
     ++stats.hrtfResets;
 }
 
+void AudioMixerSlave::prepareClusters(const Node& listener, AudioMixerClientData& listenerData,
+                                      const AvatarAudioStream& listeningNodeStream, bool isSoloing) {
+    const auto& sourceClusters = _sharedData.sourceClusters;
+    const auto& clusters = sourceClusters.getClusters();
+
+    _useCluster.assign(clusters.size(), false);
+    _numClustersUsed = 0;
+
+    // soloing is rare and specific enough to always get per-source mixing
+    if (clusters.empty() || isSoloing) {
+        return;
+    }
+
+    glm::vec3 listenerPosition = listeningNodeStream.getPosition();
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        _useCluster[i] = sourceClusters.isFarFrom(clusters[i], listenerPosition);
+    }
+
+    // A cluster's premix is shared by every listener, so it can't leave out the voices this listener ignores,
+    // is ignored by, or has set its own gain for. Those clusters are mixed per-source instead.
+    auto excludeNodeCluster = [&](const QUuid& nodeID) {
+        int index = sourceClusters.findNodeCluster(nodeID);
+        if (index >= 0) {
+            _useCluster[index] = false;
+        }
+    };
+    for (const auto& nodeID : listener.getIgnoredNodeIDs()) {
+        excludeNodeCluster(nodeID);
+    }
+    for (const auto& nodeID : listenerData.getIgnoringNodeIDs()) {
+        excludeNodeCluster(nodeID);
+    }
+    for (const auto& nodeID : listenerData.getNewIgnoredNodeIDs()) {
+        excludeNodeCluster(nodeID);
+    }
+    for (const auto& nodeID : listenerData.getNewIgnoringNodeIDs()) {
+        excludeNodeCluster(nodeID);
+    }
+    for (const auto& stream : listenerData.getStreams().active) {
+        if (stream.hrtf->getGainAdjustment() != HRTF_GAIN) {
+            excludeNodeCluster(stream.nodeStreamID.nodeID);
+        }
+    }
+
+    _numClustersUsed = (int)std::count(_useCluster.begin(), _useCluster.end(), true);
+}
+
+bool AudioMixerSlave::mixThroughCluster(AudioMixerClientData::MixableStream& mixableStream) {
+    bool isClustered = false;
+    if (_numClustersUsed > 0) {
+        int index = _sharedData.sourceClusters.findStreamCluster(mixableStream.positionalStream);
+        isClustered = index >= 0 && _useCluster[index];
+    }
+
+    if (isClustered) {
+        if (!mixableStream.isClustered) {
+            // it won't go through its HRTF for a while, drop the tail so it doesn't come back with it
+            resetHRTFState(mixableStream);
+        }
+        ++stats.clusteredStreams;
+    }
+
+    mixableStream.isClustered = isClustered;
+    return isClustered;
+}
+
+void AudioMixerSlave::addClusters(AudioMixerClientData& listenerData, const AvatarAudioStream& listeningNodeStream) {
+    if (_numClustersUsed == 0 && !listenerData.hasClusterDecoderTail) {
+        return;
+    }
+
+    memset(_clusterBedSamples, 0, sizeof(_clusterBedSamples));
+
+    const auto& clusters = _sharedData.sourceClusters.getClusters();
+    glm::vec3 listenerPosition = listeningNodeStream.getPosition();
+    glm::quat inverseOrientation = glm::inverse(listeningNodeStream.getOrientation());
+
+    // directivity can't be applied per voice in a premix, use its average over all directions instead
+    const float AVERAGE_OFF_AXIS_ATTENUATION = 0.6f;
+
+    for (size_t i = 0; i < clusters.size(); ++i) {
+        if (!_useCluster[i]) {
+            continue;
+        }
+
+        const auto& cluster = clusters[i];
+
+        glm::vec3 relativePosition = cluster.position - listenerPosition;
+        float distance = glm::max(glm::length(relativePosition), EPSILON);
+
+        float gain = listenerData.getMasterAvatarGain() * AVERAGE_OFF_AXIS_ATTENUATION;
+        gain = std::min(gain * computeDistanceAttenuation(listeningNodeStream, cluster.position, distance), ATTN_GAIN_MAX);
+        if (gain == 0.0f) {
+            continue;
+        }
+
+        // encode as a plane wave in the listener's frame, in ambiX (ACN/SN3D) order
+        // our frame is -Z forward, +X right, +Y up, the ambisonic one is +X forward, +Y left, +Z up
+        glm::vec3 direction = (inverseOrientation * relativePosition) / distance;
+        float w = gain;
+        float x = gain * -direction.z;
+        float y = gain * -direction.x;
+        float z = gain * direction.y;
+
+        for (int s = 0; s < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; ++s) {
+            float sample = cluster.premix[s];
+            _clusterBedSamples[4 * s + 0] += w * sample;
+            _clusterBedSamples[4 * s + 1] += y * sample;
+            _clusterBedSamples[4 * s + 2] += z * sample;
+            _clusterBedSamples[4 * s + 3] += x * sample;
+        }
+
+        ++stats.clusterMixes;
+    }
+
+    for (int s = 0; s < AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC; ++s) {
+        _clusterBedBuffer[s] = (int16_t)glm::clamp(_clusterBedSamples[s], (float)AudioConstants::MIN_SAMPLE_VALUE,
+                                                   (float)AudioConstants::MAX_SAMPLE_VALUE);
+    }
+
+    // the bed is already in the listener's frame, so no rotation
+    const int FOA_DATASET_INDEX = 1;
+    listenerData.clusterDecoder.render(_clusterBedBuffer, _mixSamples, FOA_DATASET_INDEX, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+                                       AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+    ++stats.clusterRenders;
+
+    // with no cluster this frame we just flushed the decoder, it can rest until a cluster comes back
+    listenerData.hasClusterDecoderTail = _numClustersUsed > 0;
+}
+
 std::unique_ptr<NLPacket> createAudioPacket(PacketType type, int size, quint16 sequence, QString codec) {
     auto audioPacket = NLPacket::create(type, size);
     audioPacket->writePrimitive(sequence);
@@ -758,19 +973,27 @@ float computeGain(float masterAvatarGain,
         gain *= masterAvatarGain;
     }
 
+    gain *= computeDistanceAttenuation(listeningNodeStream, streamToAdd.getPosition(), distance);
+    return std::min(gain, ATTN_GAIN_MAX);
+}
+
+float computeDistanceAttenuation(const AvatarAudioStream& listeningNodeStream, const glm::vec3& sourcePosition,
+                                 float distance) {
     auto& audioZones = AudioMixer::getAudioZones();
     auto& zoneSettings = AudioMixer::getZoneSettings();
 
     // find distance attenuation coefficient
     float attenuationPerDoublingInDistance = AudioMixer::getAttenuationPerDoublingInDistance();
     for (const auto& settings : zoneSettings) {
-        if (audioZones[settings.source].area.contains(streamToAdd.getPosition()) &&
+        if (audioZones[settings.source].area.contains(sourcePosition) &&
             audioZones[settings.listener].area.contains(listeningNodeStream.getPosition())) {
             attenuationPerDoublingInDistance = settings.coefficient;
             break;
         }
     }
 
+    float gain = 1.0f;
+
     if (attenuationPerDoublingInDistance < 0.0f) {
         // translate a negative zone setting to distance limit
         const float MIN_DISTANCE_LIMIT = ATTN_DISTANCE_REF + 1.0f;  // silent after 1m
@@ -780,7 +1003,6 @@ float computeGain(float masterAvatarGain,
         // reference attenuation of 0dB at distance = ATTN_DISTANCE_REF
         float d = distance - ATTN_DISTANCE_REF;
         gain *= std::max(1.0f - d / (distanceLimit - ATTN_DISTANCE_REF), 0.0f);
-        gain = std::min(gain, ATTN_GAIN_MAX);
 
     } else if (attenuationPerDoublingInDistance < 1.0f) {
         // translate a positive zone setting to gain per log2(distance)
@@ -791,7 +1013,6 @@ float computeGain(float masterAvatarGain,
         // reference attenuation of 0dB at distance = ATTN_DISTANCE_REF
         float d = (1.0f / ATTN_DISTANCE_REF) * std::max(distance, HRTF_NEARFIELD_MIN);
         gain *= fastExp2f(fastLog2f(g) * fastLog2f(d));
-        gain = std::min(gain, ATTN_GAIN_MAX);
 
     } else {
         // translate a zone setting of 1.0 be silent at any distance
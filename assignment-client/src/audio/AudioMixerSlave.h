@@ -22,7 +22,9 @@
 #include <NodeList.h>
 #include <PositionalAudioStream.h>
 
+#include "AudioMixerAudienceGroups.h"
 #include "AudioMixerClientData.h"
+#include "AudioMixerSourceClusters.h"
 #include "AudioMixerStats.h"
 
 class AvatarAudioStream;
@@ -36,6 +38,8 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+        AudioMixerSourceClusters sourceClusters;
+        AudioMixerAudienceGroups audienceGroups;
     };
 
     AudioMixerSlave(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -55,6 +59,13 @@ public:
 private:
     // create mix, returns true if mix has audio
     bool prepareMix(const SharedNodePointer& listener);
+    // create and encode the mix, returns true if there is a payload to send
+    bool encodeMix(const SharedNodePointer& listener, QByteArray& encodedBuffer);
+    // share the group's payload, encoding it first if this is the first member of the group mixed this frame
+    bool mixAudienceGroup(AudioMixerAudienceGroups::Group& group, const SharedNodePointer& listener,
+                          QByteArray& encodedBuffer);
+    // keep the streams of a listener that didn't mix this frame up to date
+    void skipMix(Node& listener, AudioMixerClientData& listenerData);
     void addStream(AudioMixerClientData::MixableStream& mixableStream,
                    AvatarAudioStream& listeningNodeStream,
                    float masterAvatarGain,
@@ -66,11 +77,24 @@ private:
                               float masterInjectorGain);
     void resetHRTFState(AudioMixerClientData::MixableStream& mixableStream);
 
+    // pick the source clusters far enough from the listener to be heard through the ambisonic bed
+    void prepareClusters(const Node& listener, AudioMixerClientData& listenerData,
+                         const AvatarAudioStream& listeningNodeStream, bool isSoloing);
+    // returns true if the stream is heard through its cluster this frame, and must not be rendered on its own
+    bool mixThroughCluster(AudioMixerClientData::MixableStream& mixableStream);
+    void addClusters(AudioMixerClientData& listenerData, const AvatarAudioStream& listeningNodeStream);
+
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
+    float _clusterBedSamples[AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC];
+    int16_t _clusterBedBuffer[AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC];
+
+    // per listener, whether each source cluster is heard through the ambisonic bed
+    std::vector<bool> _useCluster;
+    int _numClustersUsed { 0 };
 
     // frame state
     ConstIter _begin;
@@ -0,0 +1,120 @@
+//
+//  AudioMixerSourceClusters.cpp
+//  assignment-client/src/audio
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerSourceClusters.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <GLMHelpers.h>
+#include <PositionalAudioStream.h>
+
+#include "AudioMixerClientData.h"
+
+const float AudioMixerSourceClusters::DEFAULT_CELL_SIZE = 10.0f; // meters
+const float AudioMixerSourceClusters::DEFAULT_MIN_DISTANCE = 30.0f; // meters
+
+namespace {
+    struct CellKeyHash {
+        size_t operator()(const glm::ivec3& cell) const {
+            return hashGridCell(cell);
+        }
+    };
+}
+
+void AudioMixerSourceClusters::rebuild(ConstIter begin, ConstIter end) {
+    _clusters.clear();
+    _streamClusters.clear();
+    _nodeClusters.clear();
+
+    if (!_isEnabled) {
+        return;
+    }
+
+    std::unordered_map<glm::ivec3, int, CellKeyHash> cellClusters;
+    std::vector<std::vector<glm::vec3>> clusterPositions;
+
+    int16_t samples[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        auto nodeData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!nodeData) {
+            return;
+        }
+
+        for (auto& stream : nodeData->getAudioStreams()) {
+            // only avatar voices are clustered, their gain is the same for every listener but for distance and
+            // directivity, which a far away cluster can share
+            if (stream->getType() != PositionalAudioStream::Microphone || stream->isStereo() ||
+                !stream->lastPopSucceeded() || stream->getLastPopOutputLoudness() == 0.0f) {
+                continue;
+            }
+
+            glm::vec3 position = stream->getPosition();
+            glm::ivec3 cell = glm::ivec3(glm::floor(position / _cellSize));
+
+            int index;
+            auto it = cellClusters.find(cell);
+            if (it == cellClusters.end()) {
+                index = (int)_clusters.size();
+                cellClusters[cell] = index;
+                _clusters.emplace_back();
+                memset(_clusters.back().premix, 0, sizeof(_clusters.back().premix));
+                clusterPositions.emplace_back();
+            } else {
+                index = it->second;
+            }
+
+            auto& cluster = _clusters[index];
+
+            AudioRingBuffer::ConstIterator popOutput = stream->getLastPopOutput();
+            popOutput.readSamples(samples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; ++i) {
+                cluster.premix[i] += samples[i];
+            }
+
+            ++cluster.numStreams;
+            clusterPositions[index].push_back(position);
+
+            _streamClusters[stream.get()] = index;
+            _nodeClusters[node->getUUID()] = index;
+        }
+    });
+
+    for (size_t i = 0; i < _clusters.size(); ++i) {
+        auto& cluster = _clusters[i];
+        const auto& positions = clusterPositions[i];
+
+        glm::vec3 centroid(0.0f);
+        for (const auto& position : positions) {
+            centroid += position;
+        }
+        centroid /= (float)positions.size();
+
+        float radius = 0.0f;
+        for (const auto& position : positions) {
+            radius = glm::max(radius, glm::distance(centroid, position));
+        }
+
+        cluster.position = centroid;
+        cluster.radius = radius;
+    }
+}
+
+int AudioMixerSourceClusters::findStreamCluster(const PositionalAudioStream* stream) const {
+    auto it = _streamClusters.find(stream);
+    return it != _streamClusters.end() ? it->second : -1;
+}
+
+int AudioMixerSourceClusters::findNodeCluster(const QUuid& nodeID) const {
+    auto it = _nodeClusters.find(nodeID);
+    return it != _nodeClusters.end() ? it->second : -1;
+}
@@ -0,0 +1,72 @@
+//
+//  AudioMixerSourceClusters.h
+//  assignment-client/src/audio
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerSourceClusters_h
+#define hifi_AudioMixerSourceClusters_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <AudioConstants.h>
+#include <NodeList.h>
+#include <UUIDHasher.h>
+
+class PositionalAudioStream;
+
+// Groups the mono avatar streams of a frame into spatial clusters, each premixed once per frame.
+// Listeners far enough from a cluster hear it through a single first-order ambisonic bed instead of
+// one HRTF render per source, see AudioMixerSlave::prepareMix.
+class AudioMixerSourceClusters {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    static const float DEFAULT_CELL_SIZE;
+    static const float DEFAULT_MIN_DISTANCE;
+
+    struct Cluster {
+        glm::vec3 position; // centroid of the sources
+        float radius { 0.0f }; // from the centroid to the furthest source
+        int numStreams { 0 };
+        float premix[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+    };
+
+    bool isEnabled() const { return _isEnabled; }
+    void setEnabled(bool enabled) { _isEnabled = enabled; }
+
+    float getMinDistance() const { return _minDistance; }
+    void setMinDistance(float minDistance) { _minDistance = minDistance; }
+
+    // must be called once the streams have popped their frame, and before the slaves mix
+    void rebuild(ConstIter begin, ConstIter end);
+
+    const std::vector<Cluster>& getClusters() const { return _clusters; }
+
+    // returns -1 for streams that are not part of any cluster this frame
+    int findStreamCluster(const PositionalAudioStream* stream) const;
+    int findNodeCluster(const QUuid& nodeID) const;
+
+    bool isFarFrom(const Cluster& cluster, const glm::vec3& listenerPosition) const {
+        return glm::distance(cluster.position, listenerPosition) - cluster.radius >= _minDistance;
+    }
+
+private:
+    bool _isEnabled { false };
+    float _cellSize { DEFAULT_CELL_SIZE };
+    float _minDistance { DEFAULT_MIN_DISTANCE };
+
+    std::vector<Cluster> _clusters;
+    std::unordered_map<const PositionalAudioStream*, int> _streamClusters;
+    std::unordered_map<QUuid, int> _nodeClusters;
+};
+
+#endif // hifi_AudioMixerSourceClusters_h
@@ -25,6 +25,15 @@ void AudioMixerStats::reset() {
     manualStereoMixes = 0;
     manualEchoMixes = 0;
 
+    clusteredStreams = 0;
+    clusterMixes = 0;
+    clusterRenders = 0;
+
+    audienceGroups = 0;
+    audienceListeners = 0;
+    audienceMixesSaved = 0;
+    audienceMixTimeSaved = 0;
+
     skippedToActive = 0;
     skippedToInactive = 0;
     inactiveToSkipped = 0;
@@ -55,6 +64,15 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     manualStereoMixes += otherStats.manualStereoMixes;
     manualEchoMixes += otherStats.manualEchoMixes;
 
+    clusteredStreams += otherStats.clusteredStreams;
+    clusterMixes += otherStats.clusterMixes;
+    clusterRenders += otherStats.clusterRenders;
+
+    audienceGroups += otherStats.audienceGroups;
+    audienceListeners += otherStats.audienceListeners;
+    audienceMixesSaved += otherStats.audienceMixesSaved;
+    audienceMixTimeSaved += otherStats.audienceMixTimeSaved;
+
     skippedToActive += otherStats.skippedToActive;
     skippedToInactive += otherStats.skippedToInactive;
     inactiveToSkipped += otherStats.inactiveToSkipped;
@@ -12,9 +12,7 @@
 #ifndef hifi_AudioMixerStats_h
 #define hifi_AudioMixerStats_h
 
-#ifdef HIFI_AUDIO_MIXER_DEBUG
 #include <cstdint>
-#endif
 
 struct AudioMixerStats {
     int sumStreams { 0 };
@@ -30,6 +28,15 @@ struct AudioMixerStats {
     int manualStereoMixes { 0 };
     int manualEchoMixes { 0 };
 
+    int clusteredStreams { 0 };
+    int clusterMixes { 0 };
+    int clusterRenders { 0 };
+
+    int audienceGroups { 0 };
+    int audienceListeners { 0 };
+    int audienceMixesSaved { 0 };
+    uint64_t audienceMixTimeSaved { 0 }; // nanoseconds
+
     int skippedToActive { 0 };
     int skippedToInactive { 0 };
     int inactiveToSkipped { 0 };
@@ -71,7 +71,6 @@ AvatarMixer::AvatarMixer(ReceivedMessage& message) :
     connect(DependencyManager::get<NodeList>().data(), &NodeList::nodeKilled, this, &AvatarMixer::handleAvatarKilled);
 
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
-    packetReceiver.registerListener(PacketType::AvatarData, this, "queueIncomingPacket");
     packetReceiver.registerListener(PacketType::AdjustAvatarSorting, this, "handleAdjustAvatarSorting");
     packetReceiver.registerListener(PacketType::AvatarQuery, this, "handleAvatarQueryPacket");
     packetReceiver.registerListener(PacketType::AvatarIdentity, this, "handleAvatarIdentityPacket");
@@ -79,11 +78,19 @@ AvatarMixer::AvatarMixer(ReceivedMessage& message) :
     packetReceiver.registerListener(PacketType::NodeIgnoreRequest, this, "handleNodeIgnoreRequestPacket");
     packetReceiver.registerListener(PacketType::RadiusIgnoreRequest, this, "handleRadiusIgnoreRequestPacket");
     packetReceiver.registerListener(PacketType::RequestsDomainListData, this, "handleRequestsDomainListDataPacket");
-    packetReceiver.registerListener(PacketType::SetAvatarTraits, this, "queueIncomingPacket");
-    packetReceiver.registerListener(PacketType::BulkAvatarTraitsAck, this, "queueIncomingPacket");
     packetReceiver.registerListenerForTypes({ PacketType::OctreeStats, PacketType::EntityData, PacketType::EntityErase },
         this, "handleOctreePacket");
-    packetReceiver.registerListener(PacketType::ChallengeOwnership, this, "queueIncomingPacket");
+
+    // packets for the avatar of their own node go straight to its queue from the receive thread
+    packetReceiver.registerHandlerForTypes({
+        PacketType::AvatarData,
+        PacketType::SetAvatarTraits,
+        PacketType::BulkAvatarTraitsAck,
+        PacketType::AvatarJointDeltasAck,
+        PacketType::ChallengeOwnership
+    }, this, [this](QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
+        queueIncomingPacket(message, node);
+    });
 
     packetReceiver.registerListenerForTypes({
         PacketType::ReplicatedAvatarIdentity,
@@ -322,6 +329,10 @@ void AvatarMixer::start() {
             auto start = usecTimestampNow();
             nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
                 auto start = usecTimestampNow();
+
+                // the slaves only read the grid, and the nodes it points to are held by the list for this whole scope
+                _slaveSharedData.spatialGrid.rebuild(cbegin, cend);
+
                 _slavePool.broadcastAvatarData(cbegin, cend, _lastFrameTimestamp, _maxKbpsPerNode, _throttlingRatio);
                 auto end = usecTimestampNow();
                 _broadcastAvatarDataInner += (end - start);
@@ -839,6 +850,18 @@ void AvatarMixer::sendStatsPacket() {
     slavesAggregatObject["sent_6_averageIdentityBytes"] = TIGHT_LOOP_STAT(aggregateStats.numIdentityBytesSent);
     slavesAggregatObject["sent_7_averageHeroAvatars"] = TIGHT_LOOP_STAT(aggregateStats.numHeroesIncluded);
 
+    float averageNearCandidates = averageNodes ? aggregateStats.numNearCandidates / averageNodes : 0.0f;
+    slavesAggregatObject["sent_8_averageNearCandidates"] = TIGHT_LOOP_STAT(averageNearCandidates);
+    float averageFarCandidates = averageNodes ? aggregateStats.numFarCandidates / averageNodes : 0.0f;
+    slavesAggregatObject["sent_9_averageFarCandidates"] = TIGHT_LOOP_STAT(averageFarCandidates);
+    float averageFarDeferred = averageNodes ? aggregateStats.numFarDeferred / averageNodes : 0.0f;
+    slavesAggregatObject["sent_10_averageFarDeferred"] = TIGHT_LOOP_STAT(averageFarDeferred);
+    slavesAggregatObject["sent_11_spatialGridCells"] = _slaveSharedData.spatialGrid.getNumCells();
+    int numCacheableEncodings = aggregateStats.numEncodingCacheHits + aggregateStats.numEncodingCacheMisses;
+    slavesAggregatObject["sent_12_averageEncodingCacheHits"] = TIGHT_LOOP_STAT(aggregateStats.numEncodingCacheHits);
+    slavesAggregatObject["sent_13_encodingCacheHitRate"] =
+        numCacheableEncodings ? (float)aggregateStats.numEncodingCacheHits / (float)numCacheableEncodings : 0.0f;
+
     slavesAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     slavesAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
     slavesAggregatObject["timing_3_toByteArray"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.toByteArrayElapsedTime);
@@ -848,17 +871,6 @@ void AvatarMixer::sendStatsPacket() {
 
     statsObject["slaves_aggregate (per frame)"] = slavesAggregatObject;
 
-    _handleViewFrustumPacketElapsedTime = 0;
-    _handleAvatarIdentityPacketElapsedTime = 0;
-    _handleKillAvatarPacketElapsedTime = 0;
-    _handleNodeIgnoreRequestPacketElapsedTime = 0;
-    _handleRadiusIgnoreRequestPacketElapsedTime = 0;
-    _handleRequestsDomainListDataPacketElapsedTime = 0;
-    _processEventsElapsedTime = 0;
-    _queueIncomingPacketElapsedTime = 0;
-    _processQueuedAvatarDataPacketsElapsedTime = 0;
-    _processQueuedAvatarDataPacketsLockWaitElapsedTime = 0;
-
     QJsonObject avatarsObject;
     auto nodeList = DependencyManager::get<NodeList>();
     // add stats for each listener
@@ -900,6 +912,33 @@ void AvatarMixer::sendStatsPacket() {
 
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(statsObject);
 
+    resetStatsInterval();
+
+    auto end = usecTimestampNow();
+    _sendStatsElapsedTime = (end - start);
+
+    _lastStatsTime = start;
+
+}
+
+void AvatarMixer::resetStatsInterval() {
+    // the slaves start over once harvested
+    AvatarMixerSlaveStats slaveStats;
+    _slavePool.each([&](AvatarMixerSlave& slave) {
+        slave.harvestStats(slaveStats);
+    });
+
+    _handleViewFrustumPacketElapsedTime = 0;
+    _handleAvatarIdentityPacketElapsedTime = 0;
+    _handleKillAvatarPacketElapsedTime = 0;
+    _handleNodeIgnoreRequestPacketElapsedTime = 0;
+    _handleRadiusIgnoreRequestPacketElapsedTime = 0;
+    _handleRequestsDomainListDataPacketElapsedTime = 0;
+    _processEventsElapsedTime = 0;
+    _queueIncomingPacketElapsedTime = 0;
+    _processQueuedAvatarDataPacketsElapsedTime = 0;
+    _processQueuedAvatarDataPacketsLockWaitElapsedTime = 0;
+
     _sumListeners = 0;
     _sumIdentityPackets = 0;
     _numTightLoopFrames = 0;
@@ -914,13 +953,6 @@ void AvatarMixer::sendStatsPacket() {
     _ignoreCalculationElapsedTime = 0;
     _avatarDataPackingElapsedTime = 0;
     _packetSendingElapsedTime = 0;
-
-
-    auto end = usecTimestampNow();
-    _sendStatsElapsedTime = (end - start);
-
-    _lastStatsTime = start;
-
 }
 
 void AvatarMixer::run() {
@@ -935,6 +967,8 @@ void AvatarMixer::run() {
 }
 
 AvatarMixerClientData* AvatarMixer::getOrCreateClientData(SharedNodePointer node) {
+    // avatar packets are queued from the receive thread while the main thread may create the same client data
+    QMutexLocker locker(&node->getMutex());
     auto clientData = dynamic_cast<AvatarMixerClientData*>(node->getLinkedData());
 
     if (!clientData) {
@@ -1029,6 +1063,17 @@ void AvatarMixer::parseDomainServerSettings(const QJsonObject& domainSettings) {
         }
     }
 
+    {   // Only avatars near a listener or in its view are considered every frame, the rest are visited in slices:
+        static const QString SPATIAL_INTEREST_GRID_KEY = "spatial_interest_grid";
+        static const QString INTEREST_RADIUS_KEY = "interest_radius";
+        auto& spatialGrid = _slaveSharedData.spatialGrid;
+        spatialGrid.setEnabled(avatarMixerGroupObject[SPATIAL_INTEREST_GRID_KEY].toBool(true));
+        float interestRadius = float(avatarMixerGroupObject[INTEREST_RADIUS_KEY].toDouble(AvatarMixerSpatialGrid::DEFAULT_NEAR_RADIUS));
+        spatialGrid.setNearRadius(interestRadius > 0.0f ? interestRadius : AvatarMixerSpatialGrid::DEFAULT_NEAR_RADIUS);
+        qCDebug(avatars) << "Avatar mixer spatial interest grid" << (spatialGrid.isEnabled() ? "enabled" : "disabled")
+            << "with an interest radius of" << spatialGrid.getNearRadius();
+    }
+
     const QString AVATARS_SETTINGS_KEY = "avatars";
 
     static const QString MIN_HEIGHT_OPTION = "min_avatar_height";
@@ -15,6 +15,7 @@
 #ifndef hifi_AvatarMixer_h
 #define hifi_AvatarMixer_h
 
+#include <atomic>
 #include <set>
 #include <shared/RateCounter.h>
 #include <PortableHighResolutionClock.h>
@@ -38,6 +39,9 @@ public:
             to.getLocalSocket() != from.getLocalSocket();
     }
 
+protected:
+    void resetStatsInterval() override;
+
 public slots:
     /// runs the avatar mixer
     void run() override;
@@ -52,7 +56,6 @@ public slots:
     void entityChange();
 
 private slots:
-    void queueIncomingPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     void handleAdjustAvatarSorting(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleAvatarQueryPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleAvatarIdentityPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
@@ -68,7 +71,11 @@ private slots:
     void start();
 
 private:
+    // called on the receive thread, see PacketReceiver::registerHandler
+    void queueIncomingPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
+
     AvatarMixerClientData* getOrCreateClientData(SharedNodePointer node);
+
     std::chrono::microseconds timeFrame(p_high_resolution_clock::time_point& timestamp);
     void throttle(std::chrono::microseconds duration, int frame);
 
@@ -145,7 +152,7 @@ private:
 
     quint64 _processEventsElapsedTime { 0 };
     quint64 _sendStatsElapsedTime { 0 };
-    quint64 _queueIncomingPacketElapsedTime { 0 };
+    std::atomic<quint64> _queueIncomingPacketElapsedTime { 0 };
     quint64 _lastStatsTime { usecTimestampNow() };
 
     RateCounter<> _loopRate; // this is the rate that the main thread tight loop runs
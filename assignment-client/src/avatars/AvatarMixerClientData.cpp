@@ -36,6 +36,14 @@ uint64_t AvatarMixerClientData::getLastOtherAvatarEncodeTime(NLPacket::LocalID o
     return 0;
 }
 
+JointDeltas::Sequence AvatarMixerClientData::getAcknowledgedJointPose(NLPacket::LocalID otherAvatar) const {
+    const auto itr = _acknowledgedJointPoses.find(otherAvatar);
+    if (itr != _acknowledgedJointPoses.end()) {
+        return itr->second;
+    }
+    return JointDeltas::NO_BASELINE;
+}
+
 void AvatarMixerClientData::setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time) {
     auto itr = _lastOtherAvatarEncodeTime.find(otherAvatar);
     if (itr != _lastOtherAvatarEncodeTime.end()) {
@@ -46,6 +54,7 @@ void AvatarMixerClientData::setLastOtherAvatarEncodeTime(NLPacket::LocalID other
 }
 
 void AvatarMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
+    std::lock_guard<std::mutex> lock(_packetQueueMutex);
     if (!_packetQueue.node) {
         _packetQueue.node = node;
     }
@@ -54,12 +63,19 @@ void AvatarMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message,
 
 int AvatarMixerClientData::processPackets(const SlaveSharedData& slaveSharedData) {
     int packetsProcessed = 0;
-    SharedNodePointer node = _packetQueue.node;
-    assert(_packetQueue.empty() || node);
-    _packetQueue.node.clear();
 
-    while (!_packetQueue.empty()) {
-        auto& packet = _packetQueue.front();
+    // take this frame's packets, the receive thread keeps queueing the next ones meanwhile
+    PacketQueue packetQueue;
+    {
+        std::lock_guard<std::mutex> lock(_packetQueueMutex);
+        std::swap(packetQueue, _packetQueue);
+    }
+
+    SharedNodePointer node = packetQueue.node;
+    assert(packetQueue.empty() || node);
+
+    while (!packetQueue.empty()) {
+        auto& packet = packetQueue.front();
 
         packetsProcessed++;
 
@@ -73,15 +89,18 @@ int AvatarMixerClientData::processPackets(const SlaveSharedData& slaveSharedData
             case PacketType::BulkAvatarTraitsAck:
                 processBulkAvatarTraitsAckMessage(*packet);
                 break;
+            case PacketType::AvatarJointDeltasAck:
+                processJointDeltasAckMessage(*packet);
+                break;
             case PacketType::ChallengeOwnership:
                 _avatar->processChallengeResponse(*packet);
                 break;
             default:
                 Q_UNREACHABLE();
         }
-        _packetQueue.pop();
+        packetQueue.pop();
     }
-    assert(_packetQueue.empty());
+    assert(packetQueue.empty());
 
     if (_avatar) {
         _avatar->processCertifyEvents();
@@ -346,6 +365,21 @@ void AvatarMixerClientData::processBulkAvatarTraitsAckMessage(ReceivedMessage& m
     }
 }
 
+void AvatarMixerClientData::processJointDeltasAckMessage(ReceivedMessage& message) {
+    auto nodeList = DependencyManager::get<NodeList>();
+    while (message.getBytesLeftToRead() >= (qint64)(NUM_BYTES_RFC4122_UUID + sizeof(JointDeltas::Sequence))) {
+        QUuid avatarID = QUuid::fromRfc4122(message.readWithoutCopy(NUM_BYTES_RFC4122_UUID));
+        JointDeltas::Sequence sequence;
+        message.readPrimitive(&sequence);
+
+        // acknowledgements for avatars that left since are dropped
+        auto otherNode = nodeList->nodeWithUUID(avatarID);
+        if (otherNode) {
+            _acknowledgedJointPoses[otherNode->getLocalID()] = sequence;
+        }
+    }
+}
+
 void AvatarMixerClientData::checkSkeletonURLAgainstWhitelist(const SlaveSharedData& slaveSharedData,
                                                              Node& sendingNode,
                                                              AvatarTraits::TraitVersion traitVersion) {
@@ -508,6 +542,7 @@ AvatarMixerClientData::TraitsCheckTimestamp AvatarMixerClientData::getLastOtherA
 void AvatarMixerClientData::cleanupKilledNode(const QUuid&, Node::LocalID nodeLocalID) {
     removeLastBroadcastSequenceNumber(nodeLocalID);
     removeLastBroadcastTime(nodeLocalID);
+    _acknowledgedJointPoses.erase(nodeLocalID);
     _lastSentTraitsTimestamps.erase(nodeLocalID);
     _perNodeSentTraitVersions.erase(nodeLocalID);
     _perNodeAckedTraitVersions.erase(nodeLocalID);
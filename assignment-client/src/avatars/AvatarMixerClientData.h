@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <queue>
@@ -126,13 +127,15 @@ public:
     uint64_t getLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar) const;
     void setLastOtherAvatarEncodeTime(NLPacket::LocalID otherAvatar, uint64_t time);
 
-    QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
+    // the last pose of another avatar this node acknowledged, NO_BASELINE until it does or when it asks for a key frame
+    JointDeltas::Sequence getAcknowledgedJointPose(NLPacket::LocalID otherAvatar) const;
 
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     int processPackets(const SlaveSharedData& slaveSharedData); // returns number of packets processed
 
     void processSetTraitsMessage(ReceivedMessage& message, const SlaveSharedData& slaveSharedData, Node& sendingNode);
     void processBulkAvatarTraitsAckMessage(ReceivedMessage& message);
+    void processJointDeltasAckMessage(ReceivedMessage& message);
     void checkSkeletonURLAgainstWhitelist(const SlaveSharedData& slaveSharedData, Node& sendingNode,
                                           AvatarTraits::TraitVersion traitVersion);
 
@@ -163,6 +166,7 @@ private:
         QWeakPointer<Node> node;
     };
     PacketQueue _packetQueue;
+    std::mutex _packetQueueMutex; // packets are queued from the receive thread
 
     MixerAvatarSharedPointer _avatar { new MixerAvatar() };
 
@@ -173,7 +177,7 @@ private:
     // this is a map of the last time we encoded an "other" avatar for
     // sending to "this" node
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
-    std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
+    std::unordered_map<NLPacket::LocalID, JointDeltas::Sequence> _acknowledgedJointPoses;
 
     uint64_t _identityChangeTimestamp;
     bool _avatarSessionDisplayNameMustChange{ true };
@@ -12,7 +12,6 @@
 #include "AvatarMixerSlave.h"
 
 #include <algorithm>
-#include <random>
 #include <chrono>
 
 #include <glm/glm.hpp>
@@ -316,13 +315,11 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
     auto nodeList = DependencyManager::get<NodeList>();
 
-    // setup for distributed random floating point values
-    std::random_device randomDevice;
-    std::mt19937 generator(randomDevice());
-    std::uniform_real_distribution<float> distribution;
-
     _stats.nodesBroadcastedTo++;
 
+    // lets the sources' shared encoding caches tell one broadcast frame from the next
+    const uint64_t encodingFrame = (uint64_t)_lastFrameTimestamp.time_since_epoch().count();
+
     AvatarMixerClientData* destinationNodeData = reinterpret_cast<AvatarMixerClientData*>(destinationNode->getLinkedData());
 
     destinationNodeData->resetInViewStats();
@@ -330,9 +327,6 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     const AvatarData& avatar = destinationNodeData->getAvatar();
     glm::vec3 destinationPosition = avatar.getClientGlobalPosition();
 
-    // reset the internal state for correct random number distribution
-    distribution.reset();
-
     // Estimate number to sort on number sent last frame (with min. of 20).
     const int numToSendEst = std::max(int(destinationNodeData->getNumAvatarsSentLastFrame() * 2.5f), 20);
 
@@ -384,10 +378,31 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             AvatarData::_avatarSortCoefficientCenter, AvatarData::_avatarSortCoefficientAge}
     };
 
-    avatarPriorityQueues[kNonhero].reserve(_end - _begin);
+    // Gather the other avatars this listener should consider this frame. Normally that is everyone near it or in
+    // its view, plus the slice of far away avatars whose grid bucket is due. While the PAL is (or just was) open
+    // every avatar is visited, the PAL needs all of them and closing it sends kill packets for ignored avatars.
+    _nearCandidates.clear();
+    _farCandidates.clear();
+    const auto& spatialGrid = _sharedData->spatialGrid;
+    if (spatialGrid.isEnabled() && !PALIsOpen && !PALWasOpen) {
+        _stats.numFarDeferred += spatialGrid.gatherCandidates(destinationPosition, cameraViews,
+                                                              _nearCandidates, _farCandidates);
+    } else {
+        for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
+            _nearCandidates.push_back((*listedNode).data());
+        }
+    }
+    _stats.numNearCandidates += (int)_nearCandidates.size();
+    _stats.numFarCandidates += (int)_farCandidates.size();
+
+    const int numNearCandidates = (int)_nearCandidates.size();
+    const int numCandidates = numNearCandidates + (int)_farCandidates.size();
 
-    for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
-        Node* otherNodeRaw = (*listedNode).data();
+    avatarPriorityQueues[kNonhero].reserve(numCandidates);
+
+    for (int candidateIndex = 0; candidateIndex < numCandidates; ++candidateIndex) {
+        bool isFarCandidate = candidateIndex >= numNearCandidates;
+        Node* otherNodeRaw = isFarCandidate ? _farCandidates[candidateIndex - numNearCandidates] : _nearCandidates[candidateIndex];
         if (otherNodeRaw->getType() != NodeType::Agent
             || !otherNodeRaw->getLinkedData()
             || otherNodeRaw == destinationNode) {
@@ -454,8 +469,9 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 // This is important for Agent scripts that are not avatar
                 // so that they don't appear to be an avatar at the origin
                 sendAvatar = false;
-            } else if (lastSeqFromSender - lastSeqToReceiver > 1) {
+            } else if (lastSeqFromSender - lastSeqToReceiver > 1 && !isFarCandidate) {
                 // this is a skip - we still send the packet but capture the presence of the skip so we see it happening
+                // (far avatars are only visited every few frames, so they always look like they skipped)
                 ++numAvatarsWithSkippedFrames;
             }
         }
@@ -548,7 +564,7 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 detail = PALIsOpen ? AvatarData::PALMinimum : AvatarData::MinimumData;
                 destinationNodeData->incrementAvatarOutOfView();
             } else if (!overBudget) {
-                detail = distribution(generator) < AVATAR_SEND_FULL_UPDATE_RATIO ? AvatarData::SendAllData : AvatarData::CullSmallData;
+                detail = sourceAvatar->isFullUpdateFrame(encodingFrame) ? AvatarData::SendAllData : AvatarData::CullSmallData;
                 destinationNodeData->incrementAvatarInView();
 
                 // If the time that the mixer sent AVATAR DATA about Avatar B to Node A is BEFORE OR EQUAL TO
@@ -562,33 +578,80 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
                 }
             }
 
-            QVector<JointData>& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(sourceNode->getLocalID());
-
             const bool distanceAdjust = true;
             const bool dropFaceTracking = false;
             AvatarDataPacket::SendStatus sendStatus;
             sendStatus.sendUUID = true;
 
-            do {
-                auto startSerialize = chrono::high_resolution_clock::now();
-                QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
-                    sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
-                    &lastSentJointsForOther, avatarSpaceAvailable);
-                auto endSerialize = chrono::high_resolution_clock::now();
-                _stats.toByteArrayElapsedTime +=
-                    (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
-
-                avatarPacket->write(bytes);
-                avatarSpaceAvailable -= bytes.size();
-                numAvatarDataBytes += bytes.size();
-                if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
-                    // Weren't able to fit everything.
+            // The joints go as deltas against the pose of the source this listener acknowledged last, so nothing is
+            // lost to dropped packets. Small changes of a far away source are culled, until they add up.
+            JointDeltas::Encoding jointDeltas;
+            const QVector<JointData> noLastSentJointData;
+            bool isCacheable = detail != AvatarData::NoData;
+            MixerAvatar::EncodingKey encodingKey;
+            if (isCacheable) {
+                sourceAvatar->getJointDeltas(encodingFrame,
+                    destinationNodeData->getAcknowledgedJointPose(sourceNode->getLocalID()), detail,
+                    destinationPosition, jointDeltas);
+                encodingKey = sourceAvatar->getEncodingKey(detail, lastEncodeForOther, jointDeltas);
+            }
+
+            // Look for bytes another listener with the same baseline was already sent this frame.
+            QByteArray cachedBytes;
+            if (isCacheable && sourceAvatar->findCachedEncoding(encodingFrame, encodingKey, cachedBytes)) {
+                ++_stats.numEncodingCacheHits;
+
+                if (cachedBytes.size() > avatarSpaceAvailable) {
                     nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
                     ++numPacketsSent;
                     avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
                     avatarSpaceAvailable = avatarPacketCapacity;
                 }
-            } while (!sendStatus);
+
+                avatarPacket->write(cachedBytes);
+                avatarSpaceAvailable -= cachedBytes.size();
+                numAvatarDataBytes += cachedBytes.size();
+                if (avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                    nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                    ++numPacketsSent;
+                    avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                    avatarSpaceAvailable = avatarPacketCapacity;
+                }
+            } else {
+                if (isCacheable) {
+                    ++_stats.numEncodingCacheMisses;
+                }
+
+                // only an encoding that fit in one go is complete, and so the same for every listener with this key
+                bool isSinglePass = true;
+                QByteArray bytes;
+
+                do {
+                    auto startSerialize = chrono::high_resolution_clock::now();
+                    bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, noLastSentJointData,
+                        sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
+                        nullptr, avatarSpaceAvailable, nullptr, jointDeltas.pose ? &jointDeltas : nullptr);
+                    auto endSerialize = chrono::high_resolution_clock::now();
+                    _stats.toByteArrayElapsedTime +=
+                        (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
+
+                    avatarPacket->write(bytes);
+                    avatarSpaceAvailable -= bytes.size();
+                    numAvatarDataBytes += bytes.size();
+                    if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                        // Weren't able to fit everything.
+                        isSinglePass = isSinglePass && sendStatus;
+                        nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                        ++numPacketsSent;
+                        avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                        avatarSpaceAvailable = avatarPacketCapacity;
+                    }
+                } while (!sendStatus);
+
+                if (isCacheable && isSinglePass) {
+                    sourceAvatar->addCachedEncoding(encodingFrame, encodingKey, bytes);
+                }
+            }
 
             if (detail != AvatarData::NoData) {
                 _stats.numOthersIncluded++;
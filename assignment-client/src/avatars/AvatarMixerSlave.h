@@ -14,6 +14,8 @@
 
 #include <NodeList.h>
 
+#include "AvatarMixerSpatialGrid.h"
+
 class AvatarMixerClientData;
 
 class AvatarMixerSlaveStats {
@@ -33,6 +35,11 @@ public:
     int numOthersIncluded { 0 };
     int overBudgetAvatars { 0 };
     int numHeroesIncluded { 0 };
+    int numNearCandidates { 0 };
+    int numFarCandidates { 0 };
+    int numFarDeferred { 0 };
+    int numEncodingCacheHits { 0 };
+    int numEncodingCacheMisses { 0 };
 
     quint64 ignoreCalculationElapsedTime { 0 };
     quint64 avatarDataPackingElapsedTime { 0 };
@@ -59,6 +66,11 @@ public:
         numOthersIncluded = 0;
         overBudgetAvatars = 0;
         numHeroesIncluded = 0;
+        numNearCandidates = 0;
+        numFarCandidates = 0;
+        numFarDeferred = 0;
+        numEncodingCacheHits = 0;
+        numEncodingCacheMisses = 0;
 
         ignoreCalculationElapsedTime = 0;
         avatarDataPackingElapsedTime = 0;
@@ -83,6 +95,11 @@ public:
         numOthersIncluded += rhs.numOthersIncluded;
         overBudgetAvatars += rhs.overBudgetAvatars;
         numHeroesIncluded += rhs.numHeroesIncluded;
+        numNearCandidates += rhs.numNearCandidates;
+        numFarCandidates += rhs.numFarCandidates;
+        numFarDeferred += rhs.numFarDeferred;
+        numEncodingCacheHits += rhs.numEncodingCacheHits;
+        numEncodingCacheMisses += rhs.numEncodingCacheMisses;
 
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
         avatarDataPackingElapsedTime += rhs.avatarDataPackingElapsedTime;
@@ -100,6 +117,7 @@ struct SlaveSharedData {
     QStringList skeletonURLWhitelist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+    AvatarMixerSpatialGrid spatialGrid;
 };
 
 class AvatarMixerSlave {
@@ -138,6 +156,10 @@ private:
     ConstIter _begin;
     ConstIter _end;
 
+    // reused across listeners, filled from the spatial grid
+    std::vector<Node*> _nearCandidates;
+    std::vector<Node*> _farCandidates;
+
     p_high_resolution_clock::time_point _lastFrameTimestamp;
     float _maxKbpsPerNode { 0.0f };
     float _throttlingRatio { 0.0f };
@@ -14,14 +14,21 @@
 #include <assert.h>
 #include <algorithm>
 
+#include <udt/Socket.h>
+
 void AvatarMixerSlaveThread::run() {
     while (true) {
         wait();
 
-        // iterate over all available nodes
-        SharedNodePointer node;
-        while (try_pop(node)) {
-            (this->*_function)(node);
+        {
+            // packets sent while we work through our nodes go out together when we're done
+            udt::Socket::BatchedWriteScope batchedWrites;
+
+            // iterate over all available nodes
+            SharedNodePointer node;
+            while (try_pop(node)) {
+                (this->*_function)(node);
+            }
         }
 
         bool stopping = _stop;
@@ -0,0 +1,127 @@
+//
+//  AvatarMixerSpatialGrid.cpp
+//  assignment-client/src/avatars
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarMixerSpatialGrid.h"
+
+#include <algorithm>
+
+#include <glm/gtx/norm.hpp>
+
+#include <GLMHelpers.h>
+
+#include "AvatarMixerClientData.h"
+
+const float AvatarMixerSpatialGrid::DEFAULT_CELL_SIZE = 16.0f; // meters
+const float AvatarMixerSpatialGrid::DEFAULT_NEAR_RADIUS = 20.0f; // meters
+
+namespace {
+    const int CELL_COORDINATE_BITS = 21;
+    const int CELL_COORDINATE_LIMIT = (1 << (CELL_COORDINATE_BITS - 1)) - 1;
+
+    int64_t cellKey(const glm::ivec3& coordinates) {
+        const int64_t MASK = (int64_t(1) << CELL_COORDINATE_BITS) - 1;
+        return ((int64_t)coordinates.x & MASK)
+            | (((int64_t)coordinates.y & MASK) << CELL_COORDINATE_BITS)
+            | (((int64_t)coordinates.z & MASK) << (2 * CELL_COORDINATE_BITS));
+    }
+
+    // spreads the far cells over FAR_CELL_INTERVAL frames so each frame only pays for a slice of them
+    unsigned int cellBucket(const glm::ivec3& coordinates) {
+        return hashGridCell(coordinates);
+    }
+}
+
+void AvatarMixerSpatialGrid::rebuild(ConstIter begin, ConstIter end) {
+    ++_frame;
+    _numNodes = 0;
+
+    // keep the cells' node vectors around so a steady state frame doesn't allocate
+    for (auto& cell : _cells) {
+        cell.nodes.clear();
+        cell.maxRadius = 0.0f;
+    }
+
+    for (auto listedNode = begin; listedNode != end; ++listedNode) {
+        Node* node = (*listedNode).data();
+        if (node->getType() != NodeType::Agent || !node->getLinkedData()) {
+            continue;
+        }
+
+        const auto* nodeData = reinterpret_cast<const AvatarMixerClientData*>(node->getLinkedData());
+        const AvatarData& avatar = nodeData->getAvatar();
+
+        glm::vec3 position = avatar.getClientGlobalPosition();
+        glm::ivec3 coordinates = glm::clamp(glm::ivec3(glm::floor(position / _cellSize)),
+                                            glm::ivec3(-CELL_COORDINATE_LIMIT), glm::ivec3(CELL_COORDINATE_LIMIT));
+
+        auto key = cellKey(coordinates);
+        auto it = _cellIndices.find(key);
+        int index;
+        if (it == _cellIndices.end()) {
+            index = (int)_cells.size();
+            _cellIndices[key] = index;
+            _cells.push_back(Cell());
+            _cells.back().coordinates = coordinates;
+        } else {
+            index = it->second;
+        }
+
+        glm::vec3 scale = avatar.getGlobalBoundingBox().getScale();
+        float radius = 0.5f * glm::max(scale.x, glm::max(scale.y, scale.z));
+
+        auto& cell = _cells[index];
+        cell.maxRadius = glm::max(cell.maxRadius, radius);
+        cell.nodes.push_back(node);
+        ++_numNodes;
+    }
+
+    // drop the cells nobody is in anymore and loosen the bounds of the others by their largest avatar
+    _cellIndices.clear();
+    auto last = std::remove_if(_cells.begin(), _cells.end(), [](const Cell& cell) { return cell.nodes.empty(); });
+    _cells.erase(last, _cells.end());
+
+    for (int i = 0; i < (int)_cells.size(); ++i) {
+        auto& cell = _cells[i];
+        glm::vec3 corner = glm::vec3(cell.coordinates) * _cellSize - glm::vec3(cell.maxRadius);
+        cell.bounds = AABox(corner, glm::vec3(_cellSize + 2.0f * cell.maxRadius));
+        _cellIndices[cellKey(cell.coordinates)] = i;
+    }
+}
+
+int AvatarMixerSpatialGrid::gatherCandidates(const glm::vec3& listenerPosition, const ConicalViewFrustums& views,
+                                             std::vector<Node*>& nearNodes, std::vector<Node*>& farNodes) const {
+    int numDeferred = 0;
+    float nearRadiusSquared = _nearRadius * _nearRadius;
+
+    for (const auto& cell : _cells) {
+        glm::vec3 closestPoint = glm::clamp(listenerPosition, cell.bounds.getMinimumPoint(), cell.bounds.getMaximumPoint());
+        bool isNear = glm::distance2(listenerPosition, closestPoint) <= nearRadiusSquared;
+
+        if (!isNear) {
+            for (const auto& view : views) {
+                if (view.intersects(cell.bounds)) {
+                    isNear = true;
+                    break;
+                }
+            }
+        }
+
+        if (isNear) {
+            nearNodes.insert(nearNodes.end(), cell.nodes.begin(), cell.nodes.end());
+        } else if ((cellBucket(cell.coordinates) + _frame) % FAR_CELL_INTERVAL == 0) {
+            farNodes.insert(farNodes.end(), cell.nodes.begin(), cell.nodes.end());
+        } else {
+            numDeferred += (int)cell.nodes.size();
+        }
+    }
+
+    return numDeferred;
+}
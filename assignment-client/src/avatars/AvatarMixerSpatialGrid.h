@@ -0,0 +1,73 @@
+//
+//  AvatarMixerSpatialGrid.h
+//  assignment-client/src/avatars
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarMixerSpatialGrid_h
+#define hifi_AvatarMixerSpatialGrid_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <AABox.h>
+#include <NodeList.h>
+#include <shared/ConicalViewFrustum.h>
+
+// A loose uniform grid of the avatars in the domain.
+// The AvatarMixer rebuilds it once per frame before the slaves broadcast, the slaves then only read it
+// to find the avatars each listener should consider this frame.
+class AvatarMixerSpatialGrid {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    static const float DEFAULT_CELL_SIZE;
+    static const float DEFAULT_NEAR_RADIUS;
+
+    // out of view cells further than the near radius are only visited every FAR_CELL_INTERVAL frames
+    static const unsigned int FAR_CELL_INTERVAL = 4;
+
+    bool isEnabled() const { return _isEnabled; }
+    void setEnabled(bool enabled) { _isEnabled = enabled; }
+
+    float getNearRadius() const { return _nearRadius; }
+    void setNearRadius(float nearRadius) { _nearRadius = nearRadius; }
+
+    // must be called while the nodes in [begin, end) are guaranteed to stay alive for the rest of the frame
+    void rebuild(ConstIter begin, ConstIter end);
+
+    // Near (or in view) avatars are added to nearNodes and the avatars of the far cells that are due this frame
+    // to farNodes. Returns the number of far avatars that were deferred to a later frame.
+    int gatherCandidates(const glm::vec3& listenerPosition, const ConicalViewFrustums& views,
+                         std::vector<Node*>& nearNodes, std::vector<Node*>& farNodes) const;
+
+    int getNumCells() const { return (int)_cells.size(); }
+    int getNumNodes() const { return _numNodes; }
+
+private:
+    struct Cell {
+        glm::ivec3 coordinates;
+        AABox bounds;
+        float maxRadius { 0.0f };
+        std::vector<Node*> nodes;
+    };
+
+    bool _isEnabled { true };
+    float _cellSize { DEFAULT_CELL_SIZE };
+    float _nearRadius { DEFAULT_NEAR_RADIUS };
+
+    unsigned int _frame { 0 };
+    int _numNodes { 0 };
+
+    std::vector<Cell> _cells;
+    std::unordered_map<int64_t, int> _cellIndices;
+};
+
+#endif // hifi_AvatarMixerSpatialGrid_h
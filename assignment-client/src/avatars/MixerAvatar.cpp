@@ -19,17 +19,23 @@
 #include <QCryptographicHash>
 #include <QApplication>
 
+#include <limits>
+
 #include <ResourceManager.h>
 #include <NetworkAccessManager.h>
 #include <NetworkingConstants.h>
 #include <EntityItem.h>
 #include <EntityItemProperties.h>
+#include <SharedUtil.h>
 #include "ClientTraitsHandler.h"
 #include "AvatarLogging.h"
 
 MixerAvatar::MixerAvatar() {
     static constexpr int CHALLENGE_TIMEOUT_MS = 10 * 1000;  // 10 s
 
+    // so that an acknowledgement still in flight for another avatar that had this one's local ID doesn't match
+    _lastJointPoseSequence = (JointDeltas::Sequence)randIntInRange(1, std::numeric_limits<JointDeltas::Sequence>::max());
+
     _challengeTimer.setSingleShot(true);
     _challengeTimer.setInterval(CHALLENGE_TIMEOUT_MS);
     _challengeTimer.callOnTimeout(this, &MixerAvatar::challengeTimeout);
@@ -415,3 +421,119 @@ void MixerAvatar::stopChallengeTimer() {
         QMetaObject::invokeMethod(&_challengeTimer, &QTimer::stop);
     }
 }
+
+MixerAvatar::EncodingKey MixerAvatar::getEncodingKey(AvatarDataDetail detail, quint64 lastSentTime,
+                                                     const JointDeltas::Encoding& jointDeltas) const {
+    const bool dropFaceTracking = false;
+
+    EncodingKey key;
+    key.detail = detail;
+    key.wantedFlags = getWantedFlags(detail, lastSentTime, dropFaceTracking);
+    if (key.wantedFlags & AvatarDataPacket::PACKET_HAS_JOINT_DATA) {
+        key.jointBaseline = jointDeltas.baselineSequence;
+        key.jointPose = jointDeltas.sequence;
+    }
+    return key;
+}
+
+void MixerAvatar::rollEncodingFrame(uint64_t frame) const {
+    if (frame != _encodingCacheFrame) {
+        _encodingCacheFrame = frame;
+        _encodingCache.clear();
+        _culledJointPoses.clear();
+        _isFullUpdateFrame = randFloat() < AVATAR_SEND_FULL_UPDATE_RATIO;
+
+        JointDeltas::SharedPose pose;
+        {
+            QReadLocker readLock(&_jointDataLock);
+            pose = JointDeltas::quantizePose(_jointData);
+        }
+        if (!_jointPose || *pose != *_jointPose) {
+            _lastJointPoseSequence = JointDeltas::nextSequence(_lastJointPoseSequence);
+            _jointPoseSequence = _lastJointPoseSequence;
+            _jointPose = pose;
+            _jointPoseHistory.add(_jointPoseSequence, pose);
+        }
+    }
+}
+
+bool MixerAvatar::findCachedEncoding(uint64_t frame, const EncodingKey& key, QByteArray& bytes) const {
+    std::lock_guard<std::mutex> lock(_encodingCacheMutex);
+    rollEncodingFrame(frame);
+
+    for (const auto& cached : _encodingCache) {
+        if (cached.first == key) {
+            bytes = cached.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+void MixerAvatar::addCachedEncoding(uint64_t frame, const EncodingKey& key, const QByteArray& bytes) const {
+    std::lock_guard<std::mutex> lock(_encodingCacheMutex);
+    rollEncodingFrame(frame);
+
+    for (const auto& cached : _encodingCache) {
+        if (cached.first == key) {
+            return;
+        }
+    }
+    _encodingCache.emplace_back(key, bytes);
+}
+
+void MixerAvatar::getJointDeltas(uint64_t frame, JointDeltas::Sequence acknowledgedSequence, AvatarDataDetail detail,
+                                 const glm::vec3& viewerPosition, JointDeltas::Encoding& encoding) const {
+    std::lock_guard<std::mutex> lock(_encodingCacheMutex);
+    rollEncodingFrame(frame);
+
+    encoding.sequence = _jointPoseSequence;
+    encoding.pose = _jointPose;
+    encoding.baseline = JointDeltas::SharedPose();
+    if (acknowledgedSequence != JointDeltas::NO_BASELINE) {
+        encoding.baseline = _jointPoseHistory.find(acknowledgedSequence);
+        if (!encoding.baseline) {
+            encoding.baseline = _culledJointPoseHistory.find(acknowledgedSequence);
+        }
+    }
+    encoding.baselineSequence = encoding.baseline ? acknowledgedSequence : JointDeltas::NO_BASELINE;
+
+    // a key frame is never culled, nor is a full update
+    if (detail != CullSmallData || !encoding.baseline || encoding.baseline == encoding.pose) {
+        return;
+    }
+
+    float minRotationDot = getDistanceBasedMinRotationDOT(viewerPosition);
+    for (const auto& culled : _culledJointPoses) {
+        if (culled.baselineSequence == encoding.baselineSequence && culled.minRotationDot == minRotationDot) {
+            encoding.sequence = culled.sequence;
+            encoding.pose = culled.pose;
+            return;
+        }
+    }
+
+    CulledJointPose culled;
+    culled.baselineSequence = encoding.baselineSequence;
+    culled.minRotationDot = minRotationDot;
+    culled.pose = JointDeltas::cullPose(_jointPose, encoding.baseline, minRotationDot,
+                                        getDistanceBasedMinTranslationDistance(viewerPosition));
+    if (culled.pose == _jointPose) {
+        culled.sequence = _jointPoseSequence;
+    } else if (culled.pose == encoding.baseline) {
+        culled.sequence = encoding.baselineSequence;
+    } else {
+        _lastJointPoseSequence = JointDeltas::nextSequence(_lastJointPoseSequence);
+        culled.sequence = _lastJointPoseSequence;
+        _culledJointPoseHistory.add(culled.sequence, culled.pose);
+    }
+    _culledJointPoses.push_back(culled);
+
+    encoding.sequence = culled.sequence;
+    encoding.pose = culled.pose;
+}
+
+bool MixerAvatar::isFullUpdateFrame(uint64_t frame) const {
+    std::lock_guard<std::mutex> lock(_encodingCacheMutex);
+    rollEncodingFrame(frame);
+    return _isFullUpdateFrame;
+}
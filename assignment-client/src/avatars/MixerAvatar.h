@@ -14,6 +14,9 @@
 #ifndef hifi_MixerAvatar_h
 #define hifi_MixerAvatar_h
 
+#include <mutex>
+#include <vector>
+
 #include <AvatarData.h>
 
 class ResourceRequest;
@@ -48,7 +51,65 @@ public:
     const QUuid& getScreenshareZone() const { return _screenshareZone; }
     void setScreenshareZone(QUuid zone) { _screenshareZone = zone; }
 
+    // Encodings of this avatar are shared by all the listeners that would get the exact same bytes in a broadcast frame.
+    // Besides the detail and the sections wanted, that is the listeners that acknowledged the same pose of this avatar,
+    // the joints being delta encoded against it, and that are sent the same pose after culling.
+    struct EncodingKey {
+        AvatarDataDetail detail { NoData };
+        AvatarDataPacket::HasFlags wantedFlags { 0 };
+        JointDeltas::Sequence jointBaseline { JointDeltas::NO_BASELINE };
+        JointDeltas::Sequence jointPose { JointDeltas::NO_BASELINE };
+
+        bool operator==(const EncodingKey& other) const {
+            return detail == other.detail && wantedFlags == other.wantedFlags && jointBaseline == other.jointBaseline &&
+                jointPose == other.jointPose;
+        }
+    };
+
+    EncodingKey getEncodingKey(AvatarDataDetail detail, quint64 lastSentTime, const JointDeltas::Encoding& jointDeltas) const;
+
+    // the broadcast frame is any value that changes from one frame to the next
+    bool findCachedEncoding(uint64_t frame, const EncodingKey& key, QByteArray& bytes) const;
+    void addCachedEncoding(uint64_t frame, const EncodingKey& key, const QByteArray& bytes) const;
+
+    // The joints of this avatar in the broadcast frame, as deltas against the pose the listener acknowledged. The pose
+    // is quantized once per frame for every listener, and gets a new sequence only when it changed. A key frame if the
+    // acknowledged pose is too old to be kept, or NO_BASELINE.
+    // With CullSmallData the joints that changed less than what can be seen from the listener's distance keep their
+    // acknowledged value. Such a culled pose gets its own sequence, shared by the listeners with the same baseline at
+    // the same distance level, so that it can be acknowledged and small changes still add up to one that is sent.
+    void getJointDeltas(uint64_t frame, JointDeltas::Sequence acknowledgedSequence, AvatarDataDetail detail,
+                        const glm::vec3& viewerPosition, JointDeltas::Encoding& encoding) const;
+
+    // Full updates are picked per avatar and frame rather than per listener, so that listeners keep sharing encodings.
+    // They resend the sections that are only sent on change, the joints are always deltas.
+    bool isFullUpdateFrame(uint64_t frame) const;
+
 private:
+    // the distance levels of getDistanceBasedMinRotationDOT
+    static const size_t NUM_JOINT_CULL_LEVELS = 6;
+
+    void rollEncodingFrame(uint64_t frame) const;
+
+    mutable std::mutex _encodingCacheMutex;
+    mutable uint64_t _encodingCacheFrame { 0 };
+    mutable bool _isFullUpdateFrame { false };
+    mutable std::vector<std::pair<EncodingKey, QByteArray>> _encodingCache;
+
+    mutable JointDeltas::Sequence _lastJointPoseSequence { JointDeltas::NO_BASELINE }; // of the poses and culled poses
+    mutable JointDeltas::Sequence _jointPoseSequence { JointDeltas::NO_BASELINE };
+    mutable JointDeltas::SharedPose _jointPose;
+    mutable JointDeltas::PoseHistory _jointPoseHistory;
+
+    struct CulledJointPose {
+        JointDeltas::Sequence baselineSequence;
+        float minRotationDot;
+        JointDeltas::Sequence sequence;
+        JointDeltas::SharedPose pose;
+    };
+    mutable std::vector<CulledJointPose> _culledJointPoses; // of this frame
+    mutable JointDeltas::PoseHistory _culledJointPoseHistory { JointDeltas::HISTORY_SIZE * NUM_JOINT_CULL_LEVELS };
+
     bool _needsHeroCheck { false };
     static const char* stateToName(VerifyState state);
     VerifyState _verifyState { nonCertified };
@@ -455,9 +455,53 @@ QString EntityServer::serverSubclassStats() {
     }
     statsString += "\r\n\r\n";
 
+    statsString += "<b>Entity Edit Filter Statistics</b>\r\n";
+    statsString += "----- Zone ID --------------------------    -- Kind --    "
+                   "---------- Calls ---------    -------- Rejected --------    "
+                   "-------- Changed ---------    ------ Average Time ------\r\n";
+
+    QJsonArray filterStats = DependencyManager::get<EntityEditFilters>()->getFilterStats();
+    for (const auto& value : filterStats) {
+        QJsonObject stats = value.toObject();
+        statsString += stats["zone"].toString().leftJustified(38, ' ');
+        statsString += "    ";
+        statsString += (stats["native"].toBool() ? QString("rules") : QString("script")).leftJustified(10, ' ');
+        statsString += locale.toString((qulonglong)stats["calls"].toDouble()).rightJustified(COLUMN_WIDTH, ' ');
+        statsString += locale.toString((qulonglong)stats["rejected"].toDouble()).rightJustified(COLUMN_WIDTH + 4, ' ');
+        statsString += locale.toString((qulonglong)stats["changed"].toDouble()).rightJustified(COLUMN_WIDTH + 4, ' ');
+        statsString += QString("%1 usecs")
+            .arg(locale.toString(stats["averageTime"].toDouble(), 'f', 1).rightJustified(COLUMN_WIDTH - 2, ' '));
+        statsString += "\r\n";
+        statsString += "        " + stats["url"].toString() + "\r\n";
+    }
+    if (filterStats.isEmpty()) {
+        statsString += "    no filters... \r\n";
+    }
+    statsString += "\r\n\r\n";
+
     return statsString;
 }
 
+QJsonObject EntityServer::serverSubclassStatsObject() {
+    QJsonObject statsObject;
+    statsObject["filters"] = DependencyManager::get<EntityEditFilters>()->getFilterStats();
+    statsObject["averageFilterTime"] = (double)_tree->getAverageFilterTime();
+
+    if (_entitySimulation) {
+        // the entities visited per simulation update
+        auto scanStats = _entitySimulation->getScanStats();
+        double updates = (double)glm::max(scanStats.updates, (uint64_t)1);
+        QJsonObject simulationObject;
+        simulationObject["updates"] = (double)scanStats.updates;
+        simulationObject["mortalsScannedPerUpdate"] = scanStats.mortals / updates;
+        simulationObject["kinematicsScannedPerUpdate"] = scanStats.kinematics / updates;
+        simulationObject["staleOwnershipsScannedPerUpdate"] = scanStats.staleOwnerships / updates;
+        simulationObject["ownerlessScannedPerUpdate"] = scanStats.ownerless / updates;
+        statsObject["simulation"] = simulationObject;
+    }
+    return statsObject;
+}
+
 void EntityServer::domainSettingsRequestFailed() {
     auto nodeList = DependencyManager::get<NodeList>();
     qCDebug(entities) << "The EntityServer couldn't get the Domain Settings. Starting dynamic domain verification with default values...";
@@ -20,12 +20,20 @@
 EntityTreeSendThread::EntityTreeSendThread(OctreeServer* myServer, const SharedNodePointer& node) :
     OctreeSendThread(myServer, node)
 {
-    connect(std::static_pointer_cast<EntityTree>(myServer->getOctree()).get(), &EntityTree::editingEntityPointer, this, &EntityTreeSendThread::editingEntityPointer, Qt::QueuedConnection);
-    connect(std::static_pointer_cast<EntityTree>(myServer->getOctree()).get(), &EntityTree::deletingEntityPointer, this, &EntityTreeSendThread::deletingEntityPointer, Qt::QueuedConnection);
+    // the tree and the node data signal from other threads, so their changes wait for our next send
+    auto entityTree = std::static_pointer_cast<EntityTree>(myServer->getOctree());
+    connect(entityTree.get(), &EntityTree::editingEntityPointer, this, [this](const EntityItemPointer& entity) {
+        queueChange([this, entity] { editingEntityPointer(entity); });
+    }, Qt::DirectConnection);
+    connect(entityTree.get(), &EntityTree::deletingEntityPointer, this, [this](EntityItem* entity) {
+        queueChange([this, entity] { deletingEntityPointer(entity); });
+    }, Qt::DirectConnection);
 
     // connect to connection ID change on EntityNodeData so we can clear state for this receiver
     auto nodeData = static_cast<EntityNodeData*>(node->getLinkedData());
-    connect(nodeData, &EntityNodeData::incomingConnectionIDChanged, this, &EntityTreeSendThread::resetState);
+    connect(nodeData, &EntityNodeData::incomingConnectionIDChanged, this, [this] {
+        queueChange([this] { resetState(); });
+    }, Qt::DirectConnection);
 }
 
 void EntityTreeSendThread::resetState() {
@@ -377,7 +385,20 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
                     // Record explicitly filtered-in entity so that extra entities can be flagged.
                     entityNodeData->insertSentFilteredEntity(entityID);
                 }
-                OctreeElement::AppendState appendEntityState = entity->appendEntityData(&_packetData, params, _extraEncodeData, entityNode->getCanGetAndSetPrivateUserData());
+                // Most viewers get the same bytes for an entity, copy its shared encoding when it fits whole.
+                // Viewers that can see private user data and entities left partially sent are encoded just for us.
+                OctreeElement::AppendState appendEntityState;
+                QByteArray sharedEncodedData;
+                if (!entityNode->getCanGetAndSetPrivateUserData() && !_extraEncodeData->entities.contains(entityID)) {
+                    sharedEncodedData = entity->getSharedEncodedData();
+                }
+                if (!sharedEncodedData.isEmpty() && _packetData.appendRawData(sharedEncodedData)) {
+                    params.trackSend(entityID, entity->getLastEdited());
+                    appendEntityState = OctreeElement::COMPLETED;
+                } else {
+                    appendEntityState = entity->appendEntityData(&_packetData, params, _extraEncodeData,
+                                                                 entityNode->getCanGetAndSetPrivateUserData());
+                }
 
                 if (appendEntityState != OctreeElement::COMPLETED) {
                     if (appendEntityState == OctreeElement::PARTIAL) {
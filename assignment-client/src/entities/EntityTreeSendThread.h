@@ -34,10 +34,9 @@ protected:
     bool traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData,
             bool viewFrustumChanged, bool isFullScene) override;
 
-private slots:
+private:
     void resetState(); // clears our known state forcing entities to appear unsent
 
-private:
     // the following two methods return booleans to indicate if any extra flagged entities were new additions to set
     bool addAncestorsToExtraFlaggedEntities(const QUuid& filteredEntityID, EntityItem& entityItem, EntityNodeData& nodeData);
     bool addDescendantsToExtraFlaggedEntities(const QUuid& filteredEntityID, EntityItem& entityItem, EntityNodeData& nodeData);
@@ -58,7 +57,6 @@ private:
     int32_t _numEntitiesOffset { 0 };
     uint16_t _numEntities { 0 };
 
-private slots:
     void editingEntityPointer(const EntityItemPointer& entity);
     void deletingEntityPointer(EntityItem* entity);
 };
@@ -11,11 +11,15 @@
 
 #include "OctreeInboundPacketProcessor.h"
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 
+#include <MetricRegistry.h>
 #include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
+#include <TBBHelpers.h>
 
 #include "OctreeServer.h"
 #include "OctreeServerConsts.h"
@@ -23,6 +27,9 @@
 static QUuid DEFAULT_NODE_ID_REF;
 const quint64 TOO_LONG_SINCE_LAST_NACK = 1 * USECS_PER_SECOND;
 
+// bounds how long the edits at the front of a batch wait for the rest of it, and how long the batch holds the lock
+const size_t MAX_EDIT_PACKETS_PER_BATCH = 256;
+
 OctreeInboundPacketProcessor::OctreeInboundPacketProcessor(OctreeServer* myServer) :
     _myServer(myServer),
     _receivedPacketCount(0),
@@ -34,6 +41,9 @@ OctreeInboundPacketProcessor::OctreeInboundPacketProcessor(OctreeServer* myServe
     _lastNackTime(usecTimestampNow()),
     _shuttingDown(false)
 {
+    for (auto& bucket : _lockHoldHistogram) {
+        bucket = 0;
+    }
 }
 
 void OctreeInboundPacketProcessor::resetStats() {
@@ -42,12 +52,41 @@ void OctreeInboundPacketProcessor::resetStats() {
     _totalLockWaitTime = 0;
     _totalElementsInPacket = 0;
     _totalPackets = 0;
+    _totalEditBatches = 0;
+    _totalCoalescedEdits = 0;
+    for (auto& bucket : _lockHoldHistogram) {
+        bucket = 0;
+    }
     _lastNackTime = usecTimestampNow();
 
     QWriteLocker locker(&_senderStatsLock);
     _singleSenderStats.clear();
 }
 
+const std::vector<int64_t>& OctreeInboundPacketProcessor::getLockHoldBucketsUsecs() {
+    static const std::vector<int64_t> LOCK_HOLD_BUCKETS_USECS { 100, 250, 500, 1000, 2500, 5000, 10000 };
+    return LOCK_HOLD_BUCKETS_USECS;
+}
+
+std::vector<uint64_t> OctreeInboundPacketProcessor::getLockHoldHistogram() const {
+    std::vector<uint64_t> histogram;
+    histogram.reserve(_lockHoldHistogram.size());
+    for (auto& bucket : _lockHoldHistogram) {
+        histogram.push_back(bucket);
+    }
+    return histogram;
+}
+
+void OctreeInboundPacketProcessor::recordLockHold(quint64 lockHoldTime) {
+    static auto lockHoldMetric = MetricRegistry::getInstance().histogram("octree_edit_lock_hold_us",
+        "Time the octree write lock was held to apply inbound edits, in microseconds", getLockHoldBucketsUsecs());
+    lockHoldMetric.record((int64_t)lockHoldTime);
+
+    const auto& bounds = getLockHoldBucketsUsecs();
+    size_t bucket = std::upper_bound(bounds.begin(), bounds.end(), (int64_t)lockHoldTime) - bounds.begin();
+    _lockHoldHistogram[std::min(bucket, _lockHoldHistogram.size() - 1)]++;
+}
+
 uint32_t OctreeInboundPacketProcessor::getMaxWait() const {
     // calculate time until next sendNackPackets()
     quint64 nextNackTime = _lastNackTime + TOO_LONG_SINCE_LAST_NACK;
@@ -76,6 +115,10 @@ void OctreeInboundPacketProcessor::midProcess() {
     }
 }
 
+void OctreeInboundPacketProcessor::postProcess() {
+    processPendingEditPackets();
+}
+
 void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
     if (_shuttingDown) {
         qDebug() << "OctreeInboundPacketProcessor::processPacket() while shutting down... ignoring incoming packet";
@@ -92,6 +135,12 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
 
     // Ask our tree subclass if it can handle the incoming packet...
     PacketType packetType = message->getType();
+
+    // anything that can't join the batch of edits waits for it, so that packets are still applied in the order they came
+    bool canBatch = _myServer->getOctree()->canDecodeEditPacketType(packetType);
+    if (!canBatch) {
+        processPendingEditPackets();
+    }
     
     if (packetType == PacketType::ChallengeOwnership) {
         _myServer->getOctree()->withWriteLock([&] {
@@ -152,6 +201,19 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
                 qDebug() << "    ----- UNEXPECTED ---- got a packet without any edit details!!!! --------";
             }
         }
+
+        if (canBatch) {
+            PendingEditPacket packet;
+            packet.message = message;
+            packet.sendingNode = sendingNode;
+            packet.sequence = sequence;
+            packet.transitTime = transitTime;
+            _pendingEditPackets.push_back(std::move(packet));
+            if (_pendingEditPackets.size() >= MAX_EDIT_PACKETS_PER_BATCH) {
+                processPendingEditPackets();
+            }
+            return;
+        }
         
         const unsigned char* editData = nullptr;
         
@@ -178,6 +240,7 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
                     _myServer->getOctree()->processEditPacketData(*message, editData, maxSize, sendingNode);
             });
             quint64 endProcess = usecTimestampNow();
+            recordLockHold(endProcess - startProcess);
 
             if (debugProcessPacket) {
                 qDebug() << "OctreeInboundPacketProcessor::processPacket() after processEditPacketData()..."
@@ -225,6 +288,91 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
     }
 }
 
+void OctreeInboundPacketProcessor::decodeEditPacket(PendingEditPacket& packet) {
+    auto tree = _myServer->getOctree();
+    ReceivedMessage& message = *packet.message;
+
+    quint64 startDecode = usecTimestampNow();
+    while (message.getBytesLeftToRead() > 0) {
+        auto editData = reinterpret_cast<const unsigned char*>(message.getRawMessage() + message.getPosition());
+        int maxSize = message.getBytesLeftToRead();
+
+        Octree::DecodedEditPointer edit;
+        int editDataBytesRead = tree->decodeEditPacketData(message, editData, maxSize, packet.sendingNode, edit);
+        if (edit) {
+            packet.edits.push_back(std::move(edit));
+        }
+        if (editDataBytesRead <= 0) {
+            // the rest of the packet can't be delimited
+            break;
+        }
+
+        // skip to next edit record in the packet
+        message.seek(message.getPosition() + editDataBytesRead);
+    }
+    packet.decodeTime = usecTimestampNow() - startDecode;
+}
+
+void OctreeInboundPacketProcessor::processPendingEditPackets() {
+    if (_pendingEditPackets.empty()) {
+        return;
+    }
+
+    auto tree = _myServer->getOctree();
+
+    // decoding doesn't touch the tree, so the packets are decoded in parallel, each by one task since the edits in a
+    // packet are only delimited by decoding them
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _pendingEditPackets.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            decodeEditPacket(_pendingEditPackets[i]);
+        }
+    });
+
+    std::vector<Octree::DecodedEditPointer> edits;
+    for (auto& packet : _pendingEditPackets) {
+        std::move(packet.edits.begin(), packet.edits.end(), std::back_inserter(edits));
+    }
+    quint64 totalEdits = edits.size();
+
+    quint64 startProcess, startLock = usecTimestampNow();
+    int editsApplied = 0;
+    tree->withWriteLock([&] {
+        startProcess = usecTimestampNow();
+        editsApplied = tree->processDecodedEdits(edits);
+    });
+    quint64 endProcess = usecTimestampNow();
+    edits.clear();
+
+    quint64 applyTime = endProcess - startProcess;
+    quint64 lockWaitTime = startProcess - startLock;
+    recordLockHold(applyTime);
+    _totalEditBatches++;
+    _totalCoalescedEdits += totalEdits - std::min(totalEdits, (quint64)editsApplied);
+
+    if (_myServer->wantsDebugReceiving()) {
+        qDebug() << "PROCESSING THREAD: applied" << editsApplied << "of" << totalEdits << "edits from"
+            << _pendingEditPackets.size() << "packets, lock wait=" << lockWaitTime << "usecs hold=" << applyTime << "usecs";
+    }
+
+    // each packet is charged for the share of the batch's wait and apply that its edits make up
+    for (auto& packet : _pendingEditPackets) {
+        int editsInPacket = (int)packet.edits.size();
+        quint64 processTime = packet.decodeTime;
+        quint64 packetLockWaitTime = 0;
+        if (totalEdits > 0) {
+            processTime += applyTime * editsInPacket / totalEdits;
+            packetLockWaitTime = lockWaitTime * editsInPacket / totalEdits;
+        }
+
+        QUuid nodeUUID;
+        if (packet.sendingNode) {
+            nodeUUID = packet.sendingNode->getUUID();
+        }
+        trackInboundPacket(nodeUUID, packet.sequence, packet.transitTime, editsInPacket, processTime, packetLockWaitTime);
+    }
+    _pendingEditPackets.clear();
+}
+
 void OctreeInboundPacketProcessor::trackInboundPacket(const QUuid& nodeUUID, unsigned short int sequence, quint64 transitTime,
             int editsInPacket, quint64 processTime, quint64 lockWaitTime) {
 
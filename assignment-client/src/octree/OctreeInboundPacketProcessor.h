@@ -14,6 +14,11 @@
 #ifndef hifi_OctreeInboundPacketProcessor_h
 #define hifi_OctreeInboundPacketProcessor_h
 
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include <Octree.h>
 #include <ReceivedPacketProcessor.h>
 
 #include "SequenceNumberStats.h"
@@ -72,6 +77,13 @@ public:
 
     void resetStats();
 
+    // how long each write lock taken for edits was held, counted in the buckets bounded by getLockHoldBucketsUsecs(),
+    // with a last bucket for the holds longer than all of them
+    static const std::vector<int64_t>& getLockHoldBucketsUsecs();
+    std::vector<uint64_t> getLockHoldHistogram() const;
+    quint64 getTotalEditBatches() const { return _totalEditBatches; }
+    quint64 getTotalCoalescedEdits() const { return _totalCoalescedEdits; }
+
     NodeToSenderStatsMap getSingleSenderStats() { QReadLocker locker(&_senderStatsLock); return _singleSenderStats; }
 
     virtual void terminating() override { _shuttingDown = true; ReceivedPacketProcessor::terminating(); }
@@ -83,10 +95,25 @@ protected:
     virtual uint32_t getMaxWait() const override;
     virtual void preProcess() override;
     virtual void midProcess() override;
+    virtual void postProcess() override;
 
 private:
     int sendNackPackets();
 
+    // an edit packet waiting for the rest of its batch, to be decoded with them and then applied under one write lock
+    struct PendingEditPacket {
+        QSharedPointer<ReceivedMessage> message;
+        SharedNodePointer sendingNode;
+        unsigned short int sequence;
+        quint64 transitTime;
+        std::vector<Octree::DecodedEditPointer> edits;
+        quint64 decodeTime { 0 };
+    };
+
+    void decodeEditPacket(PendingEditPacket& packet);
+    void processPendingEditPackets();
+    void recordLockHold(quint64 lockHoldTime);
+
 private:
     void trackInboundPacket(const QUuid& nodeUUID, unsigned short int sequence, quint64 transitTime,
             int elementsInPacket, quint64 processTime, quint64 lockWaitTime);
@@ -99,6 +126,13 @@ private:
     std::atomic<uint64_t> _totalLockWaitTime;
     std::atomic<uint64_t> _totalElementsInPacket;
     std::atomic<uint64_t> _totalPackets;
+    std::atomic<uint64_t> _totalEditBatches { 0 };
+    std::atomic<uint64_t> _totalCoalescedEdits { 0 };
+
+    static const size_t NUM_LOCK_HOLD_BUCKETS = 8;
+    std::array<std::atomic<uint64_t>, NUM_LOCK_HOLD_BUCKETS> _lockHoldHistogram;
+
+    std::vector<PendingEditPacket> _pendingEditPackets;
     
     NodeToSenderStatsMap _singleSenderStats;
     QReadWriteLock _senderStatsLock;
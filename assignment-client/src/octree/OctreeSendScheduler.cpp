@@ -0,0 +1,228 @@
+//
+//  OctreeSendScheduler.cpp
+//  assignment-client/src/octree
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeSendScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "OctreeSendThread.h"
+#include "OctreeServer.h"
+#include "OctreeServerConsts.h"
+
+static const int MAX_DEFAULT_SEND_WORKERS = 8;
+
+int OctreeSendScheduler::getDefaultNumWorkers() {
+    return std::min(MAX_DEFAULT_SEND_WORKERS, std::max(1, (int)std::thread::hardware_concurrency() / 2));
+}
+
+OctreeSendScheduler::OctreeSendScheduler(OctreeServer* server, int numWorkers) :
+    _server(server),
+    _nextTickTime(usecTimestampNow())
+{
+    numWorkers = std::max(1, numWorkers);
+
+    qCDebug(octree_server) << "Starting" << numWorkers << "octree send workers";
+
+    // every worker has to exist before any of them start stealing
+    _workers.reserve(numWorkers);
+    for (int i = 0; i < numWorkers; ++i) {
+        _workers.emplace_back(new Worker());
+    }
+    for (int i = 0; i < numWorkers; ++i) {
+        _workers[i]->thread = std::thread([this, i] { run(i); });
+    }
+}
+
+OctreeSendScheduler::~OctreeSendScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(_tickMutex);
+        _isStopping = true;
+    }
+    _tickCondition.notify_all();
+
+    for (auto& worker : _workers) {
+        worker->thread.join();
+    }
+
+    // no worker is sending now, so the clients can go
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    for (auto& job : _jobs) {
+        job.second->sendThread->setIsShuttingDown();
+    }
+    _jobs.clear();
+    _retiredJobs.clear();
+    for (auto& worker : _workers) {
+        worker->jobs.clear();
+    }
+}
+
+void OctreeSendScheduler::addClient(const SendThreadPointer& sendThread) {
+    auto job = std::make_shared<Job>(sendThread);
+
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    auto& entry = _jobs[sendThread->getNodeUuid()];
+    if (entry) {
+        entry->sendThread->setIsShuttingDown();
+        _retiredJobs.push_back(entry);
+    }
+    entry = job;
+}
+
+bool OctreeSendScheduler::hasClient(const QUuid& nodeUuid) const {
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    auto itr = _jobs.find(nodeUuid);
+    return itr != _jobs.end() && !itr->second->sendThread->isShuttingDown();
+}
+
+void OctreeSendScheduler::removeClient(const QUuid& nodeUuid) {
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    auto itr = _jobs.find(nodeUuid);
+    if (itr != _jobs.end()) {
+        // the next tick drops it
+        itr->second->sendThread->setIsShuttingDown();
+    }
+}
+
+OctreeSendScheduler::Stats OctreeSendScheduler::getStats() const {
+    Stats stats;
+    stats.numWorkers = getNumWorkers();
+    {
+        std::lock_guard<std::mutex> lock(_jobsMutex);
+        stats.numClients = (int)_jobs.size();
+    }
+    stats.ticks = _tick;
+    stats.steals = _steals;
+    stats.budgetSkips = _budgetSkips;
+    stats.overruns = _overruns;
+    return stats;
+}
+
+void OctreeSendScheduler::run(int index) {
+    uint64_t lastTick = 0;
+    while (!_isStopping) {
+        if (auto job = takeJob(index)) {
+            runJob(*job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_tickMutex);
+        if (_isStopping) {
+            break;
+        }
+        if (lastTick != _tick) {
+            // a tick started since we last looked for clients
+            lastTick = _tick;
+            continue;
+        }
+
+        uint64_t now = usecTimestampNow();
+        if (now >= _nextTickTime) {
+            startTick(now);
+            lastTick = _tick;
+            continue;
+        }
+
+        // the clock can be skewed backwards, so never wait longer than an interval
+        uint64_t usecsToWait = std::min(_nextTickTime - now, (uint64_t)OCTREE_SEND_INTERVAL_USECS);
+        _tickCondition.wait_for(lock, std::chrono::microseconds(usecsToWait));
+    }
+}
+
+void OctreeSendScheduler::startTick(uint64_t now) {
+    // protected: _tickMutex is held
+    _nextTickTime += OCTREE_SEND_INTERVAL_USECS;
+    if (_nextTickTime <= now) {
+        // we fell behind, don't catch up with a burst of ticks
+        _nextTickTime = now + OCTREE_SEND_INTERVAL_USECS;
+    }
+
+    std::vector<JobPointer> ready;
+    {
+        std::lock_guard<std::mutex> lock(_jobsMutex);
+        _retiredJobs.erase(std::remove_if(_retiredJobs.begin(), _retiredJobs.end(), [](const JobPointer& job) {
+            return !job->isQueued;
+        }), _retiredJobs.end());
+
+        ready.reserve(_jobs.size());
+        auto itr = _jobs.begin();
+        while (itr != _jobs.end()) {
+            auto& job = itr->second;
+            if (job->isQueued) {
+                ++_overruns;
+                ++itr;
+            } else if (job->sendThread->isShuttingDown()) {
+                itr = _jobs.erase(itr);
+            } else {
+                ready.push_back(job);
+                ++itr;
+            }
+        }
+    }
+
+    // the clients that have waited longest go first, so the ones the budget cut off aren't cut off again
+    std::stable_sort(ready.begin(), ready.end(), [](const JobPointer& a, const JobPointer& b) {
+        return a->lastServedTick < b->lastServedTick;
+    });
+
+    _bytesLeftThisTick = (int64_t)_server->getPacketsTotalPerInterval() * udt::MAX_PACKET_SIZE;
+    ++_tick;
+
+    // deal the clients out in order, so each worker starts on the front of the line
+    for (size_t i = 0; i < ready.size(); ++i) {
+        ready[i]->isQueued = true;
+        auto& worker = *_workers[i % _workers.size()];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.jobs.push_back(std::move(ready[i]));
+    }
+    _tickCondition.notify_all();
+}
+
+OctreeSendScheduler::JobPointer OctreeSendScheduler::takeJob(int index) {
+    {
+        auto& worker = *_workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (!worker.jobs.empty()) {
+            auto job = std::move(worker.jobs.front());
+            worker.jobs.pop_front();
+            return job;
+        }
+    }
+
+    int numWorkers = getNumWorkers();
+    for (int i = 1; i < numWorkers; ++i) {
+        auto& victim = *_workers[(index + i) % numWorkers];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            auto job = std::move(victim.jobs.back());
+            victim.jobs.pop_back();
+            ++_steals;
+            return job;
+        }
+    }
+    return JobPointer();
+}
+
+void OctreeSendScheduler::runJob(Job& job) {
+    int64_t bytesLeft = _bytesLeftThisTick;
+    if (bytesLeft > 0) {
+        // a client can always send a packet while there is budget left, so every client makes progress
+        int maxPackets = (int)std::max<int64_t>(1, bytesLeft / udt::MAX_PACKET_SIZE);
+        if (!job.sendThread->process(maxPackets)) {
+            job.sendThread->setIsShuttingDown();
+        }
+        _bytesLeftThisTick -= job.sendThread->getBytesSentThisInterval();
+        job.lastServedTick = _tick;
+    } else {
+        ++_budgetSkips;
+    }
+    job.isQueued = false;
+}
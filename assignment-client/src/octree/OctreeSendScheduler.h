@@ -0,0 +1,113 @@
+//
+//  OctreeSendScheduler.h
+//  assignment-client/src/octree
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeSendScheduler_h
+#define hifi_OctreeSendScheduler_h
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore/QUuid>
+
+#include <UUIDHasher.h>
+
+class OctreeSendThread;
+class OctreeServer;
+
+// Sends to every client of an octree server from a fixed pool of workers, instead of a thread per client.
+//
+// Each send interval is a tick: the clients are dealt out to the workers' queues, and a worker that runs out of clients
+// steals from the back of another's queue. A client is sent for by one worker at a time, and at most once per tick.
+// The tick has a budget of the server's total packets per interval, in bytes. Each client may use what is left of it,
+// on top of its own per client limit, and the clients that the budget cut off go first in the next tick.
+class OctreeSendScheduler {
+public:
+    using SendThreadPointer = std::shared_ptr<OctreeSendThread>;
+
+    struct Stats {
+        int numWorkers { 0 };
+        int numClients { 0 };
+        uint64_t ticks { 0 };
+        uint64_t steals { 0 }; // clients sent for by a worker that took them from another's queue
+        uint64_t budgetSkips { 0 }; // clients not sent for in a tick because its budget was spent
+        uint64_t overruns { 0 }; // clients still being sent for when the next tick started
+    };
+
+    // sized to the machine, leaving the other threads of the server their own cores on big boxes
+    static int getDefaultNumWorkers();
+
+    OctreeSendScheduler(OctreeServer* server, int numWorkers);
+    ~OctreeSendScheduler();
+
+    OctreeSendScheduler(const OctreeSendScheduler&) = delete;
+    OctreeSendScheduler& operator=(const OctreeSendScheduler&) = delete;
+
+    // replaces the send state the client had, if any
+    void addClient(const SendThreadPointer& sendThread);
+
+    // true if the client has send state that isn't shutting down
+    bool hasClient(const QUuid& nodeUuid) const;
+
+    // shuts down the send state of the client, it is released once no worker is sending for it
+    void removeClient(const QUuid& nodeUuid);
+
+    int getNumWorkers() const { return (int)_workers.size(); }
+    Stats getStats() const;
+
+private:
+    struct Job {
+        Job(const SendThreadPointer& sendThread) : sendThread(sendThread) { }
+
+        SendThreadPointer sendThread;
+        std::atomic<bool> isQueued { false }; // on a worker's queue, or being sent for
+        uint64_t lastServedTick { 0 };
+    };
+    using JobPointer = std::shared_ptr<Job>;
+
+    struct Worker {
+        std::mutex mutex;
+        std::deque<JobPointer> jobs;
+        std::thread thread;
+    };
+
+    void run(int index);
+    void startTick(uint64_t now);
+    JobPointer takeJob(int index);
+    void runJob(Job& job);
+
+    OctreeServer* _server;
+
+    mutable std::mutex _jobsMutex;
+    std::unordered_map<QUuid, JobPointer> _jobs;
+    std::vector<JobPointer> _retiredJobs; // replaced while queued, released with the next tick that they aren't
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+    std::mutex _tickMutex;
+    std::condition_variable _tickCondition;
+    uint64_t _nextTickTime { 0 };
+    std::atomic<uint64_t> _tick { 0 };
+    std::atomic<bool> _isStopping { false };
+    std::atomic<int64_t> _bytesLeftThisTick { 0 };
+
+    std::atomic<uint64_t> _steals { 0 };
+    std::atomic<uint64_t> _budgetSkips { 0 };
+    std::atomic<uint64_t> _overruns { 0 };
+};
+
+#endif // hifi_OctreeSendScheduler_h
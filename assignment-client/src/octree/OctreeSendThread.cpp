@@ -11,8 +11,7 @@
 
 #include "OctreeSendThread.h"
 
-#include <chrono>
-#include <thread>
+#include <algorithm>
 
 #include <NodeList.h>
 #include <NumericalConstants.h>
@@ -33,7 +32,7 @@ OctreeSendThread::OctreeSendThread(OctreeServer* myServer, const SharedNodePoint
 {
     QString safeServerName("Octree");
 
-    // set our QThread object name so we can identify this thread while debugging
+    // set our object name so we can identify this client while debugging
     setObjectName(QString("Octree Send Thread (%1)").arg(uuidStringWithoutCurlyBraces(_nodeUuid)));
 
     if (_myServer) {
@@ -41,7 +40,7 @@ OctreeSendThread::OctreeSendThread(OctreeServer* myServer, const SharedNodePoint
     }
 
     qDebug() << qPrintable(safeServerName)  << "server [" << _myServer << "]: client connected "
-                                            "- starting sending thread [" << this << "]";
+                                            "- starting sending [" << this << "]";
 
     OctreeServer::clientConnected();
 }
@@ -55,7 +54,7 @@ OctreeSendThread::~OctreeSendThread() {
     }
 
     qDebug() << qPrintable(safeServerName)  << "server [" << _myServer << "]: client disconnected "
-                                            "- ending sending thread [" << this << "]";
+                                            "- ending sending [" << this << "]";
 
     OctreeServer::clientDisconnected();
     OctreeServer::stopTrackingThread(this);
@@ -66,14 +65,32 @@ void OctreeSendThread::setIsShuttingDown() {
 }
 
 
-bool OctreeSendThread::process() {
+void OctreeSendThread::queueChange(std::function<void()> change) {
+    std::lock_guard<std::mutex> lock(_queuedChangesMutex);
+    _queuedChanges.push_back(std::move(change));
+}
+
+void OctreeSendThread::processQueuedChanges() {
+    std::vector<std::function<void()>> changes;
+    {
+        std::lock_guard<std::mutex> lock(_queuedChangesMutex);
+        changes.swap(_queuedChanges);
+    }
+    for (auto& change : changes) {
+        change();
+    }
+}
+
+bool OctreeSendThread::process(int maxPackets) {
     if (_isShuttingDown) {
         return false; // exit early if we're shutting down
     }
 
     OctreeServer::didProcess(this);
 
-    quint64  start = usecTimestampNow();
+    processQueuedChanges();
+    _maxPacketsThisInterval = std::max(1, maxPackets);
+    _trueBytesSent = 0;
 
     // we'd better have a server at this point, or we're in trouble
     assert(_myServer);
@@ -97,33 +114,14 @@ bool OctreeSendThread::process() {
         }
     }
 
-    if (_isShuttingDown) {
-        return false; // exit early if we're shutting down
-    }
-
-    // Only sleep if we're still running and we got the lock last time we tried, otherwise try to get the lock asap
-    if (isStillRunning()) {
-        // dynamically sleep until we need to fire off the next set of octree elements
-        int elapsed = (usecTimestampNow() - start);
-        int usecToSleep =  OCTREE_SEND_INTERVAL_USECS - elapsed;
-
-        if (usecToSleep <= 0) {
-            const int MIN_USEC_TO_SLEEP = 1;
-            usecToSleep = MIN_USEC_TO_SLEEP;
-        }
-
-        {
-            PerformanceWarning warn(false,"OctreeSendThread... usleep()",false,&_usleepTime,&_usleepCalls);
-            std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
-        }
-
-    }
+    return !_isShuttingDown;
+}
 
-    return isStillRunning();  // keep running till they terminate us
+int OctreeSendThread::getMaxPacketsPerInterval(OctreeQueryNode* nodeData) const {
+    int clientMaxPacketsPerInterval = std::max(1, (nodeData->getMaxQueryPacketsPerSecond() / INTERVALS_PER_SECOND));
+    return std::min({ clientMaxPacketsPerInterval, _myServer->getPacketsPerClientPerInterval(), _maxPacketsThisInterval });
 }
 
-AtomicUIntStat OctreeSendThread::_usleepTime { 0 };
-AtomicUIntStat OctreeSendThread::_usleepCalls { 0 };
 AtomicUIntStat OctreeSendThread::_totalBytes { 0 };
 AtomicUIntStat OctreeSendThread::_totalWastedBytes { 0 };
 AtomicUIntStat OctreeSendThread::_totalPackets { 0 };
@@ -386,8 +384,7 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
     }
 
     // calculate max number of packets that can be sent during this interval
-    int clientMaxPacketsPerInterval = std::max(1, (nodeData->getMaxQueryPacketsPerSecond() / INTERVALS_PER_SECOND));
-    int maxPacketsPerInterval = std::min(clientMaxPacketsPerInterval, _myServer->getPacketsPerClientPerInterval());
+    int maxPacketsPerInterval = getMaxPacketsPerInterval(nodeData);
 
     // Re-send packets that were nacked by the client
     while (nodeData->hasNextNackedPacket() && _packetsSentThisInterval < maxPacketsPerInterval) {
@@ -427,8 +424,7 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
 
 bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData, bool viewFrustumChanged, bool isFullScene) {
     // calculate max number of packets that can be sent during this interval
-    int clientMaxPacketsPerInterval = std::max(1, (nodeData->getMaxQueryPacketsPerSecond() / INTERVALS_PER_SECOND));
-    int maxPacketsPerInterval = std::min(clientMaxPacketsPerInterval, _myServer->getPacketsPerClientPerInterval());
+    int maxPacketsPerInterval = getMaxPacketsPerInterval(nodeData);
 
     int extraPackingAttempts = 0;
 
@@ -505,8 +501,7 @@ bool OctreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, Octre
 
     if (somethingToSend && _myServer->wantsVerboseDebug()) {
         qCDebug(octree) << "Hit PPS Limit, packetsSentThisInterval =" << _packetsSentThisInterval
-                        << "  maxPacketsPerInterval = " << maxPacketsPerInterval
-                        << "  clientMaxPacketsPerInterval = " << clientMaxPacketsPerInterval;
+                        << "  maxPacketsPerInterval = " << maxPacketsPerInterval;
     }
 
     return params.stopReason == EncodeBitstreamParams::FINISHED;
@@ -5,7 +5,7 @@
 //  Created by Brad Hefta-Gaub on 8/21/13.
 //  Copyright 2013 High Fidelity, Inc.
 //
-//  Threaded or non-threaded object for sending octree data packets to a client
+//  Per-client state for sending octree data packets to a client
 //
 //  Distributed under the Apache License, Version 2.0.
 //  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
@@ -15,8 +15,12 @@
 #define hifi_OctreeSendThread_h
 
 #include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QObject>
 
-#include <GenericThread.h>
 #include <Node.h>
 #include <OctreePacketData.h>
 #include "OctreeQueryNode.h"
@@ -26,8 +30,9 @@ class OctreeServer;
 
 using AtomicUIntStat = std::atomic<uintmax_t>;
 
-/// Threaded processor for sending octree packets to a single client
-class OctreeSendThread : public GenericThread {
+/// Processor for sending octree packets to a single client. It isn't tied to a thread, the workers of the
+/// OctreeSendScheduler run it once per send interval, one worker at a time.
+class OctreeSendThread : public QObject {
     Q_OBJECT
 public:
     OctreeSendThread(OctreeServer* myServer, const SharedNodePointer& node);
@@ -38,6 +43,11 @@ public:
 
     QUuid getNodeUuid() const { return _nodeUuid; }
 
+    /// Sends to the client for one interval, at most maxPackets packets. Returns false once the client is gone.
+    bool process(int maxPackets);
+
+    int getBytesSentThisInterval() const { return _trueBytesSent; }
+
     static AtomicUIntStat _totalBytes;
     static AtomicUIntStat _totalWastedBytes;
     static AtomicUIntStat _totalPackets;
@@ -45,12 +55,9 @@ public:
     static AtomicUIntStat _totalSpecialBytes;
     static AtomicUIntStat _totalSpecialPackets;
 
-    static AtomicUIntStat _usleepTime;
-    static AtomicUIntStat _usleepCalls;
-
 protected:
-    /// Implements generic processing behavior for this thread.
-    virtual bool process() override;
+    /// Holds a change signalled from another thread until the next process(), so it doesn't race the worker
+    void queueChange(std::function<void()> change);
 
     virtual bool traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData,
             bool viewFrustumChanged, bool isFullScene);
@@ -64,6 +71,8 @@ protected:
 private:
     /// Called before a packetDistributor pass to allow for pre-distribution processing
     virtual void preDistributionProcessing() = 0;
+    void processQueuedChanges();
+    int getMaxPacketsPerInterval(OctreeQueryNode* nodeData) const;
     int handlePacketSend(SharedNodePointer node, OctreeQueryNode* nodeData, bool dontSuppressDuplicate = false);
     int packetDistributor(SharedNodePointer node, OctreeQueryNode* nodeData, bool viewFrustumChanged);
 
@@ -73,7 +82,11 @@ private:
     int _truePacketsSent { 0 }; // available for debug stats
     int _trueBytesSent { 0 }; // available for debug stats
     int _packetsSentThisInterval { 0 }; // used for bandwidth throttle condition
-    bool _isShuttingDown { false };
+    int _maxPacketsThisInterval { 1 }; // the share of the scheduler's budget for this interval
+    std::atomic<bool> _isShuttingDown { false };
+
+    std::mutex _queuedChangesMutex;
+    std::vector<std::function<void()>> _queuedChanges;
 };
 
 #endif // hifi_OctreeSendThread_h
@@ -22,6 +22,7 @@
 #include <HTTPConnection.h>
 #include <LogHandler.h>
 #include <shared/NetworkUtils.h>
+#include <shared/QtHelpers.h>
 #include <NumericalConstants.h>
 #include <UUID.h>
 
@@ -237,6 +238,7 @@ OctreeServer::OctreeServer(ReceivedMessage& message) :
     _statusPort(0),
     _packetsPerClientPerInterval(10),
     _packetsTotalPerInterval(DEFAULT_PACKETS_PER_INTERVAL),
+    _numSendWorkers(OctreeSendScheduler::getDefaultNumWorkers()),
     _tree(nullptr),
     _wantPersist(true),
     _debugSending(false),
@@ -873,22 +875,15 @@ void OctreeServer::parsePayload() {
     }
 }
 
-OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePointer& node) {
-    auto sendThread = newSendThread(node);
-
-    // we want to be notified when the thread finishes
-    connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread);
-    sendThread->initialize(true);
-
-    return sendThread;
-}
-
-void OctreeServer::removeSendThread() {
-    // If the object has been deleted since the event was queued, sender() will return nullptr
-    if (auto sendThread = qobject_cast<OctreeSendThread*>(sender())) {
-        // This deletes the unique_ptr, so sendThread is destructed after that line
-        _sendThreads.erase(sendThread->getNodeUuid());
-    }
+OctreeSendScheduler::SendThreadPointer OctreeServer::createSendThread(const SharedNodePointer& node) {
+    // the send workers may release it on their threads, so it is deleted on ours
+    return OctreeSendScheduler::SendThreadPointer(newSendThread(node).release(), [](OctreeSendThread* sendThread) {
+        if (QThread::currentThread() == sendThread->thread()) {
+            delete sendThread;
+        } else {
+            sendThread->deleteLater();
+        }
+    });
 }
 
 void OctreeServer::handleOctreeQueryPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
@@ -898,13 +893,9 @@ void OctreeServer::handleOctreeQueryPacket(QSharedPointer<ReceivedMessage> messa
         auto nodeList = DependencyManager::get<NodeList>();
         nodeList->updateNodeWithDataFromPacket(message, senderNode);
 
-        auto it = _sendThreads.find(senderNode->getUUID());
-        if (it == _sendThreads.end()) {
-            _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
-        } else if (it->second->isShuttingDown()) {
-            _sendThreads.erase(it); // Remove right away and wait on thread to be
-
-            _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
+        // a client whose send state is shutting down gets fresh state
+        if (_sendScheduler && !_sendScheduler->hasClient(senderNode->getUUID())) {
+            _sendScheduler->addClient(createSendThread(senderNode));
         }
     }
 }
@@ -1047,7 +1038,10 @@ void OctreeServer::readConfiguration() {
         qDebug() << "persistFilePath=" << _persistFilePath;
         qDebug() << "persisAbsoluteFilePath=" << _persistAbsoluteFilePath;
 
-        _persistAsFileType = "json.gz";
+        bool persistBinary = false;
+        readOptionBool(QString("persistBinary"), settingsSectionObject, persistBinary);
+        _persistAsFileType = persistBinary ? OctreePersistThread::BINARY_FILE_TYPE : "json.gz";
+        qDebug() << "persistAsFileType=" << _persistAsFileType;
 
         _persistInterval = OctreePersistThread::DEFAULT_PERSIST_INTERVAL;
         int result { -1 };
@@ -1058,6 +1052,15 @@ void OctreeServer::readConfiguration() {
 
         qDebug() << "persistInterval=" << _persistInterval.count();
 
+        _persistDomainServerInterval = OctreePersistThread::DEFAULT_BINARY_DS_UPLOAD_INTERVAL;
+        result = -1;
+        readOptionInt(QString("persistDomainServerInterval"), settingsSectionObject, result);
+        if (result != -1) {
+            _persistDomainServerInterval = std::chrono::milliseconds(result);
+        }
+
+        qDebug() << "persistDomainServerInterval=" << _persistDomainServerInterval.count();
+
         readOptionBool(QString("persistFileDownload"), settingsSectionObject, _persistFileDownload);
         qDebug() << "persistFileDownload=" << _persistFileDownload;
 
@@ -1096,6 +1099,13 @@ void OctreeServer::readConfiguration() {
     qDebug("packetsPerSecondTotalMax=%d _packetsTotalPerInterval=%d",
                     packetsPerSecondTotalMax, _packetsTotalPerInterval);
 
+    // the number of threads that send to all of the clients
+    int sendWorkers = -1;
+    if (readOptionInt(QString("sendWorkers"), settingsSectionObject, sendWorkers) && sendWorkers > 0) {
+        _numSendWorkers = sendWorkers;
+    }
+    qDebug("sendWorkers=%d _numSendWorkers=%d", sendWorkers, _numSendWorkers);
+
 
     readAdditionalConfiguration(settingsSectionObject);
 }
@@ -1186,7 +1196,7 @@ void OctreeServer::domainSettingsRequestComplete() {
 
         // now set up PersistThread
         _persistManager = new OctreePersistThread(_tree, _persistAbsoluteFilePath, _persistInterval, _debugTimestampNow,
-                                                 _persistAsFileType);
+                                                 _persistAsFileType, _persistDomainServerInterval);
         _persistManager->moveToThread(&_persistThread);
         connect(&_persistThread, &QThread::finished, _persistManager, &QObject::deleteLater);
         connect(&_persistThread, &QThread::started, _persistManager, &OctreePersistThread::start);
@@ -1223,6 +1233,9 @@ void OctreeServer::beginRunning() {
     _octreeInboundPacketProcessor = new OctreeInboundPacketProcessor(this);
     _octreeInboundPacketProcessor->initialize(true);
 
+    // and the workers that send to the clients
+    _sendScheduler.reset(new OctreeSendScheduler(this, _numSendWorkers));
+
     // Convert now to tm struct for local timezone
     tm* localtm = localtime(&_started);
     const int MAX_TIME_LENGTH = 128;
@@ -1246,11 +1259,9 @@ void OctreeServer::nodeAdded(SharedNodePointer node) {
 void OctreeServer::nodeKilled(SharedNodePointer node) {
     quint64 start  = usecTimestampNow();
 
-    // Shutdown send thread
-    auto it = _sendThreads.find(node->getUUID());
-    if (it != _sendThreads.end()) {
-        auto& sendThread = *it->second;
-        sendThread.setIsShuttingDown();
+    // Shutdown sending to the node
+    if (_sendScheduler) {
+        _sendScheduler->removeClient(node->getUUID());
     }
 
     // calling this here since nodeKilled slot in ReceivedPacketProcessor can't be triggered by signals yet!!
@@ -1288,18 +1299,14 @@ void OctreeServer::aboutToFinish() {
         _octreeInboundPacketProcessor->terminating();
     }
 
-    // Shut down all the send threads
-    for (auto& it : _sendThreads) {
-        auto& sendThread = *it.second;
-        sendThread.setIsShuttingDown();
-        sendThread.terminate();
-    }
-
-    // Clear will destruct all the unique_ptr to OctreeSendThreads which will call the GenericThread's dtor
-    // which waits on the thread to be done before returning
-    _sendThreads.clear(); // Cleans up all the send threads.
+    // Stopping the scheduler waits on the send workers to be done, then releases every client's send state
+    _sendScheduler.reset();
 
     if (_persistManager) {
+        // the last save, and the domain server's copy of the entities when binary saves held it back
+        if (_persistThread.isRunning()) {
+            BLOCKING_INVOKE_METHOD(_persistManager, "aboutToFinish");
+        }
         _persistThread.quit();
     }
 
@@ -1422,6 +1429,18 @@ void OctreeServer::sendStatsPacket() {
     statsArray1["5. clients"] = getCurrentClientCount();
     statsArray1["6. threads"] = threadsStats;
 
+    if (_sendScheduler) {
+        auto schedulerStats = _sendScheduler->getStats();
+        QJsonObject sendWorkersStats;
+        sendWorkersStats["1. workers"] = schedulerStats.numWorkers;
+        sendWorkersStats["2. clients"] = schedulerStats.numClients;
+        sendWorkersStats["3. ticks"] = (double)schedulerStats.ticks;
+        sendWorkersStats["4. steals"] = (double)schedulerStats.steals;
+        sendWorkersStats["5. budgetSkips"] = (double)schedulerStats.budgetSkips;
+        sendWorkersStats["6. overruns"] = (double)schedulerStats.overruns;
+        statsArray1["7. sendWorkers"] = sendWorkersStats;
+    }
+
     // Octree Stats
     QJsonObject octreeStats;
     octreeStats["1. elementCount"] = (double)OctreeElement::getNodeCount();
@@ -1464,6 +1483,18 @@ void OctreeServer::sendStatsPacket() {
         timingArray2["3. avgLockWaitTimePerPacket"] = (double)_octreeInboundPacketProcessor->getAverageLockWaitTimePerPacket();
         timingArray2["4. avgProcessTimePerElement"] = (double)_octreeInboundPacketProcessor->getAverageProcessTimePerElement();
         timingArray2["5. avgLockWaitTimePerElement"] = (double)_octreeInboundPacketProcessor->getAverageLockWaitTimePerElement();
+
+        dataArray2["4. editBatches"] = (double)_octreeInboundPacketProcessor->getTotalEditBatches();
+        dataArray2["5. coalescedEdits"] = (double)_octreeInboundPacketProcessor->getTotalCoalescedEdits();
+
+        QJsonObject lockHoldHistogram;
+        const auto& bounds = OctreeInboundPacketProcessor::getLockHoldBucketsUsecs();
+        auto counts = _octreeInboundPacketProcessor->getLockHoldHistogram();
+        for (size_t i = 0; i < counts.size(); ++i) {
+            QString bucket = i < bounds.size() ? QString("<=%1").arg(bounds[i]) : QString(">%1").arg(bounds.back());
+            lockHoldHistogram[QString("%1. %2").arg(i + 1).arg(bucket)] = (double)counts[i];
+        }
+        timingArray2["6. lockHoldTimeHistogram"] = lockHoldHistogram;
     }
 
     QJsonObject statsObject3;
@@ -1477,6 +1508,11 @@ void OctreeServer::sendStatsPacket() {
     jsonArray["3. outbound"] = statsObject2;
     jsonArray["4. inbound"] = statsObject3;
 
+    QJsonObject subclassStats = serverSubclassStatsObject();
+    if (!subclassStats.isEmpty()) {
+        jsonArray["5. " + QString(getMyServerName()).toLower()] = subclassStats;
+    }
+
     QJsonObject statsObject;
     statsObject[QString(getMyServerName()) + "Server"] = jsonArray;
     addPacketStatsAndSendStatsPacket(statsObject);
@@ -16,6 +16,7 @@
 
 #include <QStringList>
 #include <QDateTime>
+#include <QJsonObject>
 #include <QtCore/QCoreApplication>
 
 #include <HTTPManager.h>
@@ -23,6 +24,7 @@
 #include <ThreadedAssignment.h>
 
 #include "OctreePersistThread.h"
+#include "OctreeSendScheduler.h"
 #include "OctreeSendThread.h"
 #include "OctreeServerConsts.h"
 #include "OctreeInboundPacketProcessor.h"
@@ -82,6 +84,7 @@ public:
     virtual bool hasSpecialPacketsToSend(const SharedNodePointer& node) { return false; }
     virtual int sendSpecialPackets(const SharedNodePointer& node, OctreeQueryNode* queryNode, int& packetsSent) { return 0; }
     virtual QString serverSubclassStats() { return QString(); }
+    virtual QJsonObject serverSubclassStatsObject() { return QJsonObject(); }
     virtual void trackSend(const QUuid& dataID, quint64 dataLastEdited, const QUuid& viewerNode) { }
     virtual void trackViewerGone(const QUuid& viewerNode) { }
 
@@ -141,11 +144,9 @@ private slots:
     void domainSettingsRequestComplete();
     void handleOctreeQueryPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
     void handleOctreeDataNackPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
-    void removeSendThread();
 
 protected:
     using UniqueSendThread = std::unique_ptr<OctreeSendThread>;
-    using SendThreads = std::unordered_map<QUuid, UniqueSendThread>;
     
     virtual OctreePointer createTree() = 0;
     bool readOptionBool(const QString& optionName, const QJsonObject& settingsSectionObject, bool& result);
@@ -164,7 +165,7 @@ protected:
 
     void beginRunning();
     
-    UniqueSendThread createSendThread(const SharedNodePointer& node);
+    OctreeSendScheduler::SendThreadPointer createSendThread(const SharedNodePointer& node);
     virtual UniqueSendThread newSendThread(const SharedNodePointer& node) = 0;
 
     int _argc;
@@ -183,6 +184,7 @@ protected:
     QString _persistAsFileType;
     int _packetsPerClientPerInterval;
     int _packetsTotalPerInterval;
+    int _numSendWorkers;
     OctreePointer _tree; // this IS a reaveraging tree
     bool _wantPersist;
     bool _debugSending;
@@ -194,6 +196,7 @@ protected:
     QThread _persistThread;
 
     std::chrono::milliseconds _persistInterval;
+    std::chrono::milliseconds _persistDomainServerInterval;
     bool _persistFileDownload;
     int _maxBackupVersions;
 
@@ -201,7 +204,7 @@ protected:
     quint64 _startedUSecs;
     QString _safeServerName;
     
-    SendThreads _sendThreads;
+    std::unique_ptr<OctreeSendScheduler> _sendScheduler;
 
     static int _clientCount;
     static SimpleMovingAverage _averageLoopTime;
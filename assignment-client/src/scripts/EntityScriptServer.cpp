@@ -13,6 +13,8 @@
 
 #include <mutex>
 
+#include <QtCore/QJsonArray>
+
 #include <AudioConstants.h>
 #include <AudioInjectorManager.h>
 #include <ClientServerUtils.h>
@@ -125,7 +127,8 @@ void EntityScriptServer::handleEntityScriptGetStatusPacket(QSharedPointer<Receiv
         replyPacketList->writePrimitive(messageID);
 
         EntityScriptDetails details;
-        if (_entitiesScriptEngine->getEntityScriptDetails(entityID, details)) {
+        auto engine = getEngineForEntity(entityID);
+        if (engine && engine->getEntityScriptDetails(entityID, details)) {
             replyPacketList->writePrimitive(true);
             replyPacketList->writePrimitive(details.status);
             replyPacketList->writeString(details.errorInfo);
@@ -156,6 +159,22 @@ void EntityScriptServer::handleSettings() {
 
     static const QString MAX_ENTITY_PPS_OPTION = "max_total_entity_pps";
     static const QString ENTITY_PPS_PER_SCRIPT = "entity_pps_per_script";
+    static const QString SCRIPT_ENGINE_SHARDS_OPTION = "script_engine_shards";
+
+    if (entityScriptServerSettings.contains(SCRIPT_ENGINE_SHARDS_OPTION)) {
+        int numScriptShards = std::max(1, entityScriptServerSettings[SCRIPT_ENGINE_SHARDS_OPTION].toInt());
+        if (numScriptShards != _numScriptShards) {
+            _numScriptShards = numScriptShards;
+            if (_hasLoadedEntityScripts) {
+                // the scripts can't move to another engine without being reloaded
+                qWarning() << "Entity script engine shards will change to" << _numScriptShards << "on restart.";
+            } else if (_entityScriptShards && !_shuttingDown) {
+                qDebug() << "Running entity scripts on" << _numScriptShards << "script engine shards.";
+                stopEntitiesScriptEngines();
+                resetEntitiesScriptEngines();
+            }
+        }
+    }
 
     if (!entityScriptServerSettings.contains(MAX_ENTITY_PPS_OPTION) || !entityScriptServerSettings.contains(ENTITY_PPS_PER_SCRIPT)) {
         qWarning() << "Received settings from the domain-server with no max_total_entity_pps or entity_pps_per_script properties.";
@@ -170,7 +189,7 @@ void EntityScriptServer::handleSettings() {
 }
 
 void EntityScriptServer::updateEntityPPS() {
-    int numRunningScripts = _entitiesScriptEngine->getNumRunningEntityScripts();
+    int numRunningScripts = _entityScriptShards ? _entityScriptShards->getNumRunningEntityScripts() : 0;
     int pps;
     if (std::numeric_limits<int>::max() / _entityPPSPerScript < numRunningScripts) {
         qWarning() << QString("Integer multiplication would overflow, clamping to maxint: %1 * %2").arg(numRunningScripts).arg(_entityPPSPerScript);
@@ -231,7 +250,7 @@ void EntityScriptServer::pushLogs() {
 
 void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
 
-    if (_entitiesScriptEngine && _entityViewer.getTree() && !_shuttingDown) {
+    if (_entityScriptShards && _entityViewer.getTree() && !_shuttingDown) {
         auto entityID = QUuid::fromRfc4122(receivedMessage->read(NUM_BYTES_RFC4122_UUID));
 
         auto method = receivedMessage->readString();
@@ -245,7 +264,7 @@ void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<Recei
             params << paramString;
         }
 
-        _entitiesScriptEngine->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+        _entityScriptShards->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
     }
 }
 
@@ -276,8 +295,8 @@ void EntityScriptServer::run() {
         NodeType::EntityServer, NodeType::MessagesMixer, NodeType::AssetServer
     });
 
-    // Setup Script Engine
-    resetEntitiesScriptEngine();
+    // Setup Script Engines
+    resetEntitiesScriptEngines();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     entityScriptingInterface->init();
@@ -439,7 +458,7 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
     }
 }
 
-void EntityScriptServer::resetEntitiesScriptEngine() {
+ScriptEnginePointer EntityScriptServer::createEntitiesScriptEngine(int shard) {
     auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
     auto newEngine = scriptEngineFactory(ScriptEngine::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
 
@@ -456,48 +475,80 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
     connect(newEngine.data(), &ScriptEngine::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
     connect(newEngine.data(), &ScriptEngine::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
 
-    connect(newEngine.data(), &ScriptEngine::update, this, [this] {
-        _entityViewer.queryOctree();
-        _entityViewer.getTree()->preUpdate();
-        _entityViewer.getTree()->update();
-    });
+    // the first shard drives the entity tree for all of them
+    if (shard == 0) {
+        connect(newEngine.data(), &ScriptEngine::update, this, [this] {
+            _entityViewer.queryOctree();
+            _entityViewer.getTree()->preUpdate();
+            _entityViewer.getTree()->update();
+        });
+    }
+
+    connect(newEngine.data(), &ScriptEngine::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
 
     scriptEngines->runScriptInitializers(newEngine);
     newEngine->runInThread();
-    auto newEngineSP = qSharedPointerCast<EntitiesScriptEngineProvider>(newEngine);
-    DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(newEngineSP);
+    return newEngine;
+}
+
+void EntityScriptServer::resetEntitiesScriptEngines() {
+    if (_entityScriptShards) {
+        for (int shard = 0; shard < _entityScriptShards->getNumShards(); shard++) {
+            disconnect(_entityScriptShards->getEngine(shard).data(), &ScriptEngine::entityScriptDetailsUpdated,
+                       this, &EntityScriptServer::updateEntityPPS);
+        }
+    }
 
-    if (_entitiesScriptEngine) {
-        disconnect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-                   this, &EntityScriptServer::updateEntityPPS);
+    std::vector<ScriptEnginePointer> engines;
+    for (int shard = 0; shard < _numScriptShards; shard++) {
+        engines.push_back(createEntitiesScriptEngine(shard));
     }
+    _entityScriptShards = QSharedPointer<EntityScriptShards>::create(engines);
+    _lastShardCPUTimes.assign(_numScriptShards, 0);
+    _hasLoadedEntityScripts = false;
 
-    _entitiesScriptEngine.swap(newEngine);
-    connect(_entitiesScriptEngine.data(), &ScriptEngine::entityScriptDetailsUpdated,
-            this, &EntityScriptServer::updateEntityPPS);
+    // calls between entity scripts go through the shards, to the thread of the shard that runs the script
+    DependencyManager::get<EntityScriptingInterface>()->setEntitiesScriptEngine(_entityScriptShards);
 }
 
+ScriptEnginePointer EntityScriptServer::getEngineForEntity(const EntityItemID& entityID) const {
+    return _entityScriptShards ? _entityScriptShards->getEngineForEntity(entityID) : ScriptEnginePointer();
+}
 
-void EntityScriptServer::clear() {
-    // unload and stop the engine
-    if (_entitiesScriptEngine) {
-        // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
-        _entitiesScriptEngine->unloadAllEntityScripts();
-        _entitiesScriptEngine->stop();
-        _entitiesScriptEngine->waitTillDoneRunning();
+void EntityScriptServer::stopEntitiesScriptEngines() {
+    if (!_entityScriptShards) {
+        return;
     }
 
+    // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
+    for (int shard = 0; shard < _entityScriptShards->getNumShards(); shard++) {
+        auto& engine = _entityScriptShards->getEngine(shard);
+        engine->unloadAllEntityScripts();
+        engine->stop();
+    }
+    for (int shard = 0; shard < _entityScriptShards->getNumShards(); shard++) {
+        _entityScriptShards->getEngine(shard)->waitTillDoneRunning();
+    }
+}
+
+void EntityScriptServer::clear() {
+    // unload and stop the engines
+    stopEntitiesScriptEngines();
+
     _entityViewer.clear();
 
-    // reset the engine
+    // reset the engines
     if (!_shuttingDown) {
-        resetEntitiesScriptEngine();
+        resetEntitiesScriptEngines();
     }
 }
 
 void EntityScriptServer::shutdownScriptEngine() {
-    if (_entitiesScriptEngine) {
-        _entitiesScriptEngine->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+    if (_entityScriptShards) {
+        for (int shard = 0; shard < _entityScriptShards->getNumShards(); shard++) {
+            // disconnect all slots/signals from the script engine, except essential
+            _entityScriptShards->getEngine(shard)->disconnectNonEssentialSignals();
+        }
     }
     _shuttingDown = true;
 
@@ -506,7 +557,7 @@ void EntityScriptServer::shutdownScriptEngine() {
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
     scriptEngines->shutdownScripting();
 
-    _entitiesScriptEngine.clear();
+    _entityScriptShards.clear();
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     // our entity tree is going to go away so tell that to the EntityScriptingInterface
@@ -524,8 +575,8 @@ void EntityScriptServer::addingEntity(const EntityItemID& entityID) {
 }
 
 void EntityScriptServer::deletingEntity(const EntityItemID& entityID) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
-        _entitiesScriptEngine->unloadEntityScript(entityID, true);
+    if (_entityViewer.getTree() && !_shuttingDown && _entityScriptShards) {
+        getEngineForEntity(entityID)->unloadEntityScript(entityID, true);
     }
 }
 
@@ -536,20 +587,22 @@ void EntityScriptServer::entityServerScriptChanging(const EntityItemID& entityID
 }
 
 void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, bool forceRedownload) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptEngine) {
+    if (_entityViewer.getTree() && !_shuttingDown && _entityScriptShards) {
 
+        auto engine = getEngineForEntity(entityID);
         EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
         EntityScriptDetails details;
-        bool isRunning = _entitiesScriptEngine->getEntityScriptDetails(entityID, details);
+        bool isRunning = engine->getEntityScriptDetails(entityID, details);
         if (entity && (forceRedownload || !isRunning || details.scriptText != entity->getServerScripts())) {
             if (isRunning) {
-                _entitiesScriptEngine->unloadEntityScript(entityID, true);
+                engine->unloadEntityScript(entityID, true);
             }
 
             QString scriptUrl = entity->getServerScripts();
             if (!scriptUrl.isEmpty()) {
                 scriptUrl = DependencyManager::get<ResourceManager>()->normalizeURL(scriptUrl);
-                _entitiesScriptEngine->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                engine->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                _hasLoadedEntityScripts = true;
             }
         }
     }
@@ -566,9 +619,29 @@ void EntityScriptServer::sendStatsPacket() {
 
     QJsonObject scriptEngineStats;
     int numberRunningScripts = 0;
-    const auto scriptEngine = _entitiesScriptEngine;
-    if (scriptEngine) {
-        numberRunningScripts = scriptEngine->getNumRunningEntityScripts();
+    const auto entityScriptShards = _entityScriptShards;
+    if (entityScriptShards) {
+        numberRunningScripts = entityScriptShards->getNumRunningEntityScripts();
+
+        // the CPU use of each shard's thread since the last stats, and the calls queued to it
+        quint64 now = usecTimestampNow();
+        float statsPeriod = _lastStatsTime > 0 ? (float)(now - _lastStatsTime) / USECS_PER_SECOND : 0.0f;
+        _lastStatsTime = now;
+
+        QJsonArray shardsArray;
+        auto shardStats = entityScriptShards->getShardStats();
+        for (size_t shard = 0; shard < shardStats.size(); shard++) {
+            auto& stats = shardStats[shard];
+            quint64 cpuTime = stats.cpuTime - std::min(stats.cpuTime, _lastShardCPUTimes[shard]);
+            _lastShardCPUTimes[shard] = stats.cpuTime;
+
+            QJsonObject shardObject;
+            shardObject["running_scripts"] = stats.runningScripts;
+            shardObject["cpu_usage"] = statsPeriod > 0.0f ? (float)cpuTime / USECS_PER_SECOND / statsPeriod : 0.0f;
+            shardObject["backlog"] = stats.backlog;
+            shardsArray.append(shardObject);
+        }
+        scriptEngineStats["shards"] = shardsArray;
     }
     scriptEngineStats["number_running_scripts"] = numberRunningScripts;
     statsObject["script_engine_stats"] = scriptEngineStats;
@@ -24,6 +24,7 @@
 #include <SimpleEntitySimulation.h>
 #include <ThreadedAssignment.h>
 #include "../entities/EntityTreeHeadlessViewer.h"
+#include "EntityScriptShards.h"
 
 class EntityScriptServer : public ThreadedAssignment {
     Q_OBJECT
@@ -61,7 +62,10 @@ private:
     void negotiateAudioFormat();
     void selectAudioFormat(const QString& selectedCodecName);
 
-    void resetEntitiesScriptEngine();
+    void resetEntitiesScriptEngines();
+    ScriptEnginePointer createEntitiesScriptEngine(int shard);
+    ScriptEnginePointer getEngineForEntity(const EntityItemID& entityID) const;
+    void stopEntitiesScriptEngines();
     void clear();
     void shutdownScriptEngine();
 
@@ -75,7 +79,13 @@ private:
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    ScriptEnginePointer _entitiesScriptEngine;
+    QSharedPointer<EntityScriptShards> _entityScriptShards;
+    int _numScriptShards { DEFAULT_SCRIPT_ENGINE_SHARDS };
+    bool _hasLoadedEntityScripts { false };
+
+    // the shard CPU times at the last stats packet, to report the CPU used since
+    std::vector<quint64> _lastShardCPUTimes;
+    quint64 _lastStatsTime { 0 };
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
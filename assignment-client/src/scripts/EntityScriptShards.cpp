@@ -0,0 +1,88 @@
+//
+//  EntityScriptShards.cpp
+//  assignment-client/src/scripts
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityScriptShards.h"
+
+#include <QThread>
+#include <QTimer>
+
+#include <SharedUtil.h>
+
+EntityScriptShards::EntityScriptShards(const std::vector<ScriptEnginePointer>& engines) {
+    for (auto& engine : engines) {
+        auto shard = std::make_shared<Shard>();
+        shard->engine = engine;
+
+        // sample the CPU time of the engine's thread once a frame, from that thread
+        std::weak_ptr<Shard> weakShard = shard;
+        QObject::connect(engine.data(), &ScriptEngine::update, engine.data(), [weakShard] {
+            if (auto shard = weakShard.lock()) {
+                shard->cpuTime = usecThreadCPUTimeNow();
+            }
+        }, Qt::DirectConnection);
+
+        _shards.push_back(shard);
+    }
+}
+
+const EntityScriptShards::ShardPointer& EntityScriptShards::getShardForEntity(const EntityItemID& entityID) const {
+    return _shards[qHash(entityID) % _shards.size()];
+}
+
+const ScriptEnginePointer& EntityScriptShards::getEngineForEntity(const EntityItemID& entityID) const {
+    return getShardForEntity(entityID)->engine;
+}
+
+void EntityScriptShards::callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                                const QStringList& params, const QUuid& remoteCallerID) {
+    auto& shard = getShardForEntity(entityID);
+
+    // a call from the shard's own thread, as with a single shard, runs now like it would on the engine itself
+    if (QThread::currentThread() == shard->engine->thread()) {
+        shard->engine->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+        return;
+    }
+
+    shard->backlog++;
+
+    // dropped if the shards are replaced before it runs
+    std::weak_ptr<Shard> weakShard = shard;
+    QTimer::singleShot(0, shard->engine.data(), [weakShard, entityID, methodName, params, remoteCallerID] {
+        if (auto shard = weakShard.lock()) {
+            shard->backlog--;
+            shard->engine->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+        }
+    });
+}
+
+QFuture<QVariant> EntityScriptShards::getLocalEntityScriptDetails(const EntityItemID& entityID) {
+    return getEngineForEntity(entityID)->getLocalEntityScriptDetails(entityID);
+}
+
+int EntityScriptShards::getNumRunningEntityScripts() const {
+    int numRunningScripts = 0;
+    for (auto& shard : _shards) {
+        numRunningScripts += shard->engine->getNumRunningEntityScripts();
+    }
+    return numRunningScripts;
+}
+
+std::vector<EntityScriptShards::ShardStats> EntityScriptShards::getShardStats() const {
+    std::vector<ShardStats> shardStats;
+    for (auto& shard : _shards) {
+        ShardStats stats;
+        stats.runningScripts = shard->engine->getNumRunningEntityScripts();
+        stats.cpuTime = shard->cpuTime;
+        stats.backlog = shard->backlog;
+        shardStats.push_back(stats);
+    }
+    return shardStats;
+}
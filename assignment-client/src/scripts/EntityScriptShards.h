@@ -0,0 +1,61 @@
+//
+//  EntityScriptShards.h
+//  assignment-client/src/scripts
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityScriptShards_h
+#define hifi_EntityScriptShards_h
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <EntitiesScriptEngineProvider.h>
+#include <ScriptEngine.h>
+
+static const int DEFAULT_SCRIPT_ENGINE_SHARDS = 1;
+
+// The script engines of the entity script server, each on its own thread, with the entity scripts spread over them by
+// entity ID. Calls to an entity script from another thread are queued to the thread of the engine that runs it, so a
+// call from one shard's script to another's doesn't wait on the other shard.
+class EntityScriptShards : public EntitiesScriptEngineProvider {
+public:
+    struct ShardStats {
+        int runningScripts { 0 };
+        quint64 cpuTime { 0 }; // usecs used by the shard's thread, as of its last update
+        int backlog { 0 }; // calls queued to the shard from other threads and not run yet
+    };
+
+    EntityScriptShards(const std::vector<ScriptEnginePointer>& engines);
+
+    int getNumShards() const { return (int)_shards.size(); }
+    const ScriptEnginePointer& getEngine(int shard) const { return _shards[shard]->engine; }
+    const ScriptEnginePointer& getEngineForEntity(const EntityItemID& entityID) const;
+
+    void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                const QStringList& params = QStringList(), const QUuid& remoteCallerID = QUuid()) override;
+    QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID) override;
+
+    int getNumRunningEntityScripts() const;
+    std::vector<ShardStats> getShardStats() const;
+
+private:
+    struct Shard {
+        ScriptEnginePointer engine;
+        std::atomic<quint64> cpuTime { 0 };
+        std::atomic<int> backlog { 0 };
+    };
+    using ShardPointer = std::shared_ptr<Shard>;
+
+    const ShardPointer& getShardForEntity(const EntityItemID& entityID) const;
+
+    std::vector<ShardPointer> _shards;
+};
+
+#endif // hifi_EntityScriptShards_h
@@ -15,6 +15,14 @@ macro(SETUP_HIFI_LIBRARY)
   file(GLOB_RECURSE LIB_SRCS "src/*.h" "src/*.cpp" "src/*.c" "src/*.qrc")
   list(APPEND ${TARGET_NAME}_SRCS ${LIB_SRCS})
 
+  # add compiler flags to SSE4.1 source files, MSVC needs no flag for SSE4.1 intrinsics
+  file(GLOB_RECURSE SSE41_SRCS "src/sse41/*.cpp" "src/sse41/*.c")
+  foreach(SRC ${SSE41_SRCS})
+    if (APPLE OR (UNIX AND NOT ANDROID))
+      set_source_files_properties(${SRC} PROPERTIES COMPILE_FLAGS -msse4.1)
+    endif()
+  endforeach()
+
   # add compiler flags to AVX source files
   file(GLOB_RECURSE AVX_SRCS "src/avx/*.cpp" "src/avx/*.c")
   foreach(SRC ${AVX_SRCS})
@@ -11,6 +11,7 @@
 
 #include "DomainServer.h"
 
+#include <algorithm>
 #include <memory>
 #include <random>
 #include <iostream>
@@ -765,6 +766,7 @@ void DomainServer::setupNodeListAndAssignments() {
     packetReceiver.registerListener(PacketType::DomainListRequest, this, "processListRequestPacket");
     packetReceiver.registerListener(PacketType::DomainServerPathQuery, this, "processPathQueryPacket");
     packetReceiver.registerListener(PacketType::NodeJsonStats, this, "processNodeJSONStatsPacket");
+    packetReceiver.registerListener(PacketType::NodeMetrics, this, "processNodeMetricsPacket");
     packetReceiver.registerListener(PacketType::DomainDisconnectRequest, this, "processNodeDisconnectRequestPacket");
     packetReceiver.registerListener(PacketType::AvatarZonePresence, this, "processAvatarZonePresencePacket");
 
@@ -1099,7 +1101,11 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     // client-side send time of last connect/domain list request
     nodeData->setLastDomainCheckinTimestamp(nodeRequestData.lastPingTimestamp);
 
-    sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false);
+    // the sockets may have changed the entry other nodes get for this one
+    nodeData->updateDomainListEntry(*sendingNode);
+
+    sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false,
+                         nodeRequestData.acknowledgedListVersion);
 }
 
 bool DomainServer::isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
@@ -1177,20 +1183,79 @@ void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 reques
         newNode->setIsReplicated(true);
     }
 
+    nodeData->updateDomainListEntry(*newNode);
+
     // send out this node to our other connected nodes
     broadcastNewNode(newNode);
 }
 
-void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const HifiSockAddr &senderSockAddr, bool newConnection) {
+void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const HifiSockAddr &senderSockAddr,
+                                        bool newConnection, quint32 acknowledgedListVersion) {
     const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID +
         NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID + 4;
 
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    // gather the nodes this one should hear about, and the revision of the entry it would get for each
+    std::vector<SharedNodePointer> listedNodes;
+    if (nodeData->getNodeInterestSet().size() > 0 && nodeData->isAuthenticated()) {
+        limitedNodeList->eachNode([this, node, &listedNodes](const SharedNodePointer& otherNode) {
+            if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
+                auto otherNodeData = static_cast<DomainServerNodeData*>(otherNode->getLinkedData());
+                if (otherNodeData && otherNodeData->getDomainListEntry().isEmpty()) {
+                    otherNodeData->updateDomainListEntry(*otherNode);
+                }
+                listedNodes.push_back(otherNode);
+            }
+        });
+    }
+
+    // a node that holds the last list we sent it only needs what changed since, anything else gets the whole list
+    auto& sentEntries = nodeData->getSentDomainListEntries();
+    quint32 sentVersion = nodeData->getSentDomainListVersion();
+    bool sendChanges = !newConnection && acknowledgedListVersion != 0 && acknowledgedListVersion == sentVersion;
+
+    std::vector<SharedNodePointer> changedNodes;
+    QList<QUuid> removedNodes;
+    QHash<QUuid, quint64> listedEntries;
+    listedEntries.reserve((int)listedNodes.size());
+
+    for (const auto& otherNode : listedNodes) {
+        auto otherNodeData = static_cast<DomainServerNodeData*>(otherNode->getLinkedData());
+        quint64 revision = otherNodeData ? otherNodeData->getDomainListEntryRevision() : 0;
+        listedEntries.insert(otherNode->getUUID(), revision);
+
+        if (!sendChanges || revision == 0 || sentEntries.value(otherNode->getUUID()) != revision) {
+            changedNodes.push_back(otherNode);
+        }
+    }
+
+    if (sendChanges) {
+        for (auto it = sentEntries.cbegin(); it != sentEntries.cend(); ++it) {
+            if (!listedEntries.contains(it.key())) {
+                removedNodes.push_back(it.key());
+            }
+        }
+    }
+
+    // the version only moves when the node has something new to acknowledge
+    quint32 baseVersion = sendChanges ? sentVersion : 0;
+    quint32 listVersion = sentVersion;
+    if (!sendChanges || !changedNodes.empty() || !removedNodes.empty()) {
+        listVersion = sentVersion + 1;
+        if (listVersion == 0) {
+            // 0 is the version of a node that holds no list
+            listVersion = 1;
+        }
+    }
+    nodeData->setSentDomainListVersion(listVersion);
+    sentEntries = listedEntries;
+
     // setup the extended header for the domain list packets
     // this data is at the beginning of each of the domain list packets
     QByteArray extendedHeader(NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES, 0);
     QDataStream extendedHeaderStream(&extendedHeader, QIODevice::WriteOnly);
-    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
-    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
     extendedHeaderStream << limitedNodeList->getSessionUUID();
     extendedHeaderStream << limitedNodeList->getSessionLocalID();
@@ -1202,35 +1267,29 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     extendedHeaderStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
     extendedHeaderStream << quint64(duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count()) - requestPacketReceiveTime;
     extendedHeaderStream << newConnection;
+    extendedHeaderStream << listVersion << baseVersion << (quint32)changedNodes.size() << removedNodes;
     auto domainListPackets = NLPacketList::create(PacketType::DomainList, extendedHeader);
 
     // always send the node their own UUID back
     QDataStream domainListStream(domainListPackets.get());
 
-    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
-    auto& nodeInterestSet = nodeData->getNodeInterestSet();
-
-    if (nodeInterestSet.size() > 0) {
-
-        // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
-        if (nodeData->isAuthenticated()) {
-            // if this authenticated node has any interest types, send back those nodes as well
-            limitedNodeList->eachNode([this, node, &domainListPackets, &domainListStream](const SharedNodePointer& otherNode) {
-                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
-                    // since we're about to add a node to the packet we start a segment
-                    domainListPackets->startSegment();
+    for (const auto& otherNode : changedNodes) {
+        // since we're about to add a node to the packet we start a segment
+        domainListPackets->startSegment();
 
-                    // don't send avatar nodes to other avatars, that will come from avatar mixer
-                    domainListStream << *otherNode.data();
+        auto otherNodeData = static_cast<DomainServerNodeData*>(otherNode->getLinkedData());
+        if (otherNodeData) {
+            const QByteArray& entry = otherNodeData->getDomainListEntry();
+            domainListStream.writeRawData(entry.constData(), entry.size());
+        } else {
+            domainListStream << *otherNode.data();
+        }
 
-                    // pack the secret that these two nodes will use to communicate with each other
-                    domainListStream << connectionSecretForNodes(node, otherNode);
+        // pack the secret that these two nodes will use to communicate with each other
+        domainListStream << connectionSecretForNodes(node, otherNode);
 
-                    // we've added the node we wanted so end the segment now
-                    domainListPackets->endSegment();
-                }
-            });
-        }
+        // we've added the node we wanted so end the segment now
+        domainListPackets->endSegment();
     }
 
     // send an empty list to the node, in case there were no other nodes
@@ -1240,19 +1299,17 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     limitedNodeList->sendPacketList(std::move(domainListPackets), *node);
 }
 
-QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
-    DomainServerNodeData* nodeAData = static_cast<DomainServerNodeData*>(nodeA->getLinkedData());
-    DomainServerNodeData* nodeBData = static_cast<DomainServerNodeData*>(nodeB->getLinkedData());
+static quint32 connectionSecretKey(Node::LocalID localIDA, Node::LocalID localIDB) {
+    return ((quint32)std::min(localIDA, localIDB) << 16) | std::max(localIDA, localIDB);
+}
 
-    if (nodeAData && nodeBData) {
-        QUuid& secretUUID = nodeAData->getSessionSecretHash()[nodeB->getUUID()];
+QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
+    if (nodeA->getLinkedData() && nodeB->getLinkedData()) {
+        QUuid& secretUUID = _connectionSecrets[connectionSecretKey(nodeA->getLocalID(), nodeB->getLocalID())];
 
         if (secretUUID.isNull()) {
             // generate a new secret UUID these two nodes can use
             secretUUID = QUuid::createUuid();
-
-            // set it on the other Node's sessionSecretHash
-            static_cast<DomainServerNodeData*>(nodeBData)->getSessionSecretHash().insert(nodeA->getUUID(), secretUUID);
         }
 
         return secretUUID;
@@ -1864,6 +1921,16 @@ void DomainServer::processNodeJSONStatsPacket(QSharedPointer<ReceivedMessage> pa
     }
 }
 
+void DomainServer::processNodeMetricsPacket(QSharedPointer<ReceivedMessage> packetList, SharedNodePointer sendingNode) {
+    auto nodeData = static_cast<DomainServerNodeData*>(sendingNode->getLinkedData());
+    if (nodeData && !nodeData->getMetrics().readChanges(packetList->getMessage())) {
+        // the set refuses changes until it reads all of the metrics again, ask the node for them
+        qCWarning(domain_server) << "Dropped the unreadable metrics of" << sendingNode->getUUID();
+        auto resendRequest = NLPacket::create(PacketType::NodeMetricsResendRequest, 0);
+        DependencyManager::get<LimitedNodeList>()->sendPacket(std::move(resendRequest), *sendingNode);
+    }
+}
+
 QJsonObject DomainServer::jsonForSocket(const HifiSockAddr& socket) {
     QJsonObject socketJSON;
 
@@ -1965,6 +2032,7 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
 
     const QString URI_ASSIGNMENT = "/assignment";
     const QString URI_NODES = "/nodes";
+    const QString URI_METRICS = "/metrics";
     const QString URI_SETTINGS = "/settings";
     const QString URI_CONTENT_UPLOAD = "/content/upload";
     const QString URI_RESTART = "/restart";
@@ -2167,6 +2235,29 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
             // send the response
             connection->respond(HTTPConnection::StatusCode200, nodesDocument.toJson(), qPrintable(JSON_MIME_TYPE));
 
+            return true;
+        } else if (url.path() == URI_METRICS) {
+            // the metrics of every node, in the Prometheus text format
+            const QString PROMETHEUS_MIME_TYPE = "text/plain; version=0.0.4";
+
+            std::vector<std::pair<QString, const MetricSet*>> labelledMetrics;
+            nodeList->eachNode([&labelledMetrics](const SharedNodePointer& node) {
+                auto nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+                if (nodeData && !nodeData->getMetrics().isEmpty()) {
+                    QString nodeType = NodeType::getNodeTypeName(node->getType()).toLower().replace(' ', '-');
+                    QString labels = QString("node_type=\"%1\",node_id=\"%2\"")
+                        .arg(nodeType, uuidStringWithoutCurlyBraces(node->getUUID()));
+                    labelledMetrics.emplace_back(labels, &nodeData->getMetrics());
+                }
+            });
+
+            QByteArray metricsText;
+            QTextStream metricsStream(&metricsText);
+            MetricSet::writePrometheus(metricsStream, labelledMetrics);
+            metricsStream.flush();
+
+            connection->respond(HTTPConnection::StatusCode200, metricsText, qPrintable(PROMETHEUS_MIME_TYPE));
+
             return true;
         } else if (url.path() == URI_API_BACKUPS) {
             auto deferred = makePromise("getAllBackupsAndStatus");
@@ -2248,9 +2339,17 @@ bool DomainServer::handleHTTPRequest(HTTPConnection* connection, const QUrl& url
                 // see if we have a node that matches this ID
                 SharedNodePointer matchingNode = nodeList->nodeWithUUID(matchingUUID);
                 if (matchingNode) {
+                    auto nodeData = static_cast<DomainServerNodeData*>(matchingNode->getLinkedData());
+
+                    // assignment clients only build their JSON stats while someone looks at them, the page
+                    // polls this so the stats follow after the first request
+                    if (matchingNode->getType() != NodeType::Agent && nodeData->shouldRequestJSONStats(usecTimestampNow())) {
+                        auto statsRequest = NLPacket::create(PacketType::NodeJsonStatsRequest, 0);
+                        nodeList->sendPacket(std::move(statsRequest), *matchingNode);
+                    }
+
                     // create a QJsonDocument with the stats QJsonObject
-                    QJsonObject statsObject =
-                        static_cast<DomainServerNodeData*>(matchingNode->getLinkedData())->getStatsJSONObject();
+                    QJsonObject statsObject = nodeData->getStatsJSONObject();
 
                     // add the node type to the JSON data for output purposes
                     statsObject["node_type"] = NodeType::getNodeTypeName(matchingNode->getType()).toLower().replace(' ', '-');
@@ -3066,6 +3165,11 @@ void DomainServer::updateReplicatedNodes() {
                     << otherNode->getPermissions().getVerifiedUserName() << otherNode->getUUID();
             }
             otherNode->setIsReplicated(shouldReplicate);
+
+            auto nodeData = static_cast<DomainServerNodeData*>(otherNode->getLinkedData());
+            if (nodeData) {
+                nodeData->updateDomainListEntry(*otherNode);
+            }
         }
     );
 }
@@ -3110,11 +3214,14 @@ void DomainServer::nodeKilled(SharedNodePointer node) {
             }
         }
 
-        // cleanup the connection secrets that we set up for this node (on the other nodes)
-        foreach (const QUuid& otherNodeSessionUUID, nodeData->getSessionSecretHash().keys()) {
-            SharedNodePointer otherNode = DependencyManager::get<LimitedNodeList>()->nodeWithUUID(otherNodeSessionUUID);
-            if (otherNode) {
-                static_cast<DomainServerNodeData*>(otherNode->getLinkedData())->getSessionSecretHash().remove(node->getUUID());
+        // cleanup the connection secrets that we set up for this node, its local ID may be handed out again, and the
+        // nodes it shared them with may already be gone from the list
+        Node::LocalID localID = node->getLocalID();
+        for (auto it = _connectionSecrets.begin(); it != _connectionSecrets.end();) {
+            if ((Node::LocalID)(it->first >> 16) == localID || (Node::LocalID)(it->first & 0xFFFF) == localID) {
+                it = _connectionSecrets.erase(it);
+            } else {
+                ++it;
             }
         }
 
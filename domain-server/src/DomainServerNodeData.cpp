@@ -17,6 +17,7 @@
 #include <QtCore/QJsonObject>
 #include <QtCore/QVariant>
 
+#include <NumericalConstants.h>
 #include <udt/PacketHeaders.h>
 
 DomainServerNodeData::StringPairHash DomainServerNodeData::_overrideHash;
@@ -25,12 +26,37 @@ DomainServerNodeData::DomainServerNodeData() {
     _paymentIntervalTimer.start();
 }
 
+void DomainServerNodeData::updateDomainListEntry(const Node& node) {
+    // revisions are unique across nodes, so a node replaced under the same UUID still reads as changed
+    static quint64 nextDomainListEntryRevision { 1 };
+
+    QByteArray entry;
+    QDataStream entryStream(&entry, QIODevice::WriteOnly);
+    entryStream << node;
+
+    if (entry != _domainListEntry) {
+        _domainListEntry = entry;
+        _domainListEntryRevision = nextDomainListEntryRevision++;
+    }
+}
+
 void DomainServerNodeData::updateJSONStats(QByteArray statsByteArray) {
     auto document = QJsonDocument::fromBinaryData(statsByteArray);
     Q_ASSERT(document.isObject());
     _statsJSONObject = overrideValuesIfNeeded(document.object());
 }
 
+bool DomainServerNodeData::shouldRequestJSONStats(quint64 now) {
+    // well within the time the node keeps sending them for, so that a page being watched doesn't miss an update
+    static const quint64 JSON_STATS_REQUEST_INTERVAL_USECS = 2 * USECS_PER_SECOND;
+
+    if (now - _lastJSONStatsRequest < JSON_STATS_REQUEST_INTERVAL_USECS) {
+        return false;
+    }
+    _lastJSONStatsRequest = now;
+    return true;
+}
+
 QJsonObject DomainServerNodeData::overrideValuesIfNeeded(const QJsonObject& newStats) {
     QJsonObject result;
     for (auto it = newStats.constBegin(); it != newStats.constEnd(); ++it) {
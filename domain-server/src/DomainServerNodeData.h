@@ -18,7 +18,9 @@
 #include <QtCore/QJsonObject>
 
 #include <HifiSockAddr.h>
+#include <MetricRegistry.h>
 #include <NLPacket.h>
+#include <Node.h>
 #include <NodeData.h>
 #include <NodeType.h>
 
@@ -30,6 +32,11 @@ public:
 
     void updateJSONStats(QByteArray statsByteArray);
 
+    MetricSet& getMetrics() { return _metrics; }
+
+    // the node only builds its JSON stats for a while after it was asked for them
+    bool shouldRequestJSONStats(quint64 now);
+
     void setAssignmentUUID(const QUuid& assignmentUUID) { _assignmentUUID = assignmentUUID; }
     const QUuid& getAssignmentUUID() const { return _assignmentUUID; }
 
@@ -47,7 +54,16 @@ public:
     void setIsAuthenticated(bool isAuthenticated) { _isAuthenticated = isAuthenticated; }
     bool isAuthenticated() const { return _isAuthenticated; }
 
-    QHash<QUuid, QUuid>& getSessionSecretHash() { return _sessionSecretHash; }
+    // this node as it appears in the domain lists of other nodes, re-serialized by updateDomainListEntry
+    // and given a new revision only when it changes
+    void updateDomainListEntry(const Node& node);
+    const QByteArray& getDomainListEntry() const { return _domainListEntry; }
+    quint64 getDomainListEntryRevision() const { return _domainListEntryRevision; }
+
+    // the version of the last domain list sent to this node, and the entry revision of every node it held
+    quint32 getSentDomainListVersion() const { return _sentDomainListVersion; }
+    void setSentDomainListVersion(quint32 version) { _sentDomainListVersion = version; }
+    QHash<QUuid, quint64>& getSentDomainListEntries() { return _sentDomainListEntries; }
 
     const NodeSet& getNodeInterestSet() const { return _nodeInterestSet; }
     void setNodeInterestSet(const NodeSet& nodeInterestSet) { _nodeInterestSet = nodeInterestSet; }
@@ -80,7 +96,6 @@ private:
     QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
     QJsonArray overrideValuesIfNeeded(const QJsonArray& newStats);
     
-    QHash<QUuid, QUuid> _sessionSecretHash;
     QUuid _assignmentUUID;
     QUuid _walletUUID;
     QString _username;
@@ -88,6 +103,8 @@ private:
     
     using StringPairHash = QHash<QPair<QString, QString>, QString>;
     QJsonObject _statsJSONObject;
+    quint64 _lastJSONStatsRequest { 0 };
+    MetricSet _metrics;
     static StringPairHash _overrideHash;
     
     HifiSockAddr _sendingSockAddr;
@@ -99,6 +116,11 @@ private:
     quint64 _lastDomainCheckinTimestamp;
     QString _placeName;
 
+    QByteArray _domainListEntry;
+    quint64 _domainListEntryRevision { 0 };
+    quint32 _sentDomainListVersion { 0 };
+    QHash<QUuid, quint64> _sentDomainListEntries;
+
     bool _wasAssigned { false };
 
     bool _hasCheckedIn { false };
@@ -29,6 +29,7 @@ public:
     HifiSockAddr senderSockAddr;
     QList<NodeType_t> interestList;
     QString placeName;
+    quint32 acknowledgedListVersion { 0 }; // the last complete domain list the node holds, list requests only
     QString hardwareAddress;
     QUuid machineFingerprint;
     QString SystemInfo;
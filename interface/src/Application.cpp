@@ -1487,10 +1487,13 @@ Application::Application(int& argc, char** argv, QElapsedTimer& startupTimer, bo
     QString concurrentDownloadsStr = getCmdOption(argc, constArgv, "--concurrent-downloads");
     bool success;
     uint32_t concurrentDownloads = concurrentDownloadsStr.toUInt(&success);
-    if (!success) {
-        concurrentDownloads = MAX_CONCURRENT_RESOURCE_DOWNLOADS;
+    if (success) {
+        ResourceCache::setRequestLimit(concurrentDownloads);
+    } else {
+        // start from the usual limit, and let the throughput of the connection move it
+        ResourceCache::setRequestLimit(MAX_CONCURRENT_RESOURCE_DOWNLOADS);
+        ResourceCache::setAdaptiveRequestLimit(MAX_CONCURRENT_RESOURCE_DOWNLOADS / 2, MAX_CONCURRENT_RESOURCE_DOWNLOADS * 2);
     }
-    ResourceCache::setRequestLimit(concurrentDownloads);
 
     // perhaps override the avatar url.  Since we will test later for validity
     // we don't need to do so here.
@@ -5200,6 +5203,8 @@ void Application::idle() {
         PROFILE_COUNTER_IF_CHANGED(app, "present", float, displayPlugin->presentRate());
     }
     PROFILE_COUNTER_IF_CHANGED(app, "renderLoopRate", float, getRenderLoopRate());
+    ResourceCache::updatePendingRequests();
+    PROFILE_COUNTER_IF_CHANGED(app, "downloadLimit", uint32_t, ResourceCache::getRequestLimit());
     PROFILE_COUNTER_IF_CHANGED(app, "currentDownloads", uint32_t, ResourceCache::getLoadingRequests().length());
     PROFILE_COUNTER_IF_CHANGED(app, "pendingDownloads", uint32_t, ResourceCache::getPendingRequestCount());
     PROFILE_COUNTER_IF_CHANGED(app, "currentProcessing", int, DependencyManager::get<StatTracker>()->getStat("Processing").toInt());
@@ -5588,6 +5593,10 @@ void Application::init() {
     });
 
     ObjectMotionState::setShapeManager(&_shapeManager);
+    // keep the hulls and BVHs of collision shapes on disk, so models we've seen before don't rebuild them
+    auto shapeCache = std::make_shared<ShapeCache>();
+    shapeCache->initialize();
+    _shapeManager.setShapeCache(shapeCache);
     _physicsEngine->init();
 
     EntityTreePointer tree = getEntities()->getTree();
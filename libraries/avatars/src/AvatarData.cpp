@@ -40,6 +40,7 @@
 #include <Profile.h>
 #include <VariantMapToScriptValue.h>
 #include <BitVectorHelpers.h>
+#include <JointPacking.h>
 
 #include "AvatarLogging.h"
 #include "AvatarTraits.h"
@@ -62,6 +63,18 @@ static const float DEFAULT_AVATAR_DENSITY = 1000.0f; // density of water
 
 #define ASSERT(COND)  do { if (!(COND)) { abort(); } } while(0)
 
+// the joints being packed or unpacked by the calling thread, kept from one avatar to the next to save allocations
+struct JointPackingScratch {
+    std::vector<uint8_t> validity;
+    JointPacking::Rotations rotations;
+    JointPacking::Translations translations;
+};
+
+static JointPackingScratch& getJointPackingScratch() {
+    static thread_local JointPackingScratch scratch;
+    return scratch;
+}
+
 size_t AvatarDataPacket::maxFaceTrackerInfoSize(size_t numBlendshapeCoefficients) {
     return FACE_TRACKER_INFO_SIZE + numBlendshapeCoefficients * sizeof(float);
 }
@@ -282,16 +295,82 @@ QByteArray AvatarData::toByteArrayStateful(AvatarDataDetail dataDetail, bool dro
     return avatarByteArray;
 }
 
+AvatarDataPacket::HasFlags AvatarData::getWantedFlags(AvatarDataDetail dataDetail, quint64 lastSentTime,
+                                                      bool dropFaceTracking) const {
+    bool sendAll = (dataDetail == SendAllData);
+    bool sendMinimum = (dataDetail == MinimumData);
+    bool sendPALMinimum = (dataDetail == PALMinimum);
+
+    lazyInitHeadData();
+
+    bool hasAvatarGlobalPosition = true; // always include global position
+    bool hasAvatarOrientation = false;
+    bool hasAvatarBoundingBox = false;
+    bool hasAvatarScale = false;
+    bool hasLookAtPosition = false;
+    bool hasAudioLoudness = false;
+    bool hasSensorToWorldMatrix = false;
+    bool hasJointData = false;
+    bool hasJointDefaultPoseFlags = false;
+    bool hasAdditionalFlags = false;
+
+    // local position, and parent info only apply to avatars that are parented. The local position
+    // and the parent info can change independently though, so we track their "changed since"
+    // separately
+    bool hasParentInfo = false;
+    bool hasAvatarLocalPosition = false;
+    bool hasHandControllers = false;
+
+    bool hasFaceTrackerInfo = false;
+
+    if (sendPALMinimum) {
+        hasAudioLoudness = true;
+    } else {
+        hasAvatarOrientation = sendAll || rotationChangedSince(lastSentTime);
+        hasAvatarBoundingBox = sendAll || avatarBoundingBoxChangedSince(lastSentTime);
+        hasAvatarScale = sendAll || avatarScaleChangedSince(lastSentTime);
+        hasLookAtPosition = sendAll || lookAtPositionChangedSince(lastSentTime);
+        hasAudioLoudness = sendAll || audioLoudnessChangedSince(lastSentTime);
+        hasSensorToWorldMatrix = sendAll || sensorToWorldMatrixChangedSince(lastSentTime);
+        hasAdditionalFlags = sendAll || additionalFlagsChangedSince(lastSentTime);
+        hasParentInfo = sendAll || parentInfoChangedSince(lastSentTime);
+        hasAvatarLocalPosition = hasParent() && (sendAll ||
+            tranlationChangedSince(lastSentTime) ||
+            parentInfoChangedSince(lastSentTime));
+        hasHandControllers = _controllerLeftHandMatrixCache.isValid() || _controllerRightHandMatrixCache.isValid();
+        hasFaceTrackerInfo = !dropFaceTracking && (getHasScriptedBlendshapes() || _headData->_hasInputDrivenBlendshapes) &&
+            (sendAll || faceTrackerInfoChangedSince(lastSentTime));
+        hasJointData = !sendMinimum;
+        hasJointDefaultPoseFlags = hasJointData;
+    }
+
+    return
+        (hasAvatarGlobalPosition ? AvatarDataPacket::PACKET_HAS_AVATAR_GLOBAL_POSITION : 0)
+        | (hasAvatarBoundingBox ? AvatarDataPacket::PACKET_HAS_AVATAR_BOUNDING_BOX : 0)
+        | (hasAvatarOrientation ? AvatarDataPacket::PACKET_HAS_AVATAR_ORIENTATION : 0)
+        | (hasAvatarScale ? AvatarDataPacket::PACKET_HAS_AVATAR_SCALE : 0)
+        | (hasLookAtPosition ? AvatarDataPacket::PACKET_HAS_LOOK_AT_POSITION : 0)
+        | (hasAudioLoudness ? AvatarDataPacket::PACKET_HAS_AUDIO_LOUDNESS : 0)
+        | (hasSensorToWorldMatrix ? AvatarDataPacket::PACKET_HAS_SENSOR_TO_WORLD_MATRIX : 0)
+        | (hasAdditionalFlags ? AvatarDataPacket::PACKET_HAS_ADDITIONAL_FLAGS : 0)
+        | (hasParentInfo ? AvatarDataPacket::PACKET_HAS_PARENT_INFO : 0)
+        | (hasAvatarLocalPosition ? AvatarDataPacket::PACKET_HAS_AVATAR_LOCAL_POSITION : 0)
+        | (hasHandControllers ? AvatarDataPacket::PACKET_HAS_HAND_CONTROLLERS : 0)
+        | (hasFaceTrackerInfo ? AvatarDataPacket::PACKET_HAS_FACE_TRACKER_INFO : 0)
+        | (hasJointData ? AvatarDataPacket::PACKET_HAS_JOINT_DATA : 0)
+        | (hasJointDefaultPoseFlags ? AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS : 0)
+        | (hasJointData ? AvatarDataPacket::PACKET_HAS_GRAB_JOINTS : 0);
+}
+
 QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime,
                                    const QVector<JointData>& lastSentJointData, AvatarDataPacket::SendStatus& sendStatus,
                                    bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
                                    QVector<JointData>* sentJointDataOut,
-                                   int maxDataSize, AvatarDataRate* outboundDataRateOut) const {
+                                   int maxDataSize, AvatarDataRate* outboundDataRateOut,
+                                   const JointDeltas::Encoding* jointDeltas) const {
 
     bool cullSmallChanges = (dataDetail == CullSmallData);
     bool sendAll = (dataDetail == SendAllData);
-    bool sendMinimum = (dataDetail == MinimumData);
-    bool sendPALMinimum = (dataDetail == PALMinimum);
 
     lazyInitHeadData();
     ASSERT(maxDataSize == 0 || (size_t)maxDataSize >= AvatarDataPacket::MIN_BULK_PACKET_SIZE);
@@ -341,72 +420,19 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
     if (sendStatus.itemFlags == 0) {
         // New avatar ...
-        bool hasAvatarGlobalPosition = true; // always include global position
-        bool hasAvatarOrientation = false;
-        bool hasAvatarBoundingBox = false;
-        bool hasAvatarScale = false;
-        bool hasLookAtPosition = false;
-        bool hasAudioLoudness = false;
-        bool hasSensorToWorldMatrix = false;
-        bool hasJointData = false;
-        bool hasJointDefaultPoseFlags = false;
-        bool hasAdditionalFlags = false;
-
-        // local position, and parent info only apply to avatars that are parented. The local position
-        // and the parent info can change independently though, so we track their "changed since"
-        // separately
-        bool hasParentInfo = false;
-        bool hasAvatarLocalPosition = false;
-        bool hasHandControllers = false;
-
-        bool hasFaceTrackerInfo = false;
-
-        if (sendPALMinimum) {
-            hasAudioLoudness = true;
-        } else {
-            hasAvatarOrientation = sendAll || rotationChangedSince(lastSentTime);
-            hasAvatarBoundingBox = sendAll || avatarBoundingBoxChangedSince(lastSentTime);
-            hasAvatarScale = sendAll || avatarScaleChangedSince(lastSentTime);
-            hasLookAtPosition = sendAll || lookAtPositionChangedSince(lastSentTime);
-            hasAudioLoudness = sendAll || audioLoudnessChangedSince(lastSentTime);
-            hasSensorToWorldMatrix = sendAll || sensorToWorldMatrixChangedSince(lastSentTime);
-            hasAdditionalFlags = sendAll || additionalFlagsChangedSince(lastSentTime);
-            hasParentInfo = sendAll || parentInfoChangedSince(lastSentTime);
-            hasAvatarLocalPosition = hasParent() && (sendAll ||
-                tranlationChangedSince(lastSentTime) ||
-                parentInfoChangedSince(lastSentTime));
-            hasHandControllers = _controllerLeftHandMatrixCache.isValid() || _controllerRightHandMatrixCache.isValid();
-            hasFaceTrackerInfo = !dropFaceTracking && (getHasScriptedBlendshapes() || _headData->_hasInputDrivenBlendshapes) &&
-                (sendAll || faceTrackerInfoChangedSince(lastSentTime));
-            hasJointData = !sendMinimum;
-            hasJointDefaultPoseFlags = hasJointData;
-        }
-
-        wantedFlags =
-            (hasAvatarGlobalPosition ? AvatarDataPacket::PACKET_HAS_AVATAR_GLOBAL_POSITION : 0)
-            | (hasAvatarBoundingBox ? AvatarDataPacket::PACKET_HAS_AVATAR_BOUNDING_BOX : 0)
-            | (hasAvatarOrientation ? AvatarDataPacket::PACKET_HAS_AVATAR_ORIENTATION : 0)
-            | (hasAvatarScale ? AvatarDataPacket::PACKET_HAS_AVATAR_SCALE : 0)
-            | (hasLookAtPosition ? AvatarDataPacket::PACKET_HAS_LOOK_AT_POSITION : 0)
-            | (hasAudioLoudness ? AvatarDataPacket::PACKET_HAS_AUDIO_LOUDNESS : 0)
-            | (hasSensorToWorldMatrix ? AvatarDataPacket::PACKET_HAS_SENSOR_TO_WORLD_MATRIX : 0)
-            | (hasAdditionalFlags ? AvatarDataPacket::PACKET_HAS_ADDITIONAL_FLAGS : 0)
-            | (hasParentInfo ? AvatarDataPacket::PACKET_HAS_PARENT_INFO : 0)
-            | (hasAvatarLocalPosition ? AvatarDataPacket::PACKET_HAS_AVATAR_LOCAL_POSITION : 0)
-            | (hasHandControllers ? AvatarDataPacket::PACKET_HAS_HAND_CONTROLLERS : 0)
-            | (hasFaceTrackerInfo ? AvatarDataPacket::PACKET_HAS_FACE_TRACKER_INFO : 0)
-            | (hasJointData ? AvatarDataPacket::PACKET_HAS_JOINT_DATA : 0)
-            | (hasJointDefaultPoseFlags ? AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS : 0)
-            | (hasJointData ? AvatarDataPacket::PACKET_HAS_GRAB_JOINTS : 0);
-
-            sendStatus.itemFlags = wantedFlags;
-            sendStatus.rotationsSent = 0;
-            sendStatus.translationsSent = 0;
+        wantedFlags = getWantedFlags(dataDetail, lastSentTime, dropFaceTracking);
+        if (jointDeltas && (wantedFlags & AvatarDataPacket::PACKET_HAS_JOINT_DATA)) {
+            wantedFlags = (wantedFlags & ~AvatarDataPacket::PACKET_HAS_JOINT_DATA) | AvatarDataPacket::PACKET_HAS_JOINT_DELTAS;
+        }
+
+        sendStatus.itemFlags = wantedFlags;
+        sendStatus.rotationsSent = 0;
+        sendStatus.translationsSent = 0;
     } else {  // Continuing avatar ...
         wantedFlags = sendStatus.itemFlags;
         if (wantedFlags & AvatarDataPacket::PACKET_HAS_GRAB_JOINTS) {
             // Must send joints for grab joints -
-            wantedFlags |= AvatarDataPacket::PACKET_HAS_JOINT_DATA;
+            wantedFlags |= jointDeltas ? AvatarDataPacket::PACKET_HAS_JOINT_DELTAS : AvatarDataPacket::PACKET_HAS_JOINT_DATA;
         }
     }
 
@@ -438,7 +464,8 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         AvatarDataPacket::maxFaceTrackerInfoSize(_headData->getBlendshapeCoefficients().size()) +
         AvatarDataPacket::maxJointDataSize(_jointData.size()) +
         AvatarDataPacket::maxJointDefaultPoseFlagsSize(_jointData.size()) +
-        AvatarDataPacket::FAR_GRAB_JOINTS_SIZE;
+        AvatarDataPacket::FAR_GRAB_JOINTS_SIZE +
+        (jointDeltas ? JointDeltas::maxSectionSize((int)jointDeltas->pose->size()) : 0);
 
     if (maxDataSize == 0) {
         maxDataSize = (int)byteArraySize;
@@ -710,7 +737,6 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         *destinationBuffer++ = (uint8_t)numJoints;
 
         unsigned char* validityPosition = destinationBuffer;
-        memset(validityPosition, 0, jointBitVectorSize);
 
 #ifdef WANT_DEBUG
         int rotationSentCount = 0;
@@ -728,22 +754,26 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         float minRotationDOT = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinRotationDOT(viewerPosition) : AVATAR_MIN_ROTATION_DOT;
 
+        // pick the rotations to send, as many as fit, then pack them all at once
+        JointPackingScratch& scratch = getJointPackingScratch();
+        scratch.validity.assign(numJoints, 0);
+        scratch.rotations.clear();
+        ptrdiff_t spaceLeft = packetEnd - destinationBuffer;
+
         int i = sendStatus.rotationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
             const JointData& last = lastSentJointData[i];
 
-            if (packetEnd - destinationBuffer >= minSizeForJoint) {
+            if (spaceLeft >= minSizeForJoint) {
                 if (!data.rotationIsDefaultPose) {
                     // The dot product for larger rotations is a lower number,
                     // so if the dot() is less than the value, then the rotation is a larger angle of rotation
                     if (sendAll || last.rotationIsDefaultPose || (!cullSmallChanges && last.rotation != data.rotation)
                         || (cullSmallChanges && fabsf(glm::dot(last.rotation, data.rotation)) < minRotationDOT)) {
-                        validityPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
-#ifdef WANT_DEBUG
-                        rotationSentCount++;
-#endif
-                        destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
+                        scratch.validity[i] = 1;
+                        scratch.rotations.append(data.rotation);
+                        spaceLeft -= JointPacking::PACKED_ROTATION_SIZE;
 
                         if (sentJoints) {
                             sentJoints[i].rotation = data.rotation;
@@ -761,6 +791,13 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         }
         sendStatus.rotationsSent = i;
 
+        JointPacking::packValidityBits(scratch.validity.data(), numJoints, validityPosition);
+        JointPacking::packRotations(scratch.rotations, destinationBuffer);
+        destinationBuffer += scratch.rotations.size() * JointPacking::PACKED_ROTATION_SIZE;
+#ifdef WANT_DEBUG
+        rotationSentCount = scratch.rotations.size();
+#endif
+
         // joint translation data
         validityPosition = destinationBuffer;
 
@@ -769,7 +806,6 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         unsigned char* beforeTranslations = destinationBuffer;
 #endif
 
-        memset(destinationBuffer, 0, jointBitVectorSize);
         destinationBuffer += jointBitVectorSize; // Move pointer past the validity bytes
 
         // write maxTranslationDimension
@@ -777,22 +813,23 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         float minTranslation = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinTranslationDistance(viewerPosition) : AVATAR_MIN_TRANSLATION;
 
+        scratch.validity.assign(numJoints, 0);
+        scratch.translations.clear();
+        spaceLeft = packetEnd - destinationBuffer;
+
         i = sendStatus.translationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
             const JointData& last = lastSentJointData[i];
 
             // Note minSizeForJoint is conservative since there isn't a following bit-vector + scale.
-            if (packetEnd - destinationBuffer >= minSizeForJoint) {
+            if (spaceLeft >= minSizeForJoint) {
                 if (!data.translationIsDefaultPose) {
                     if (sendAll || last.translationIsDefaultPose || (!cullSmallChanges && last.translation != data.translation)
                         || (cullSmallChanges && glm::distance(data.translation, lastSentJointData[i].translation) > minTranslation)) {
-                        validityPosition[i / BITS_IN_BYTE] |= 1 << (i % BITS_IN_BYTE);
-#ifdef WANT_DEBUG
-                        translationSentCount++;
-#endif
-                        destinationBuffer += packFloatVec3ToSignedTwoByteFixed(destinationBuffer, data.translation / maxTranslationDimension,
-                                                                               TRANSLATION_COMPRESSION_RADIX);
+                        scratch.validity[i] = 1;
+                        scratch.translations.append(data.translation);
+                        spaceLeft -= JointPacking::PACKED_TRANSLATION_SIZE;
 
                         if (sentJoints) {
                             sentJoints[i].translation = data.translation;
@@ -810,6 +847,59 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         }
         sendStatus.translationsSent = i;
 
+        JointPacking::packValidityBits(scratch.validity.data(), numJoints, validityPosition);
+        JointPacking::packTranslations(scratch.translations, maxTranslationDimension, TRANSLATION_COMPRESSION_RADIX,
+                                       destinationBuffer);
+        destinationBuffer += scratch.translations.size() * JointPacking::PACKED_TRANSLATION_SIZE;
+#ifdef WANT_DEBUG
+        translationSentCount = scratch.translations.size();
+#endif
+
+#ifdef WANT_DEBUG
+        if (sendAll) {
+            qCDebug(avatars) << "AvatarData::toByteArray" << cullSmallChanges << sendAll
+                << "rotations:" << rotationSentCount << "translations:" << translationSentCount
+                << "largest:" << maxTranslationDimension
+                << "size:"
+                << (beforeRotations - startPosition) << "+"
+                << (beforeTranslations - beforeRotations) << "+"
+                << (destinationBuffer - beforeTranslations) << "="
+                << (destinationBuffer - startPosition);
+        }
+#endif
+
+        if (sendStatus.rotationsSent != numJoints || sendStatus.translationsSent != numJoints) {
+            extraReturnedFlags |= AvatarDataPacket::PACKET_HAS_JOINT_DATA;
+        }
+
+        int numBytes = destinationBuffer - startSection;
+        if (outboundDataRateOut) {
+            outboundDataRateOut->jointDataRate.increment(numBytes);
+        }
+    }
+
+    IF_AVATAR_SPACE(PACKET_HAS_JOINT_DELTAS, JointDeltas::MIN_SECTION_SIZE) {
+        auto startSection = destinationBuffer;
+
+        // a section takes the joints that fit, the rest go in the next packet
+        int nextJoint = sendStatus.rotationsSent;
+        destinationBuffer += JointDeltas::writeSection(destinationBuffer, (int)(packetEnd - destinationBuffer),
+                                                       *jointDeltas, sendStatus.rotationsSent, nextJoint);
+        sendStatus.rotationsSent = nextJoint;
+        sendStatus.translationsSent = nextJoint;
+
+        if (nextJoint != (int)jointDeltas->pose->size()) {
+            extraReturnedFlags |= AvatarDataPacket::PACKET_HAS_JOINT_DELTAS;
+        }
+
+        int numBytes = destinationBuffer - startSection;
+        if (outboundDataRateOut) {
+            outboundDataRateOut->jointDataRate.increment(numBytes);
+        }
+    }
+
+    // the far grab joints follow the joints, however they were encoded
+    if (includedFlags & (AvatarDataPacket::PACKET_HAS_JOINT_DATA | AvatarDataPacket::PACKET_HAS_JOINT_DELTAS)) {
         IF_AVATAR_SPACE(PACKET_HAS_GRAB_JOINTS, sizeof (AvatarDataPacket::FarGrabJoints)) {
             // the far-grab joints may range further than 3 meters, so we can't use packFloatVec3ToSignedTwoByteFixed etc
             auto startSection = destinationBuffer;
@@ -838,28 +928,6 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
                 outboundDataRateOut->farGrabJointRate.increment(numBytes);
             }
         }
-
-#ifdef WANT_DEBUG
-        if (sendAll) {
-            qCDebug(avatars) << "AvatarData::toByteArray" << cullSmallChanges << sendAll
-                << "rotations:" << rotationSentCount << "translations:" << translationSentCount
-                << "largest:" << maxTranslationDimension
-                << "size:"
-                << (beforeRotations - startPosition) << "+"
-                << (beforeTranslations - beforeRotations) << "+"
-                << (destinationBuffer - beforeTranslations) << "="
-                << (destinationBuffer - startPosition);
-        }
-#endif
-
-        if (sendStatus.rotationsSent != numJoints || sendStatus.translationsSent != numJoints) {
-            extraReturnedFlags |= AvatarDataPacket::PACKET_HAS_JOINT_DATA;
-        }
-
-        int numBytes = destinationBuffer - startSection;
-        if (outboundDataRateOut) {
-            outboundDataRateOut->jointDataRate.increment(numBytes);
-        }
     }
 
     IF_AVATAR_SPACE(PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS, 1 + 2 * jointBitVectorSize) {
@@ -997,6 +1065,7 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
     bool hasJointData             = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DATA);
     bool hasJointDefaultPoseFlags = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS);
     bool hasGrabJoints            = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_GRAB_JOINTS);
+    bool hasJointDeltas           = HAS_FLAG(packetStateFlags, AvatarDataPacket::PACKET_HAS_JOINT_DELTAS);
 
     quint64 now = usecTimestampNow();
 
@@ -1328,61 +1397,37 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
         const int bytesOfValidity = (int)ceil((float)numJoints / (float)BITS_IN_BYTE);
         PACKET_READ_CHECK(JointRotationValidityBits, bytesOfValidity);
 
-        int numValidJointRotations = 0;
-        QVector<bool> validRotations;
-        validRotations.resize(numJoints);
-        { // rotation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
-                }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointRotations;
-                }
-                validRotations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
-            }
-        }
+        // rotation validity bits
+        JointPackingScratch& scratch = getJointPackingScratch();
+        scratch.validity.resize(numJoints);
+        int numValidJointRotations = JointPacking::unpackValidityBits(sourceBuffer, numJoints, scratch.validity.data());
+        sourceBuffer += bytesOfValidity;
 
         // each joint rotation is stored in 6 bytes.
+        PACKET_READ_CHECK(JointRotations, numValidJointRotations * JointPacking::PACKED_ROTATION_SIZE);
+        scratch.rotations.resize(numValidJointRotations);
+        JointPacking::unpackRotations(sourceBuffer, scratch.rotations);
+        sourceBuffer += numValidJointRotations * JointPacking::PACKED_ROTATION_SIZE;
+
         QWriteLocker writeLock(&_jointDataLock);
         _jointData.resize(numJoints);
 
-        const int COMPRESSED_QUATERNION_SIZE = 6;
-        PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
-        for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validRotations[i]) {
-                sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
-                _hasNewJointData = true;
+        for (int i = 0, j = 0; i < numJoints; i++) {
+            if (scratch.validity[i]) {
+                JointData& data = _jointData[i];
+                data.rotation = scratch.rotations.at(j++);
                 data.rotationIsDefaultPose = false;
             }
         }
+        if (numValidJointRotations > 0) {
+            _hasNewJointData = true;
+        }
 
         PACKET_READ_CHECK(JointTranslationValidityBits, bytesOfValidity);
 
         // get translation validity bits -- these indicate which translations were packed
-        int numValidJointTranslations = 0;
-        QVector<bool> validTranslations;
-        validTranslations.resize(numJoints);
-        { // translation validity bits
-            unsigned char validity = 0;
-            int validityBit = 0;
-            for (int i = 0; i < numJoints; i++) {
-                if (validityBit == 0) {
-                    validity = *sourceBuffer++;
-                }
-                bool valid = (bool)(validity & (1 << validityBit));
-                if (valid) {
-                    ++numValidJointTranslations;
-                }
-                validTranslations[i] = valid;
-                validityBit = (validityBit + 1) % BITS_IN_BYTE;
-            }
-        } // 1 + bytesOfValidity bytes
+        int numValidJointTranslations = JointPacking::unpackValidityBits(sourceBuffer, numJoints, scratch.validity.data());
+        sourceBuffer += bytesOfValidity;
 
         // read maxTranslationDimension
         float maxTranslationDimension;
@@ -1391,18 +1436,22 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
         sourceBuffer += sizeof(float);
 
         // each joint translation component is stored in 6 bytes.
-        const int COMPRESSED_TRANSLATION_SIZE = 6;
-        PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * COMPRESSED_TRANSLATION_SIZE);
-
-        for (int i = 0; i < numJoints; i++) {
-            JointData& data = _jointData[i];
-            if (validTranslations[i]) {
-                sourceBuffer += unpackFloatVec3FromSignedTwoByteFixed(sourceBuffer, data.translation, TRANSLATION_COMPRESSION_RADIX);
-                data.translation *= maxTranslationDimension;
-                _hasNewJointData = true;
+        PACKET_READ_CHECK(JointTranslation, numValidJointTranslations * JointPacking::PACKED_TRANSLATION_SIZE);
+        scratch.translations.resize(numValidJointTranslations);
+        JointPacking::unpackTranslations(sourceBuffer, maxTranslationDimension, TRANSLATION_COMPRESSION_RADIX,
+                                         scratch.translations);
+        sourceBuffer += numValidJointTranslations * JointPacking::PACKED_TRANSLATION_SIZE;
+
+        for (int i = 0, j = 0; i < numJoints; i++) {
+            if (scratch.validity[i]) {
+                JointData& data = _jointData[i];
+                data.translation = scratch.translations.at(j++);
                 data.translationIsDefaultPose = false;
             }
         }
+        if (numValidJointTranslations > 0) {
+            _hasNewJointData = true;
+        }
 
 #ifdef WANT_DEBUG
         if (numValidJointRotations > 15) {
@@ -1414,46 +1463,66 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
         int numBytesRead = sourceBuffer - startSection;
         _jointDataRate.increment(numBytesRead);
         _jointDataUpdateRate.increment();
+    }
 
-        if (hasGrabJoints) {
-            auto startSection = sourceBuffer;
-
-            PACKET_READ_CHECK(FarGrabJoints, sizeof(AvatarDataPacket::FarGrabJoints));
-
-            AvatarDataPacket::FarGrabJoints farGrabJoints;
-            memcpy(&farGrabJoints, sourceBuffer, sizeof(farGrabJoints)); // to avoid misaligned floats
-
-            glm::vec3 leftFarGrabPosition = glm::vec3(farGrabJoints.leftFarGrabPosition[0],
-                                                      farGrabJoints.leftFarGrabPosition[1],
-                                                      farGrabJoints.leftFarGrabPosition[2]);
-            glm::quat leftFarGrabRotation = glm::quat(farGrabJoints.leftFarGrabRotation[0],
-                                                      farGrabJoints.leftFarGrabRotation[1],
-                                                      farGrabJoints.leftFarGrabRotation[2],
-                                                      farGrabJoints.leftFarGrabRotation[3]);
-            glm::vec3 rightFarGrabPosition = glm::vec3(farGrabJoints.rightFarGrabPosition[0],
-                                                       farGrabJoints.rightFarGrabPosition[1],
-                                                       farGrabJoints.rightFarGrabPosition[2]);
-            glm::quat rightFarGrabRotation = glm::quat(farGrabJoints.rightFarGrabRotation[0],
-                                                       farGrabJoints.rightFarGrabRotation[1],
-                                                       farGrabJoints.rightFarGrabRotation[2],
-                                                       farGrabJoints.rightFarGrabRotation[3]);
-            glm::vec3 mouseFarGrabPosition = glm::vec3(farGrabJoints.mouseFarGrabPosition[0],
-                                                       farGrabJoints.mouseFarGrabPosition[1],
-                                                       farGrabJoints.mouseFarGrabPosition[2]);
-            glm::quat mouseFarGrabRotation = glm::quat(farGrabJoints.mouseFarGrabRotation[0],
-                                                       farGrabJoints.mouseFarGrabRotation[1],
-                                                       farGrabJoints.mouseFarGrabRotation[2],
-                                                       farGrabJoints.mouseFarGrabRotation[3]);
-
-            _farGrabLeftMatrixCache.set(createMatFromQuatAndPos(leftFarGrabRotation, leftFarGrabPosition));
-            _farGrabRightMatrixCache.set(createMatFromQuatAndPos(rightFarGrabRotation, rightFarGrabPosition));
-            _farGrabMouseMatrixCache.set(createMatFromQuatAndPos(mouseFarGrabRotation, mouseFarGrabPosition));
-
-            sourceBuffer += sizeof(AvatarDataPacket::FarGrabJoints);
-            int numBytesRead = sourceBuffer - startSection;
-            _farGrabJointRate.increment(numBytesRead);
-            _farGrabJointUpdateRate.increment();
+    if (hasJointDeltas) {
+        auto startSection = sourceBuffer;
+
+        QWriteLocker writeLock(&_jointDataLock);
+        int sectionSize = _jointDeltasReceiver.readSection(sourceBuffer, (int)(endPosition - sourceBuffer), _jointData);
+        if (sectionSize < 0) {
+            if (shouldLogError(now)) {
+                qCWarning(avatars) << "AvatarData packet has malformed joint deltas," << getSessionUUID();
+            }
+            return buffer.size();
         }
+        sourceBuffer += sectionSize;
+        _hasNewJointData = true;
+
+        int numBytesRead = sourceBuffer - startSection;
+        _jointDataRate.increment(numBytesRead);
+        _jointDataUpdateRate.increment();
+    }
+
+    // the far grab joints follow the joints, however they were encoded
+    if (hasGrabJoints && (hasJointData || hasJointDeltas)) {
+        auto startSection = sourceBuffer;
+
+        PACKET_READ_CHECK(FarGrabJoints, sizeof(AvatarDataPacket::FarGrabJoints));
+
+        AvatarDataPacket::FarGrabJoints farGrabJoints;
+        memcpy(&farGrabJoints, sourceBuffer, sizeof(farGrabJoints)); // to avoid misaligned floats
+
+        glm::vec3 leftFarGrabPosition = glm::vec3(farGrabJoints.leftFarGrabPosition[0],
+                                                  farGrabJoints.leftFarGrabPosition[1],
+                                                  farGrabJoints.leftFarGrabPosition[2]);
+        glm::quat leftFarGrabRotation = glm::quat(farGrabJoints.leftFarGrabRotation[0],
+                                                  farGrabJoints.leftFarGrabRotation[1],
+                                                  farGrabJoints.leftFarGrabRotation[2],
+                                                  farGrabJoints.leftFarGrabRotation[3]);
+        glm::vec3 rightFarGrabPosition = glm::vec3(farGrabJoints.rightFarGrabPosition[0],
+                                                   farGrabJoints.rightFarGrabPosition[1],
+                                                   farGrabJoints.rightFarGrabPosition[2]);
+        glm::quat rightFarGrabRotation = glm::quat(farGrabJoints.rightFarGrabRotation[0],
+                                                   farGrabJoints.rightFarGrabRotation[1],
+                                                   farGrabJoints.rightFarGrabRotation[2],
+                                                   farGrabJoints.rightFarGrabRotation[3]);
+        glm::vec3 mouseFarGrabPosition = glm::vec3(farGrabJoints.mouseFarGrabPosition[0],
+                                                   farGrabJoints.mouseFarGrabPosition[1],
+                                                   farGrabJoints.mouseFarGrabPosition[2]);
+        glm::quat mouseFarGrabRotation = glm::quat(farGrabJoints.mouseFarGrabRotation[0],
+                                                   farGrabJoints.mouseFarGrabRotation[1],
+                                                   farGrabJoints.mouseFarGrabRotation[2],
+                                                   farGrabJoints.mouseFarGrabRotation[3]);
+
+        _farGrabLeftMatrixCache.set(createMatFromQuatAndPos(leftFarGrabRotation, leftFarGrabPosition));
+        _farGrabRightMatrixCache.set(createMatFromQuatAndPos(rightFarGrabRotation, rightFarGrabPosition));
+        _farGrabMouseMatrixCache.set(createMatFromQuatAndPos(mouseFarGrabRotation, mouseFarGrabPosition));
+
+        sourceBuffer += sizeof(AvatarDataPacket::FarGrabJoints);
+        int numBytesRead = sourceBuffer - startSection;
+        _farGrabJointRate.increment(numBytesRead);
+        _farGrabJointUpdateRate.increment();
     }
 
     if (hasJointDefaultPoseFlags) {
@@ -1702,6 +1771,11 @@ QVector<JointData> AvatarData::getJointData() const {
     return jointData;
 }
 
+bool AvatarData::takeJointDeltasAcknowledgement(quint64 now, JointDeltas::Sequence& sequence) {
+    QWriteLocker writeLock(&_jointDataLock);
+    return _jointDeltasReceiver.takeAcknowledgement(now, sequence);
+}
+
 void AvatarData::clearJointData(int index) {
     if (index < 0 || index >= LOWEST_PSEUDO_JOINT_INDEX) {
         return;
@@ -37,6 +37,7 @@
 
 #include <AvatarConstants.h>
 #include <JointData.h>
+#include <JointDeltas.h>
 #include <NLPacket.h>
 #include <Node.h>
 #include <NumericalConstants.h>
@@ -205,6 +206,7 @@ namespace AvatarDataPacket {
     const HasFlags PACKET_HAS_JOINT_DATA               = 1U << 12;
     const HasFlags PACKET_HAS_JOINT_DEFAULT_POSE_FLAGS = 1U << 13;
     const HasFlags PACKET_HAS_GRAB_JOINTS              = 1U << 14;
+    const HasFlags PACKET_HAS_JOINT_DELTAS             = 1U << 15;
     const size_t AVATAR_HAS_FLAGS_SIZE = 2;
 
     using SixByteQuat = uint8_t[6];
@@ -353,6 +355,22 @@ namespace AvatarDataPacket {
     size_t maxJointDataSize(size_t numJoints);
     size_t minJointDataSize(size_t numJoints);
 
+    // In place of JointData, the joints delta encoded against a pose the receiver acknowledged, possibly split across
+    // several packets, see JointDeltas::writeSection.
+    /*
+    struct JointDeltas {
+        uint8_t numJoints;
+        uint16_t sequence;                                         // of the pose, never 0
+        uint16_t baselineSequence;                                 // of the pose the residuals add to, 0 for a key frame
+        uint8_t firstJoint;
+        uint8_t numSectionJoints;
+        uint8_t rotationChangedBits[ceil(numSectionJoints / 8)];
+        uint8_t translationChangedBits[ceil(numSectionJoints / 8)];
+        varint rotationResiduals[numChangedRotations][3];         // smallest three quaternion components, 15 bits each
+        varint translationResiduals[numChangedTranslations][3];   // 1/16384 meter steps
+    };
+    */
+
     /*
     struct JointDefaultPoseFlags {
        uint8_t numJoints;
@@ -623,9 +641,11 @@ public:
 
     virtual QByteArray toByteArrayStateful(AvatarDataDetail dataDetail, bool dropFaceTracking = false);
 
+    // With jointDeltas, the joints are sent as that encoding rather than against lastSentJointData.
     virtual QByteArray toByteArray(AvatarDataDetail dataDetail, quint64 lastSentTime, const QVector<JointData>& lastSentJointData,
         AvatarDataPacket::SendStatus& sendStatus, bool dropFaceTracking, bool distanceAdjust, glm::vec3 viewerPosition,
-        QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr) const;
+        QVector<JointData>* sentJointDataOut, int maxDataSize = 0, AvatarDataRate* outboundDataRateOut = nullptr,
+        const JointDeltas::Encoding* jointDeltas = nullptr) const;
 
     virtual void doneEncoding(bool cullSmallChanges);
 
@@ -775,6 +795,9 @@ public:
 
     const QVector<JointData>& getRawJointData() const { return _jointData; }
 
+    // the pose of this avatar to acknowledge to the avatar mixer, if it is time to
+    bool takeJointDeltasAcknowledgement(quint64 now, JointDeltas::Sequence& sequence);
+
     /**jsdoc
      * Sets joint translations and rotations from raw joint data.
      * @function Avatar.setRawJointData
@@ -1679,6 +1702,9 @@ protected:
     float getDistanceBasedMinRotationDOT(glm::vec3 viewerPosition) const;
     float getDistanceBasedMinTranslationDistance(glm::vec3 viewerPosition) const;
 
+    // the sections toByteArray wants to include when it starts encoding this avatar for dataDetail
+    AvatarDataPacket::HasFlags getWantedFlags(AvatarDataDetail dataDetail, quint64 lastSentTime, bool dropFaceTracking) const;
+
     bool avatarBoundingBoxChangedSince(quint64 time) const { return _avatarBoundingBoxChanged >= time; }
     bool avatarScaleChangedSince(quint64 time) const { return _avatarScaleChanged >= time; }
     bool lookAtPositionChangedSince(quint64 time) const { return _headData->lookAtPositionChangedSince(time); }
@@ -1716,6 +1742,7 @@ protected:
     QVector<JointData> _jointData; ///< the state of the skeleton joints
     QVector<JointData> _lastSentJointData; ///< the state of the skeleton joints last time we transmitted
     mutable QReadWriteLock _jointDataLock;
+    JointDeltas::Receiver _jointDeltasReceiver; // rebuilds _jointData from delta encoded joints, under _jointDataLock
 
     // key state
     KeyState _keyState;
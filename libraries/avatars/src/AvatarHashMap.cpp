@@ -243,8 +243,37 @@ void AvatarHashMap::processAvatarDataPacket(QSharedPointer<ReceivedMessage> mess
     PerformanceTimer perfTimer("receiveAvatar");
     // enumerate over all of the avatars in this packet
     // only add them if mixerWeakPointer points to something (meaning that mixer is still around)
+    quint64 now = usecTimestampNow();
+    std::unique_ptr<NLPacket> jointDeltasAckPacket;
+    const qint64 JOINT_DELTAS_ACK_SIZE = NUM_BYTES_RFC4122_UUID + sizeof(JointDeltas::Sequence);
+
     while (message->getBytesLeftToRead()) {
-        parseAvatarData(message, sendingNode);
+        auto avatar = parseAvatarData(message, sendingNode);
+
+        // acknowledge the poses we rebuilt so that the mixer sends the next ones as deltas against them
+        JointDeltas::Sequence sequence;
+        if (avatar && avatar->takeJointDeltasAcknowledgement(now, sequence)) {
+            if (jointDeltasAckPacket && jointDeltasAckPacket->bytesAvailableForWrite() < JOINT_DELTAS_ACK_SIZE) {
+                sendJointDeltasAcknowledgements(std::move(jointDeltasAckPacket));
+            }
+            if (!jointDeltasAckPacket) {
+                jointDeltasAckPacket = NLPacket::create(PacketType::AvatarJointDeltasAck);
+            }
+            jointDeltasAckPacket->write(avatar->getSessionUUID().toRfc4122());
+            jointDeltasAckPacket->writePrimitive(sequence);
+        }
+    }
+
+    if (jointDeltasAckPacket) {
+        sendJointDeltasAcknowledgements(std::move(jointDeltasAckPacket));
+    }
+}
+
+void AvatarHashMap::sendJointDeltasAcknowledgements(std::unique_ptr<NLPacket> packet) {
+    auto nodeList = DependencyManager::get<LimitedNodeList>();
+    SharedNodePointer avatarMixer = nodeList->soloNodeOfType(NodeType::AvatarMixer);
+    if (!avatarMixer.isNull()) {
+        nodeList->sendPacket(std::move(packet), *avatarMixer);
     }
 }
 
@@ -235,6 +235,8 @@ protected:
     virtual void removeAvatar(const QUuid& sessionUUID, KillAvatarReason removalReason = KillAvatarReason::NoReason);
     
     virtual void handleRemovedAvatar(const AvatarSharedPointer& removedAvatar, KillAvatarReason removalReason = KillAvatarReason::NoReason);
+
+    void sendJointDeltasAcknowledgements(std::unique_ptr<NLPacket> packet);
     
     mutable QReadWriteLock _hashLock;
     AvatarHash _avatarHash;
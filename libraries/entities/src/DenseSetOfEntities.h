@@ -0,0 +1,72 @@
+//
+//  DenseSetOfEntities.h
+//  libraries/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DenseSetOfEntities_h
+#define hifi_DenseSetOfEntities_h
+
+#include <unordered_map>
+#include <vector>
+
+#include "EntityTypes.h"
+
+// A set of entities kept in a contiguous array, for sets that are walked every frame. Removal swaps the last entity
+// into the hole, so the order isn't kept.
+class DenseSetOfEntities {
+public:
+    using const_iterator = std::vector<EntityItemPointer>::const_iterator;
+
+    // returns false if the entity was already in the set
+    bool insert(const EntityItemPointer& entity) {
+        if (!_indices.emplace(entity.get(), _entities.size()).second) {
+            return false;
+        }
+        _entities.push_back(entity);
+        return true;
+    }
+
+    // returns false if the entity wasn't in the set
+    bool remove(const EntityItemPointer& entity) {
+        auto itr = _indices.find(entity.get());
+        if (itr == _indices.end()) {
+            return false;
+        }
+        removeAt(itr->second);
+        return true;
+    }
+
+    void removeAt(size_t index) {
+        _indices.erase(_entities[index].get());
+        if (index != _entities.size() - 1) {
+            _entities[index] = std::move(_entities.back());
+            _indices[_entities[index].get()] = index;
+        }
+        _entities.pop_back();
+    }
+
+    bool contains(const EntityItemPointer& entity) const { return _indices.find(entity.get()) != _indices.end(); }
+
+    const EntityItemPointer& operator[](size_t index) const { return _entities[index]; }
+    size_t size() const { return _entities.size(); }
+    bool empty() const { return _entities.empty(); }
+    const_iterator begin() const { return _entities.begin(); }
+    const_iterator end() const { return _entities.end(); }
+
+    void clear() {
+        _entities.clear();
+        _indices.clear();
+    }
+
+private:
+    std::vector<EntityItemPointer> _entities;
+    std::unordered_map<const EntityItem*, size_t> _indices;
+};
+
+#endif // hifi_DenseSetOfEntities_h
@@ -0,0 +1,294 @@
+//
+//  EntityEditFilterRules.cpp
+//  libraries/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityEditFilterRules.h"
+
+#include <algorithm>
+
+#include <QJsonArray>
+
+#include <NumericalConstants.h>
+
+namespace {
+    // how to read and write a property that can be clamped, floats in x
+    struct ClampableProperty {
+        bool (EntityItemProperties::*changed)() const;
+        glm::vec3 (*get)(const EntityItemProperties& properties);
+        void (*set)(EntityItemProperties& properties, const glm::vec3& value);
+    };
+
+#define CLAMPABLE_VEC3(n, N) \
+    { &EntityItemProperties::n##Changed, \
+      [](const EntityItemProperties& properties) { return properties.get##N(); }, \
+      [](EntityItemProperties& properties, const glm::vec3& value) { properties.set##N(value); } }
+
+#define CLAMPABLE_FLOAT(n, N) \
+    { &EntityItemProperties::n##Changed, \
+      [](const EntityItemProperties& properties) { return glm::vec3(properties.get##N()); }, \
+      [](EntityItemProperties& properties, const glm::vec3& value) { properties.set##N(value.x); } }
+
+    // in the order of CLAMPABLE_PROPERTIES
+    const ClampableProperty CLAMPABLE[] = {
+        CLAMPABLE_VEC3(dimensions, Dimensions),
+        CLAMPABLE_VEC3(velocity, Velocity),
+        CLAMPABLE_VEC3(angularVelocity, AngularVelocity),
+        CLAMPABLE_VEC3(gravity, Gravity),
+        CLAMPABLE_VEC3(acceleration, Acceleration),
+        CLAMPABLE_FLOAT(lifetime, Lifetime),
+        CLAMPABLE_FLOAT(density, Density),
+        CLAMPABLE_FLOAT(damping, Damping),
+        CLAMPABLE_FLOAT(angularDamping, AngularDamping),
+        CLAMPABLE_FLOAT(restitution, Restitution),
+        CLAMPABLE_FLOAT(friction, Friction)
+    };
+
+    // a number for every component, or an array of one number per component
+    bool readBound(const QJsonValue& value, glm::vec3& bound) {
+        if (value.isDouble()) {
+            bound = glm::vec3((float)value.toDouble());
+            return true;
+        }
+        QJsonArray array = value.toArray();
+        if (array.size() == 3 && array[0].isDouble() && array[1].isDouble() && array[2].isDouble()) {
+            bound = glm::vec3((float)array[0].toDouble(), (float)array[1].toDouble(), (float)array[2].toDouble());
+            return true;
+        }
+        return false;
+    }
+
+    using FilterTypes = bool[EntityTree::FilterType::Delete + 1];
+
+    bool readFilterTypes(const QJsonValue& value, const QString& key, FilterTypes& filterTypes, QString& error) {
+        static const QStringList FILTER_TYPE_NAMES = { "add", "edit", "physics", "delete" };
+        if (!value.isArray()) {
+            error = key + " is not an array";
+            return false;
+        }
+        for (auto& wants : filterTypes) {
+            wants = false;
+        }
+        for (const auto& name : value.toArray()) {
+            int filterType = FILTER_TYPE_NAMES.indexOf(name.toString());
+            if (filterType < 0) {
+                error = key + " has an unknown type " + name.toString();
+                return false;
+            }
+            filterTypes[filterType] = true;
+        }
+        return true;
+    }
+
+    bool readPropertyList(const QJsonValue& value, const QString& key, std::vector<EntityPropertyList>& properties,
+                          QString& error) {
+        if (!value.isArray()) {
+            error = key + " is not an array of property names";
+            return false;
+        }
+        for (const auto& name : value.toArray()) {
+            EntityPropertyInfo propertyInfo;
+            if (!EntityItemProperties::getPropertyInfo(name.toString(), propertyInfo)) {
+                error = key + " has an unknown property " + name.toString();
+                return false;
+            }
+            properties.push_back(propertyInfo.propertyEnum);
+        }
+        return true;
+    }
+}
+
+// how often the buckets of the senders that went quiet are dropped, at most
+static const quint64 RATE_BUCKET_EXPIRY_INTERVAL = 10 * USECS_PER_SECOND;
+
+const QStringList EntityEditFilterRules::CLAMPABLE_PROPERTIES = {
+    "dimensions", "velocity", "angularVelocity", "gravity", "acceleration",
+    "lifetime", "density", "damping", "angularDamping", "restitution", "friction"
+};
+
+std::shared_ptr<EntityEditFilterRules> EntityEditFilterRules::compile(const QJsonObject& rules, QString& error) {
+    static_assert(sizeof(CLAMPABLE) / sizeof(CLAMPABLE[0]) == 11, "CLAMPABLE doesn't match CLAMPABLE_PROPERTIES");
+
+    auto compiled = std::make_shared<EntityEditFilterRules>();
+
+    for (auto it = rules.begin(); it != rules.end(); ++it) {
+        const QString& key = it.key();
+        const QJsonValue& value = it.value();
+
+        if (key == "filterTypes") {
+            if (!readFilterTypes(value, key, compiled->_filterTypes, error)) {
+                return nullptr;
+            }
+
+        } else if (key == "rejectAll") {
+            compiled->_rejectAll = value.toBool();
+
+        } else if (key == "allowedProperties") {
+            std::vector<EntityPropertyList> allowed { PROP_SIMULATION_OWNER, PROP_QUERY_AA_CUBE, PROP_LAST_EDITED_BY };
+            if (!readPropertyList(value, key, allowed, error)) {
+                return nullptr;
+            }
+            compiled->_allowedProperties.assign(PROP_AFTER_LAST_ITEM, false);
+            for (auto property : allowed) {
+                compiled->_allowedProperties[property] = true;
+            }
+
+        } else if (key == "deniedProperties") {
+            if (!readPropertyList(value, key, compiled->_deniedProperties, error)) {
+                return nullptr;
+            }
+
+        } else if (key == "clamp") {
+            QJsonObject clamps = value.toObject();
+            for (auto clampIt = clamps.begin(); clampIt != clamps.end(); ++clampIt) {
+                Clamp clamp;
+                clamp.property = CLAMPABLE_PROPERTIES.indexOf(clampIt.key());
+                if (clamp.property < 0) {
+                    error = "clamp has a property that can't be clamped " + clampIt.key();
+                    return nullptr;
+                }
+
+                QJsonObject bounds = clampIt.value().toObject();
+                clamp.minimum = glm::vec3(-FLT_MAX);
+                clamp.maximum = glm::vec3(FLT_MAX);
+                if ((bounds.contains("min") && !readBound(bounds["min"], clamp.minimum)) ||
+                    (bounds.contains("max") && !readBound(bounds["max"], clamp.maximum))) {
+                    error = "clamp of " + clampIt.key() + " has a min or max that isn't a number or an array of 3 numbers";
+                    return nullptr;
+                }
+                compiled->_clamps.push_back(clamp);
+            }
+
+        } else if (key == "zoneBounds") {
+            if (value.toString() == "reject") {
+                compiled->_zoneBounds = ZoneBounds::Reject;
+            } else if (value.toString() == "clamp") {
+                compiled->_zoneBounds = ZoneBounds::Clamp;
+            } else {
+                error = "zoneBounds is neither reject nor clamp";
+                return nullptr;
+            }
+
+        } else if (key == "rateLimit") {
+            QJsonObject rateLimit = value.toObject();
+            compiled->_ratePerSecond = (float)rateLimit["perSecond"].toDouble();
+            compiled->_rateBurst = (float)rateLimit["burst"].toDouble(compiled->_ratePerSecond);
+            if (compiled->_ratePerSecond <= 0.0f || compiled->_rateBurst < 1.0f) {
+                error = "rateLimit needs a positive perSecond, and a burst of at least 1";
+                return nullptr;
+            }
+            if (rateLimit.contains("filterTypes") &&
+                !readFilterTypes(rateLimit["filterTypes"], "rateLimit filterTypes", compiled->_rateFilterTypes, error)) {
+                return nullptr;
+            }
+
+        } else {
+            error = "unknown rule " + key;
+            return nullptr;
+        }
+    }
+
+    return compiled;
+}
+
+bool EntityEditFilterRules::takeRateToken(const QUuid& senderID, quint64 now) {
+    // a bucket that would have refilled is the same as none
+    quint64 timeToFill = (quint64)(_rateBurst / _ratePerSecond * USECS_PER_SECOND);
+
+    std::lock_guard<std::mutex> lock(_rateMutex);
+
+    // drop the buckets of the senders that went quiet, now and then
+    if (now > _lastRateExpiry + std::max(timeToFill, RATE_BUCKET_EXPIRY_INTERVAL)) {
+        _lastRateExpiry = now;
+        for (auto it = _rateBuckets.begin(); it != _rateBuckets.end();) {
+            if (now >= it->lastTime + timeToFill) {
+                it = _rateBuckets.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    auto it = _rateBuckets.find(senderID);
+    if (it == _rateBuckets.end()) {
+        it = _rateBuckets.insert(senderID, { _rateBurst, now });
+    } else if (now > it->lastTime) {
+        float elapsed = (float)(now - it->lastTime) / USECS_PER_SECOND;
+        it->tokens = glm::min(it->tokens + elapsed * _ratePerSecond, _rateBurst);
+        it->lastTime = now;
+    }
+
+    if (it->tokens < 1.0f) {
+        return false;
+    }
+    it->tokens -= 1.0f;
+    return true;
+}
+
+EntityEditFilterRules::Result EntityEditFilterRules::filter(EntityItemProperties& properties,
+                                                            EntityTree::FilterType filterType,
+                                                            const EntityItemPointer& existingEntity,
+                                                            const AABox* zoneBox, quint64 now,
+                                                            const QUuid& senderID) {
+    if (!_filterTypes[filterType]) {
+        return Result::Accepted;
+    }
+    if (_rejectAll) {
+        return Result::Rejected;
+    }
+    if (_ratePerSecond > 0.0f && _rateFilterTypes[filterType] && !takeRateToken(senderID, now)) {
+        return Result::Rejected;
+    }
+
+    if (!_allowedProperties.empty() || !_deniedProperties.empty()) {
+        EntityPropertyFlags changedProperties = properties.getChangedProperties();
+        for (auto property : _deniedProperties) {
+            if (changedProperties.getHasProperty(property)) {
+                return Result::Rejected;
+            }
+        }
+        if (!_allowedProperties.empty()) {
+            for (int property = 0; property < PROP_AFTER_LAST_ITEM; property++) {
+                if (!_allowedProperties[property] && changedProperties.getHasProperty((EntityPropertyList)property)) {
+                    return Result::Rejected;
+                }
+            }
+        }
+    }
+
+    Result result = Result::Accepted;
+
+    // a position relative to a parent can't be compared to the zone
+    if (zoneBox && _zoneBounds != ZoneBounds::Ignore && properties.positionChanged()) {
+        QUuid parentID = properties.parentIDChanged() ? properties.getParentID() :
+            (existingEntity ? existingEntity->getParentID() : QUuid());
+        const glm::vec3& position = properties.getPosition();
+        if (parentID.isNull() && !zoneBox->contains(position)) {
+            if (_zoneBounds == ZoneBounds::Reject) {
+                return Result::Rejected;
+            }
+            properties.setPosition(glm::clamp(position, zoneBox->getMinimumPoint(), zoneBox->getMaximumPoint()));
+            result = Result::Changed;
+        }
+    }
+
+    for (const auto& clamp : _clamps) {
+        const auto& clampable = CLAMPABLE[clamp.property];
+        if ((properties.*clampable.changed)()) {
+            glm::vec3 value = clampable.get(properties);
+            glm::vec3 clamped = glm::clamp(value, clamp.minimum, clamp.maximum);
+            if (clamped != value) {
+                clampable.set(properties, clamped);
+                result = Result::Changed;
+            }
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,112 @@
+//
+//  EntityEditFilterRules.h
+//  libraries/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityEditFilterRules_h
+#define hifi_EntityEditFilterRules_h
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QHash>
+#include <QJsonObject>
+#include <QUuid>
+#include <glm/glm.hpp>
+
+#include <AABox.h>
+
+#include "EntityItemProperties.h"
+#include "EntityTree.h"
+
+// An entity edit filter given as rules rather than as a script. The rules are compiled once into native checks, and
+// an edit is filtered without a script engine or any conversion of its properties:
+//
+//     {
+//         "filterTypes": [ "add", "edit", "physics" ],
+//         "allowedProperties": [ "position", "rotation", "velocity", "angularVelocity" ],
+//         "deniedProperties": [ "script", "serverScripts" ],
+//         "clamp": {
+//             "dimensions": { "min": 0.1, "max": [ 10, 4, 10 ] },
+//             "lifetime": { "max": 3600 }
+//         },
+//         "zoneBounds": "clamp",
+//         "rateLimit": { "perSecond": 20, "burst": 100, "filterTypes": [ "add", "edit" ] }
+//     }
+//
+// - filterTypes: the messages the filter looks at, others are accepted as they are. Add, edit and physics by default.
+// - rejectAll: rejects every message the filter looks at.
+// - allowedProperties: rejects an edit that changes any other property. The bookkeeping properties sent with edits,
+//   simulationOwner, queryAACube and lastEditedBy, are always allowed.
+// - deniedProperties: rejects an edit that changes one of these properties.
+// - clamp: clamps the properties in CLAMPABLE_PROPERTIES, a vector to a number for every component or to one number each.
+// - zoneBounds: "reject" or "clamp" a position outside of the zone of the filter, for the positions that aren't
+//   relative to a parent. Not used by the filter of the whole domain.
+// - rateLimit: rejects the messages of a sender beyond a rate, after a burst. Its filterTypes are the messages counted,
+//   add, edit and delete by default: physics results are only limited when asked for, an entity moved by physics
+//   sends them all the time.
+class EntityEditFilterRules {
+public:
+    enum class Result {
+        Accepted,
+        Changed,
+        Rejected
+    };
+
+    // the properties that can be clamped
+    static const QStringList CLAMPABLE_PROPERTIES;
+
+    // returns null and sets the error if the rules aren't valid
+    static std::shared_ptr<EntityEditFilterRules> compile(const QJsonObject& rules, QString& error);
+
+    bool wantsZoneBounds() const { return _zoneBounds != ZoneBounds::Ignore; }
+
+    // Checks and clamps the properties of a message. The zone box is null for the filter of the whole domain, the
+    // sender is null for the messages of the server itself.
+    Result filter(EntityItemProperties& properties, EntityTree::FilterType filterType,
+                  const EntityItemPointer& existingEntity, const AABox* zoneBox, quint64 now,
+                  const QUuid& senderID = QUuid());
+
+private:
+    enum class ZoneBounds {
+        Ignore,
+        Reject,
+        Clamp
+    };
+
+    struct Clamp {
+        int property; // index in CLAMPABLE_PROPERTIES
+        glm::vec3 minimum;
+        glm::vec3 maximum;
+    };
+
+    struct RateBucket {
+        float tokens;
+        quint64 lastTime;
+    };
+
+    bool takeRateToken(const QUuid& senderID, quint64 now);
+
+    bool _filterTypes[EntityTree::FilterType::Delete + 1] { true, true, true, false };
+    bool _rejectAll { false };
+    std::vector<bool> _allowedProperties; // empty if every property is allowed
+    std::vector<EntityPropertyList> _deniedProperties;
+    std::vector<Clamp> _clamps;
+    ZoneBounds _zoneBounds { ZoneBounds::Ignore };
+
+    float _ratePerSecond { 0.0f }; // no limit if 0
+    float _rateBurst { 0.0f };
+    bool _rateFilterTypes[EntityTree::FilterType::Delete + 1] { true, true, false, true };
+    std::mutex _rateMutex;
+    QHash<QUuid, RateBucket> _rateBuckets; // a sender without a bucket has a full one
+    quint64 _lastRateExpiry { 0 };
+};
+
+#endif // hifi_EntityEditFilterRules_h
@@ -11,11 +11,35 @@
 
 #include "EntityEditFilters.h"
 
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QUrl>
 
 #include <ResourceManager.h>
+#include <SharedUtil.h>
 #include <shared/ScriptInitializerMixin.h>
 
+namespace {
+    // times one call of a filter, and counts it as rejected unless it's marked accepted
+    struct FilterCall {
+        EntityEditFilters::FilterStats& stats;
+        quint64 start { usecTimestampNow() };
+        bool accepted { false };
+        bool changed { false };
+
+        FilterCall(EntityEditFilters::FilterStats& stats) : stats(stats) {}
+        ~FilterCall() {
+            stats.totalTime += usecTimestampNow() - start;
+            stats.calls++;
+            if (!accepted) {
+                stats.rejected++;
+            } else if (changed) {
+                stats.changed++;
+            }
+        }
+    };
+}
+
 QList<EntityItemID> EntityEditFilters::getZonesByPosition(glm::vec3& position) {
     QList<EntityItemID> zones;
     QList<EntityItemID> missingZones;
@@ -43,7 +67,8 @@ QList<EntityItemID> EntityEditFilters::getZonesByPosition(glm::vec3& position) {
 }
 
 bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut,
-        bool& wasChanged, EntityTree::FilterType filterType, EntityItemID& itemID, const EntityItemPointer& existingEntity) {
+        bool& wasChanged, EntityTree::FilterType filterType, EntityItemID& itemID, const EntityItemPointer& existingEntity,
+        const QUuid& senderID) {
     
     // get the ids of all the zones (plus the global entity edit filter) that the position
     // lies within
@@ -59,10 +84,28 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
         _lock.unlock();
     
         if (filterData.valid()) {
+            FilterCall call(*filterData.stats);
             if (filterData.rejectAll) {
                 return false;
             }
 
+            if (filterData.rules) {
+                auto result = filterWithRules(filterData, id, propertiesIn, filterType, existingEntity, senderID);
+                if (result == EntityEditFilterRules::Result::Rejected) {
+                    return false;
+                }
+                if (result == EntityEditFilterRules::Result::Changed) {
+                    // the rules changed propertiesIn, for the next filter
+                    if (&propertiesOut != &propertiesIn) {
+                        propertiesOut = propertiesIn;
+                    }
+                    wasChanged = true;
+                    call.changed = true;
+                }
+                call.accepted = true;
+                continue;
+            }
+
             // check to see if this filter wants to filter this message type
             if ((!filterData.wantsToFilterEdit && filterType == EntityTree::FilterType::Edit) ||
                 (!filterData.wantsToFilterPhysics && filterType == EntityTree::FilterType::Physics) ||
@@ -70,6 +113,7 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
                 (!filterData.wantsToFilterAdd && filterType == EntityTree::FilterType::Add)) {
 
                 wasChanged = false;
+                call.accepted = true;
                 return true; // accept the message
             }
 
@@ -143,7 +187,8 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
                 propertiesOut.copyFromScriptValue(result, false);
                 // Javascript objects are == only if they are the same object. To compare arbitrary values, we need to use JSON.
                 auto out = QJsonValue::fromVariant(result.toVariant());
-                wasChanged |= (in != out);
+                call.changed = (in != out);
+                wasChanged |= call.changed;
             } else if (result.isBool()) {
 
                 // if the filter returned false, then it's authoritative
@@ -154,16 +199,77 @@ bool EntityEditFilters::filter(glm::vec3& position, EntityItemProperties& proper
                 // otherwise, assume it wants to pass all properties
                 propertiesOut = propertiesIn;
                 wasChanged = false;
-                
+
             } else {
                 return false;
             }
+            call.accepted = true;
         }
     }
     // if we made it here, 
     return true;
 }
 
+EntityEditFilterRules::Result EntityEditFilters::filterWithRules(FilterData& filterData, const EntityItemID& id,
+                                                                 EntityItemProperties& propertiesIn,
+                                                                 EntityTree::FilterType filterType,
+                                                                 const EntityItemPointer& existingEntity,
+                                                                 const QUuid& senderID) {
+    // the global filter has no zone to bound positions to
+    AABox zoneBox;
+    bool hasZoneBox = false;
+    if (filterData.rules->wantsZoneBounds() && !id.isInvalidID()) {
+        auto zoneEntity = _tree->findEntityByEntityItemID(id);
+        if (zoneEntity) {
+            zoneBox = zoneEntity->getAABox(hasZoneBox);
+        }
+    }
+    return filterData.rules->filter(propertiesIn, filterType, existingEntity, hasZoneBox ? &zoneBox : nullptr,
+                                    usecTimestampNow(), senderID);
+}
+
+QJsonArray EntityEditFilters::getFilterStats() {
+    QJsonArray filterStats;
+    QReadLocker readLock(&_lock);
+    for (auto it = _filterDataMap.begin(); it != _filterDataMap.end(); ++it) {
+        const FilterData& filterData = it.value();
+        quint64 calls = filterData.stats->calls;
+        QJsonObject stats;
+        stats["zone"] = it.key().isInvalidID() ? QString("global") : it.key().toString();
+        stats["url"] = filterData.url;
+        stats["native"] = (bool)filterData.rules;
+        stats["calls"] = (double)calls;
+        stats["rejected"] = (double)filterData.stats->rejected;
+        stats["changed"] = (double)filterData.stats->changed;
+        stats["averageTime"] = calls > 0 ? (double)filterData.stats->totalTime / calls : 0.0;
+        filterStats.append(stats);
+    }
+    return filterStats;
+}
+
+bool EntityEditFilters::addFilterRules(EntityItemID entityID, const QString& url, const QJsonObject& rules) {
+    QString error;
+    FilterData filterData;
+    filterData.url = url;
+    filterData.rules = EntityEditFilterRules::compile(rules, error);
+    if (!filterData.rules) {
+        qCritical() << "Invalid entity edit filter rules in" << url << ":" << error;
+        return false;
+    }
+
+    _lock.lockForWrite();
+    _filterDataMap.insert(entityID, filterData);
+    _lock.unlock();
+
+    qDebug() << "filter rules processed for entity id " << entityID;
+    return true;
+}
+
+bool EntityEditFilters::hasFilters() {
+    QReadLocker readLock(&_lock);
+    return !_filterDataMap.isEmpty();
+}
+
 void EntityEditFilters::removeFilter(EntityItemID entityID) {
     QWriteLocker writeLock(&_lock);
     FilterData filterData = _filterDataMap.value(entityID);
@@ -195,6 +301,7 @@ void EntityEditFilters::addFilter(EntityItemID entityID, QString filterURL) {
     
     // reject all edits until we load the script
     FilterData filterData;
+    filterData.url = filterURL;
     filterData.rejectAll = true;
 
     _lock.lockForWrite();
@@ -255,6 +362,15 @@ void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
         const QString urlString = scriptRequest->getUrl().toString();
         auto scriptContents = scriptRequest->getData();
         qInfo() << "Downloaded script:" << scriptContents;
+
+        // a filter given as rules rather than as a script
+        QJsonDocument rulesDocument = QJsonDocument::fromJson(scriptContents);
+        if (rulesDocument.isObject()) {
+            // an invalid filter is left rejecting all edits
+            emit filterAdded(entityID, addFilterRules(entityID, urlString, rulesDocument.object()));
+            return;
+        }
+
         QScriptProgram program(scriptContents, urlString);
         if (hasCorrectSyntax(program)) {
             // create a QScriptEngine for this script
@@ -269,6 +385,7 @@ void EntityEditFilters::scriptRequestFinished(EntityItemID entityID) {
             if (!hadUncaughtExceptions(*engine, urlString)) {
                 // put the engine in the engine map (so we don't leak them, etc...)
                 FilterData filterData;
+                filterData.url = urlString;
                 filterData.engine = engine;
                 filterData.rejectAll = false;
                 
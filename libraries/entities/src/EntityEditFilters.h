@@ -12,13 +12,17 @@
 #define hifi_EntityEditFilters_h
 
 #include <QObject>
+#include <QJsonArray>
 #include <QMap>
 #include <QScriptValue>
 #include <QScriptEngine>
 #include <glm/glm.hpp>
 
+#include <atomic>
 #include <functional>
+#include <memory>
 
+#include "EntityEditFilterRules.h"
 #include "EntityItemID.h"
 #include "EntityItemProperties.h"
 #include "EntityTree.h"
@@ -26,7 +30,21 @@
 class EntityEditFilters : public QObject, public Dependency {
     Q_OBJECT
 public:
+    // shared by the copies of a filter's data, filters run on several threads at once
+    struct FilterStats {
+        std::atomic<quint64> calls { 0 };
+        std::atomic<quint64> rejected { 0 };
+        std::atomic<quint64> changed { 0 };
+        std::atomic<quint64> totalTime { 0 }; // usecs
+    };
+
     struct FilterData {
+        QString url;
+        std::shared_ptr<FilterStats> stats { std::make_shared<FilterStats>() };
+
+        // a filter given as rules is run natively, instead of calling filterFn
+        std::shared_ptr<EntityEditFilterRules> rules;
+
         QScriptValue filterFn;
         bool wantsOriginalProperties { false };
         bool wantsZoneProperties { false };
@@ -45,7 +63,7 @@ public:
         bool rejectAll;
         
         FilterData(): engine(nullptr), rejectAll(false) {};
-        bool valid() { return (rejectAll || (engine != nullptr && filterFn.isFunction() && uncaughtExceptions)); }
+        bool valid() { return (rejectAll || rules || (engine != nullptr && filterFn.isFunction() && uncaughtExceptions)); }
     };
 
     EntityEditFilters() {};
@@ -54,8 +72,18 @@ public:
     void addFilter(EntityItemID entityID, QString filterURL);
     void removeFilter(EntityItemID entityID);
 
+    // adds a filter given as rules, returns false and leaves the filters as they were if the rules aren't valid
+    bool addFilterRules(EntityItemID entityID, const QString& url, const QJsonObject& rules);
+
+    // whether any filter, loaded or still loading, could reject or change a message
+    bool hasFilters();
+
     bool filter(glm::vec3& position, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged, 
-                EntityTree::FilterType filterType, EntityItemID& entityID, const EntityItemPointer& existingEntity);
+                EntityTree::FilterType filterType, EntityItemID& entityID, const EntityItemPointer& existingEntity,
+                const QUuid& senderID = QUuid());
+
+    // the calls, results and average time of each filter, for the server stats
+    QJsonArray getFilterStats();
 
 signals:
     void filterAdded(EntityItemID id, bool success);
@@ -65,6 +93,11 @@ private slots:
     
 private:
     QList<EntityItemID> getZonesByPosition(glm::vec3& position);
+    EntityEditFilterRules::Result filterWithRules(FilterData& filterData, const EntityItemID& id,
+                                                  EntityItemProperties& propertiesIn,
+                                                  EntityTree::FilterType filterType,
+                                                  const EntityItemPointer& existingEntity,
+                                                  const QUuid& senderID);
 
     EntityTreePointer _tree {};
     bool _rejectAll {false};
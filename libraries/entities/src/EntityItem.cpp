@@ -398,6 +398,35 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
     return appendState;
 }
 
+QByteArray EntityItem::getSharedEncodedData() const {
+    EncodedDataVersion version;
+    withReadLock([&] {
+        version.lastEdited = _lastEdited;
+        version.lastUpdated = _lastUpdated;
+        version.lastSimulated = _lastSimulated;
+        version.changedOnServer = _changedOnServer;
+    });
+    version.changes = _encodedDataChanges;
+
+    // hold the lock while encoding, the other send threads asking for this entity will wait for the result
+    std::lock_guard<std::mutex> lock(_sharedEncodedDataMutex);
+    if (!_hasSharedEncodedData || !(_sharedEncodedDataVersion == version)) {
+        OctreePacketData packetData;
+        EncodeBitstreamParams params;
+        auto extraEncodeData = std::make_shared<EntityTreeElementExtraEncodeData>();
+
+        if (appendEntityData(&packetData, params, extraEncodeData, false) == OctreeElement::COMPLETED) {
+            _sharedEncodedData = QByteArray((const char*)packetData.getUncompressedData(), packetData.getUncompressedSize());
+        } else {
+            // too big for a single packet, the send threads will split it themselves
+            _sharedEncodedData.clear();
+        }
+        _sharedEncodedDataVersion = version;
+        _hasSharedEncodedData = true;
+    }
+    return _sharedEncodedData;
+}
+
 // TODO: My goal is to get rid of this concept completely. The old code (and some of the current code) used this
 // result to calculate if a packet being sent to it was potentially bad or corrupt. I've adjusted this to now
 // only consider the minimum header bytes as being required. But it would be preferable to completely eliminate
@@ -1001,6 +1030,8 @@ int EntityItem::readEntityDataFromBuffer(const unsigned char* data, int bytesLef
         element->getTree()->trackIncomingEntityLastEdited(lastEditedFromBufferAdjusted, bytesRead);
     }
 
+    // not every property read goes through a setter
+    invalidateSharedEncodedData();
 
     return bytesRead;
 }
@@ -1587,6 +1618,9 @@ bool EntityItem::setProperties(const EntityItemProperties& properties) {
         _created = timestamp;
     }
 
+    // not every property is set under the write lock
+    invalidateSharedEncodedData();
+
     return somethingChanged;
 }
 
@@ -1878,6 +1912,7 @@ void EntityItem::setParentID(const QUuid& value) {
         }
 
         SpatiallyNestable::setParentID(value);
+        invalidateSharedEncodedData();
         // children are forced to be kinematic
         // may need to not collide with own avatar
         markDirtyFlags(Simulation::DIRTY_MOTION_TYPE | Simulation::DIRTY_COLLISION_GROUP);
@@ -1950,6 +1985,7 @@ void EntityItem::setVelocity(const glm::vec3& value) {
             }
             setLocalVelocity(velocity);
             _flags |= Simulation::DIRTY_LINEAR_VELOCITY;
+            invalidateSharedEncodedData();
         }
     }
 }
@@ -1997,6 +2033,7 @@ void EntityItem::setAngularVelocity(const glm::vec3& value) {
             }
             setLocalAngularVelocity(angularVelocity);
             _flags |= Simulation::DIRTY_ANGULAR_VELOCITY;
+            invalidateSharedEncodedData();
         }
     }
 }
@@ -2122,6 +2159,7 @@ void EntityItem::setSimulationOwner(const QUuid& id, uint8_t priority) {
         qCDebug(entities) << "sim ownership for" << getDebugName() << "is now" << id << priority;
     }
     _simulationOwner.set(id, priority);
+    invalidateSharedEncodedData();
 }
 
 void EntityItem::setSimulationOwner(const SimulationOwner& owner) {
@@ -2141,6 +2179,7 @@ void EntityItem::clearSimulationOwnership() {
     }
 
     _simulationOwner.clear();
+    invalidateSharedEncodedData();
     // don't bother setting the DIRTY_SIMULATOR_ID flag because:
     // (a) when entity-server calls clearSimulationOwnership() the dirty-flags are meaningless (only used by interface)
     // (b) the interface only calls clearSimulationOwnership() in a context that already knows best about dirty flags
@@ -2526,7 +2565,8 @@ const QByteArray EntityItem::getDynamicData() const {
     QByteArray result;
 
     if (_dynamicDataDirty) {
-        withWriteLock([&] {
+        // only refreshes a cache, the entity doesn't change
+        ReadWriteLockable::withWriteLock([&] {
             getDynamicDataInternal();
             result = _allActionsDataCache;
         });
@@ -2599,6 +2639,7 @@ QList<EntityDynamicPointer> EntityItem::getActionsOfType(EntityDynamicType typeT
 
 void EntityItem::locationChanged(bool tellPhysics, bool tellChildren) {
     requiresRecalcBoxes();
+    invalidateSharedEncodedData();
     if (tellPhysics) {
         _flags |= Simulation::DIRTY_TRANSFORM;
         EntityTreePointer tree = getTree();
@@ -2614,6 +2655,7 @@ void EntityItem::locationChanged(bool tellPhysics, bool tellChildren) {
 
 void EntityItem::dimensionsChanged() {
     requiresRecalcBoxes();
+    invalidateSharedEncodedData();
     SpatiallyNestable::dimensionsChanged(); // Do what you have to do
     _boundingRadius = 0.5f * glm::length(getScaledDimensions());
     std::pair<int32_t, glm::vec4> data(_spaceIndex, glm::vec4(getWorldPosition(), _boundingRadius));
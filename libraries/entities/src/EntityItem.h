@@ -13,6 +13,7 @@
 #define hifi_EntityItem_h
 
 #include <memory>
+#include <mutex>
 #include <stdint.h>
 
 #include <glm/glm.hpp>
@@ -139,6 +140,20 @@ public:
                                                         EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
                                                         const bool destinationNodeCanGetAndSetPrivateUserData = false) const;
 
+    // The complete encoding of this entity for the viewers that can't get its private user data, shared by all of them
+    // and only redone once the entity changed. Empty if the entity doesn't fit in a single packet.
+    QByteArray getSharedEncodedData() const;
+
+    // Every setter writes under this lock, so taking it marks the shared encoding as out of date. The changes made
+    // outside of it (the transform, velocities, parent and simulation owner) call invalidateSharedEncodedData().
+    using ReadWriteLockable::withWriteLock;
+    template <typename F>
+    void withWriteLock(F&& f) const {
+        ReadWriteLockable::withWriteLock(std::forward<F>(f));
+        invalidateSharedEncodedData();
+    }
+    void invalidateSharedEncodedData() const { ++_encodedDataChanges; }
+
     virtual void appendSubclassData(OctreePacketData* packetData, EncodeBitstreamParams& params,
                                     EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
                                     EntityPropertyFlags& requestedProperties,
@@ -612,6 +627,26 @@ protected:
     quint64 _created { 0 };
     quint64 _changedOnServer { 0 };
 
+    // see getSharedEncodedData(), any change to the timestamps or to the entity invalidates the encoding
+    struct EncodedDataVersion {
+        quint64 lastEdited { 0 };
+        quint64 lastUpdated { 0 };
+        quint64 lastSimulated { 0 };
+        quint64 changedOnServer { 0 };
+        uint32_t changes { 0 };
+
+        bool operator==(const EncodedDataVersion& other) const {
+            return lastEdited == other.lastEdited && lastUpdated == other.lastUpdated &&
+                lastSimulated == other.lastSimulated && changedOnServer == other.changedOnServer &&
+                changes == other.changes;
+        }
+    };
+    mutable std::atomic<uint32_t> _encodedDataChanges { 0 };
+    mutable std::mutex _sharedEncodedDataMutex;
+    mutable QByteArray _sharedEncodedData;
+    mutable EncodedDataVersion _sharedEncodedDataVersion;
+    mutable bool _hasSharedEncodedData { false };
+
     mutable AABox _cachedAABox;
     mutable AACube _maxAACube;
     mutable AACube _minAACube;
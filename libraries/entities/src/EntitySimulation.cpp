@@ -24,7 +24,6 @@ void EntitySimulation::setEntityTree(EntityTreePointer tree) {
         _changedEntities.clear();
         _entitiesToUpdate.clear();
         _mortalEntities.clear();
-        _nextExpiry = std::numeric_limits<uint64_t>::max();
     }
     _entityTree = tree;
 }
@@ -34,6 +33,8 @@ void EntitySimulation::updateEntities() {
     QMutexLocker lock(&_mutex);
     uint64_t now = usecTimestampNow();
 
+    _scanStats.updates++;
+
     // these methods may accumulate entries in _entitiesToBeDeleted
     expireMortalEntities(now);
     callUpdateOnEntitiesThatNeedIt(now);
@@ -68,31 +69,25 @@ void EntitySimulation::prepareEntityForDelete(EntityItemPointer entity) {
 
 // protected
 void EntitySimulation::expireMortalEntities(uint64_t now) {
-    if (now > _nextExpiry) {
-        PROFILE_RANGE_EX(simulation_physics, "ExpireMortals", 0xffff00ff, (uint64_t)_mortalEntities.size());
-        // only search for expired entities if we expect to find one
-        _nextExpiry = std::numeric_limits<uint64_t>::max();
-        QMutexLocker lock(&_mutex);
-        SetOfEntities::iterator itemItr = _mortalEntities.begin();
-        while (itemItr != _mortalEntities.end()) {
-            EntityItemPointer entity = *itemItr;
-            uint64_t expiry = entity->getExpiry();
-            if (expiry < now) {
-                itemItr = _mortalEntities.erase(itemItr);
-                entity->die();
-                prepareEntityForDelete(entity);
-            } else {
-                if (expiry < _nextExpiry) {
-                    // remember the smallest _nextExpiry so we know when to start the next search
-                    _nextExpiry = expiry;
-                }
-                ++itemItr;
-            }
-        }
-        if (_mortalEntities.size() < 1) {
-            _nextExpiry = -1;
+    QMutexLocker lock(&_mutex);
+    _dueEntities.clear();
+    _scanStats.mortals += _mortalEntities.advance(now, _dueEntities);
+    if (_dueEntities.empty()) {
+        return;
+    }
+
+    PROFILE_RANGE_EX(simulation_physics, "ExpireMortals", 0xffff00ff, (uint64_t)_dueEntities.size());
+    for (auto& entity : _dueEntities) {
+        // the lifetime may have been made longer since the entity was scheduled
+        uint64_t expiry = entity->getExpiry();
+        if (expiry < now) {
+            entity->die();
+            prepareEntityForDelete(entity);
+        } else {
+            _mortalEntities.schedule(entity, expiry);
         }
     }
+    _dueEntities.clear();
 }
 
 // protected
@@ -147,11 +142,7 @@ void EntitySimulation::sortEntitiesThatMoved() {
 void EntitySimulation::addEntityToInternalLists(EntityItemPointer entity) {
     // protected: _mutex lock is guaranteed
     if (entity->isMortal()) {
-        _mortalEntities.insert(entity);
-        uint64_t expiry = entity->getExpiry();
-        if (expiry < _nextExpiry) {
-            _nextExpiry = expiry;
-        }
+        _mortalEntities.schedule(entity, entity->getExpiry());
     }
     if (entity->needsToCallUpdate()) {
         _entitiesToUpdate.insert(entity);
@@ -193,11 +184,7 @@ void EntitySimulation::processChangedEntity(const EntityItemPointer& entity) {
     if (dirtyFlags & (Simulation::DIRTY_LIFETIME | Simulation::DIRTY_UPDATEABLE)) {
         if (dirtyFlags & Simulation::DIRTY_LIFETIME) {
             if (entity->isMortal()) {
-                _mortalEntities.insert(entity);
-                uint64_t expiry = entity->getExpiry();
-                if (expiry < _nextExpiry) {
-                    _nextExpiry = expiry;
-                }
+                _mortalEntities.schedule(entity, entity->getExpiry());
             } else {
                 _mortalEntities.remove(entity);
             }
@@ -222,14 +209,19 @@ void EntitySimulation::clearEntities() {
     _deadEntitiesToRemoveFromTree.clear();
     _entitiesToUpdate.clear();
     _mortalEntities.clear();
-    _nextExpiry = std::numeric_limits<uint64_t>::max();
+}
+
+EntitySimulation::ScanStats EntitySimulation::getScanStats() {
+    QMutexLocker lock(&_mutex);
+    return _scanStats;
 }
 
 void EntitySimulation::moveSimpleKinematics(uint64_t now) {
     PROFILE_RANGE_EX(simulation_physics, "MoveSimples", 0xffff00ff, (uint64_t)_simpleKinematicEntities.size());
-    SetOfEntities::iterator itemItr = _simpleKinematicEntities.begin();
-    while (itemItr != _simpleKinematicEntities.end()) {
-        EntityItemPointer entity = *itemItr;
+    _scanStats.kinematics += _simpleKinematicEntities.size();
+    size_t index = 0;
+    while (index < _simpleKinematicEntities.size()) {
+        EntityItemPointer entity = _simpleKinematicEntities[index];
 
         // The entity-server doesn't know where avatars are, so don't attempt to do simple extrapolation for
         // children of avatars.  See related code in EntityMotionState::remoteSimulationOutOfSync.
@@ -244,7 +236,7 @@ void EntitySimulation::moveSimpleKinematics(uint64_t now) {
                 entity->updateQueryAACube();
             }
             _entitiesToSort.insert(entity);
-            ++itemItr;
+            ++index;
         } else {
             if (!isMoving && ancestryIsKnown && !hasAvatarAncestor) {
                 // HACK: This catches most cases where the entity's QueryAACube (and spatial sorting in the EntityTree)
@@ -253,7 +245,7 @@ void EntitySimulation::moveSimpleKinematics(uint64_t now) {
                 _entitiesToSort.insert(entity);
             }
             // the entity is no longer non-physical-kinematic
-            itemItr = _simpleKinematicEntities.erase(itemItr);
+            _simpleKinematicEntities.removeAt(index);
         }
     }
 }
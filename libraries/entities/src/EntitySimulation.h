@@ -12,19 +12,22 @@
 #ifndef hifi_EntitySimulation_h
 #define hifi_EntitySimulation_h
 
-#include <limits>
 #include <unordered_set>
+#include <vector>
 
 #include <QtCore/QObject>
 #include <QVector>
 
 #include <PerfStat.h>
+#include <TimingWheel.h>
 
+#include "DenseSetOfEntities.h"
 #include "EntityItem.h"
 #include "EntityTree.h"
 
 using EntitySimulationPointer = std::shared_ptr<EntitySimulation>;
 using VectorOfEntities = QVector<EntityItemPointer>;
+using EntityTimingWheel = TimingWheel<EntityItem>;
 
 // the EntitySimulation needs to know when these things change on an entity,
 // so it can sort EntityItem or relay its state to the PhysicsEngine.
@@ -44,7 +47,16 @@ const int DIRTY_SIMULATION_FLAGS =
 
 class EntitySimulation : public QObject, public std::enable_shared_from_this<EntitySimulation> {
 public:
-    EntitySimulation() : _mutex(QMutex::Recursive), _nextExpiry(std::numeric_limits<uint64_t>::max()), _entityTree(nullptr) { }
+    // the entities visited by the scheduled work of updateEntities, to show that it scales with the work due
+    struct ScanStats {
+        uint64_t updates { 0 };
+        uint64_t mortals { 0 };
+        uint64_t kinematics { 0 };
+        uint64_t staleOwnerships { 0 };
+        uint64_t ownerless { 0 };
+    };
+
+    EntitySimulation() : _mutex(QMutex::Recursive), _entityTree(nullptr) { }
     virtual ~EntitySimulation() { setEntityTree(nullptr); }
 
     inline EntitySimulationPointer getThisPointer() const {
@@ -80,6 +92,8 @@ public:
     void processChangedEntities();
     virtual void queueEraseDomainEntity(const QUuid& id) const { }
 
+    ScanStats getScanStats();
+
 protected:
     virtual void addEntityToInternalLists(EntityItemPointer entity);
     virtual void removeEntityFromInternalLists(EntityItemPointer entity);
@@ -93,9 +107,12 @@ protected:
     QMutex _mutex{ QMutex::Recursive };
 
     SetOfEntities _entitiesToSort; // entities moved by simulation (and might need resort in EntityTree)
-    SetOfEntities _simpleKinematicEntities; // entities undergoing non-colliding kinematic motion
+    DenseSetOfEntities _simpleKinematicEntities; // entities undergoing non-colliding kinematic motion
     SetOfEntities _deadEntitiesToRemoveFromTree;
 
+    std::vector<EntityItemPointer> _dueEntities; // scratch for advancing the timing wheels
+    ScanStats _scanStats;
+
 private:
     void moveSimpleKinematics();
 
@@ -104,8 +121,7 @@ private:
     std::unordered_set<EntityItemPointer> _changedEntities; // all changes this frame
     SetOfEntities _allEntities; // tracks all entities added the simulation
     SetOfEntities _entitiesToUpdate; // entities that need to call EntityItem::update()
-    SetOfEntities _mortalEntities; // entities that have an expiry
-    uint64_t _nextExpiry;
+    EntityTimingWheel _mortalEntities; // entities that have an expiry
 
     // back pointer to EntityTree structure
     EntityTreePointer _entityTree;
@@ -1390,13 +1390,14 @@ void EntityTree::fixupTerseEditLogging(EntityItemProperties& properties, QList<Q
 }
 
 
-bool EntityTree::filterProperties(const EntityItemPointer& existingEntity, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged, FilterType filterType) const {
+bool EntityTree::filterProperties(const EntityItemPointer& existingEntity, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged, FilterType filterType, const QUuid& senderID) const {
     bool accepted = true;
     auto entityEditFilters = DependencyManager::get<EntityEditFilters>();
     if (entityEditFilters) {
         auto position = existingEntity ? existingEntity->getWorldPosition() : propertiesIn.getPosition();
         auto entityID = existingEntity ? existingEntity->getEntityItemID() : EntityItemID();
-        accepted = entityEditFilters->filter(position, propertiesIn, propertiesOut, wasChanged, filterType, entityID, existingEntity);
+        accepted = entityEditFilters->filter(position, propertiesIn, propertiesOut, wasChanged, filterType, entityID, existingEntity,
+                                             senderID);
     }
 
     return accepted;
@@ -1779,8 +1780,6 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
     }
 
     int processedBytes = 0;
-    bool isAdd = false;
-    bool isClone = false;
     // we handle these types of "edit" packets
     switch (message.getType()) {
         case PacketType::EntityErase: {
@@ -1790,314 +1789,409 @@ int EntityTree::processEditPacketData(ReceivedMessage& message, const unsigned c
         }
 
         case PacketType::EntityClone:
-            isClone = true; // fall through to next case
-            // FALLTHRU
         case PacketType::EntityAdd:
-            isAdd = true;  // fall through to next case
-            // FALLTHRU
         case PacketType::EntityPhysics:
         case PacketType::EntityEdit: {
-            quint64 startDecode = 0, endDecode = 0;
-            quint64 startLookup = 0, endLookup = 0;
-            quint64 startUpdate = 0, endUpdate = 0;
-            quint64 startCreate = 0, endCreate = 0;
-            quint64 startFilter = 0, endFilter = 0;
-            quint64 startLogging = 0, endLogging = 0;
+            DecodedEntityEdit edit;
+            processedBytes = decodeEntityEdit(message.getType(), editData, maxLength, senderNode, edit);
+            applyEntityEdit(edit);
+            break;
+        }
 
-            bool suppressDisallowedClientScript = false;
-            bool suppressDisallowedServerScript = false;
-            bool suppressDisallowedPrivateUserData = false;
-            bool isPhysics = message.getType() == PacketType::EntityPhysics;
+        default:
+            processedBytes = 0;
+            break;
+    }
+    return processedBytes;
+}
 
-            _totalEditMessages++;
 
-            EntityItemID entityItemID;
-            EntityItemProperties properties;
-            startDecode = usecTimestampNow();
-
-            bool validEditPacket = false;
-            EntityItemID entityIDToClone;
-            EntityItemPointer entityToClone;
-            if (isClone) {
-                QByteArray buffer = QByteArray::fromRawData(reinterpret_cast<const char*>(editData), maxLength);
-                validEditPacket = EntityItemProperties::decodeCloneEntityMessage(buffer, processedBytes, entityIDToClone, entityItemID);
-                if (validEditPacket) {
-                    entityToClone = findEntityByEntityItemID(entityIDToClone);
-                    if (entityToClone) {
-                        properties = entityToClone->getProperties();
-                    }
-                }
-            } else {
-                validEditPacket = EntityItemProperties::decodeEntityEditPacket(editData, maxLength, processedBytes, entityItemID, properties);
-            }
+bool EntityTree::canDecodeEditPacketType(PacketType packetType) const {
+    switch (packetType) {
+        case PacketType::EntityAdd:
+        case PacketType::EntityClone:
+        case PacketType::EntityEdit:
+        case PacketType::EntityPhysics:
+            return true;
+        default:
+            return false;
+    }
+}
+
+int EntityTree::decodeEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
+                                     const SharedNodePointer& senderNode, DecodedEditPointer& edit) {
+    if (!getIsServer() || !canDecodeEditPacketType(message.getType())) {
+        return 0;
+    }
 
-            endDecode = usecTimestampNow();
+    auto entityEdit = std::unique_ptr<DecodedEntityEdit>(new DecodedEntityEdit());
+    int processedBytes = decodeEntityEdit(message.getType(), editData, maxLength, senderNode, *entityEdit);
+    edit = std::move(entityEdit);
+    return processedBytes;
+}
 
-            EntityItemPointer existingEntity;
-            if (!isAdd) {
-                // search for the entity by EntityItemID
-                startLookup = usecTimestampNow();
-                existingEntity = findEntityByEntityItemID(entityItemID);
-                endLookup = usecTimestampNow();
-                if (!existingEntity) {
-                    // this is not an add-entity operation, and we don't know about the identified entity.
-                    validEditPacket = false;
-                }
+int EntityTree::processDecodedEdits(std::vector<DecodedEditPointer>& edits) {
+    // Edits to an entity from the same sender that follow each other in the batch are applied as one.  Only adjacent
+    // edits merge, so the merged edit keeps its place among the edits of the other entities it may depend on.
+    // Simulation owners send a stream of physics edits for the entities they own, so under load most of a batch folds.
+    auto entityEditFilters = DependencyManager::get<EntityEditFilters>();
+    bool hasEditFilters = entityEditFilters && entityEditFilters->hasFilters();
+
+    std::vector<DecodedEntityEdit*> entityEdits;
+    entityEdits.reserve(edits.size());
+    for (auto& edit : edits) {
+        auto entityEdit = static_cast<DecodedEntityEdit*>(edit.get());
+        if (!entityEdit) {
+            continue;
+        }
+
+        if (!entityEdits.empty()) {
+            auto previous = entityEdits.back();
+            if (previous->entityItemID == entityEdit->entityItemID &&
+                canCoalesceEntityEdits(*previous, *entityEdit, hasEditFilters)) {
+                previous->properties.merge(entityEdit->properties);
+                previous->properties.setLastEdited(std::max(previous->properties.getLastEdited(),
+                                                            entityEdit->properties.getLastEdited()));
+                previous->decodeTime += entityEdit->decodeTime;
+                _totalEditMessages++;
+                continue;
             }
+        }
 
-            if (validEditPacket && !_entityScriptSourceWhitelist.isEmpty()) {
+        entityEdits.push_back(entityEdit);
+    }
 
-                bool wasDeletedBecauseOfClientScript = false;
+    for (auto entityEdit : entityEdits) {
+        applyEntityEdit(*entityEdit);
+    }
+    return (int)entityEdits.size();
+}
 
-                // check the client entity script to make sure its URL is in the whitelist
-                if (!properties.getScript().isEmpty()) {
-                    bool clientScriptPassedWhitelist = isScriptInWhitelist(properties.getScript());
+bool EntityTree::canCoalesceEntityEdits(const DecodedEntityEdit& earlier, const DecodedEntityEdit& later,
+                                        bool hasEditFilters) {
+    // the checks of rights see the merged properties, so they have to be the sender's, and the same
+    if (!earlier.validEditPacket || !later.validEditPacket || earlier.isAdd || later.isAdd ||
+        earlier.type != later.type || !earlier.senderNode || earlier.senderNode != later.senderNode ||
+        earlier.suppressDisallowedClientScript != later.suppressDisallowedClientScript ||
+        earlier.suppressDisallowedServerScript != later.suppressDisallowedServerScript ||
+        earlier.suppressDisallowedPrivateUserData != later.suppressDisallowedPrivateUserData) {
+        return false;
+    }
 
-                    if (!clientScriptPassedWhitelist) {
-                        if (wantEditLogging()) {
-                            qCDebug(entities) << "User [" << senderNode->getUUID()
-                                << "] attempting to set entity script not on whitelist, edit rejected";
-                        }
+    // the filters judge each edit on its own, a rejected edit mustn't take the accepted ones with it
+    return !hasEditFilters || (!later.isPhysics && later.senderNode->isAllowedEditor());
+}
 
-                        // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
-                        if (isAdd) {
-                            QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                            _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
-                            validEditPacket = false;
-                            wasDeletedBecauseOfClientScript = true;
-                        } else {
-                            suppressDisallowedClientScript = true;
-                        }
-                    }
-                }
+int EntityTree::decodeEntityEdit(PacketType type, const unsigned char* editData, int maxLength,
+                                 const SharedNodePointer& senderNode, DecodedEntityEdit& edit) {
+    int processedBytes = 0;
+    edit.type = type;
+    edit.senderNode = senderNode;
+    edit.isClone = type == PacketType::EntityClone;
+    edit.isAdd = edit.isClone || type == PacketType::EntityAdd;
+    edit.isPhysics = type == PacketType::EntityPhysics;
+
+    quint64 startDecode = usecTimestampNow();
+    if (edit.isClone) {
+        // the properties come from the entity to clone, which needs the tree, so they are checked when it is applied
+        QByteArray buffer = QByteArray::fromRawData(reinterpret_cast<const char*>(editData), maxLength);
+        edit.validEditPacket = EntityItemProperties::decodeCloneEntityMessage(buffer, processedBytes,
+                                                                              edit.entityIDToClone, edit.entityItemID);
+    } else {
+        edit.validEditPacket = EntityItemProperties::decodeEntityEditPacket(editData, maxLength, processedBytes,
+                                                                            edit.entityItemID, edit.properties);
+        checkEntityEditRights(edit);
+    }
+    edit.decodeTime = usecTimestampNow() - startDecode;
 
-                // check all server entity scripts to make sure their URLs are in the whitelist
-                if (!properties.getServerScripts().isEmpty()) {
-                    bool serverScriptPassedWhitelist = isScriptInWhitelist(properties.getServerScripts());
+    return processedBytes;
+}
 
-                    if (!serverScriptPassedWhitelist) {
-                        if (wantEditLogging()) {
-                            qCDebug(entities) << "User [" << senderNode->getUUID()
-                                << "] attempting to set server entity script not on whitelist, edit rejected";
-                        }
+void EntityTree::checkEntityEditRights(DecodedEntityEdit& edit) {
+    const SharedNodePointer& senderNode = edit.senderNode;
+    EntityItemProperties& properties = edit.properties;
 
-                        // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
-                        if (isAdd) {
-                            // Make sure we didn't already need to send back a delete because the client script failed
-                            // the whitelist check
-                            if (!wasDeletedBecauseOfClientScript) {
-                                QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                                _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
-                                validEditPacket = false;
-                            }
-                        } else {
-                            suppressDisallowedServerScript = true;
-                        }
-                    }
-                }
-            }
+    if (edit.validEditPacket && !_entityScriptSourceWhitelist.isEmpty()) {
+
+        bool wasDeletedBecauseOfClientScript = false;
 
-            if (!properties.getPrivateUserData().isEmpty() && validEditPacket && !senderNode->getCanGetAndSetPrivateUserData()) {
+        // check the client entity script to make sure its URL is in the whitelist
+        if (!properties.getScript().isEmpty()) {
+            bool clientScriptPassedWhitelist = isScriptInWhitelist(properties.getScript());
+
+            if (!clientScriptPassedWhitelist) {
                 if (wantEditLogging()) {
                     qCDebug(entities) << "User [" << senderNode->getUUID()
-                        << "] is attempting to set private user data but user isn't allowed; edit rejected...";
+                        << "] attempting to set entity script not on whitelist, edit rejected";
                 }
 
                 // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
-                if (isAdd) {
+                if (edit.isAdd) {
                     QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                    _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
-                    validEditPacket = false;
+                    _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), edit.entityItemID);
+                    edit.validEditPacket = false;
+                    wasDeletedBecauseOfClientScript = true;
                 } else {
-                    suppressDisallowedPrivateUserData = true;
+                    edit.suppressDisallowedClientScript = true;
                 }
             }
+        }
 
-            if (!isClone) {
-                if ((isAdd || properties.lifetimeChanged()) &&
-                    ((!senderNode->getCanRez() && senderNode->getCanRezTmp()) ||
-                    (!senderNode->getCanRezCertified() && senderNode->getCanRezTmpCertified()))) {
-                    // this node is only allowed to rez temporary entities.  if need be, cap the lifetime.
-                    if (properties.getLifetime() == ENTITY_ITEM_IMMORTAL_LIFETIME ||
-                        properties.getLifetime() > _maxTmpEntityLifetime) {
-                        properties.setLifetime(_maxTmpEntityLifetime);
-                        bumpTimestamp(properties);
-                    }
+        // check all server entity scripts to make sure their URLs are in the whitelist
+        if (!properties.getServerScripts().isEmpty()) {
+            bool serverScriptPassedWhitelist = isScriptInWhitelist(properties.getServerScripts());
+
+            if (!serverScriptPassedWhitelist) {
+                if (wantEditLogging()) {
+                    qCDebug(entities) << "User [" << senderNode->getUUID()
+                        << "] attempting to set server entity script not on whitelist, edit rejected";
                 }
 
-                if (isAdd && properties.getLocked() && !senderNode->isAllowedEditor()) {
-                    // if a node can't change locks, don't allow it to create an already-locked entity -- automatically
-                    // clear the locked property and allow the unlocked entity to be created.
-                    properties.setLocked(false);
-                    bumpTimestamp(properties);
+                // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
+                if (edit.isAdd) {
+                    // Make sure we didn't already need to send back a delete because the client script failed
+                    // the whitelist check
+                    if (!wasDeletedBecauseOfClientScript) {
+                        QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+                        _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), edit.entityItemID);
+                        edit.validEditPacket = false;
+                    }
+                } else {
+                    edit.suppressDisallowedServerScript = true;
                 }
             }
+        }
+    }
 
-            // If we got a valid edit packet, then it could be a new entity or it could be an update to
-            // an existing entity... handle appropriately
-            if (validEditPacket) {
-                startFilter = usecTimestampNow();
-                bool wasChanged = false;
-                // Having (un)lock rights bypasses the filter, unless it's a physics result.
-                FilterType filterType = isPhysics ? FilterType::Physics : (isAdd ? FilterType::Add : FilterType::Edit);
-                bool allowed = (!isPhysics && senderNode->isAllowedEditor()) || filterProperties(existingEntity, properties, properties, wasChanged, filterType);
-                if (!allowed) {
-                    // the update failed and we need to convey that fact to the sender
-                    // our method is to re-assert the current properties and bump the lastEdited timestamp
-                    auto timestamp = properties.getLastEdited();
-                    properties = EntityItemProperties();
-                    properties.setLastEdited(timestamp);
-                }
-                if (!allowed || wasChanged) {
-                    bumpTimestamp(properties);
-                    // For now, free ownership on any modification.
-                    properties.clearSimulationOwner();
-                }
-                endFilter = usecTimestampNow();
+    if (!properties.getPrivateUserData().isEmpty() && edit.validEditPacket && !senderNode->getCanGetAndSetPrivateUserData()) {
+        if (wantEditLogging()) {
+            qCDebug(entities) << "User [" << senderNode->getUUID()
+                << "] is attempting to set private user data but user isn't allowed; edit rejected...";
+        }
 
-                if (existingEntity && !isAdd) {
+        // If this was an add, we also want to tell the client that sent this edit that the entity was not added.
+        if (edit.isAdd) {
+            QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+            _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), edit.entityItemID);
+            edit.validEditPacket = false;
+        } else {
+            edit.suppressDisallowedPrivateUserData = true;
+        }
+    }
 
-                    if (suppressDisallowedClientScript) {
-                        bumpTimestamp(properties);
-                        properties.setScript(existingEntity->getScript());
-                    }
+    if (!edit.isClone) {
+        if ((edit.isAdd || properties.lifetimeChanged()) &&
+            ((!senderNode->getCanRez() && senderNode->getCanRezTmp()) ||
+            (!senderNode->getCanRezCertified() && senderNode->getCanRezTmpCertified()))) {
+            // this node is only allowed to rez temporary entities.  if need be, cap the lifetime.
+            if (properties.getLifetime() == ENTITY_ITEM_IMMORTAL_LIFETIME ||
+                properties.getLifetime() > _maxTmpEntityLifetime) {
+                properties.setLifetime(_maxTmpEntityLifetime);
+                bumpTimestamp(properties);
+            }
+        }
 
-                    if (suppressDisallowedServerScript) {
-                        bumpTimestamp(properties);
-                        properties.setServerScripts(existingEntity->getServerScripts());
-                    }
+        if (edit.isAdd && properties.getLocked() && !senderNode->isAllowedEditor()) {
+            // if a node can't change locks, don't allow it to create an already-locked entity -- automatically
+            // clear the locked property and allow the unlocked entity to be created.
+            properties.setLocked(false);
+            bumpTimestamp(properties);
+        }
+    }
+}
+
+void EntityTree::applyEntityEdit(DecodedEntityEdit& edit) {
+    quint64 startLookup = 0, endLookup = 0;
+    quint64 startUpdate = 0, endUpdate = 0;
+    quint64 startCreate = 0, endCreate = 0;
+    quint64 startFilter = 0, endFilter = 0;
+    quint64 startLogging = 0, endLogging = 0;
+
+    const SharedNodePointer& senderNode = edit.senderNode;
+    const EntityItemID& entityItemID = edit.entityItemID;
+    const EntityItemID& entityIDToClone = edit.entityIDToClone;
+    EntityItemProperties& properties = edit.properties;
+    bool isAdd = edit.isAdd;
+    bool isClone = edit.isClone;
+    bool isPhysics = edit.isPhysics;
+
+    _totalEditMessages++;
 
-                    if (suppressDisallowedPrivateUserData) {
-                        bumpTimestamp(properties);
-                        properties.setPrivateUserData(existingEntity->getPrivateUserData());
+    EntityItemPointer entityToClone;
+    if (isClone && edit.validEditPacket) {
+        entityToClone = findEntityByEntityItemID(entityIDToClone);
+        if (entityToClone) {
+            properties = entityToClone->getProperties();
+        }
+        checkEntityEditRights(edit);
+    }
+
+    EntityItemPointer existingEntity;
+    if (!isAdd) {
+        // search for the entity by EntityItemID
+        startLookup = usecTimestampNow();
+        existingEntity = findEntityByEntityItemID(entityItemID);
+        endLookup = usecTimestampNow();
+        if (!existingEntity) {
+            // this is not an add-entity operation, and we don't know about the identified entity.
+            edit.validEditPacket = false;
+        }
+    }
+
+    // If we got a valid edit packet, then it could be a new entity or it could be an update to
+    // an existing entity... handle appropriately
+    if (edit.validEditPacket) {
+        startFilter = usecTimestampNow();
+        bool wasChanged = false;
+        // Having (un)lock rights bypasses the filter, unless it's a physics result.
+        FilterType filterType = isPhysics ? FilterType::Physics : (isAdd ? FilterType::Add : FilterType::Edit);
+        bool allowed = (!isPhysics && senderNode->isAllowedEditor()) || filterProperties(existingEntity, properties, properties, wasChanged, filterType, senderNode->getUUID());
+        if (!allowed) {
+            // the update failed and we need to convey that fact to the sender
+            // our method is to re-assert the current properties and bump the lastEdited timestamp
+            auto timestamp = properties.getLastEdited();
+            properties = EntityItemProperties();
+            properties.setLastEdited(timestamp);
+        }
+        if (!allowed || wasChanged) {
+            bumpTimestamp(properties);
+            // For now, free ownership on any modification.
+            properties.clearSimulationOwner();
+        }
+        endFilter = usecTimestampNow();
+
+        if (existingEntity && !isAdd) {
+
+            if (edit.suppressDisallowedClientScript) {
+                bumpTimestamp(properties);
+                properties.setScript(existingEntity->getScript());
+            }
+
+            if (edit.suppressDisallowedServerScript) {
+                bumpTimestamp(properties);
+                properties.setServerScripts(existingEntity->getServerScripts());
+            }
+
+            if (edit.suppressDisallowedPrivateUserData) {
+                bumpTimestamp(properties);
+                properties.setPrivateUserData(existingEntity->getPrivateUserData());
+            }
+
+            // if the EntityItem exists, then update it
+            startLogging = usecTimestampNow();
+            if (wantEditLogging()) {
+                qCDebug(entities) << "User [" << senderNode->getUUID() << "] editing entity. ID:" << entityItemID;
+                qCDebug(entities) << "   properties:" << properties;
+            }
+            if (wantTerseEditLogging()) {
+                QList<QString> changedProperties = properties.listChangedProperties();
+                fixupTerseEditLogging(properties, changedProperties);
+                qCDebug(entities) << senderNode->getUUID() << "edit" <<
+                    existingEntity->getDebugName() << changedProperties;
+            }
+            endLogging = usecTimestampNow();
+
+            startUpdate = usecTimestampNow();
+            if (!isPhysics) {
+                properties.setLastEditedBy(senderNode->getUUID());
+            }
+            updateEntity(existingEntity, properties, senderNode);
+            existingEntity->markAsChangedOnServer();
+            endUpdate = usecTimestampNow();
+            _totalUpdates++;
+        } else if (isAdd) {
+            bool failedAdd = !allowed;
+            bool isCertified = !properties.getCertificateID().isEmpty();
+            bool isCloneable = properties.getCloneable();
+            int cloneLimit = properties.getCloneLimit();
+            if (!allowed) {
+                qCDebug(entities) << "Filtered entity add. ID:" << entityItemID;
+            } else if (!isClone && !isCertified && !senderNode->getCanRez() && !senderNode->getCanRezTmp()) {
+                failedAdd = true;
+                qCDebug(entities) << "User without 'uncertified rez rights' [" << senderNode->getUUID()
+                    << "] attempted to add an uncertified entity with ID:" << entityItemID;
+            } else if (!isClone && isCertified && !senderNode->getCanRezCertified() && !senderNode->getCanRezTmpCertified()) {
+                failedAdd = true;
+                qCDebug(entities) << "User without 'certified rez rights' [" << senderNode->getUUID()
+                    << "] attempted to add a certified entity with ID:" << entityItemID;
+            } else if (isClone && isCertified && !properties.getCertificateType().contains(DOMAIN_UNLIMITED)) {
+                failedAdd = true;
+                qCDebug(entities) << "User attempted to clone certified entity from entity ID:" << entityIDToClone;
+            } else if (isClone && !isCloneable) {
+                failedAdd = true;
+                qCDebug(entities) << "User attempted to clone non-cloneable entity from entity ID:" << entityIDToClone;
+            } else if (isClone && entityToClone && entityToClone->getCloneIDs().size() >= cloneLimit && cloneLimit != 0) {
+                failedAdd = true;
+                qCDebug(entities) << "User attempted to clone entity ID:" << entityIDToClone << " which reached it's cloneable limit.";
+            } else {
+                if (isClone) {
+                    properties.convertToCloneProperties(entityIDToClone);
+                }
+
+                // this is a new entity... assign a new entityID
+                properties.setLastEditedBy(senderNode->getUUID());
+                startCreate = usecTimestampNow();
+                EntityItemPointer newEntity = addEntity(entityItemID, properties);
+                endCreate = usecTimestampNow();
+                _totalCreates++;
+
+                if (newEntity && isCertified && getIsServer()) {
+                    if (!properties.verifyStaticCertificateProperties()) {
+                        qCDebug(entities) << "User" << senderNode->getUUID()
+                            << "attempted to add a certified entity with ID" << entityItemID << "which failed"
+                            << "static certificate verification.";
+                        // Delete the entity we just added if it doesn't pass static certificate verification
+                        deleteEntity(entityItemID, true);
+                    } else {
+                        validatePop(properties.getCertificateID(), entityItemID, senderNode);
                     }
+                }
+
+                if (newEntity && isClone) {
+                    entityToClone->addCloneID(newEntity->getEntityItemID());
+                    newEntity->setCloneOriginID(entityIDToClone);
+                }
+
+                if (newEntity) {
+                    newEntity->markAsChangedOnServer();
+                    notifyNewlyCreatedEntity(*newEntity, senderNode);
 
-                    // if the EntityItem exists, then update it
                     startLogging = usecTimestampNow();
                     if (wantEditLogging()) {
-                        qCDebug(entities) << "User [" << senderNode->getUUID() << "] editing entity. ID:" << entityItemID;
+                        qCDebug(entities) << "User [" << senderNode->getUUID() << "] added entity. ID:"
+                                          << newEntity->getEntityItemID();
                         qCDebug(entities) << "   properties:" << properties;
                     }
                     if (wantTerseEditLogging()) {
                         QList<QString> changedProperties = properties.listChangedProperties();
                         fixupTerseEditLogging(properties, changedProperties);
-                        qCDebug(entities) << senderNode->getUUID() << "edit" <<
-                            existingEntity->getDebugName() << changedProperties;
+                        qCDebug(entities) << senderNode->getUUID() << "add" << entityItemID << changedProperties;
                     }
                     endLogging = usecTimestampNow();
 
-                    startUpdate = usecTimestampNow();
-                    if (!isPhysics) {
-                        properties.setLastEditedBy(senderNode->getUUID());
-                    }
-                    updateEntity(existingEntity, properties, senderNode);
-                    existingEntity->markAsChangedOnServer();
-                    endUpdate = usecTimestampNow();
-                    _totalUpdates++;
-                } else if (isAdd) {
-                    bool failedAdd = !allowed;
-                    bool isCertified = !properties.getCertificateID().isEmpty();
-                    bool isCloneable = properties.getCloneable();
-                    int cloneLimit = properties.getCloneLimit();
-                    if (!allowed) {
-                        qCDebug(entities) << "Filtered entity add. ID:" << entityItemID;
-                    } else if (!isClone && !isCertified && !senderNode->getCanRez() && !senderNode->getCanRezTmp()) {
-                        failedAdd = true;
-                        qCDebug(entities) << "User without 'uncertified rez rights' [" << senderNode->getUUID()
-                            << "] attempted to add an uncertified entity with ID:" << entityItemID;
-                    } else if (!isClone && isCertified && !senderNode->getCanRezCertified() && !senderNode->getCanRezTmpCertified()) {
-                        failedAdd = true;
-                        qCDebug(entities) << "User without 'certified rez rights' [" << senderNode->getUUID()
-                            << "] attempted to add a certified entity with ID:" << entityItemID;
-                    } else if (isClone && isCertified && !properties.getCertificateType().contains(DOMAIN_UNLIMITED)) {
-                        failedAdd = true;
-                        qCDebug(entities) << "User attempted to clone certified entity from entity ID:" << entityIDToClone;
-                    } else if (isClone && !isCloneable) {
-                        failedAdd = true;
-                        qCDebug(entities) << "User attempted to clone non-cloneable entity from entity ID:" << entityIDToClone;
-                    } else if (isClone && entityToClone && entityToClone->getCloneIDs().size() >= cloneLimit && cloneLimit != 0) {
-                        failedAdd = true;
-                        qCDebug(entities) << "User attempted to clone entity ID:" << entityIDToClone << " which reached it's cloneable limit.";
-                    } else {
-                        if (isClone) {
-                            properties.convertToCloneProperties(entityIDToClone);
-                        }
-
-                        // this is a new entity... assign a new entityID
-                        properties.setLastEditedBy(senderNode->getUUID());
-                        startCreate = usecTimestampNow();
-                        EntityItemPointer newEntity = addEntity(entityItemID, properties);
-                        endCreate = usecTimestampNow();
-                        _totalCreates++;
-
-                        if (newEntity && isCertified && getIsServer()) {
-                            if (!properties.verifyStaticCertificateProperties()) {
-                                qCDebug(entities) << "User" << senderNode->getUUID()
-                                    << "attempted to add a certified entity with ID" << entityItemID << "which failed"
-                                    << "static certificate verification.";
-                                // Delete the entity we just added if it doesn't pass static certificate verification
-                                deleteEntity(entityItemID, true);
-                            } else {
-                                validatePop(properties.getCertificateID(), entityItemID, senderNode);
-                            }
-                        }
-
-                        if (newEntity && isClone) {
-                            entityToClone->addCloneID(newEntity->getEntityItemID());
-                            newEntity->setCloneOriginID(entityIDToClone);
-                        }
-
-                        if (newEntity) {
-                            newEntity->markAsChangedOnServer();
-                            notifyNewlyCreatedEntity(*newEntity, senderNode);
-                            
-                            startLogging = usecTimestampNow();
-                            if (wantEditLogging()) {
-                                qCDebug(entities) << "User [" << senderNode->getUUID() << "] added entity. ID:"
-                                                  << newEntity->getEntityItemID();
-                                qCDebug(entities) << "   properties:" << properties;
-                            }
-                            if (wantTerseEditLogging()) {
-                                QList<QString> changedProperties = properties.listChangedProperties();
-                                fixupTerseEditLogging(properties, changedProperties);
-                                qCDebug(entities) << senderNode->getUUID() << "add" << entityItemID << changedProperties;
-                            }
-                            endLogging = usecTimestampNow();
-
-                        } else {
-                            failedAdd = true;
-                            qCDebug(entities) << "Add entity failed ID:" << entityItemID;
-                        }
-                    }
-                    if (failedAdd) { // Let client know it failed, so that they don't have an entity that no one else sees.
-                        QWriteLocker locker(&_recentlyDeletedEntitiesLock);
-                        _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
-                    }
                 } else {
-                    HIFI_FCDEBUG(entities(), "Edit failed. [" << message.getType() <<"] " <<
-                            "entity id:" << entityItemID << 
-                            "existingEntity pointer:" << existingEntity.get());
+                    failedAdd = true;
+                    qCDebug(entities) << "Add entity failed ID:" << entityItemID;
                 }
             }
-
-
-            _totalDecodeTime += endDecode - startDecode;
-            _totalLookupTime += endLookup - startLookup;
-            _totalUpdateTime += endUpdate - startUpdate;
-            _totalCreateTime += endCreate - startCreate;
-            _totalLoggingTime += endLogging - startLogging;
-            _totalFilterTime += endFilter - startFilter;
-
-            break;
+            if (failedAdd) { // Let client know it failed, so that they don't have an entity that no one else sees.
+                QWriteLocker locker(&_recentlyDeletedEntitiesLock);
+                _recentlyDeletedEntityItemIDs.insert(usecTimestampNow(), entityItemID);
+            }
+        } else {
+            HIFI_FCDEBUG(entities(), "Edit failed. [" << edit.type <<"] " <<
+                    "entity id:" << entityItemID <<
+                    "existingEntity pointer:" << existingEntity.get());
         }
-
-        default:
-            processedBytes = 0;
-            break;
     }
-    return processedBytes;
-}
 
+    _totalDecodeTime += edit.decodeTime;
+    _totalLookupTime += endLookup - startLookup;
+    _totalUpdateTime += endUpdate - startUpdate;
+    _totalCreateTime += endCreate - startCreate;
+    _totalLoggingTime += endLogging - startLogging;
+    _totalFilterTime += endFilter - startFilter;
+}
 
 void EntityTree::notifyNewlyCreatedEntity(const EntityItem& newEntity, const SharedNodePointer& senderNode) {
     _newlyCreatedHooksLock.lockForRead();
@@ -2354,7 +2448,7 @@ bool EntityTree::shouldEraseEntity(EntityItemID entityID, const SharedNodePointe
     EntityItemProperties dummyProperties;
     bool wasChanged = false;
 
-    bool allowed = (sourceNode->isAllowedEditor()) || filterProperties(existingEntity, dummyProperties, dummyProperties, wasChanged, filterType);
+    bool allowed = (sourceNode->isAllowedEditor()) || filterProperties(existingEntity, dummyProperties, dummyProperties, wasChanged, filterType, sourceNode->getUUID());
     auto endFilter = usecTimestampNow();
 
     _totalFilterTime += endFilter - startFilter;
@@ -3097,6 +3191,144 @@ bool EntityTree::readFromMap(QVariantMap& map) {
     return success;
 }
 
+namespace {
+    // the first byte of each binary persist item says how the entity is encoded
+    enum PersistEncoding : char {
+        WirePersistEncoding = 0, // the entity data of EntityData packets
+        JSONPersistEncoding = 1 // the properties as they are saved to JSON, for entities too long for the wire format
+    };
+
+    const int MAX_PERSIST_WIRE_ENCODING_SIZE = 16 * 1024 * 1024;
+
+    QByteArray encodeEntityForPersist(const EntityItemPointer& entity, std::unique_ptr<QScriptEngine>& scriptEngine) {
+        for (int targetSize = MAX_OCTREE_PACKET_DATA_SIZE; targetSize <= MAX_PERSIST_WIRE_ENCODING_SIZE; targetSize *= 4) {
+            OctreePacketData packetData(false, targetSize);
+            EncodeBitstreamParams params;
+            auto extraEncodeData = std::make_shared<EntityTreeElementExtraEncodeData>();
+
+            auto appendState = entity->appendEntityData(&packetData, params, extraEncodeData, true);
+            if (packetData.hasTruncatedValues()) {
+                break;
+            }
+            if (appendState == OctreeElement::COMPLETED) {
+                QByteArray encoded(1, WirePersistEncoding);
+                encoded.append((const char*)packetData.getUncompressedData(), packetData.getUncompressedSize());
+                return encoded;
+            }
+        }
+
+        if (!scriptEngine) {
+            scriptEngine.reset(new QScriptEngine());
+        }
+        QScriptValue properties = EntityItemNonDefaultPropertiesToScriptValue(scriptEngine.get(), entity->getProperties());
+        QByteArray encoded(1, JSONPersistEncoding);
+        encoded.append(QJsonDocument::fromVariant(properties.toVariant()).toJson(QJsonDocument::Compact));
+        return encoded;
+    }
+}
+
+void EntityTree::collectBinaryPersistChanges(bool allItems, OctreeBinaryPersist::Changes& changes) {
+    std::unique_ptr<QScriptEngine> scriptEngine;
+    QSet<EntityItemID> persistedIDs;
+
+    withReadLock([&] {
+        quint64 lastCollect = _lastBinaryPersistCollect;
+        _lastBinaryPersistCollect = usecTimestampNow();
+
+        // isParentIDValid looks the parent up in _entityMap, so don't hold its lock past here
+        QList<EntityItemPointer> entities;
+        {
+            QReadLocker locker(&_entityMapLock);
+            entities = _entityMap.values();
+        }
+        persistedIDs.reserve(entities.size());
+
+        for (const auto& entity : entities) {
+            // like the JSON saves, see RecurseOctreeToMapOperator
+            if (!entity->isParentIDValid()) {
+                continue;
+            }
+
+            const EntityItemID& entityID = entity->getEntityItemID();
+            persistedIDs.insert(entityID);
+
+            quint64 lastChanged = std::max({ entity->getLastEdited(), entity->getLastChangedOnServer(),
+                                             entity->getLastSimulated() });
+            if (allItems || lastChanged >= lastCollect || !_binaryPersistedIDs.contains(entityID)) {
+                changes.updated.emplace_back(entityID, encodeEntityForPersist(entity, scriptEngine));
+            }
+        }
+    });
+
+    if (!allItems) {
+        for (const auto& entityID : _binaryPersistedIDs) {
+            if (!persistedIDs.contains(entityID)) {
+                changes.removed.push_back(entityID);
+            }
+        }
+    }
+    _binaryPersistedIDs.swap(persistedIDs);
+}
+
+bool EntityTree::readFromBinaryPersistItems(const std::vector<QByteArray>& items, PacketVersion bitstreamVersion) {
+    // decoded on this thread, the entities are QObjects that belong to the thread creating them, and reading one
+    // goes through the node list, the dynamic factory and the subclasses' readers, none of them made for concurrent use
+    QScriptEngine scriptEngine;
+    QMap<QUuid, QVector<QUuid>> cloneIDs;
+    bool success = true;
+
+    for (size_t i = 0; i < items.size(); ++i) {
+        const QByteArray& item = items[i];
+        EntityItemPointer entity;
+
+        if (item.size() > 1 && item[0] == WirePersistEncoding) {
+            const unsigned char* data = (const unsigned char*)item.constData() + 1;
+            int dataSize = item.size() - 1;
+            entity = EntityTypes::constructEntityItem(data, dataSize);
+            if (entity) {
+                ReadBitstreamToTreeParams args;
+                entity->readEntityDataFromBuffer(data, dataSize, args);
+            }
+        }
+
+        if (entity) {
+            if (getContainingElement(entity->getEntityItemID())) {
+                qCWarning(entities) << "Binary entity already in the tree:" << entity->getEntityItemID();
+                continue;
+            }
+            AddEntityOperator theOperator(getThisPointer(), entity);
+            recurseTreeWithOperator(&theOperator);
+            postAddEntity(entity);
+        } else if (item.size() > 1 && item[0] == JSONPersistEncoding) {
+            QVariantMap entityMap = QJsonDocument::fromJson(item.mid(1)).toVariant().toMap();
+            QScriptValue entityScriptValue = variantMapToScriptValue(entityMap, scriptEngine);
+            EntityItemProperties properties;
+            EntityItemPropertiesFromScriptValueIgnoreReadOnly(entityScriptValue, properties);
+            entity = addEntity(EntityItemID(QUuid(entityMap["id"].toString())), properties);
+        }
+
+        if (!entity) {
+            qCDebug(entities) << "Failed to read binary entity" << i;
+            success = false;
+            continue;
+        }
+
+        const QUuid& cloneOriginID = entity->getCloneOriginID();
+        if (!cloneOriginID.isNull()) {
+            cloneIDs[cloneOriginID].push_back(entity->getEntityItemID());
+        }
+    }
+
+    for (const auto& entityID : cloneIDs.keys()) {
+        auto entity = findEntityByID(entityID);
+        if (entity) {
+            entity->setCloneIDs(cloneIDs.value(entityID));
+        }
+    }
+
+    return success;
+}
+
 bool EntityTree::writeToJSON(QString& jsonString, const OctreeElementPointer& element) {
     QScriptEngine scriptEngine;
     RecurseOctreeToJSONOperator theOperator(element, &scriptEngine, jsonString);
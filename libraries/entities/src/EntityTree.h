@@ -89,6 +89,10 @@ public:
     void fixupTerseEditLogging(EntityItemProperties& properties, QList<QString>& changedProperties);
     virtual int processEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
                                       const SharedNodePointer& senderNode) override;
+    virtual bool canDecodeEditPacketType(PacketType packetType) const override;
+    virtual int decodeEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
+                                     const SharedNodePointer& senderNode, DecodedEditPointer& edit) override;
+    virtual int processDecodedEdits(std::vector<DecodedEditPointer>& edits) override;
     virtual void processChallengeOwnershipRequestPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) override;
     virtual void processChallengeOwnershipReplyPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) override;
     virtual void processChallengeOwnershipPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) override;
@@ -198,6 +202,10 @@ public:
     virtual bool readFromMap(QVariantMap& entityDescription) override;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) override;
 
+    virtual bool supportsBinaryPersist() const override { return true; }
+    virtual void collectBinaryPersistChanges(bool allItems, OctreeBinaryPersist::Changes& changes) override;
+    virtual bool readFromBinaryPersistItems(const std::vector<QByteArray>& items, PacketVersion bitstreamVersion) override;
+
 
     glm::vec3 getContentsDimensions();
     float getContentsLargestDimension();
@@ -370,7 +378,7 @@ protected:
 
     float _maxTmpEntityLifetime { DEFAULT_MAX_TMP_ENTITY_LIFETIME };
 
-    bool filterProperties(const EntityItemPointer& existingEntity, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged, FilterType filterType) const;
+    bool filterProperties(const EntityItemPointer& existingEntity, EntityItemProperties& propertiesIn, EntityItemProperties& propertiesOut, bool& wasChanged, FilterType filterType, const QUuid& senderID = QUuid()) const;
     bool _hasEntityEditFilter{ false };
     QStringList _entityScriptSourceWhitelist;
 
@@ -386,6 +394,31 @@ private:
     void sendChallengeOwnershipRequestPacket(const QByteArray& id, const QByteArray& text, const QByteArray& nodeToChallenge, const SharedNodePointer& senderNode);
     void validatePop(const QString& certID, const EntityItemID& entityItemID, const SharedNodePointer& senderNode);
 
+    // an add, clone, edit or physics edit, decoded and checked against the rights of its sender
+    class DecodedEntityEdit : public DecodedEdit {
+    public:
+        PacketType type;
+        SharedNodePointer senderNode;
+        EntityItemID entityItemID;
+        EntityItemID entityIDToClone;
+        EntityItemProperties properties;
+        bool isAdd { false };
+        bool isClone { false };
+        bool isPhysics { false };
+        bool validEditPacket { false };
+        bool suppressDisallowedClientScript { false };
+        bool suppressDisallowedServerScript { false };
+        bool suppressDisallowedPrivateUserData { false };
+        quint64 decodeTime { 0 };
+    };
+
+    int decodeEntityEdit(PacketType type, const unsigned char* editData, int maxLength,
+                         const SharedNodePointer& senderNode, DecodedEntityEdit& edit);
+    void checkEntityEditRights(DecodedEntityEdit& edit);
+    void applyEntityEdit(DecodedEntityEdit& edit);
+    static bool canCoalesceEntityEdits(const DecodedEntityEdit& earlier, const DecodedEntityEdit& later,
+                                       bool hasEditFilters);
+
     std::shared_ptr<AvatarData> _myAvatar{ nullptr };
 
     static std::function<QObject*(const QUuid&)> _getEntityObjectOperator;
@@ -400,6 +433,10 @@ private:
 
     std::map<QString, QString> _namedPaths;
 
+    // the entities in the last binary save, and when it was collected
+    QSet<EntityItemID> _binaryPersistedIDs;
+    quint64 _lastBinaryPersistCollect { 0 };
+
     void updateEntityQueryAACubeWorker(SpatiallyNestablePointer object, EntityEditPacketSender* packetSender,
                                        MovingEntitiesOperator& moveOperator, bool force, bool tellServer);
 };
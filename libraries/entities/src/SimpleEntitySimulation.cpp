@@ -27,11 +27,11 @@ void SimpleEntitySimulation::clearOwnership(const QUuid& ownerID) {
             // the simulator has abandonded this object --> remove from owned list
             itemItr = _entitiesWithSimulationOwner.erase(itemItr);
 
+            _staleOwnerships.remove(entity);
+
             if (entity->getDynamic() && entity->hasLocalVelocity()) {
                 // it is still moving dynamically --> add to orphaned list
-                _entitiesThatNeedSimulationOwner.insert(entity);
-                uint64_t expiry = entity->getLastChangedOnServer() + MAX_OWNERLESS_PERIOD;
-                _nextOwnerlessExpiry = glm::min(_nextOwnerlessExpiry, expiry);
+                needSimulationOwner(entity);
             }
 
             // remove ownership and dirty all the tree elements that contain the it
@@ -61,20 +61,16 @@ void SimpleEntitySimulation::addEntityToInternalLists(EntityItemPointer entity)
         if (entity->getDynamic()) {
             // we don't allow dynamic objects to move without an owner so nothing to do here
         } else if (entity->isMovingRelativeToParent()) {
-            SetOfEntities::iterator itr = _simpleKinematicEntities.find(entity);
-            if (itr != _simpleKinematicEntities.end()) {
-                _simpleKinematicEntities.insert(entity);
+            if (_simpleKinematicEntities.insert(entity)) {
                 entity->setLastSimulated(usecTimestampNow());
             }
         }
     } else {
         _entitiesWithSimulationOwner.insert(entity);
-        _nextStaleOwnershipExpiry = glm::min(_nextStaleOwnershipExpiry, entity->getSimulationOwnershipExpiry());
+        _staleOwnerships.schedule(entity, entity->getSimulationOwnershipExpiry());
 
         if (entity->isMovingRelativeToParent()) {
-            SetOfEntities::iterator itr = _simpleKinematicEntities.find(entity);
-            if (itr != _simpleKinematicEntities.end()) {
-                _simpleKinematicEntities.insert(entity);
+            if (_simpleKinematicEntities.insert(entity)) {
                 entity->setLastSimulated(usecTimestampNow());
             }
         }
@@ -83,6 +79,7 @@ void SimpleEntitySimulation::addEntityToInternalLists(EntityItemPointer entity)
 
 void SimpleEntitySimulation::removeEntityFromInternalLists(EntityItemPointer entity) {
     _entitiesWithSimulationOwner.remove(entity);
+    _staleOwnerships.remove(entity);
     _entitiesThatNeedSimulationOwner.remove(entity);
     EntitySimulation::removeEntityFromInternalLists(entity);
 }
@@ -95,42 +92,30 @@ void SimpleEntitySimulation::processChangedEntity(const EntityItemPointer& entit
         if (entity->getSimulatorID().isNull()) {
             QMutexLocker lock(&_mutex);
             _entitiesWithSimulationOwner.remove(entity);
+            _staleOwnerships.remove(entity);
 
             if (entity->getDynamic()) {
                 // we don't allow dynamic objects to move without an owner
-                SetOfEntities::iterator itr = _simpleKinematicEntities.find(entity);
-                if (itr != _simpleKinematicEntities.end()) {
-                    _simpleKinematicEntities.erase(itr);
-                }
+                _simpleKinematicEntities.remove(entity);
             } else if (entity->isMovingRelativeToParent()) {
-                SetOfEntities::iterator itr = _simpleKinematicEntities.find(entity);
-                if (itr == _simpleKinematicEntities.end()) {
-                    _simpleKinematicEntities.insert(entity);
+                if (_simpleKinematicEntities.insert(entity)) {
                     entity->setLastSimulated(usecTimestampNow());
                 }
             } else {
-                SetOfEntities::iterator itr = _simpleKinematicEntities.find(entity);
-                if (itr != _simpleKinematicEntities.end()) {
-                    _simpleKinematicEntities.erase(itr);
-                }
+                _simpleKinematicEntities.remove(entity);
             }
         } else {
             QMutexLocker lock(&_mutex);
             _entitiesWithSimulationOwner.insert(entity);
-            _nextStaleOwnershipExpiry = glm::min(_nextStaleOwnershipExpiry, entity->getSimulationOwnershipExpiry());
+            _staleOwnerships.schedule(entity, entity->getSimulationOwnershipExpiry());
             _entitiesThatNeedSimulationOwner.remove(entity);
 
             if (entity->isMovingRelativeToParent()) {
-                SetOfEntities::iterator itr = _simpleKinematicEntities.find(entity);
-                if (itr == _simpleKinematicEntities.end()) {
-                    _simpleKinematicEntities.insert(entity);
+                if (_simpleKinematicEntities.insert(entity)) {
                     entity->setLastSimulated(usecTimestampNow());
                 }
             } else {
-                SetOfEntities::iterator itr = _simpleKinematicEntities.find(entity);
-                if (itr != _simpleKinematicEntities.end()) {
-                    _simpleKinematicEntities.erase(itr);
-                }
+                _simpleKinematicEntities.remove(entity);
             }
         }
     }
@@ -140,6 +125,7 @@ void SimpleEntitySimulation::processChangedEntity(const EntityItemPointer& entit
 void SimpleEntitySimulation::clearEntities() {
     QMutexLocker lock(&_mutex);
     _entitiesWithSimulationOwner.clear();
+    _staleOwnerships.clear();
     _entitiesThatNeedSimulationOwner.clear();
     EntitySimulation::clearEntities();
 }
@@ -154,63 +140,57 @@ void SimpleEntitySimulation::sortEntitiesThatMoved() {
     EntitySimulation::sortEntitiesThatMoved();
 }
 
-void SimpleEntitySimulation::expireStaleOwnerships(uint64_t now) {
-    if (now > _nextStaleOwnershipExpiry) {
-        _nextStaleOwnershipExpiry = (uint64_t)(-1);
-        SetOfEntities::iterator itemItr = _entitiesWithSimulationOwner.begin();
-        while (itemItr != _entitiesWithSimulationOwner.end()) {
-            EntityItemPointer entity = *itemItr;
-            uint64_t expiry = entity->getSimulationOwnershipExpiry();
-            if (now > expiry) {
-                itemItr = _entitiesWithSimulationOwner.erase(itemItr);
-                if (entity->getDynamic()) {
-                    SetOfEntities::iterator itr = _simpleKinematicEntities.find(entity);
-                    if (itr != _simpleKinematicEntities.end()) {
-                        _simpleKinematicEntities.erase(itr);
-                    }
-                }
+void SimpleEntitySimulation::needSimulationOwner(const EntityItemPointer& entity) {
+    _entitiesThatNeedSimulationOwner.schedule(entity, entity->getLastChangedOnServer() + MAX_OWNERLESS_PERIOD);
+}
 
-                // remove ownership and dirty all the tree elements that contain the it
-                entity->clearSimulationOwnership();
-                entity->markAsChangedOnServer();
-                DirtyOctreeElementOperator op(entity->getElement());
-                getEntityTree()->recurseTreeWithOperator(&op);
-            } else {
-                _nextStaleOwnershipExpiry = glm::min(_nextStaleOwnershipExpiry, expiry);
-                ++itemItr;
+void SimpleEntitySimulation::expireStaleOwnerships(uint64_t now) {
+    _dueEntities.clear();
+    _scanStats.staleOwnerships += _staleOwnerships.advance(now, _dueEntities);
+    for (auto& entity : _dueEntities) {
+        // the ownership may have been renewed since the entity was scheduled
+        uint64_t expiry = entity->getSimulationOwnershipExpiry();
+        if (now > expiry) {
+            _entitiesWithSimulationOwner.remove(entity);
+            if (entity->getDynamic()) {
+                _simpleKinematicEntities.remove(entity);
             }
+
+            // remove ownership and dirty all the tree elements that contain the it
+            entity->clearSimulationOwnership();
+            entity->markAsChangedOnServer();
+            DirtyOctreeElementOperator op(entity->getElement());
+            getEntityTree()->recurseTreeWithOperator(&op);
+        } else {
+            _staleOwnerships.schedule(entity, expiry);
         }
     }
+    _dueEntities.clear();
 }
 
 void SimpleEntitySimulation::stopOwnerlessEntities(uint64_t now) {
-    if (now > _nextOwnerlessExpiry) {
-        // search for ownerless objects that have expired
-        QMutexLocker lock(&_mutex);
-        _nextOwnerlessExpiry = (uint64_t)(-1);
-        SetOfEntities::iterator itemItr = _entitiesThatNeedSimulationOwner.begin();
-        while (itemItr != _entitiesThatNeedSimulationOwner.end()) {
-            EntityItemPointer entity = *itemItr;
-            uint64_t expiry = entity->getLastChangedOnServer() + MAX_OWNERLESS_PERIOD;
-            if (expiry < now) {
-                // no simulators have volunteered ownership --> remove from list
-                itemItr = _entitiesThatNeedSimulationOwner.erase(itemItr);
-
-                if (entity->getSimulatorID().isNull() && entity->getDynamic() && entity->hasLocalVelocity()) {
-                    // zero the derivatives
-                    entity->setVelocity(Vectors::ZERO);
-                    entity->setAngularVelocity(Vectors::ZERO);
-                    entity->setAcceleration(Vectors::ZERO);
-
-                    // dirty all the tree elements that contain it
-                    entity->markAsChangedOnServer();
-                    DirtyOctreeElementOperator op(entity->getElement());
-                    getEntityTree()->recurseTreeWithOperator(&op);
-                }
-            } else {
-                _nextOwnerlessExpiry = glm::min(_nextOwnerlessExpiry, expiry);
-                ++itemItr;
+    // search for ownerless objects that have expired
+    QMutexLocker lock(&_mutex);
+    _dueEntities.clear();
+    _scanStats.ownerless += _entitiesThatNeedSimulationOwner.advance(now, _dueEntities);
+    for (auto& entity : _dueEntities) {
+        uint64_t expiry = entity->getLastChangedOnServer() + MAX_OWNERLESS_PERIOD;
+        if (expiry < now) {
+            // no simulators have volunteered ownership --> leave it off the list
+            if (entity->getSimulatorID().isNull() && entity->getDynamic() && entity->hasLocalVelocity()) {
+                // zero the derivatives
+                entity->setVelocity(Vectors::ZERO);
+                entity->setAngularVelocity(Vectors::ZERO);
+                entity->setAcceleration(Vectors::ZERO);
+
+                // dirty all the tree elements that contain it
+                entity->markAsChangedOnServer();
+                DirtyOctreeElementOperator op(entity->getElement());
+                getEntityTree()->recurseTreeWithOperator(&op);
             }
+        } else {
+            _entitiesThatNeedSimulationOwner.schedule(entity, expiry);
         }
     }
+    _dueEntities.clear();
 }
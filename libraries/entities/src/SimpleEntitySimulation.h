@@ -39,10 +39,11 @@ protected:
     void expireStaleOwnerships(uint64_t now);
     void stopOwnerlessEntities(uint64_t now);
 
+    void needSimulationOwner(const EntityItemPointer& entity);
+
     SetOfEntities _entitiesWithSimulationOwner;
-    SetOfEntities _entitiesThatNeedSimulationOwner;
-    uint64_t _nextOwnerlessExpiry { 0 };
-    uint64_t _nextStaleOwnershipExpiry { (uint64_t)(-1) };
+    EntityTimingWheel _staleOwnerships; // entities with an owner, by ownership expiry
+    EntityTimingWheel _entitiesThatNeedSimulationOwner; // by the end of their ownerless period
 };
 
 #endif // hifi_SimpleEntitySimulation_h
@@ -0,0 +1,182 @@
+//
+//  TextureMips.cpp
+//  image/src/image
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TextureMips.h"
+
+#include <algorithm>
+
+#include <glm/gtc/packing.hpp>
+
+#include <TBBHelpers.h>
+
+#include "ImageLogging.h"
+
+using namespace image;
+
+// enough work for a task to be worth its scheduling
+static const size_t PIXELS_PER_TASK = 16 * 1024;
+
+static float denormalize(float value, const float minValue) {
+    return value < minValue ? 0.0f : value;
+}
+
+// Denormalize else unpacking gives high and incorrect values
+// See https://www.khronos.org/opengl/wiki/Small_Float_Formats for this min value
+static const float R11G11B10_MIN_VALUE = 6.10e-5f;
+static const float R11G11B10_MAX_VALUE = 6.50e4f;
+
+gpu::uint32 image::packR11G11B10F(const glm::vec3& color) {
+    glm::vec3 ucolor;
+    ucolor.r = denormalize(color.r, R11G11B10_MIN_VALUE);
+    ucolor.g = denormalize(color.g, R11G11B10_MIN_VALUE);
+    ucolor.b = denormalize(color.b, R11G11B10_MIN_VALUE);
+    ucolor.r = std::min(ucolor.r, R11G11B10_MAX_VALUE);
+    ucolor.g = std::min(ucolor.g, R11G11B10_MAX_VALUE);
+    ucolor.b = std::min(ucolor.b, R11G11B10_MAX_VALUE);
+    return glm::packF2x11_1x10(ucolor);
+}
+
+//
+// on x86 architecture, assume that SSE2 is present
+//
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+#include <emmintrin.h>
+
+// the conversion of glm::packF2x11_1x10 to an 11 or 10 bit float, of four values at once
+template <int SHIFT, int EXPONENT_MASK, int MANTISSA_MASK, int FIELD_MASK>
+static inline __m128i packSmallFloats(__m128 value) {
+    const __m128i bits = _mm_castps_si128(value);
+    __m128i exponent = _mm_sub_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x38000000));
+    exponent = _mm_and_si128(_mm_srli_epi32(exponent, SHIFT), _mm_set1_epi32(EXPONENT_MASK));
+    __m128i mantissa = _mm_and_si128(_mm_srli_epi32(bits, SHIFT), _mm_set1_epi32(MANTISSA_MASK));
+    __m128i packed = _mm_or_si128(exponent, mantissa);
+
+    // zero packs to zero and NaN to all ones, the values are clamped so there is no infinity
+    packed = _mm_andnot_si128(_mm_castps_si128(_mm_cmpeq_ps(value, _mm_setzero_ps())), packed);
+    packed = _mm_or_si128(packed, _mm_castps_si128(_mm_cmpunord_ps(value, value)));
+    return _mm_and_si128(packed, _mm_set1_epi32(FIELD_MASK));
+}
+
+static inline __m128 clampR11G11B10(__m128 value) {
+    // the same comparisons as the scalar code, so that NaN goes through as it does there
+    value = _mm_andnot_ps(_mm_cmplt_ps(value, _mm_set1_ps(R11G11B10_MIN_VALUE)), value);
+    return _mm_min_ps(_mm_set1_ps(R11G11B10_MAX_VALUE), value);
+}
+
+static void packR11G11B10FPixels(const glm::vec4* source, size_t count, gpu::uint32* dest) {
+    const float* src = reinterpret_cast<const float*>(source);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        // four pixels in, and after the transpose their four channels
+        __m128 red = _mm_loadu_ps(src + 4 * i);
+        __m128 green = _mm_loadu_ps(src + 4 * i + 4);
+        __m128 blue = _mm_loadu_ps(src + 4 * i + 8);
+        __m128 alpha = _mm_loadu_ps(src + 4 * i + 12);
+        _MM_TRANSPOSE4_PS(red, green, blue, alpha);
+
+        __m128i packed = packSmallFloats<17, 0x07c0, 0x003f, 0x07ff>(clampR11G11B10(red));
+        packed = _mm_or_si128(packed, _mm_slli_epi32(packSmallFloats<17, 0x07c0, 0x003f, 0x07ff>(clampR11G11B10(green)), 11));
+        packed = _mm_or_si128(packed, _mm_slli_epi32(packSmallFloats<18, 0x03e0, 0x001f, 0x03ff>(clampR11G11B10(blue)), 22));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), packed);
+    }
+    for (; i < count; ++i) {
+        dest[i] = packR11G11B10F(glm::vec3(source[i]));
+    }
+}
+
+static inline void averageQuad(const glm::vec4* row0, const glm::vec4* row1, int x0, int x1, glm::vec4* dest) {
+    __m128 sum0 = _mm_add_ps(_mm_loadu_ps(&row0[x0].x), _mm_loadu_ps(&row0[x1].x));
+    __m128 sum1 = _mm_add_ps(_mm_loadu_ps(&row1[x0].x), _mm_loadu_ps(&row1[x1].x));
+    _mm_storeu_ps(&dest->x, _mm_mul_ps(_mm_add_ps(sum0, sum1), _mm_set1_ps(0.25f)));
+}
+
+#else
+
+static void packR11G11B10FPixels(const glm::vec4* source, size_t count, gpu::uint32* dest) {
+    for (size_t i = 0; i < count; ++i) {
+        dest[i] = packR11G11B10F(glm::vec3(source[i]));
+    }
+}
+
+static inline void averageQuad(const glm::vec4* row0, const glm::vec4* row1, int x0, int x1, glm::vec4* dest) {
+    // summed in the same order as the SSE2 version, for the same result
+    *dest = ((row0[x0] + row0[x1]) + (row1[x0] + row1[x1])) * 0.25f;
+}
+
+#endif
+
+static void packRGB9E5Pixels(const glm::vec4* source, size_t count, gpu::uint32* dest) {
+    for (size_t i = 0; i < count; ++i) {
+        dest[i] = glm::packF3x9_E1x5(glm::vec3(source[i]));
+    }
+}
+
+static void packUnorm4x8Pixels(const glm::vec4* source, size_t count, gpu::uint32* dest) {
+    for (size_t i = 0; i < count; ++i) {
+        dest[i] = glm::packUnorm4x8(glm::vec4(glm::vec3(source[i]), 1.0f));
+    }
+}
+
+void image::packHDRPixels(const glm::vec4* source, size_t count, gpu::uint32* dest, const gpu::Element& format) {
+    void (*packPixels)(const glm::vec4*, size_t, gpu::uint32*) = nullptr;
+    if (format == gpu::Element::COLOR_RGB9E5) {
+        packPixels = packRGB9E5Pixels;
+    } else if (format == gpu::Element::COLOR_R11G11B10) {
+        packPixels = packR11G11B10FPixels;
+    } else if (format == gpu::Element::COLOR_RGBA_32 || format == gpu::Element::COLOR_SRGBA_32 ||
+               format == gpu::Element::COLOR_BGRA_32 || format == gpu::Element::COLOR_SBGRA_32) {
+        packPixels = packUnorm4x8Pixels;
+    } else {
+        qCWarning(imagelogging) << "Unknown handler format";
+        Q_UNREACHABLE();
+        return;
+    }
+
+    if (count <= PIXELS_PER_TASK) {
+        packPixels(source, count, dest);
+        return;
+    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, PIXELS_PER_TASK), [&](const tbb::blocked_range<size_t>& range) {
+        packPixels(source + range.begin(), range.size(), dest + range.begin());
+    });
+}
+
+void image::downsampleMip(const glm::vec4* source, int width, int height, glm::vec4* dest) {
+    assert(width == 1 || (width % 2) == 0);
+    assert(height == 1 || (height % 2) == 0);
+
+    // a dimension of 1 isn't halved, its pixels are averaged with themselves
+    const int stepX = width > 1 ? 2 : 1;
+    const int stepY = height > 1 ? 2 : 1;
+    const int destWidth = std::max(1, width / 2);
+    const int destHeight = std::max(1, height / 2);
+
+    auto downsampleRows = [&](int beginRow, int endRow) {
+        for (int y = beginRow; y < endRow; ++y) {
+            const glm::vec4* row0 = source + (size_t)(y * stepY) * width;
+            const glm::vec4* row1 = row0 + (size_t)(stepY - 1) * width;
+            glm::vec4* destRow = dest + (size_t)y * destWidth;
+            for (int x = 0; x < destWidth; ++x) {
+                averageQuad(row0, row1, x * stepX, x * stepX + stepX - 1, destRow + x);
+            }
+        }
+    };
+
+    const int rowsPerTask = std::max(1, (int)(PIXELS_PER_TASK / destWidth));
+    if (destHeight <= rowsPerTask) {
+        downsampleRows(0, destHeight);
+        return;
+    }
+    tbb::parallel_for(tbb::blocked_range<int>(0, destHeight, rowsPerTask), [&](const tbb::blocked_range<int>& range) {
+        downsampleRows(range.begin(), range.end());
+    });
+}
@@ -0,0 +1,34 @@
+//
+//  TextureMips.h
+//  image/src/image
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_image_TextureMips_h
+#define hifi_image_TextureMips_h
+
+#include <glm/glm.hpp>
+
+#include <gpu/Format.h>
+
+namespace image {
+
+    // Packs an HDR color into R11G11B10, after clamping it to the range that unpacks correctly.
+    gpu::uint32 packR11G11B10F(const glm::vec3& color);
+
+    // Packs count pixels into one of the 32 bit HDR formats, the same as the packing function of that format would, and
+    // splits large batches across cores. R11G11B10 is packed four pixels at a time with SSE2 where there is SSE2.
+    void packHDRPixels(const glm::vec4* source, size_t count, gpu::uint32* dest, const gpu::Element& format);
+
+    // Box filters a mip of RGBA float pixels into the next one, of max(1, width / 2) by max(1, height / 2) pixels.
+    // The dimensions that are halved have to be even. The rows are split across cores.
+    void downsampleMip(const glm::vec4* source, int width, int height, glm::vec4* dest);
+
+}
+
+#endif // hifi_image_TextureMips_h
@@ -23,6 +23,7 @@
 #include <Profile.h>
 #include <StatTracker.h>
 #include <GLMHelpers.h>
+#include <TBBHelpers.h>
 
 #include "TGAReader.h"
 #if !defined(Q_OS_ANDROID)
@@ -30,6 +31,7 @@
 #endif
 #include "ImageLogging.h"
 #include "CubeMap.h"
+#include "TextureMips.h"
 
 using namespace gpu;
 
@@ -194,30 +196,11 @@ gpu::TexturePointer TextureUsage::createAmbientCubeTextureAndIrradianceFromImage
     return processCubeTextureColorFromImage(std::move(image), srcImageName, compress, target, CUBE_GENERATE_IRRADIANCE | CUBE_GGX_CONVOLVE, abortProcessing);
 }
 
-static float denormalize(float value, const float minValue) {
-    return value < minValue ? 0.0f : value;
-}
-
-static uint32 packR11G11B10F(const glm::vec3& color) {
-    // Denormalize else unpacking gives high and incorrect values
-    // See https://www.khronos.org/opengl/wiki/Small_Float_Formats for this min value
-    static const auto minValue = 6.10e-5f;
-    static const auto maxValue = 6.50e4f;
-    glm::vec3 ucolor;
-    ucolor.r = denormalize(color.r, minValue);
-    ucolor.g = denormalize(color.g, minValue);
-    ucolor.b = denormalize(color.b, minValue);
-    ucolor.r = std::min(ucolor.r, maxValue);
-    ucolor.g = std::min(ucolor.g, maxValue);
-    ucolor.b = std::min(ucolor.b, maxValue);
-    return glm::packF2x11_1x10(ucolor);
-}
-
 static uint32 packUnorm4x8(const glm::vec3& color) {
     return glm::packUnorm4x8(glm::vec4(color, 1.0f));
 }
 
-static std::function<uint32(const glm::vec3&)> getHDRPackingFunction(const gpu::Element& format) {
+std::function<uint32(const glm::vec3&)> getHDRPackingFunction(const gpu::Element& format) {
     if (format == gpu::Element::COLOR_RGB9E5) {
         return glm::packF3x9_E1x5;
     } else if (format == gpu::Element::COLOR_R11G11B10) {
@@ -458,39 +441,42 @@ struct OutputHandler : public nvtt::OutputHandler {
 };
 
 struct PackedFloatOutputHandler : public OutputHandler {
-    PackedFloatOutputHandler(gpu::Texture* texture, int face, gpu::Element format) : OutputHandler(texture, face) {
-        _packFunc = getHDRPackingFunction(format);
-    }
+    PackedFloatOutputHandler(gpu::Texture* texture, int face, gpu::Element format) : OutputHandler(texture, face), _format(format) {}
 
     virtual void beginImage(int size, int width, int height, int depth, int face, int miplevel) override {
         // Divide by 3 because we will compress from 3*floats to 1 uint32
         OutputHandler::beginImage(size / 3, width, height, depth, face, miplevel);
+        _pixels.clear();
+        _pixels.reserve(_size / sizeof(uint32));
+        _coordIndex = 0;
     }
     virtual bool writeData(const void* data, int size) override {
         // Expecting to write multiple of floats
-        if (_packFunc) {
-            assert((size % sizeof(float)) == 0);
-            auto floatCount = size / sizeof(float);
-            const float* floatBegin = (const float*)data;
-            const float* floatEnd = floatBegin + floatCount;
-
-            while (floatBegin < floatEnd) {
-                _pixel[_coordIndex] = *floatBegin;
-                floatBegin++;
-                _coordIndex++;
-                if (_coordIndex == 3) {
-                    uint32 packedRGB = _packFunc(_pixel);
-                    _coordIndex = 0;
-                    OutputHandler::writeData(&packedRGB, sizeof(packedRGB));
-                }
+        assert((size % sizeof(float)) == 0);
+        auto floatCount = size / sizeof(float);
+        const float* floatBegin = (const float*)data;
+        const float* floatEnd = floatBegin + floatCount;
+
+        // The pixels are packed all at once when the image ends
+        while (floatBegin < floatEnd) {
+            if (_coordIndex == 0) {
+                _pixels.emplace_back(0.0f, 0.0f, 0.0f, 1.0f);
             }
-            return true;
+            _pixels.back()[_coordIndex] = *floatBegin;
+            floatBegin++;
+            _coordIndex = (_coordIndex + 1) % 3;
         }
-        return false;
+        return true;
+    }
+    virtual void endImage() override {
+        assert(_pixels.size() * sizeof(uint32) == (size_t)_size);
+        packHDRPixels(_pixels.data(), _pixels.size(), reinterpret_cast<uint32*>(_data), _format);
+        OutputHandler::endImage();
+        _pixels.clear();
     }
 
-    std::function<uint32(const glm::vec3&)> _packFunc;
-    glm::vec3 _pixel;
+    gpu::Element _format;
+    std::vector<glm::vec4> _pixels;
     int _coordIndex{ 0 };
 };
 
@@ -501,21 +487,23 @@ struct MyErrorHandler : public nvtt::ErrorHandler {
 };
 
 #if defined(NVTT_API)
-class SequentialTaskDispatcher : public nvtt::TaskDispatcher {
+// Runs the compression tasks on the TBB pool, which shares the cores with the other textures being processed
+class ParallelTaskDispatcher : public nvtt::TaskDispatcher {
 public:
-    SequentialTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
+    ParallelTaskDispatcher(const std::atomic<bool>& abortProcessing = false) : _abortProcessing(abortProcessing) {
     }
 
     const std::atomic<bool>& _abortProcessing;
 
     void dispatch(nvtt::Task* task, void* context, int count) override {
-        for (int i = 0; i < count; i++) {
-            if (!_abortProcessing.load()) {
+        tbb::parallel_for(tbb::blocked_range<int>(0, count), [&](const tbb::blocked_range<int>& range) {
+            for (int i = range.begin(); i < range.end(); i++) {
+                if (_abortProcessing.load()) {
+                    break;
+                }
                 task(context, i);
-            } else {
-                break;
             }
-        }
+        });
     }
 };
 #endif
@@ -542,22 +530,12 @@ void convertToFloatFromPacked(const unsigned char* source, int width, int height
 
 void convertToPackedFromFloat(unsigned char* output, int width, int height, size_t outputLineByteStride, gpu::Element outputFormat,
                               const glm::vec4* source, size_t srcLinePixelStride) {
-    const glm::vec4* sourceIt;
-    auto packFunc = getHDRPackingFunction(outputFormat);
-
-    srcLinePixelStride -= width;
-    sourceIt = source;
-    for (auto lineNb = 0; lineNb < height; lineNb++) {
-        uint32* outPixelIt = reinterpret_cast<uint32*>(output + lineNb * outputLineByteStride);
-        uint32* outPixelEnd = outPixelIt + width;
-
-        while (outPixelIt < outPixelEnd) {
-            *outPixelIt = packFunc(*sourceIt);
-            ++outPixelIt;
-            ++sourceIt;
+    tbb::parallel_for(tbb::blocked_range<int>(0, height), [&](const tbb::blocked_range<int>& range) {
+        for (auto lineNb = range.begin(); lineNb < range.end(); lineNb++) {
+            uint32* outPixelIt = reinterpret_cast<uint32*>(output + lineNb * outputLineByteStride);
+            packHDRPixels(source + lineNb * srcLinePixelStride, width, outPixelIt, outputFormat);
         }
-        sourceIt += srcLinePixelStride;
-    }
+    });
 }
 
 nvtt::OutputHandler* getNVTTCompressionOutputHandler(gpu::Texture* outputTexture, int face, nvtt::CompressionOptions& compressionOptions) {
@@ -596,6 +574,47 @@ nvtt::OutputHandler* getNVTTCompressionOutputHandler(gpu::Texture* outputTexture
     }
 }
 
+static bool isPowerOfTwo(int dimension) {
+    return dimension > 0 && (dimension & (dimension - 1)) == 0;
+}
+
+// Builds and packs the mips of a RGBAF image into one of the packed float formats, without going through nvtt
+static void convertImageToPackedFloatTexture(gpu::Texture* texture, const Image& image, int baseMipLevel, bool buildMips, const std::atomic<bool>& abortProcessing, int face) {
+    const auto format = texture->getStoredMipFormat();
+    int width = image.getWidth();
+    int height = image.getHeight();
+    int mipLevel = baseMipLevel;
+
+    const glm::vec4* pixels = reinterpret_cast<const glm::vec4*>(image.getBits());
+    std::vector<glm::vec4> mip;
+    std::vector<glm::vec4> nextMip;
+    std::vector<uint32> packedMip((size_t)width * height);
+
+    while (true) {
+        const size_t pixelCount = (size_t)width * height;
+        packHDRPixels(pixels, pixelCount, packedMip.data(), format);
+
+        const auto size = pixelCount * sizeof(uint32);
+        const auto bytes = reinterpret_cast<const gpu::Byte*>(packedMip.data());
+        if (face >= 0) {
+            texture->assignStoredMipFace(mipLevel, face, size, bytes);
+        } else {
+            texture->assignStoredMip(mipLevel, size, bytes);
+        }
+
+        if (!buildMips || (width == 1 && height == 1) || abortProcessing.load()) {
+            break;
+        }
+        nextMip.resize((size_t)std::max(1, width / 2) * std::max(1, height / 2));
+        downsampleMip(pixels, width, height, nextMip.data());
+        mip.swap(nextMip);
+        pixels = mip.data();
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+        mipLevel++;
+    }
+}
+
 void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarget target, int baseMipLevel, bool buildMips, const std::atomic<bool>& abortProcessing, int face) {
     assert(image.hasFloatFormat());
 
@@ -604,6 +623,15 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
     const int width = localCopy.getWidth();
     const int height = localCopy.getHeight();
 
+    // nvtt only hands the packed float formats back to us as floats to pack, so we can build their mips ourselves.
+    // Its box filter is a plain 2x2 average when halving powers of two, for anything else it still builds the mips.
+    const auto outputFormat = texture->getStoredMipFormat();
+    if ((outputFormat == gpu::Element::COLOR_R11G11B10 || outputFormat == gpu::Element::COLOR_RGB9E5) &&
+        (!buildMips || (isPowerOfTwo(width) && isPowerOfTwo(height)))) {
+        convertImageToPackedFloatTexture(texture, localCopy, baseMipLevel, buildMips, abortProcessing, face);
+        return;
+    }
+
     nvtt::OutputOptions outputOptions;
     outputOptions.setOutputHeader(false);
 
@@ -622,7 +650,7 @@ void convertImageToHDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
     surface.setAlphaMode(nvtt::AlphaMode_None);
     surface.setWrapMode(nvtt::WrapMode_Mirror);
 
-    SequentialTaskDispatcher dispatcher(abortProcessing);
+    ParallelTaskDispatcher dispatcher(abortProcessing);
     nvtt::Compressor compressor;
     context.setTaskDispatcher(&dispatcher);
 
@@ -759,8 +787,9 @@ void convertImageToLDRTexture(gpu::Texture* texture, Image&& image, BackendTarge
         MyErrorHandler errorHandler;
         outputOptions.setErrorHandler(&errorHandler);
 
-        SequentialTaskDispatcher dispatcher(abortProcessing);
+        ParallelTaskDispatcher dispatcher(abortProcessing);
         nvtt::Compressor context;
+        context.setTaskDispatcher(&dispatcher);
 
         context.compress(surface, face, mipLevel++, compressionOptions, outputOptions);
         if (buildMips) {
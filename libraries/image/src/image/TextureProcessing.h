@@ -21,6 +21,7 @@
 
 namespace image {
 
+    std::function<gpu::uint32(const glm::vec3&)> getHDRPackingFunction(const gpu::Element& format);
     std::function<gpu::uint32(const glm::vec3&)> getHDRPackingFunction();
     std::function<glm::vec3(gpu::uint32)> getHDRUnpackingFunction();
     void convertToFloatFromPacked(const unsigned char* source, int width, int height, size_t srcLineByteStride, gpu::Element sourceFormat, 
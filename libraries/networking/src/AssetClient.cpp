@@ -575,15 +575,20 @@ void AssetClient::handleAssetGetReply(QSharedPointer<ReceivedMessage> message, S
 
 
     auto weakNode = senderNode.toWeakRef();
-    connect(message.data(), &ReceivedMessage::progress, this, [this, weakNode, messageID, length](qint64 size) {
-        handleProgressCallback(weakNode, messageID, size, length);
-    });
-    connect(message.data(), &ReceivedMessage::completed, this, [this, weakNode, messageID, length]() {
-        handleCompleteCallback(weakNode, messageID, length);
-    });
+    auto notifier = message->getNotifier();
+    if (notifier) {
+        connect(notifier, &ReceivedMessageNotifier::progress, this, [this, weakNode, messageID, length](qint64 size) {
+            handleProgressCallback(weakNode, messageID, size, length);
+        });
+        connect(notifier, &ReceivedMessageNotifier::completed, this, [this, weakNode, messageID, length]() {
+            handleCompleteCallback(weakNode, messageID, length);
+        });
+    }
 
     if (message->isComplete()) {
-        disconnect(message.data(), nullptr, this, nullptr);
+        if (notifier) {
+            disconnect(notifier, nullptr, this, nullptr);
+        }
 
         if (length != message->getBytesLeftToRead()) {
             callbacks.completeCallback(false, error, QByteArray());
@@ -869,9 +874,9 @@ bool AssetClient::cancelGetAssetRequest(MessageID id) {
         if (requestIt != messageCallbackMap.end()) {
 
             auto& message = requestIt->second.message;
-            if (message) {
+            if (message && message->getNotifier()) {
                 // disconnect from all signals emitting from the pending message
-                disconnect(message.data(), nullptr, this, nullptr);
+                disconnect(message->getNotifier(), nullptr, this, nullptr);
             }
 
             messageCallbackMap.erase(requestIt);
@@ -1001,9 +1006,9 @@ void AssetClient::forceFailureOfPendingRequests(SharedNodePointer node) {
         if (messageMapIt != _pendingRequests.end()) {
             for (const auto& value : messageMapIt->second) {
                 auto& message = value.second.message;
-                if (message) {
+                if (message && message->getNotifier()) {
                     // Disconnect from all signals emitting from the pending message
-                    disconnect(message.data(), nullptr, this, nullptr);
+                    disconnect(message->getNotifier(), nullptr, this, nullptr);
                 }
 
                 value.second.completeCallback(false, AssetUtils::AssetServerError::NoError, QByteArray());
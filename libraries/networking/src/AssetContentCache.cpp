@@ -0,0 +1,117 @@
+//
+//  AssetContentCache.cpp
+//  libraries/networking/src
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetContentCache.h"
+
+#include <algorithm>
+
+const qint64 AssetContentCache::DEFAULT_MAX_SIZE = 256 * 1024 * 1024;
+const qint64 AssetContentCache::MAX_ENTRY_SIZE = 8 * 1024 * 1024;
+const int AssetContentCache::MAX_CANDIDATES = 4096;
+
+void AssetContentCache::setMaxSize(qint64 maxSize) {
+    QMutexLocker locker(&_mutex);
+    _maxSize = std::max(maxSize, (qint64)0);
+    evict();
+}
+
+QByteArray AssetContentCache::find(const AssetUtils::AssetHash& hash) {
+    QMutexLocker locker(&_mutex);
+
+    auto it = _index.find(hash);
+    if (it == _index.end()) {
+        ++_misses;
+        return QByteArray();
+    }
+
+    ++_hits;
+    _entries.splice(_entries.begin(), _entries, it.value());
+    return it.value()->second;
+}
+
+bool AssetContentCache::shouldAdmit(const AssetUtils::AssetHash& hash, qint64 fileSize) {
+    if (!canCache(fileSize)) {
+        return false;
+    }
+
+    QMutexLocker locker(&_mutex);
+
+    auto it = _candidateIndex.find(hash);
+    if (it != _candidateIndex.end()) {
+        _candidates.erase(it.value());
+        _candidateIndex.erase(it);
+        return true;
+    }
+
+    _candidates.push_front(hash);
+    _candidateIndex.insert(hash, _candidates.begin());
+    if ((int)_candidates.size() > MAX_CANDIDATES) {
+        _candidateIndex.remove(_candidates.back());
+        _candidates.pop_back();
+    }
+    return false;
+}
+
+void AssetContentCache::insert(const AssetUtils::AssetHash& hash, const QByteArray& contents) {
+    if (!canCache(contents.size())) {
+        return;
+    }
+
+    QMutexLocker locker(&_mutex);
+
+    // another request may have loaded it in the meantime
+    if (_index.contains(hash)) {
+        return;
+    }
+
+    _entries.emplace_front(hash, contents);
+    _index.insert(hash, _entries.begin());
+    _size += contents.size();
+
+    evict();
+}
+
+void AssetContentCache::remove(const AssetUtils::AssetHash& hash) {
+    QMutexLocker locker(&_mutex);
+
+    auto it = _index.find(hash);
+    if (it != _index.end()) {
+        _size -= it.value()->second.size();
+        _entries.erase(it.value());
+        _index.erase(it);
+    }
+
+    auto candidate = _candidateIndex.find(hash);
+    if (candidate != _candidateIndex.end()) {
+        _candidates.erase(candidate.value());
+        _candidateIndex.erase(candidate);
+    }
+}
+
+AssetContentCache::Stats AssetContentCache::getStats() {
+    QMutexLocker locker(&_mutex);
+
+    Stats stats;
+    stats.hits = _hits;
+    stats.misses = _misses;
+    stats.size = _size;
+    stats.numEntries = (int)_entries.size();
+    return stats;
+}
+
+void AssetContentCache::evict() {
+    while (_size > _maxSize && !_entries.empty()) {
+        auto& leastRecent = _entries.back();
+        _size -= leastRecent.second.size();
+        _index.remove(leastRecent.first);
+        _entries.pop_back();
+    }
+}
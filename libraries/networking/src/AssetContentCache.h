@@ -0,0 +1,75 @@
+//
+//  AssetContentCache.h
+//  libraries/networking/src
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_AssetContentCache_h
+#define hifi_AssetContentCache_h
+
+#include <atomic>
+#include <list>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+
+#include "AssetUtils.h"
+
+/// A bounded LRU of the contents of recently requested asset files, shared by the SendAssetTasks.
+/// A file is only admitted once it is asked for again, so a single request never loads a whole file into memory.
+class AssetContentCache {
+public:
+    static const qint64 DEFAULT_MAX_SIZE; // bytes
+    static const qint64 MAX_ENTRY_SIZE; // bytes, larger files are always streamed from disk
+    static const int MAX_CANDIDATES; // hashes requested once that are remembered for admission
+
+    struct Stats {
+        quint64 hits { 0 };
+        quint64 misses { 0 };
+        qint64 size { 0 };
+        int numEntries { 0 };
+    };
+
+    void setMaxSize(qint64 maxSize);
+    qint64 getMaxSize() const { return _maxSize; }
+
+    /// One entry may take at most a quarter of the cache
+    bool canCache(qint64 fileSize) const { return fileSize <= MAX_ENTRY_SIZE && fileSize <= _maxSize / 4; }
+
+    /// Whether a file that missed should be loaded and inserted.  The first request for a hash only records it.
+    bool shouldAdmit(const AssetUtils::AssetHash& hash, qint64 fileSize);
+
+    /// Returns the cached contents of the asset, or a null QByteArray on a miss
+    QByteArray find(const AssetUtils::AssetHash& hash);
+    void insert(const AssetUtils::AssetHash& hash, const QByteArray& contents);
+    void remove(const AssetUtils::AssetHash& hash);
+
+    Stats getStats();
+
+private:
+    using Entry = std::pair<AssetUtils::AssetHash, QByteArray>;
+
+    void evict();
+
+    QMutex _mutex;
+    std::atomic<qint64> _maxSize { DEFAULT_MAX_SIZE };
+    qint64 _size { 0 };
+    quint64 _hits { 0 };
+    quint64 _misses { 0 };
+
+    std::list<Entry> _entries; // most recently used first
+    QHash<AssetUtils::AssetHash, std::list<Entry>::iterator> _index;
+
+    std::list<AssetUtils::AssetHash> _candidates; // oldest last
+    QHash<AssetUtils::AssetHash, std::list<AssetUtils::AssetHash>::iterator> _candidateIndex;
+};
+
+#endif // hifi_AssetContentCache_h
@@ -0,0 +1,46 @@
+//
+//  DomainListVersionTracker.cpp
+//  libraries/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DomainListVersionTracker.h"
+
+void DomainListVersionTracker::beginPacket(quint32 listVersion, quint32 baseVersion, quint32 numListEntries) {
+    if (listVersion != _pendingVersion) {
+        _pendingVersion = listVersion;
+        _pendingEntries = 0;
+    }
+    _packetBaseVersion = baseVersion;
+    _packetNumListEntries = numListEntries;
+    _isReadingPacket = true;
+}
+
+void DomainListVersionTracker::endPacket() {
+    _isReadingPacket = false;
+
+    // the nodes of a list that changes one we don't have are still current, but we can't acknowledge it,
+    // so the domain server will send a complete list instead
+    bool extendsOurList = _packetBaseVersion == 0 || _packetBaseVersion == _version;
+    if (extendsOurList && _pendingEntries >= _packetNumListEntries) {
+        _version = _pendingVersion;
+    }
+}
+
+void DomainListVersionTracker::nodeKilled() {
+    if (!_isReadingPacket) {
+        // the domain server still thinks we have the node, and won't send it again unless it changes
+        reset();
+    }
+}
+
+void DomainListVersionTracker::reset() {
+    _version = 0;
+    _pendingVersion = 0;
+    _pendingEntries = 0;
+}
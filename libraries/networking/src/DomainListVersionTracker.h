@@ -0,0 +1,45 @@
+//
+//  DomainListVersionTracker.h
+//  libraries/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DomainListVersionTracker_h
+#define hifi_DomainListVersionTracker_h
+
+#include <QtCore/QtGlobal>
+
+// The version of the domain list a node acknowledges in its check-ins.  The domain server only sends the changes
+// since that version, so it has to be the list the node actually holds: once the node drops a node on its own
+// (a silent node, or a new connection ID) it acknowledges nothing and is sent a complete list again.
+class DomainListVersionTracker {
+public:
+    // the version to acknowledge, 0 asks for a complete list
+    quint32 get() const { return _version; }
+
+    // a DomainList packet with a part of the list, that is either complete (base version 0) or the changes since
+    // the base version.  The nodes it removes are killed between beginPacket and endPacket.
+    void beginPacket(quint32 listVersion, quint32 baseVersion, quint32 numListEntries);
+    void addEntry() { ++_pendingEntries; }
+    void endPacket();
+
+    // a node was killed, by the domain server if it happens while a packet is being read, else on our own
+    void nodeKilled();
+
+    void reset();
+
+private:
+    quint32 _version { 0 };
+    quint32 _pendingVersion { 0 }; // a list may come in several packets
+    quint32 _pendingEntries { 0 };
+    quint32 _packetBaseVersion { 0 };
+    quint32 _packetNumListEntries { 0 };
+    bool _isReadingPacket { false };
+};
+
+#endif // hifi_DomainListVersionTracker_h
@@ -18,29 +18,55 @@
 #include "NetworkLogging.h"
 #include <cassert>
 
+namespace {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
-HMACAuth::HMACAuth(AuthMethod authMethod)
-    : _hmacContext(HMAC_CTX_new())
-    , _authMethod(authMethod) { }
+    HMAC_CTX* newContext() {
+        return HMAC_CTX_new();
+    }
 
-HMACAuth::~HMACAuth()
-{
-    HMAC_CTX_free(_hmacContext);
-}
+    void freeContext(HMAC_CTX* context) {
+        HMAC_CTX_free(context);
+    }
 
+    bool copyContext(HMAC_CTX* destination, HMAC_CTX* source) {
+        return HMAC_CTX_copy(destination, source);
+    }
 #else
+    HMAC_CTX* newContext() {
+        auto context = new HMAC_CTX();
+        HMAC_CTX_init(context);
+        return context;
+    }
 
-HMACAuth::HMACAuth(AuthMethod authMethod)
-    : _hmacContext(new HMAC_CTX())
-    , _authMethod(authMethod) {
-    HMAC_CTX_init(_hmacContext);
+    void freeContext(HMAC_CTX* context) {
+        HMAC_CTX_cleanup(context);
+        delete context;
+    }
+
+    bool copyContext(HMAC_CTX* destination, HMAC_CTX* source) {
+        // before 1.1 a copy does not release what the destination held
+        HMAC_CTX_cleanup(destination);
+        HMAC_CTX_init(destination);
+        return HMAC_CTX_copy(destination, source);
+    }
+#endif
+
+    // the context calculateHash works in on this thread, whichever HMACAuth it hashes for
+    struct ThreadContext {
+        ThreadContext() : context(newContext()) { }
+        ~ThreadContext() { freeContext(context); }
+
+        HMAC_CTX* context;
+    };
 }
 
+HMACAuth::HMACAuth(AuthMethod authMethod)
+    : _hmacContext(newContext())
+    , _authMethod(authMethod) { }
+
 HMACAuth::~HMACAuth() {
-    HMAC_CTX_cleanup(_hmacContext);
-    delete _hmacContext;
+    freeContext(_hmacContext);
 }
-#endif
 
 bool HMACAuth::setKey(const char* keyValue, int keyLen) {
     const EVP_MD* sslStruct = nullptr;
@@ -70,6 +96,12 @@ bool HMACAuth::setKey(const char* keyValue, int keyLen) {
         return false;
     }
 
+    std::shared_ptr<HMAC_CTX> keyedContext(newContext(), freeContext);
+    if (!HMAC_Init_ex(keyedContext.get(), keyValue, keyLen, sslStruct, nullptr)) {
+        return false;
+    }
+    std::atomic_store(&_keyedContext, keyedContext);
+
     QMutexLocker lock(&_lock);
     return (bool) HMAC_Init_ex(_hmacContext, keyValue, keyLen, sslStruct, nullptr);
 }
@@ -105,13 +137,26 @@ HMACAuth::HMACHash HMACAuth::result() {
 }
 
 bool HMACAuth::calculateHash(HMACHash& hashResult, const char* data, int dataLen) {
-    QMutexLocker lock(&_lock);
-    if (!addData(data, dataLen)) {
-        qCWarning(networking) << "Error occured calling HMACAuth::addData()";
+    auto keyedContext = std::atomic_load(&_keyedContext);
+    if (!keyedContext) {
+        qCWarning(networking) << "HMACAuth::calculateHash called before a key was set";
+        return false;
+    }
+
+    // copying the keyed context skips hashing the padded key again for every packet
+    thread_local ThreadContext threadContext;
+    auto context = threadContext.context;
+
+    unsigned int hashLen { 0 };
+    hashResult.resize(EVP_MAX_MD_SIZE);
+    if (!copyContext(context, keyedContext.get())
+        || !HMAC_Update(context, reinterpret_cast<const unsigned char*>(data), dataLen)
+        || !HMAC_Final(context, &hashResult[0], &hashLen)) {
+        qCWarning(networking) << "Error occured calculating HMAC";
         assert(false);
         return false;
     }
 
-    hashResult = result();
+    hashResult.resize((size_t)hashLen);
     return true;
 }
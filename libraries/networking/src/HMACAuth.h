@@ -29,6 +29,7 @@ public:
     bool setKey(const char* keyValue, int keyLen);
     bool setKey(const QUuid& uidKey);
     // Calculate complete hash in one.
+    // Does not lock, so any number of threads can hash at once: each starts from its own copy of the keyed context.
     bool calculateHash(HMACHash& hashResult, const char* data, int dataLen);
 
     // Append to data to be hashed.
@@ -41,6 +42,7 @@ public:
 private:
     QMutex _lock { QMutex::Recursive };
     struct hmac_ctx_st* _hmacContext;
+    std::shared_ptr<struct hmac_ctx_st> _keyedContext; // state right after setKey, swapped atomically
     AuthMethod _authMethod;
 };
 
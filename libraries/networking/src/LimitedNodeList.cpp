@@ -590,6 +590,29 @@ SharedNodePointer LimitedNodeList::nodeWithLocalID(Node::LocalID localID) const
     return idIter == _localIDMap.cend() ? nullptr : idIter->second;
 }
 
+LimitedNodeList::NodeSnapshotPointer LimitedNodeList::getNodeSnapshot() const {
+    auto snapshot = std::atomic_load(&_nodeSnapshot);
+    if (snapshot && snapshot->membershipVersion == _membershipVersion) {
+        return snapshot;
+    }
+
+    auto newSnapshot = std::make_shared<NodeSnapshot>();
+    {
+        QReadLocker readLocker(&_nodeMutex);
+
+        // take the version before copying, a node added meanwhile only makes the next call rebuild again
+        newSnapshot->membershipVersion = _membershipVersion;
+        newSnapshot->nodes.reserve(_nodeHash.size());
+        for (const auto& pair : _nodeHash) {
+            newSnapshot->nodes.push_back(pair.second);
+        }
+    }
+
+    snapshot = newSnapshot;
+    std::atomic_store(&_nodeSnapshot, snapshot);
+    return snapshot;
+}
+
 void LimitedNodeList::eraseAllNodes(QString reason) {
     std::vector<SharedNodePointer> killedNodes;
 
@@ -608,6 +631,7 @@ void LimitedNodeList::eraseAllNodes(QString reason) {
         }
         _localIDMap.clear();
         _nodeHash.clear();
+        ++_membershipVersion;
     }
 
     foreach(const SharedNodePointer& killedNode, killedNodes) {
@@ -633,6 +657,7 @@ bool LimitedNodeList::killNodeWithUUID(const QUuid& nodeUUID, ConnectionID newCo
             QWriteLocker writeLocker(&_nodeMutex);
             _localIDMap.unsafe_erase(matchingNode->getLocalID());
             _nodeHash.unsafe_erase(matchingNode->getUUID());
+            ++_membershipVersion;
         }
 
         handleNodeKill(matchingNode, newConnectionID);
@@ -693,6 +718,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
                 QWriteLocker writeLocker(&_nodeMutex);
                 _localIDMap.unsafe_erase(node->getLocalID());
                 _nodeHash.unsafe_erase(node->getUUID());
+                ++_membershipVersion;
             }
             handleNodeKill(node);
         }
@@ -737,6 +763,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
         // insert the new node and release our read lock
         _nodeHash.insert({ newNode->getUUID(), newNodePointer });
         _localIDMap.insert({ localID, newNodePointer });
+        ++_membershipVersion;
     }
 
     qCDebug(networking) << "Added" << *newNode;
@@ -903,6 +930,7 @@ void LimitedNodeList::removeSilentNodes() {
             // call the NodeHash erase to get rid of this node
             _localIDMap.unsafe_erase(node->getLocalID());
             it = _nodeHash.unsafe_erase(it);
+            ++_membershipVersion;
 
             killedNodes.insert(node);
         } else {
@@ -972,6 +1000,8 @@ void LimitedNodeList::sampleConnectionStats() {
         _inboundKbps = 0.0f;
         _outboundKbps = 0.0f;
     }
+
+    _datagramIOStats = _nodeSocket.sampleDatagramIOStats();
 }
 
 const uint32_t RFC_5389_MAGIC_COOKIE = 0x2112A442;
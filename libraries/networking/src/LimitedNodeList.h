@@ -14,10 +14,12 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #ifndef _WIN32
 #include <unistd.h> // not on windows, not needed for mac or windows
@@ -205,10 +207,23 @@ public:
     using value_type = SharedNodePointer;
     using const_iterator = std::vector<value_type>::const_iterator;
 
-    // Cede control of iteration under a single read lock (e.g. for use by thread pools)
-    // Use this for nested loops instead of taking nested read locks!
-    //   This allows multiple threads (i.e. a thread pool) to share a lock
-    //   without deadlocking when a dying node attempts to acquire a write lock
+    // An immutable copy of the node set, in one contiguous block, shared by everyone iterating the same membership
+    struct NodeSnapshot {
+        quint64 membershipVersion { 0 };
+        std::vector<SharedNodePointer> nodes;
+    };
+    using NodeSnapshotPointer = std::shared_ptr<const NodeSnapshot>;
+
+    // Bumped every time a node is added or removed, so callers can cheaply tell whether the membership changed
+    quint64 getMembershipVersion() const { return _membershipVersion; }
+
+    // Only takes the node lock to rebuild the snapshot after the membership changed.
+    // The nodes stay alive for as long as the snapshot is held, even once killed.
+    NodeSnapshotPointer getNodeSnapshot() const;
+
+    // Cede control of iteration over the current node snapshot (e.g. for use by thread pools)
+    // The snapshot holds no lock, so the functor may take node locks freely, and a dying node is not held up
+    // waiting on the iteration. lockWaitOut is always 0, and nodeTransformOut the time taken to get the snapshot.
     template<typename NestedNodeLambda>
     void nestedEach(NestedNodeLambda functor,
                     int* lockWaitOut = nullptr,
@@ -217,29 +232,17 @@ public:
         quint64 start, endTransform, endFunctor;
 
         start = usecTimestampNow();
-        std::vector<SharedNodePointer> nodes;
-        {
-            QReadLocker readLock(&_nodeMutex);
-            auto endLock = usecTimestampNow();
-            if (lockWaitOut) {
-                *lockWaitOut = (endLock - start);
-            }
+        auto snapshot = getNodeSnapshot();
 
-            // Size of _nodeHash could change at any time,
-            // so reserve enough memory for the current size
-            // and then back insert all the nodes found
-            nodes.reserve(_nodeHash.size());
-            std::transform(_nodeHash.cbegin(), _nodeHash.cend(), std::back_inserter(nodes), [&](const NodeHash::value_type& it) {
-                return it.second;
-            });
-
-            endTransform = usecTimestampNow();
-            if (nodeTransformOut) {
-                *nodeTransformOut = (endTransform - endLock);
-            }
+        endTransform = usecTimestampNow();
+        if (lockWaitOut) {
+            *lockWaitOut = 0;
+        }
+        if (nodeTransformOut) {
+            *nodeTransformOut = (endTransform - start);
         }
 
-        functor(nodes.cbegin(), nodes.cend());
+        functor(snapshot->nodes.cbegin(), snapshot->nodes.cend());
         endFunctor = usecTimestampNow();
         if (functorOut) {
             *functorOut = (endFunctor - endTransform);
@@ -248,30 +251,30 @@ public:
 
     template<typename NodeLambda>
     void eachNode(NodeLambda functor) {
-        QReadLocker readLock(&_nodeMutex);
+        auto snapshot = getNodeSnapshot();
 
-        for (NodeHash::const_iterator it = _nodeHash.cbegin(); it != _nodeHash.cend(); ++it) {
-            functor(it->second);
+        for (const auto& node : snapshot->nodes) {
+            functor(node);
         }
     }
 
     template<typename PredLambda, typename NodeLambda>
     void eachMatchingNode(PredLambda predicate, NodeLambda functor) {
-        QReadLocker readLock(&_nodeMutex);
+        auto snapshot = getNodeSnapshot();
 
-        for (NodeHash::const_iterator it = _nodeHash.cbegin(); it != _nodeHash.cend(); ++it) {
-            if (predicate(it->second)) {
-                functor(it->second);
+        for (const auto& node : snapshot->nodes) {
+            if (predicate(node)) {
+                functor(node);
             }
         }
     }
 
     template<typename BreakableNodeLambda>
     void eachNodeBreakable(BreakableNodeLambda functor) {
-        QReadLocker readLock(&_nodeMutex);
+        auto snapshot = getNodeSnapshot();
 
-        for (NodeHash::const_iterator it = _nodeHash.cbegin(); it != _nodeHash.cend(); ++it) {
-            if (!functor(it->second)) {
+        for (const auto& node : snapshot->nodes) {
+            if (!functor(node)) {
                 break;
             }
         }
@@ -335,6 +338,7 @@ public:
     int getOutboundPPS() const { return _outboundPPS; }
     float getInboundKbps() const { return _inboundKbps; }
     float getOutboundKbps() const { return _outboundKbps; }
+    udt::ConnectionStats::DatagramIOStats getDatagramIOStats() const { return _datagramIOStats; }
 
     void setDropOutgoingNodeTraffic(bool squelchOutgoingNodeTraffic) { _dropOutgoingNodeTraffic = squelchOutgoingNodeTraffic; }
 
@@ -438,6 +442,8 @@ protected:
 
     NodeHash _nodeHash;
     mutable QReadWriteLock _nodeMutex { QReadWriteLock::Recursive };
+    std::atomic<quint64> _membershipVersion { 0 }; // bumped under _nodeMutex after each add or remove
+    mutable NodeSnapshotPointer _nodeSnapshot; // swapped atomically, see getNodeSnapshot
     udt::Socket _nodeSocket;
     QUdpSocket* _dtlsSocket { nullptr };
     HifiSockAddr _localSockAddr;
@@ -497,6 +503,7 @@ private:
     int _outboundPPS { 0 };
     float _inboundKbps { 0.0f };
     float _outboundKbps { 0.0f };
+    udt::ConnectionStats::DatagramIOStats _datagramIOStats;
 
     bool _dropOutgoingNodeTraffic { false };
 
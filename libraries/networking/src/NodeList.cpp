@@ -110,6 +110,9 @@ NodeList::NodeList(char newOwnerType, int socketListenPort, int dtlsListenPort)
     // anytime we get a new node we may need to re-send our set of ignored node IDs to it
     connect(this, &LimitedNodeList::nodeActivated, this, &NodeList::maybeSendIgnoreSetToNode);
 
+    // a node we drop on our own (silent, or a new connection ID) is only sent again with a complete domain list
+    connect(this, &LimitedNodeList::nodeKilled, this, [this] { _domainListVersion.nodeKilled(); });
+
     // setup our timer to send keepalive pings (it's started and stopped on domain connect/disconnect)
     _keepAlivePingTimer.setInterval(KEEPALIVE_PING_INTERVAL_MS); // 1s, Qt::CoarseTimer acceptable
     connect(&_keepAlivePingTimer, &QTimer::timeout, this, &NodeList::sendKeepAlivePings);
@@ -173,6 +176,21 @@ qint64 NodeList::sendStatsToDomainServer(QJsonObject statsObject) {
     return sendStats(statsObject, _domainHandler.getSockAddr());
 }
 
+qint64 NodeList::sendMetricsToDomainServer(QByteArray metricChanges) {
+    if (thread() != QThread::currentThread()) {
+        QMetaObject::invokeMethod(this, "sendMetricsToDomainServer", Qt::QueuedConnection,
+                                  Q_ARG(QByteArray, metricChanges));
+        return 0;
+    }
+
+    // reliable and ordered, each write only holds the changes since the one before
+    auto metricsPacketList = NLPacketList::create(PacketType::NodeMetrics, QByteArray(), true, true);
+    metricsPacketList->write(metricChanges);
+
+    sendPacketList(std::move(metricsPacketList), _domainHandler.getSockAddr());
+    return 0;
+}
+
 void NodeList::timePingReply(ReceivedMessage& message, const SharedNodePointer& sendingNode) {
     PingType_t pingType;
 
@@ -264,6 +282,7 @@ void NodeList::reset(QString reason, bool skipDomainHandlerReset) {
         return;
     }
     LimitedNodeList::reset(reason);
+    resetDomainListVersion();
 
     // lock and clear our set of ignored IDs
     _ignoredSetLock.lockForWrite();
@@ -466,6 +485,10 @@ void NodeList::sendDomainServerCheckIn() {
         packetStream << _ownerType.load() << publicSockAddr << localSockAddr << _nodeTypesOfInterest.toList();
         packetStream << DependencyManager::get<AddressManager>()->getPlaceName();
 
+        if (domainPacketType == PacketType::DomainListRequest) {
+            packetStream << _domainListVersion.get();
+        }
+
         if (!domainIsConnected) {
             DataServerAccountInfo& accountInfo = accountManager->getAccountInfo();
             packetStream << accountInfo.getUsername();
@@ -707,6 +730,13 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     bool newConnection;
     packetStream >> newConnection;
 
+    // the list is either complete (base version 0) or the changes since the base version we acknowledged
+    quint32 listVersion;
+    quint32 baseVersion;
+    quint32 numListEntries;
+    QList<QUuid> removedNodes;
+    packetStream >> listVersion >> baseVersion >> numListEntries >> removedNodes;
+
     if (newConnection) {
         _nodeConnectTimestamp = usecTimestampNow();
         _connectReason = Connect;
@@ -786,10 +816,26 @@ void NodeList::processDomainServerList(QSharedPointer<ReceivedMessage> message)
     setPermissions(newPermissions);
     setAuthenticatePackets(isAuthenticated);
 
+    // the nodes the domain server removes are killed while the packet is being read, so that the version
+    // isn't reset as it is for nodes we drop on our own
+    _domainListVersion.beginPacket(listVersion, baseVersion, numListEntries);
+
+    foreach (const QUuid& nodeUUID, removedNodes) {
+        killNodeWithUUID(nodeUUID);
+        removeDelayedAdd(nodeUUID);
+    }
+
     // pull each node in the packet
     while (packetStream.device()->pos() < message->getSize()) {
         parseNodeFromPacketStream(packetStream);
+        _domainListVersion.addEntry();
     }
+
+    _domainListVersion.endPacket();
+}
+
+void NodeList::resetDomainListVersion() {
+    _domainListVersion.reset();
 }
 
 void NodeList::processDomainServerAddedNode(QSharedPointer<ReceivedMessage> message) {
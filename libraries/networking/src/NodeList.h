@@ -33,6 +33,7 @@
 #include <SettingHandle.h>
 
 #include "DomainHandler.h"
+#include "DomainListVersionTracker.h"
 #include "LimitedNodeList.h"
 #include "Node.h"
 
@@ -59,6 +60,7 @@ public:
 
     Q_INVOKABLE qint64 sendStats(QJsonObject statsObject, HifiSockAddr destination);
     Q_INVOKABLE qint64 sendStatsToDomainServer(QJsonObject statsObject);
+    Q_INVOKABLE qint64 sendMetricsToDomainServer(QByteArray metricChanges);
 
     DomainHandler& getDomainHandler() { return _domainHandler; }
 
@@ -161,6 +163,7 @@ private:
     void sendDSPathQuery(const QString& newPath);
 
     void parseNodeFromPacketStream(QDataStream& packetStream);
+    void resetDomainListVersion();
 
     void pingPunchForInactiveNode(const SharedNodePointer& node);
 
@@ -174,6 +177,9 @@ private:
     QTimer _keepAlivePingTimer;
     bool _requestsDomainListData { false };
 
+    // the domain server only sends the changes since the last complete list we acknowledge in our check-ins
+    DomainListVersionTracker _domainListVersion;
+
     bool _sendDomainServerCheckInEnabled { true };
 
     mutable QReadWriteLock _ignoredSetLock;
@@ -23,6 +23,10 @@ PacketReceiver::PacketReceiver(QObject* parent) : QObject(parent) {
     qRegisterMetaType<QSharedPointer<NLPacket>>();
     qRegisterMetaType<QSharedPointer<NLPacketList>>();
     qRegisterMetaType<QSharedPointer<ReceivedMessage>>();
+
+    for (auto& handler : _handlerTable) {
+        handler.store(nullptr);
+    }
 }
 
 bool PacketReceiver::registerListenerForTypes(PacketTypeList types, QObject* listener, const char* slot) {
@@ -178,11 +182,42 @@ void PacketReceiver::registerVerifiedListener(PacketType type, QObject* object,
     _messageListenerMap[type] = { QPointer<QObject>(object), slot, deliverPending };
 }
 
+void PacketReceiver::registerHandler(PacketType type, QObject* context, MessageHandler handler, bool deliverPending) {
+    Q_ASSERT_X(context, "PacketReceiver::registerHandler", "No context to register");
+    Q_ASSERT_X(handler, "PacketReceiver::registerHandler", "No handler to register");
+
+    QMutexLocker locker(&_packetListenerLock);
+
+    _handlers.emplace_back(new Handler { QPointer<QObject>(context), std::move(handler), deliverPending });
+    auto previous = _handlerTable[static_cast<size_t>(type)].exchange(_handlers.back().get());
+
+    if (previous) {
+        qCWarning(networking) << "Registering a packet handler for packet type" << type
+            << "that will remove a previously registered handler";
+    }
+}
+
+void PacketReceiver::registerHandlerForTypes(const PacketTypeList& types, QObject* context, MessageHandler handler) {
+    Q_ASSERT_X(!types.empty(), "PacketReceiver::registerHandlerForTypes", "No types to register");
+
+    for (auto type : types) {
+        registerHandler(type, context, handler);
+    }
+}
+
 void PacketReceiver::unregisterListener(QObject* listener) {
     Q_ASSERT_X(listener, "PacketReceiver::unregisterListener", "No listener to unregister");
     
     {
         QMutexLocker packetListenerLocker(&_packetListenerLock);
+
+        // clear any handlers with this listener as their context, they stay allocated for a receive in flight
+        for (auto& entry : _handlerTable) {
+            auto handler = entry.load();
+            if (handler && handler->context == listener) {
+                entry.store(nullptr);
+            }
+        }
         
         // clear any registrations for this listener in _messageListenerMap
         auto it = _messageListenerMap.begin();
@@ -250,7 +285,41 @@ void PacketReceiver::handleMessageFailure(HifiSockAddr from, udt::Packet::Messag
     }
 }
 
+bool PacketReceiver::handleWithHandler(const QSharedPointer<ReceivedMessage>& receivedMessage, bool justReceived) {
+    auto index = static_cast<size_t>(receivedMessage->getType());
+    if (index >= _handlerTable.size()) {
+        return false;
+    }
+
+    auto handler = _handlerTable[index].load(std::memory_order_acquire);
+    if (!handler) {
+        return false;
+    }
+
+    if (!handler->context) {
+        // the context is gone, drop the handler and let the listener path report the missing listener
+        _handlerTable[index].compare_exchange_strong(handler, nullptr);
+        return false;
+    }
+
+    if ((handler->deliverPending && !justReceived) || (!handler->deliverPending && !receivedMessage->isComplete())) {
+        return true;
+    }
+
+    SharedNodePointer matchingNode;
+    if (receivedMessage->getSourceID() != Node::NULL_LOCAL_ID) {
+        matchingNode = DependencyManager::get<LimitedNodeList>()->nodeWithLocalID(receivedMessage->getSourceID());
+    }
+
+    handler->function(receivedMessage, matchingNode);
+    return true;
+}
+
 void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> receivedMessage, bool justReceived) {
+    if (handleWithHandler(receivedMessage, justReceived)) {
+        return;
+    }
+
     auto nodeList = DependencyManager::get<LimitedNodeList>();
     
     SharedNodePointer matchingNode;
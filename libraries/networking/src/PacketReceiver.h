@@ -13,6 +13,10 @@
 #ifndef hifi_PacketReceiver_h
 #define hifi_PacketReceiver_h
 
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -25,6 +29,7 @@
 
 #include "NLPacket.h"
 #include "NLPacketList.h"
+#include "Node.h"
 #include "ReceivedMessage.h"
 #include "udt/PacketHeaders.h"
 
@@ -44,6 +49,7 @@ class PacketReceiver : public QObject {
     Q_OBJECT
 public:
     using PacketTypeList = std::vector<PacketType>;
+    using MessageHandler = std::function<void(QSharedPointer<ReceivedMessage>, SharedNodePointer)>;
     
     PacketReceiver(QObject* parent = 0);
     PacketReceiver(const PacketReceiver&) = delete;
@@ -58,6 +64,12 @@ public:
     bool registerListener(PacketType type, QObject* listener, const char* slot, bool deliverPending = false);
     bool registerListenerForTypes(PacketTypeList types, QObject* listener, const char* slot);
     void unregisterListener(QObject* listener);
+
+    // A handler is called directly on the thread that received the message, without the slot lookup and locking
+    // of a listener, so it must be safe to call from there. It takes precedence over a listener for the same type,
+    // and is dropped once context is destroyed or unregistered with unregisterListener.
+    void registerHandler(PacketType type, QObject* context, MessageHandler handler, bool deliverPending = false);
+    void registerHandlerForTypes(const PacketTypeList& types, QObject* context, MessageHandler handler);
     
     void handleVerifiedPacket(std::unique_ptr<udt::Packet> packet);
     void handleVerifiedMessagePacket(std::unique_ptr<udt::Packet> message);
@@ -70,6 +82,13 @@ private:
         bool deliverPending;
     };
 
+    struct Handler {
+        QPointer<QObject> context;
+        MessageHandler function;
+        bool deliverPending;
+    };
+
+    bool handleWithHandler(const QSharedPointer<ReceivedMessage>& message, bool justReceived);
     void handleVerifiedMessage(QSharedPointer<ReceivedMessage> message, bool justReceived);
 
     // these are brutal hacks for now - ideally GenericThread / ReceivedPacketProcessor
@@ -83,6 +102,10 @@ private:
     QMutex _packetListenerLock;
     QHash<PacketType, Listener> _messageListenerMap;
 
+    // read without a lock on the hot path, so a registered Handler is only freed with the PacketReceiver
+    std::array<std::atomic<Handler*>, static_cast<size_t>(PacketType::NUM_PACKET_TYPE)> _handlerTable;
+    std::vector<std::unique_ptr<Handler>> _handlers; // guarded by _packetListenerLock
+
     bool _shouldDropPackets = false;
     QMutex _directConnectSetMutex;
     QSet<QObject*> _directlyConnectedObjects;
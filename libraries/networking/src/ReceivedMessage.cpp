@@ -25,7 +25,7 @@ using namespace std::chrono;
 
 ReceivedMessage::ReceivedMessage(const NLPacketList& packetList)
     : _data(packetList.getMessage()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
+      _headData(_data),
       _numPackets(packetList.getNumPackets()),
       _sourceID(packetList.getSourceID()),
       _packetType(packetList.getType()),
@@ -37,7 +37,6 @@ ReceivedMessage::ReceivedMessage(const NLPacketList& packetList)
 
 ReceivedMessage::ReceivedMessage(NLPacket& packet)
     : _data(packet.readAll()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
       _numPackets(1),
       _sourceID(packet.getSourceID()),
       _packetType(packet.getType()),
@@ -46,12 +45,20 @@ ReceivedMessage::ReceivedMessage(NLPacket& packet)
       _isComplete(packet.getPacketPosition() == NLPacket::ONLY)
 {
     _firstPacketReceiveTime = duration_cast<microseconds>(packet.getReceiveTime().time_since_epoch()).count();
+
+    if (_isComplete) {
+        // nothing will be appended, the head can share the data
+        _headData = _data;
+    } else {
+        _headData = _data.mid(0, HEAD_DATA_SIZE);
+        _notifier.reset(new ReceivedMessageNotifier());
+    }
 }
 
 ReceivedMessage::ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                 const HifiSockAddr& senderSockAddr, NLPacket::LocalID sourceID) :
     _data(byteArray),
-    _headData(_data.mid(0, HEAD_DATA_SIZE)),
+    _headData(_data),
     _numPackets(1),
     _firstPacketReceiveTime(0),
     _sourceID(sourceID),
@@ -65,7 +72,9 @@ ReceivedMessage::ReceivedMessage(QByteArray byteArray, PacketType packetType, Pa
 void ReceivedMessage::setFailed() {
     _failed = true;
     _isComplete = true;
-    emit completed();
+    if (_notifier) {
+        emit _notifier->completed();
+    }
 }
 
 void ReceivedMessage::appendPacket(NLPacket& packet) {
@@ -80,7 +89,7 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
     _data.append(packet.getPayload(), packet.getPayloadSize());
 
     if (_numPackets % EMIT_PROGRESS_EVERY_X_PACKETS == 0) {
-        emit progress(getSize());
+        emit _notifier->progress(getSize());
     }
 
     auto packetPosition = packet.getPacketPosition();
@@ -91,7 +100,7 @@ void ReceivedMessage::appendPacket(NLPacket& packet) {
 
     if (packetPosition == NLPacket::PacketPosition::LAST) {
         _isComplete = true;
-        emit completed();
+        emit _notifier->completed();
     }
 }
 
@@ -152,8 +161,3 @@ QByteArray ReceivedMessage::readWithoutCopy(qint64 size) {
     _position += size;
     return data;
 }
-
-void ReceivedMessage::onComplete() {
-    _isComplete = true;
-    emit completed();
-}
@@ -16,11 +16,19 @@
 #include <QObject>
 
 #include <atomic>
+#include <memory>
 
 #include "NLPacketList.h"
 
-class ReceivedMessage : public QObject {
+// Reports the packets of a message that arrive after it was delivered
+class ReceivedMessageNotifier : public QObject {
     Q_OBJECT
+signals:
+    void progress(qint64 size);
+    void completed();
+};
+
+class ReceivedMessage {
 public:
     ReceivedMessage(const NLPacketList& packetList);
     ReceivedMessage(NLPacket& packet);
@@ -40,6 +48,9 @@ public:
     bool failed() const { return _failed; }
     bool isComplete() const { return _isComplete; }
 
+    // Only messages still waiting on packets when created have a notifier, complete messages stay free of QObject
+    ReceivedMessageNotifier* getNotifier() const { return _notifier.get(); }
+
     NLPacket::LocalID getSourceID() const { return _sourceID; }
     const HifiSockAddr& getSenderSockAddr() { return _senderSockAddr; }
 
@@ -81,17 +92,12 @@ public:
 
     template<typename T> qint64 readHeadPrimitive(T* data);
 
-signals:
-    void progress(qint64 size);
-    void completed();
-
-private slots:
-    void onComplete();
-
 private:
     QByteArray _data;
     QByteArray _headData;
 
+    std::unique_ptr<ReceivedMessageNotifier> _notifier;
+
     std::atomic<qint64> _position { 0 };
     std::atomic<qint64> _numPackets { 0 };
     std::atomic<quint64> _firstPacketReceiveTime { 0 };
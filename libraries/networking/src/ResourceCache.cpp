@@ -33,15 +33,28 @@ bool ResourceCacheSharedItems::appendRequest(QWeakPointer<Resource> resource) {
     if ((uint32_t)_loadingRequests.size() < _requestLimit) {
         _loadingRequests.append(resource);
         return true;
-    } else {
-        _pendingRequests.append(resource);
-        return false;
     }
+
+    auto locked = resource.lock();
+    if (locked) {
+        bool isFile = locked->getURL().scheme() == HIFI_URL_SCHEME_FILE;
+        auto& queue = isFile ? _pendingFileRequests : _pendingRequests;
+        queue.push(locked, locked->getLoadPriority(), _nextRequestOrder++);
+        _wasBackloggedInWindow = true;
+    }
+    return false;
 }
 
 void ResourceCacheSharedItems::setRequestLimit(uint32_t limit) {
     Lock lock(_mutex);
-    _requestLimit = limit;
+    _requestLimit = _minRequestLimit = _maxRequestLimit = limit;
+}
+
+void ResourceCacheSharedItems::setAdaptiveRequestLimit(uint32_t minLimit, uint32_t maxLimit) {
+    Lock lock(_mutex);
+    _minRequestLimit = std::max(1u, minLimit);
+    _maxRequestLimit = std::max(_minRequestLimit, maxLimit);
+    _requestLimit = glm::clamp(_requestLimit, _minRequestLimit, _maxRequestLimit);
 }
 
 uint32_t ResourceCacheSharedItems::getRequestLimit() const {
@@ -52,20 +65,14 @@ uint32_t ResourceCacheSharedItems::getRequestLimit() const {
 QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getPendingRequests() const {
     QList<QSharedPointer<Resource>> result;
     Lock lock(_mutex);
-
-    foreach (QWeakPointer<Resource> resource, _pendingRequests) {
-        auto locked = resource.lock();
-        if (locked) {
-            result.append(locked);
-        }
-    }
-
+    _pendingFileRequests.append(result);
+    _pendingRequests.append(result);
     return result;
 }
 
 uint32_t ResourceCacheSharedItems::getPendingRequestsCount() const {
     Lock lock(_mutex);
-    return _pendingRequests.size();
+    return (uint32_t)(_pendingFileRequests.size() + _pendingRequests.size());
 }
 
 QList<QSharedPointer<Resource>> ResourceCacheSharedItems::getLoadingRequests() const {
@@ -98,6 +105,7 @@ void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
         // Clear our resource and any freed resources
         if (!request || request.data() == resource.data()) {
             _loadingRequests.removeAt(i);
+            _completedInWindow++;
             continue;
         }
         i++;
@@ -105,45 +113,215 @@ void ResourceCacheSharedItems::removeRequest(QWeakPointer<Resource> resource) {
 }
 
 QSharedPointer<Resource> ResourceCacheSharedItems::getHighestPendingRequest() {
-    // look for the highest priority pending request
-    int highestIndex = -1;
-    float highestPriority = -FLT_MAX;
-    QSharedPointer<Resource> highestResource;
     Lock lock(_mutex);
+    auto resource = _pendingFileRequests.pop();
+    if (!resource) {
+        resource = _pendingRequests.pop();
+    }
+    return resource;
+}
 
-    bool currentHighestIsFile = false;
+void ResourceCacheSharedItems::updatePendingRequestPriority(Resource* resource) {
+    Lock lock(_mutex);
+    if (!_pendingFileRequests.update(resource, resource->getLoadPriority())) {
+        _pendingRequests.update(resource, resource->getLoadPriority());
+    }
+}
 
-    for (int i = 0; i < _pendingRequests.size();) {
-        // Clear any freed resources
-        auto resource = _pendingRequests.at(i).lock();
+void ResourceCacheSharedItems::refreshPendingRequests() {
+    Lock lock(_mutex);
+    _pendingFileRequests.refresh();
+    _pendingRequests.refresh();
+    adaptRequestLimit(usecTimestampNow());
+}
+
+void ResourceCacheSharedItems::adaptRequestLimit(quint64 now) {
+    // protected: _mutex is held
+    const quint64 REQUEST_LIMIT_WINDOW_USECS = USECS_PER_SECOND;
+    const float SIGNIFICANT_THROUGHPUT_DROP = 0.9f;
+
+    if (_windowStart == 0 || now < _windowStart) {
+        _windowStart = now;
+        return;
+    }
+    if (now - _windowStart < REQUEST_LIMIT_WINDOW_USECS) {
+        return;
+    }
+
+    bool wasBacklogged = _wasBackloggedInWindow || _pendingFileRequests.size() + _pendingRequests.size() > 0;
+    float throughput = (float)_completedInWindow * USECS_PER_SECOND / (float)(now - _windowStart);
+    _windowStart = now;
+    _completedInWindow = 0;
+    _wasBackloggedInWindow = false;
+
+    if (_minRequestLimit == _maxRequestLimit) {
+        return;
+    }
+
+    // without a backlog the throughput only shows the demand, not what more requests would get through
+    if (wasBacklogged) {
+        if (throughput < _lastThroughput * SIGNIFICANT_THROUGHPUT_DROP) {
+            // the last step made things worse, so turn around
+            _requestLimitStep = -_requestLimitStep;
+        }
+        _requestLimit = (uint32_t)glm::clamp((int)_requestLimit + _requestLimitStep,
+                                             (int)_minRequestLimit, (int)_maxRequestLimit);
+    }
+    _lastThroughput = throughput;
+}
+
+void ResourceCacheSharedItems::clear() {
+    Lock lock(_mutex);
+    _pendingFileRequests.clear();
+    _pendingRequests.clear();
+    _loadingRequests.clear();
+}
+
+bool ResourceCacheSharedItems::PendingRequestQueue::isHigher(const Entry& a, const Entry& b) {
+    return a.priority > b.priority || (a.priority == b.priority && a.order > b.order);
+}
+
+void ResourceCacheSharedItems::PendingRequestQueue::push(const QSharedPointer<Resource>& resource, float priority,
+                                                         uint64_t order) {
+    Resource* key = resource.data();
+    auto itr = _indices.find(key);
+    if (itr != _indices.end()) {
+        // requested again, or a freed request that this one took the address of
+        removeAt(itr->second);
+    }
+
+    _heap.push_back({ resource, key, priority, order });
+    _indices[key] = _heap.size() - 1;
+    siftUp(_heap.size() - 1);
+}
+
+QSharedPointer<Resource> ResourceCacheSharedItems::PendingRequestQueue::pop() {
+    while (!_heap.empty()) {
+        auto resource = _heap.front().resource.lock();
         if (!resource) {
-            _pendingRequests.removeAt(i);
+            removeAt(0);
             continue;
         }
 
-        // Check load priority
+        // an owner of the request may have gone away since its priority was cached
         float priority = resource->getLoadPriority();
-        bool isFile = resource->getURL().scheme() == HIFI_URL_SCHEME_FILE;
-        if (priority >= highestPriority && (isFile || !currentHighestIsFile)) {
-            highestPriority = priority;
-            highestIndex = i;
-            highestResource = resource;
-            currentHighestIsFile = isFile;
+        if (priority != _heap.front().priority) {
+            update(resource.data(), priority);
+            continue;
         }
-        i++;
+
+        removeAt(0);
+        return resource;
     }
+    return QSharedPointer<Resource>();
+}
 
-    if (highestIndex >= 0) {
-        _pendingRequests.takeAt(highestIndex);
+bool ResourceCacheSharedItems::PendingRequestQueue::update(Resource* resource, float priority) {
+    auto itr = _indices.find(resource);
+    if (itr == _indices.end()) {
+        return false;
     }
 
-    return highestResource;
+    size_t index = itr->second;
+    float oldPriority = _heap[index].priority;
+    _heap[index].priority = priority;
+    if (priority > oldPriority) {
+        siftUp(index);
+    } else if (priority < oldPriority) {
+        siftDown(index);
+    }
+    return true;
 }
 
-void ResourceCacheSharedItems::clear() {
-    Lock lock(_mutex);
-    _pendingRequests.clear();
-    _loadingRequests.clear();
+void ResourceCacheSharedItems::PendingRequestQueue::refresh() {
+    std::vector<Entry> entries;
+    entries.reserve(_heap.size());
+    for (auto& entry : _heap) {
+        auto resource = entry.resource.lock();
+        if (resource) {
+            entry.priority = resource->getLoadPriority();
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    // rebuilding the heap in one go is linear, where moving each request would not be
+    _heap.clear();
+    _indices.clear();
+    for (auto& entry : entries) {
+        _heap.push_back(std::move(entry));
+        _indices[_heap.back().key] = _heap.size() - 1;
+    }
+    for (size_t i = _heap.size() / 2; i-- > 0;) {
+        siftDown(i);
+    }
+}
+
+void ResourceCacheSharedItems::PendingRequestQueue::append(QList<QSharedPointer<Resource>>& result) const {
+    for (auto& entry : _heap) {
+        auto locked = entry.resource.lock();
+        if (locked) {
+            result.append(locked);
+        }
+    }
+}
+
+void ResourceCacheSharedItems::PendingRequestQueue::clear() {
+    _heap.clear();
+    _indices.clear();
+}
+
+void ResourceCacheSharedItems::PendingRequestQueue::removeAt(size_t index) {
+    _indices.erase(_heap[index].key);
+    size_t last = _heap.size() - 1;
+    if (index != last) {
+        place(std::move(_heap[last]), index);
+        _heap.pop_back();
+        if (index > 0 && isHigher(_heap[index], _heap[(index - 1) / 2])) {
+            siftUp(index);
+        } else {
+            siftDown(index);
+        }
+    } else {
+        _heap.pop_back();
+    }
+}
+
+void ResourceCacheSharedItems::PendingRequestQueue::siftUp(size_t index) {
+    Entry entry = std::move(_heap[index]);
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!isHigher(entry, _heap[parent])) {
+            break;
+        }
+        place(std::move(_heap[parent]), index);
+        index = parent;
+    }
+    place(std::move(entry), index);
+}
+
+void ResourceCacheSharedItems::PendingRequestQueue::siftDown(size_t index) {
+    size_t size = _heap.size();
+    Entry entry = std::move(_heap[index]);
+    while (true) {
+        size_t child = 2 * index + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && isHigher(_heap[child + 1], _heap[child])) {
+            child++;
+        }
+        if (!isHigher(_heap[child], entry)) {
+            break;
+        }
+        place(std::move(_heap[child]), index);
+        index = child;
+    }
+    place(std::move(entry), index);
+}
+
+void ResourceCacheSharedItems::PendingRequestQueue::place(Entry&& entry, size_t index) {
+    _indices[entry.key] = index;
+    _heap[index] = std::move(entry);
 }
 
 ScriptableResourceCache::ScriptableResourceCache(QSharedPointer<ResourceCache> resourceCache) {
@@ -349,6 +527,28 @@ void ResourceCache::setRequestLimit(uint32_t limit) {
     }
 }
 
+void ResourceCache::setAdaptiveRequestLimit(uint32_t minLimit, uint32_t maxLimit) {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    sharedItems->setAdaptiveRequestLimit(minLimit, maxLimit);
+
+    // Now go fill any new request spots
+    while (sharedItems->getLoadingRequestsCount() < sharedItems->getRequestLimit() && sharedItems->getPendingRequestsCount() > 0) {
+        attemptHighestPriorityRequest();
+    }
+}
+
+void ResourceCache::updatePendingRequests() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    sharedItems->refreshPendingRequests();
+
+    // the limit may have grown
+    while (sharedItems->getLoadingRequestsCount() < sharedItems->getRequestLimit() && sharedItems->getPendingRequestsCount() > 0) {
+        if (!attemptHighestPriorityRequest()) {
+            break;
+        }
+    }
+}
+
 QSharedPointer<Resource> ResourceCache::getResource(const QUrl& url, const QUrl& fallback, void* extra, size_t extraHash) {
     QSharedPointer<Resource> resource;
     {
@@ -604,8 +804,10 @@ void Resource::ensureLoading() {
 }
 
 void Resource::setLoadPriority(const QPointer<QObject>& owner, float priority) {
-    if (!_failedToLoad) {
+    // a NaN would never compare equal to the priority cached in the pending queue, see PendingRequestQueue::pop
+    if (!_failedToLoad && std::isfinite(priority)) {
         _loadPriorities.insert(owner, priority);
+        loadPriorityChanged();
     }
 }
 
@@ -615,13 +817,25 @@ void Resource::setLoadPriorities(const QHash<QPointer<QObject>, float>& prioriti
     }
     for (QHash<QPointer<QObject>, float>::const_iterator it = priorities.constBegin();
             it != priorities.constEnd(); it++) {
-        _loadPriorities.insert(it.key(), it.value());
+        if (std::isfinite(it.value())) {
+            _loadPriorities.insert(it.key(), it.value());
+        }
     }
+    loadPriorityChanged();
 }
 
 void Resource::clearLoadPriority(const QPointer<QObject>& owner) {
     if (!_failedToLoad) {
         _loadPriorities.remove(owner);
+        loadPriorityChanged();
+    }
+}
+
+void Resource::loadPriorityChanged() {
+    // a pending request moves in the queue now, rather than being looked for each time a request slot frees up
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    if (sharedItems) {
+        sharedItems->updatePendingRequestPriority(this);
     }
 }
 
@@ -14,6 +14,8 @@
 
 #include <atomic>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <QtCore/QHash>
 #include <QtCore/QList>
@@ -69,22 +71,68 @@ public:
     bool appendRequest(QWeakPointer<Resource> newRequest);
     void removeRequest(QWeakPointer<Resource> doneRequest);
     void setRequestLimit(uint32_t limit);
+    void setAdaptiveRequestLimit(uint32_t minLimit, uint32_t maxLimit);
     uint32_t getRequestLimit() const;
     QList<QSharedPointer<Resource>> getPendingRequests() const;
     QSharedPointer<Resource> getHighestPendingRequest();
     uint32_t getPendingRequestsCount() const;
     QList<QSharedPointer<Resource>> getLoadingRequests() const;
     uint32_t getLoadingRequestsCount() const;
+    void updatePendingRequestPriority(Resource* resource);
+    void refreshPendingRequests();
     void clear();
 
 private:
     ResourceCacheSharedItems() = default;
 
+    // The pending requests, as a max heap on their load priority, with the position of each request in it so that a
+    // change of priority only moves that request. The priorities are cached, since working one out walks the owners.
+    class PendingRequestQueue {
+    public:
+        void push(const QSharedPointer<Resource>& resource, float priority, uint64_t order);
+        QSharedPointer<Resource> pop();
+        bool update(Resource* resource, float priority);
+        void refresh();
+        void append(QList<QSharedPointer<Resource>>& result) const;
+        size_t size() const { return _heap.size(); }
+        void clear();
+
+    private:
+        struct Entry {
+            QWeakPointer<Resource> resource;
+            Resource* key;
+            float priority;
+            uint64_t order; // the later request goes first among equal priorities
+        };
+
+        static bool isHigher(const Entry& a, const Entry& b);
+        void removeAt(size_t index);
+        void siftUp(size_t index);
+        void siftDown(size_t index);
+        void place(Entry&& entry, size_t index);
+
+        std::vector<Entry> _heap;
+        std::unordered_map<Resource*, size_t> _indices;
+    };
+
+    void adaptRequestLimit(quint64 now);
+
     mutable Mutex _mutex;
-    QList<QWeakPointer<Resource>> _pendingRequests;
+    PendingRequestQueue _pendingFileRequests; // local files are always requested before anything else
+    PendingRequestQueue _pendingRequests;
+    uint64_t _nextRequestOrder { 0 };
     QList<QWeakPointer<Resource>> _loadingRequests;
     const uint32_t DEFAULT_REQUEST_LIMIT = 10;
     uint32_t _requestLimit { DEFAULT_REQUEST_LIMIT };
+
+    // when adapting, the limit climbs toward the number of requests that completes the most of them each window
+    uint32_t _minRequestLimit { DEFAULT_REQUEST_LIMIT };
+    uint32_t _maxRequestLimit { DEFAULT_REQUEST_LIMIT };
+    int _requestLimitStep { 1 };
+    quint64 _windowStart { 0 };
+    uint32_t _completedInWindow { 0 };
+    bool _wasBackloggedInWindow { false };
+    float _lastThroughput { 0.0f };
 };
 
 /// Wrapper to expose resources to JS/QML
@@ -210,6 +258,7 @@ public:
     Q_INVOKABLE QVariantList getResourceList();
 
     static void setRequestLimit(uint32_t limit);
+    static void setAdaptiveRequestLimit(uint32_t minLimit, uint32_t maxLimit);
     static uint32_t getRequestLimit() { return DependencyManager::get<ResourceCacheSharedItems>()->getRequestLimit(); }
     
     void setUnusedResourceCacheSize(qint64 unusedResourcesMaxSize);
@@ -219,6 +268,9 @@ public:
     static uint32_t getPendingRequestCount();
     static uint32_t getLoadingRequestCount();
 
+    /// Refreshes the priorities of the pending requests and adapts the request limit, call it once a frame.
+    static void updatePendingRequests();
+
     ResourceCache(QObject* parent = nullptr);
     virtual ~ResourceCache();
     
@@ -561,6 +613,7 @@ private:
     
     void retry();
     void reinsert();
+    void loadPriorityChanged();
 
     bool isInScript() const { return _isInScript; }
     void setInScript(bool isInScript) { _isInScript = isInScript; }
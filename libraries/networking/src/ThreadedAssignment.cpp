@@ -18,10 +18,12 @@
 #include <QtCore/QTimer>
 
 #include <LogHandler.h>
+#include <SharedUtil.h>
 #include <shared/QtHelpers.h>
 
 #include <platform/Platform.h>
 #include "NetworkLogging.h"
+#include "udt/PacketBufferPool.h"
 
 ThreadedAssignment::ThreadedAssignment(ReceivedMessage& message) :
     Assignment(message),
@@ -34,7 +36,7 @@ ThreadedAssignment::ThreadedAssignment(ReceivedMessage& message) :
 
     static const int STATS_TIMEOUT_MS = 1000;
     _statsTimer.setInterval(STATS_TIMEOUT_MS); // 1s, Qt::CoarseTimer acceptable
-    connect(&_statsTimer, &QTimer::timeout, this, &ThreadedAssignment::sendStatsPacket);
+    connect(&_statsTimer, &QTimer::timeout, this, &ThreadedAssignment::sendStats);
 
     connect(&_domainServerTimer, &QTimer::timeout, this, &ThreadedAssignment::checkInWithDomainServerOrExit);
     _domainServerTimer.setInterval(DOMAIN_SERVER_CHECK_IN_MSECS); // 1s, Qt::CoarseTimer acceptable
@@ -102,8 +104,17 @@ void ThreadedAssignment::commonInit(const QString& targetName, NodeType_t nodeTy
     connect(&nodeList->getDomainHandler(), &DomainHandler::connectedToDomain,
             &_statsTimer, static_cast<void (QTimer::*)()>(&QTimer::start));
 
+    // a domain server we (re)connect to starts from all of our metrics
+    connect(&nodeList->getDomainHandler(), &DomainHandler::connectedToDomain, this, [this] {
+        _metricsEncoder.reset();
+    });
+
     // stop sending stats if we disconnect
     connect(&nodeList->getDomainHandler(), &DomainHandler::disconnectedFromDomain, &_statsTimer, &QTimer::stop);
+
+    nodeList->getPacketReceiver().registerListener(PacketType::NodeJsonStatsRequest, this, "handleJSONStatsRequest");
+    nodeList->getPacketReceiver().registerListener(PacketType::NodeMetricsResendRequest, this,
+                                                   "handleMetricsResendRequest");
 }
 
 void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObject) {
@@ -119,6 +130,23 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
     ioStats["outbound_kbps"] = nodeList->getOutboundKbps();
     ioStats["outbound_pps"] = nodeList->getOutboundPPS();
 
+    auto datagramIOStats = nodeList->getDatagramIOStats();
+    ioStats["batched_read_calls"] = (double)datagramIOStats.batchedReadCalls;
+    ioStats["batched_read_datagrams"] = (double)datagramIOStats.batchedReadDatagrams;
+    ioStats["unbatched_read_datagrams"] = (double)datagramIOStats.unbatchedReadDatagrams;
+    ioStats["batched_write_calls"] = (double)datagramIOStats.batchedWriteCalls;
+    ioStats["batched_write_datagrams"] = (double)datagramIOStats.batchedWriteDatagrams;
+    ioStats["unbatched_write_datagrams"] = (double)datagramIOStats.unbatchedWriteDatagrams;
+
+    auto packetBufferStats = udt::PacketBufferPool::getStats();
+    QJsonObject packetBuffers;
+    packetBuffers["thread_cache_allocations"] = (double)packetBufferStats.threadCacheAllocations;
+    packetBuffers["shared_allocations"] = (double)packetBufferStats.sharedAllocations;
+    packetBuffers["heap_allocations"] = (double)packetBufferStats.heapAllocations;
+    packetBuffers["heap_releases"] = (double)packetBufferStats.heapReleases;
+    packetBuffers["shared_free_slabs"] = packetBufferStats.sharedFreeSlabs;
+    ioStats["packet_buffers"] = packetBuffers;
+
     statsObject["io_stats"] = ioStats;
 
     QJsonObject assignmentStats;
@@ -127,6 +155,26 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
     statsObject["assignmentStats"] = assignmentStats;
 
     nodeList->sendStatsToDomainServer(statsObject);
+
+    sendMetrics();
+}
+
+void ThreadedAssignment::sendMetrics() {
+    auto& registry = MetricRegistry::getInstance();
+    static auto inboundKbps = registry.gauge("node_inbound_kbps", "Inbound traffic of the node in kbit/s");
+    static auto inboundPPS = registry.gauge("node_inbound_pps", "Inbound packets of the node per second");
+    static auto outboundKbps = registry.gauge("node_outbound_kbps", "Outbound traffic of the node in kbit/s");
+    static auto outboundPPS = registry.gauge("node_outbound_pps", "Outbound packets of the node per second");
+    static auto queuedCheckIns = registry.gauge("node_queued_check_ins", "Domain server check-ins without a reply");
+
+    auto nodeList = DependencyManager::get<NodeList>();
+    inboundKbps.set(nodeList->getInboundKbps());
+    inboundPPS.set(nodeList->getInboundPPS());
+    outboundKbps.set(nodeList->getOutboundKbps());
+    outboundPPS.set(nodeList->getOutboundPPS());
+    queuedCheckIns.set(_numQueuedCheckIns);
+
+    nodeList->sendMetricsToDomainServer(registry.writeChanges(_metricsEncoder));
 }
 
 void ThreadedAssignment::sendStatsPacket() {
@@ -134,6 +182,34 @@ void ThreadedAssignment::sendStatsPacket() {
     addPacketStatsAndSendStatsPacket(statsObject);
 }
 
+void ThreadedAssignment::sendStats() {
+    if (usecTimestampNow() < _jsonStatsWantedUntil) {
+        sendStatsPacket();
+    } else {
+        resetStatsInterval();
+        sendMetrics();
+    }
+}
+
+void ThreadedAssignment::handleJSONStatsRequest(QSharedPointer<ReceivedMessage> message) {
+    // the domain server asks again as long as its stats page for us is open
+    static const quint64 JSON_STATS_WANTED_USECS = 5 * USECS_PER_SECOND;
+
+    auto now = usecTimestampNow();
+    bool wasWanted = now < _jsonStatsWantedUntil;
+    _jsonStatsWantedUntil = now + JSON_STATS_WANTED_USECS;
+
+    // don't leave the page empty until the next stats interval
+    if (!wasWanted && _statsTimer.isActive()) {
+        sendStatsPacket();
+    }
+}
+
+void ThreadedAssignment::handleMetricsResendRequest(QSharedPointer<ReceivedMessage> message) {
+    // the domain server couldn't follow our changes, the next write holds all of the metrics
+    _metricsEncoder.reset();
+}
+
 void ThreadedAssignment::checkInWithDomainServerOrExit() {
     // verify that the number of queued check-ins is not >= our max
     // the number of queued check-ins is cleared anytime we get a response from the domain-server
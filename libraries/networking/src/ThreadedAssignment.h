@@ -14,6 +14,8 @@
 
 #include <QtCore/QSharedPointer>
 
+#include <MetricRegistry.h>
+
 #include "ReceivedMessage.h"
 
 #include "Assignment.h"
@@ -37,6 +39,9 @@ public slots:
 
     void clearQueuedCheckIns() { _numQueuedCheckIns = 0; }
 
+    void handleJSONStatsRequest(QSharedPointer<ReceivedMessage> message);
+    void handleMetricsResendRequest(QSharedPointer<ReceivedMessage> message);
+
 signals:
     void finished();
 
@@ -44,16 +49,30 @@ protected:
     void commonInit(const QString& targetName, NodeType_t nodeType);
     void setFinished(bool isFinished);
 
+    // starts the next stats interval when sendStatsPacket wasn't called for this one, subclasses reset the
+    // per-interval counters that sendStatsPacket averages
+    virtual void resetStatsInterval() {}
+
     bool _isFinished;
     QTimer _domainServerTimer;
     QTimer _statsTimer;
     int _numQueuedCheckIns { 0 };
 
+    // the metrics the domain server was sent since we connected to it
+    MetricRegistry::Encoder _metricsEncoder;
+
+    // the JSON stats are only built while the domain server shows them
+    quint64 _jsonStatsWantedUntil { 0 };
+
 protected slots:
     void domainSettingsRequestFailed();
 
 private slots:
     void checkInWithDomainServerOrExit();
+    void sendStats();
+
+private:
+    void sendMetrics();
 };
 
 typedef QSharedPointer<ThreadedAssignment> SharedAssignmentPointer;
@@ -68,6 +68,16 @@ Connection::~Connection() {
 
 void Connection::stopSendQueue() {
     if (auto sendQueue = _sendQueue.release()) {
+        if (sendQueue->usesSharedSendThreads()) {
+            // the queue lives on our thread, stopping it detaches it from the shared sender threads
+            sendQueue->stop();
+
+            _lastMessageNumber = sendQueue->getCurrentMessageNumber();
+
+            sendQueue->deleteLater();
+            return;
+        }
+
         // grab the send queue thread so we can wait on it
         QThread* sendQueueThread = sendQueue->thread();
         
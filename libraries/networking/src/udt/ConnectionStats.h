@@ -72,6 +72,21 @@ public:
         // TODO: Remove once Win build supports brace initialization: `Events events {{ 0 }};`
         Stats() { events.fill(0); }
     };
+
+    // socket-wide counters for how datagrams got on and off the wire, sampled alongside the per-connection stats
+    struct DatagramIOStats {
+        // datagrams read through recvmmsg, and the number of recvmmsg calls that read them
+        uint64_t batchedReadCalls { 0 };
+        uint64_t batchedReadDatagrams { 0 };
+
+        // datagrams written through sendmmsg, and the number of sendmmsg calls that wrote them
+        uint64_t batchedWriteCalls { 0 };
+        uint64_t batchedWriteDatagrams { 0 };
+
+        // datagrams that went through QUdpSocket one at a time
+        uint64_t unbatchedReadDatagrams { 0 };
+        uint64_t unbatchedWriteDatagrams { 0 };
+    };
     
     ConnectionStats();
     
@@ -0,0 +1,145 @@
+//
+//  PacketBufferPool.cpp
+//  libraries/networking/src/udt
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketBufferPool.h"
+
+#include <atomic>
+#include <vector>
+
+#include <TBBHelpers.h>
+
+using namespace udt;
+
+static const size_t MAX_THREAD_CACHED_SLABS = 256;
+static const int MAX_SHARED_FREE_SLABS = 8192;
+
+namespace {
+
+struct Counters {
+    std::atomic<uint64_t> threadCacheAllocations { 0 };
+    std::atomic<uint64_t> sharedAllocations { 0 };
+    std::atomic<uint64_t> heapAllocations { 0 };
+    std::atomic<uint64_t> threadCacheReleases { 0 };
+    std::atomic<uint64_t> sharedReleases { 0 };
+    std::atomic<uint64_t> heapReleases { 0 };
+};
+
+struct SharedSlabs {
+    ~SharedSlabs() {
+        char* slab;
+        while (queue.try_pop(slab)) {
+            delete[] slab;
+        }
+    }
+
+    tbb::concurrent_queue<char*> queue;
+    std::atomic<int> size { 0 };
+};
+
+Counters& counters() {
+    static Counters instance;
+    return instance;
+}
+
+SharedSlabs& sharedSlabs() {
+    static SharedSlabs instance;
+    return instance;
+}
+
+void releaseToSharedOrHeap(char* slab) {
+    auto& shared = sharedSlabs();
+    if (shared.size.fetch_add(1, std::memory_order_relaxed) < MAX_SHARED_FREE_SLABS) {
+        shared.queue.push(slab);
+        counters().sharedReleases.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        shared.size.fetch_sub(1, std::memory_order_relaxed);
+        delete[] slab;
+        counters().heapReleases.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+struct ThreadCache {
+    ThreadCache() { slabs.reserve(MAX_THREAD_CACHED_SLABS); }
+
+    ~ThreadCache() {
+        // hand our slabs to the threads that outlive us
+        for (auto slab : slabs) {
+            releaseToSharedOrHeap(slab);
+        }
+    }
+
+    std::vector<char*> slabs;
+};
+
+ThreadCache& threadCache() {
+    static thread_local ThreadCache cache;
+    return cache;
+}
+
+}
+
+void PacketBufferDeleter::operator()(char* buffer) const {
+    if (isPooled) {
+        PacketBufferPool::release(buffer);
+    } else {
+        delete[] buffer;
+    }
+}
+
+PacketBuffer PacketBufferPool::allocate(qint64 size) {
+    if (size > SLAB_SIZE) {
+        counters().heapAllocations.fetch_add(1, std::memory_order_relaxed);
+        return PacketBuffer(new char[size], PacketBufferDeleter(false));
+    }
+
+    auto& cache = threadCache();
+    if (!cache.slabs.empty()) {
+        char* slab = cache.slabs.back();
+        cache.slabs.pop_back();
+        counters().threadCacheAllocations.fetch_add(1, std::memory_order_relaxed);
+        return PacketBuffer(slab, PacketBufferDeleter(true));
+    }
+
+    auto& shared = sharedSlabs();
+    char* slab = nullptr;
+    if (shared.queue.try_pop(slab)) {
+        shared.size.fetch_sub(1, std::memory_order_relaxed);
+        counters().sharedAllocations.fetch_add(1, std::memory_order_relaxed);
+        return PacketBuffer(slab, PacketBufferDeleter(true));
+    }
+
+    counters().heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    return PacketBuffer(new char[SLAB_SIZE], PacketBufferDeleter(true));
+}
+
+void PacketBufferPool::release(char* slab) {
+    auto& cache = threadCache();
+    if (cache.slabs.size() < MAX_THREAD_CACHED_SLABS) {
+        cache.slabs.push_back(slab);
+        counters().threadCacheReleases.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        releaseToSharedOrHeap(slab);
+    }
+}
+
+PacketBufferPool::Stats PacketBufferPool::getStats() {
+    auto& current = counters();
+
+    Stats stats;
+    stats.threadCacheAllocations = current.threadCacheAllocations.load(std::memory_order_relaxed);
+    stats.sharedAllocations = current.sharedAllocations.load(std::memory_order_relaxed);
+    stats.heapAllocations = current.heapAllocations.load(std::memory_order_relaxed);
+    stats.threadCacheReleases = current.threadCacheReleases.load(std::memory_order_relaxed);
+    stats.sharedReleases = current.sharedReleases.load(std::memory_order_relaxed);
+    stats.heapReleases = current.heapReleases.load(std::memory_order_relaxed);
+    stats.sharedFreeSlabs = sharedSlabs().size.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,69 @@
+//
+//  PacketBufferPool.h
+//  libraries/networking/src/udt
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_PacketBufferPool_h
+#define hifi_PacketBufferPool_h
+
+#include <cstdint>
+#include <memory>
+
+#include <QtCore/QtGlobal>
+
+#include "Constants.h"
+
+namespace udt {
+
+// Frees a packet buffer: slabs go back to the PacketBufferPool, anything else is delete[]'d.
+// Implicitly constructible from std::default_delete so that a std::unique_ptr<char[]> converts to a PacketBuffer.
+struct PacketBufferDeleter {
+    PacketBufferDeleter() = default;
+    PacketBufferDeleter(const std::default_delete<char[]>&) {}
+    explicit PacketBufferDeleter(bool isPooled) : isPooled(isPooled) {}
+
+    void operator()(char* buffer) const;
+
+    bool isPooled { false };
+};
+
+using PacketBuffer = std::unique_ptr<char[], PacketBufferDeleter>;
+
+// Recycles the MTU sized buffers behind every BasePacket.
+// Each thread keeps a small cache of free slabs it can use without synchronization; slabs freed past that
+// go to a shared lock-free queue where threads that mostly allocate (the socket thread, mixer slaves) pick them up.
+class PacketBufferPool {
+public:
+    static const int SLAB_SIZE = MAX_PACKET_SIZE;
+
+    struct Stats {
+        uint64_t threadCacheAllocations { 0 }; // served from the allocating thread's cache
+        uint64_t sharedAllocations { 0 }; // served from the shared queue
+        uint64_t heapAllocations { 0 }; // new slabs, or buffers too big for a slab
+
+        uint64_t threadCacheReleases { 0 };
+        uint64_t sharedReleases { 0 };
+        uint64_t heapReleases { 0 }; // freed back to the heap because every cache was full
+
+        int sharedFreeSlabs { 0 };
+    };
+
+    // returns a buffer of at least size bytes, contents are undefined
+    static PacketBuffer allocate(qint64 size);
+
+    static void release(char* slab);
+
+    static Stats getStats();
+};
+
+}
+
+#endif // hifi_PacketBufferPool_h
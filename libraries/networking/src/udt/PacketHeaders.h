@@ -136,6 +136,10 @@ public:
         BulkAvatarTraitsAck,
         StopInjector,
         AvatarZonePresence,
+        NodeMetrics,
+        AvatarJointDeltasAck,
+        NodeJsonStatsRequest,
+        NodeMetricsResendRequest,
         NUM_PACKET_TYPE
     };
 
@@ -155,6 +159,7 @@ public:
     const static QSet<PacketTypeEnum::Value> getNonVerifiedPackets() {
         const static QSet<PacketTypeEnum::Value> NON_VERIFIED_PACKETS = QSet<PacketTypeEnum::Value>()
             << PacketTypeEnum::Value::NodeJsonStats
+            << PacketTypeEnum::Value::NodeMetrics
             << PacketTypeEnum::Value::EntityQuery
             << PacketTypeEnum::Value::OctreeDataNack
             << PacketTypeEnum::Value::EntityEditNack
@@ -183,6 +188,7 @@ public:
             << PacketTypeEnum::Value::ICEPingReply << PacketTypeEnum::Value::ICEServerHeartbeatDenied
             << PacketTypeEnum::Value::AssignmentClientStatus << PacketTypeEnum::Value::StopNode
             << PacketTypeEnum::Value::DomainServerRemovedNode << PacketTypeEnum::Value::UsernameFromIDReply
+            << PacketTypeEnum::Value::NodeJsonStatsRequest << PacketTypeEnum::Value::NodeMetricsResendRequest
             << PacketTypeEnum::Value::OctreeFileReplacement << PacketTypeEnum::Value::ReplicatedMicrophoneAudioNoEcho
             << PacketTypeEnum::Value::ReplicatedMicrophoneAudioWithEcho << PacketTypeEnum::Value::ReplicatedInjectAudio
             << PacketTypeEnum::Value::ReplicatedSilentAudioFrame << PacketTypeEnum::Value::ReplicatedAvatarIdentity
@@ -343,7 +349,8 @@ enum class AvatarMixerPacketVersion : PacketVersion {
     FBXJointOrderChange,
     HandControllerSection,
     SendVerificationFailed,
-    ARKitBlendshapes
+    ARKitBlendshapes,
+    JointDeltas
 };
 
 enum class DomainConnectRequestVersion : PacketVersion {
@@ -377,7 +384,13 @@ enum class DomainListVersion : PacketVersion {
     GetMachineFingerprintFromUUIDSupport,
     AuthenticationOptional,
     HasTimestamp,
-    HasConnectReason
+    HasConnectReason,
+    HasListVersions
+};
+
+enum class DomainListRequestVersion : PacketVersion {
+    PreAcknowledgedListVersion = 22,
+    HasAcknowledgedListVersion
 };
 
 enum class AudioVersion : PacketVersion {
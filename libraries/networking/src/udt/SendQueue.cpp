@@ -64,12 +64,25 @@ private:
 const microseconds SendQueue::MAXIMUM_ESTIMATED_TIMEOUT = seconds(5);
 const microseconds SendQueue::MINIMUM_ESTIMATED_TIMEOUT = milliseconds(10);
 
+static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
+static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
+
 std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, HifiSockAddr destination, SequenceNumber currentSequenceNumber,
                                              MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK) {
     Q_ASSERT_X(socket, "SendQueue::create", "Must be called with a valid Socket*");
     
+    bool usesSharedSendThreads = SendQueueScheduler::isEnabled();
+
     auto queue = std::unique_ptr<SendQueue>(new SendQueue(socket, destination, currentSequenceNumber,
-                                                          currentMessageNumber, hasReceivedHandshakeACK));
+                                                          currentMessageNumber, hasReceivedHandshakeACK,
+                                                          usesSharedSendThreads));
+
+    if (usesSharedSendThreads) {
+        // the queue stays on the Connection's thread (so its slots are direct calls)
+        // and the shared sender threads call processScheduledSend on it until it is stopped
+        SendQueueScheduler::getInstance().add(queue.get());
+        return queue;
+    }
 
     // Setup queue private thread
     QThread* thread = new QThread;
@@ -89,10 +102,11 @@ std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, HifiSockAddr destin
 }
     
 SendQueue::SendQueue(Socket* socket, HifiSockAddr dest, SequenceNumber currentSequenceNumber,
-                     MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK) :
+                     MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK, bool usesSharedSendThreads) :
     _packets(currentMessageNumber),
     _socket(socket),
-    _destination(dest)
+    _destination(dest),
+    _usesSharedSendThreads(usesSharedSendThreads)
 {
     // set our member variables from current sequence number
     _currentSequenceNumber = currentSequenceNumber;
@@ -103,15 +117,29 @@ SendQueue::SendQueue(Socket* socket, HifiSockAddr dest, SequenceNumber currentSe
 }
 
 SendQueue::~SendQueue() {
+    if (_usesSharedSendThreads) {
+        // make sure no sender thread is still servicing us
+        SendQueueScheduler::getInstance().remove(this);
+    }
+}
+
+void SendQueue::wakeSender() {
+    if (_usesSharedSendThreads) {
+        _hasPendingWake = true;
+        SendQueueScheduler::getInstance().wake(this);
+    } else {
+        // call notify_one on the condition_variable_any in case the send thread is sleeping
+        _emptyCondition.notify_one();
+    }
 }
 
 void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
     _packets.queuePacket(std::move(packet));
     
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
+    // wake the sender in case it is sleeping waiting for packets
+    wakeSender();
     
-    if (!thread()->isRunning() && _state == State::NotStarted) {
+    if (!_usesSharedSendThreads && !thread()->isRunning() && _state == State::NotStarted) {
         thread()->start();
     }
 }
@@ -119,10 +147,10 @@ void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
 void SendQueue::queuePacketList(std::unique_ptr<PacketList> packetList) {
     _packets.queuePacketList(std::move(packetList));
     
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
+    // wake the sender in case it is sleeping waiting for packets
+    wakeSender();
     
-    if (!thread()->isRunning() && _state == State::NotStarted) {
+    if (!_usesSharedSendThreads && !thread()->isRunning() && _state == State::NotStarted) {
         thread()->start();
     }
 }
@@ -130,6 +158,12 @@ void SendQueue::queuePacketList(std::unique_ptr<PacketList> packetList) {
 void SendQueue::stop() {
     
     _state = State::Stopped;
+
+    if (_usesSharedSendThreads) {
+        // once this returns no sender thread is touching us and none will again
+        SendQueueScheduler::getInstance().remove(this);
+        return;
+    }
     
     // Notify all conditions in case we're waiting somewhere
     _handshakeACKCondition.notify_one();
@@ -138,7 +172,12 @@ void SendQueue::stop() {
     
 int SendQueue::sendPacket(const Packet& packet) {
     _lastPacketSentAt = std::chrono::high_resolution_clock::now();
-    return _socket->writeDatagram(packet.getData(), packet.getDataSize(), _destination);
+
+    std::unique_lock<std::mutex> destinationLocker(_destinationLock);
+    auto destination = _destination;
+    destinationLocker.unlock();
+
+    return _socket->writeDatagram(packet.getData(), packet.getDataSize(), destination);
 }
     
 void SendQueue::ack(SequenceNumber ack) {
@@ -164,8 +203,8 @@ void SendQueue::ack(SequenceNumber ack) {
     
     _lastACKSequenceNumber = (uint32_t) ack;
 
-    // call notify_one on the condition_variable_any in case the send thread is sleeping with a full congestion window
-    _emptyCondition.notify_one();
+    // wake the sender in case it is sleeping with a full congestion window
+    wakeSender();
 }
 
 void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
@@ -174,8 +213,8 @@ void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
         _naks.insert(ack, ack);
     }
 
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for losses to re-send
-    _emptyCondition.notify_one();
+    // wake the sender in case it is sleeping waiting for losses to re-send
+    wakeSender();
 }
 
 void SendQueue::sendHandshake() {
@@ -187,10 +226,19 @@ void SendQueue::sendHandshake() {
         SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
         auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
         handshakePacket->writePrimitive(initialSequenceNumber);
-        _socket->writeBasePacket(*handshakePacket, _destination);
+
+        std::unique_lock<std::mutex> destinationLocker(_destinationLock);
+        auto destination = _destination;
+        destinationLocker.unlock();
+
+        _socket->writeBasePacket(*handshakePacket, destination);
+
+        if (_usesSharedSendThreads) {
+            // the scheduler brings us back after the re-send interval, or sooner if we get the ACK
+            return;
+        }
         
         // we wait for the ACK or the re-send interval to expire
-        static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
         _handshakeACKCondition.wait_for(handshakeLock, HANDSHAKE_RESEND_INTERVAL);
     }
 }
@@ -203,6 +251,10 @@ void SendQueue::handshakeACK() {
 
     // Notify on the handshake ACK condition
     _handshakeACKCondition.notify_one();
+
+    if (_usesSharedSendThreads) {
+        wakeSender();
+    }
 }
 
 SequenceNumber SendQueue::getNextSequenceNumber() {
@@ -355,6 +407,138 @@ void SendQueue::run() {
     }
 }
 
+SendQueueScheduler::TimePoint SendQueue::processScheduledSend() {
+    // This is the body of the run() loop, unrolled so that a shared sender thread can service us one
+    // send event at a time. Rather than sleeping we return when we next want to be serviced.
+    auto now = p_high_resolution_clock::now();
+
+    if (_state == State::Stopped) {
+        return SendQueueScheduler::NEVER;
+    }
+
+    if (_state == State::NotStarted) {
+        _state = State::Running;
+        _nextPacketTimestamp = now;
+    }
+
+    if (_hasPendingWake.exchange(false)) {
+        // equivalent of our condition variable being notified - restart any inactivity wait
+        _inactiveWaitStartedAt = p_high_resolution_clock::time_point();
+    }
+
+    if (!_hasReceivedHandshakeACK) {
+        if (now >= _nextHandshakeAt) {
+            sendHandshake();
+            _nextHandshakeAt = now + HANDSHAKE_RESEND_INTERVAL;
+        }
+
+        // handshakeACK() will wake us before the re-send interval if the ACK comes in
+        _nextPacketTimestamp = now;
+        return _nextHandshakeAt;
+    }
+
+    bool attemptedToSendPacket = maybeResendPacket();
+
+    // if we didn't find a packet to re-send AND we think we can fit a new packet on the wire
+    // (this is according to the current flow window size) then we send out a new packet
+    auto newPacketCount = 0;
+    if (!attemptedToSendPacket) {
+        newPacketCount = maybeSendNewPacket();
+        attemptedToSendPacket = (newPacketCount > 0);
+    }
+
+    if (_state != State::Running) {
+        return SendQueueScheduler::NEVER;
+    }
+
+    if (!attemptedToSendPacket) {
+        _nextPacketTimestamp = now;
+        return nextInactiveCheck(now);
+    }
+
+    _inactiveWaitStartedAt = p_high_resolution_clock::time_point();
+
+    if (_packetSendPeriod <= 0) {
+        return now;
+    }
+
+    // push the next packet timestamp forwards by the current packet send period
+    auto nextPacketDelta = std::chrono::microseconds((newPacketCount == 2 ? 2 : 1) * _packetSendPeriod);
+    _nextPacketTimestamp += nextPacketDelta;
+
+    // same as run(), never let a stale _nextPacketTimestamp hold us back for more than nextPacketDelta
+    if (_nextPacketTimestamp - now > nextPacketDelta) {
+        _nextPacketTimestamp = now + nextPacketDelta;
+    }
+
+    return _nextPacketTimestamp;
+}
+
+SendQueueScheduler::TimePoint SendQueue::nextInactiveCheck(SendQueueScheduler::TimePoint now) {
+    // Mirrors isInactive(), but instead of waiting on _emptyCondition it returns the time at which the wait would
+    // expire. Any notification in the meantime comes in through wakeSender() and restarts the wait.
+    using DoubleLock = DoubleLock<std::recursive_mutex, std::mutex>;
+    DoubleLock doubleLock(_packets.getLock(), _naksLock);
+    DoubleLock::Lock locker(doubleLock, std::try_to_lock);
+
+    if (!locker.owns_lock() || !((_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty())) {
+        // something changed under us, come straight back
+        return now;
+    }
+
+    if (_inactiveWaitStartedAt == p_high_resolution_clock::time_point()) {
+        _inactiveWaitStartedAt = now;
+    }
+
+    if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
+        // we've sent the client as much data as we have (and they've ACKed it)
+        // either wait for new data to send or 5 seconds before cleaning up the queue
+        if (now - _inactiveWaitStartedAt < EMPTY_QUEUES_INACTIVE_TIMEOUT) {
+            return _inactiveWaitStartedAt + EMPTY_QUEUES_INACTIVE_TIMEOUT;
+        }
+
+#ifdef UDT_CONNECTION_DEBUG
+        qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
+            << EMPTY_QUEUES_INACTIVE_TIMEOUT.count()
+            << "seconds and receiver has ACKed all packets."
+            << "The queue is now inactive and will be stopped.";
+#endif
+
+        locker.unlock();
+
+        // Deactivate queue, the Connection will stop and remove us from the scheduler
+        deactivate();
+        return SendQueueScheduler::NEVER;
+    }
+
+    // We think the client is still waiting for data (based on the sequence number gap)
+    // Let's wait either for a response from the client or until the estimated timeout has elapsed
+    auto estimatedTimeout = std::chrono::microseconds(_estimatedTimeout);
+
+    // Clamp timeout beween 10 ms and 5 s
+    estimatedTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, estimatedTimeout));
+
+    bool waitTimedOut = now - _inactiveWaitStartedAt >= estimatedTimeout;
+    if (!waitTimedOut && now - _lastPacketSentAt <= estimatedTimeout) {
+        return std::min(_inactiveWaitStartedAt, _lastPacketSentAt) + estimatedTimeout;
+    }
+
+    if (SequenceNumber(_lastACKSequenceNumber) < _currentSequenceNumber) {
+        // after a timeout if we still have sent packets that the client hasn't ACKed we
+        // add them to the loss list
+
+        // Note that thanks to the DoubleLock we have the _naksLock right now
+        _naks.append(SequenceNumber(_lastACKSequenceNumber) + 1, _currentSequenceNumber);
+
+        locker.unlock();
+
+        emit timeout();
+    }
+
+    _inactiveWaitStartedAt = p_high_resolution_clock::time_point();
+    return now;
+}
+
 int SendQueue::maybeSendNewPacket() {
     if (!isFlowWindowFull()) {
         // we didn't re-send a packet, so time to send a new one
@@ -481,8 +665,6 @@ bool SendQueue::isInactive(bool attemptedToSendPacket) {
             if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
                 // we've sent the client as much data as we have (and they've ACKed it)
                 // either wait for new data to send or 5 seconds before cleaning up the queue
-                static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
-                
                 // use our condition_variable_any to wait
                 auto cvStatus = _emptyCondition.wait_for(locker, EMPTY_QUEUES_INACTIVE_TIMEOUT);
                 
@@ -559,5 +741,6 @@ bool SendQueue::isFlowWindowFull() const {
 }
 
 void SendQueue::updateDestinationAddress(HifiSockAddr newAddress) {
+    std::lock_guard<std::mutex> destinationLocker(_destinationLock);
     _destination = newAddress;
 }
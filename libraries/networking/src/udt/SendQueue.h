@@ -31,6 +31,7 @@
 #include "PacketQueue.h"
 #include "SequenceNumber.h"
 #include "LossList.h"
+#include "SendQueueScheduler.h"
 
 namespace udt {
     
@@ -68,6 +69,13 @@ public:
     void setPacketSendPeriod(int newPeriod) { _packetSendPeriod = newPeriod; }
     
     void setEstimatedTimeout(int estimatedTimeout) { _estimatedTimeout = estimatedTimeout; }
+
+    // true if this queue is serviced by the shared SendQueueScheduler pool instead of its own thread
+    bool usesSharedSendThreads() const { return _usesSharedSendThreads; }
+
+    // called by SendQueueScheduler on one of its sender threads - performs at most one send event
+    // and returns when it should next be serviced (SendQueueScheduler::NEVER if it should wait to be woken)
+    SendQueueScheduler::TimePoint processScheduledSend();
     
 public slots:
     void stop();
@@ -90,7 +98,7 @@ private slots:
     
 private:
     SendQueue(Socket* socket, HifiSockAddr dest, SequenceNumber currentSequenceNumber,
-              MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK);
+              MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK, bool usesSharedSendThreads);
     SendQueue(SendQueue& other) = delete;
     SendQueue(SendQueue&& other) = delete;
     
@@ -103,6 +111,8 @@ private:
     bool maybeResendPacket(); // Determines whether to resend a packet and which one
     
     bool isInactive(bool attemptedToSendPacket);
+    SendQueueScheduler::TimePoint nextInactiveCheck(SendQueueScheduler::TimePoint now); // non-blocking isInactive
+    void wakeSender(); // wakes the send thread or asks the scheduler to service us
     void deactivate(); // makes the queue inactive and cleans it up
 
     bool isFlowWindowFull() const;
@@ -113,6 +123,8 @@ private:
     PacketQueue _packets;
     
     Socket* _socket { nullptr }; // Socket to send packet on
+
+    mutable std::mutex _destinationLock; // Protects the destination, which can change from the Connection thread
     HifiSockAddr _destination; // Destination addr
     
     std::atomic<uint32_t> _lastACKSequenceNumber { 0 }; // Last ACKed sequence number
@@ -142,6 +154,13 @@ private:
 
     std::chrono::high_resolution_clock::time_point _lastPacketSentAt;
 
+    // state for when we are serviced by the SendQueueScheduler instead of looping in run()
+    const bool _usesSharedSendThreads;
+    std::atomic<bool> _hasPendingWake { false }; // Set when woken, restarts the inactivity wait
+    p_high_resolution_clock::time_point _nextPacketTimestamp;
+    p_high_resolution_clock::time_point _nextHandshakeAt;
+    p_high_resolution_clock::time_point _inactiveWaitStartedAt; // Default constructed when not waiting
+
     static const std::chrono::microseconds MAXIMUM_ESTIMATED_TIMEOUT;
     static const std::chrono::microseconds MINIMUM_ESTIMATED_TIMEOUT;
 };
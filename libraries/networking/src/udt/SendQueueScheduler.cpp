@@ -0,0 +1,210 @@
+//
+//  SendQueueScheduler.cpp
+//  libraries/networking/src/udt
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SendQueueScheduler.h"
+
+#include <algorithm>
+
+#include <QtCore/QProcessEnvironment>
+
+#include "../NetworkLogging.h"
+#include "SendQueue.h"
+
+using namespace udt;
+
+const SendQueueScheduler::TimePoint SendQueueScheduler::NEVER = SendQueueScheduler::TimePoint::max();
+
+// -1 means no override, fall back to the environment
+std::atomic<int> SendQueueScheduler::_enabledOverride { -1 };
+
+static const QString PER_CONNECTION_SEND_THREADS_ENV = "HIFI_UDT_PER_CONNECTION_SEND_THREADS";
+static const QString SEND_THREAD_COUNT_ENV = "HIFI_UDT_SEND_THREADS";
+
+static const int MAX_DEFAULT_SEND_THREADS = 8;
+
+bool SendQueueScheduler::isEnabled() {
+    int enabledOverride = _enabledOverride;
+    if (enabledOverride >= 0) {
+        return enabledOverride > 0;
+    }
+
+    static const bool enabledFromEnvironment = !QProcessEnvironment::systemEnvironment().contains(PER_CONNECTION_SEND_THREADS_ENV);
+    return enabledFromEnvironment;
+}
+
+void SendQueueScheduler::setEnabled(bool enabled) {
+    _enabledOverride = enabled ? 1 : 0;
+}
+
+SendQueueScheduler& SendQueueScheduler::getInstance() {
+    static SendQueueScheduler instance([] {
+        bool ok = false;
+        int numThreads = QProcessEnvironment::systemEnvironment().value(SEND_THREAD_COUNT_ENV).toInt(&ok);
+        if (!ok || numThreads <= 0) {
+            // size the pool to the machine, leaving the socket and mixer threads their own cores on big boxes
+            numThreads = std::min(MAX_DEFAULT_SEND_THREADS, std::max(1, (int)std::thread::hardware_concurrency() / 2));
+        }
+        return numThreads;
+    }());
+    return instance;
+}
+
+SendQueueScheduler::SendQueueScheduler(int numThreads) {
+    numThreads = std::max(1, numThreads);
+
+    qCDebug(networking) << "Starting" << numThreads << "shared UDT send threads";
+
+    _threads.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        _threads.emplace_back([this] { run(); });
+    }
+}
+
+SendQueueScheduler::~SendQueueScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+    }
+    _deadlineCondition.notify_all();
+
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+}
+
+void SendQueueScheduler::add(SendQueue* queue) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& entry = _entries[queue];
+        entry = Entry();
+        scheduleLocked(queue, entry, p_high_resolution_clock::now());
+    }
+    _deadlineCondition.notify_one();
+}
+
+void SendQueueScheduler::remove(SendQueue* queue) {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(queue);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    it->second.isBeingRemoved = true;
+
+    // wait for a sender thread that is in the middle of servicing this queue to let go of it
+    _serviceCompleteCondition.wait(lock, [&] {
+        return !_entries[queue].isBeingServiced;
+    });
+
+    // any deadline left in the heap for this queue is now stale and will be skipped
+    _entries.erase(queue);
+}
+
+void SendQueueScheduler::wake(SendQueue* queue) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = _entries.find(queue);
+        if (it == _entries.end() || it->second.isBeingRemoved) {
+            return;
+        }
+
+        auto& entry = it->second;
+        if (entry.isBeingServiced) {
+            // the sender thread servicing it will re-schedule it immediately once it is done
+            entry.hasPendingWake = true;
+            return;
+        }
+
+        auto now = p_high_resolution_clock::now();
+        if (entry.deadline <= now) {
+            // already due, nothing to do
+            return;
+        }
+
+        scheduleLocked(queue, entry, now);
+    }
+    _deadlineCondition.notify_one();
+}
+
+int SendQueueScheduler::getNumQueues() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (int)_entries.size();
+}
+
+void SendQueueScheduler::scheduleLocked(SendQueue* queue, Entry& entry, TimePoint deadline) {
+    // bumping the generation invalidates whatever deadline this queue previously had in the heap
+    entry.generation = ++_nextGeneration;
+    entry.deadline = deadline;
+
+    if (deadline != NEVER) {
+        _deadlines.push({ deadline, queue, entry.generation });
+    }
+}
+
+void SendQueueScheduler::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (!_isStopping) {
+        if (_deadlines.empty()) {
+            _deadlineCondition.wait(lock);
+            continue;
+        }
+
+        auto next = _deadlines.top();
+
+        auto it = _entries.find(next.queue);
+        if (it == _entries.end() || it->second.generation != next.generation || it->second.isBeingRemoved) {
+            // stale deadline for a queue that was re-scheduled or removed
+            _deadlines.pop();
+            continue;
+        }
+
+        if (next.time > p_high_resolution_clock::now()) {
+            // sleep until the earliest deadline, or until an earlier one is pushed
+            _deadlineCondition.wait_until(lock, next.time);
+            continue;
+        }
+
+        _deadlines.pop();
+
+        auto& entry = it->second;
+        entry.isBeingServiced = true;
+        entry.hasPendingWake = false;
+        entry.deadline = NEVER;
+
+        lock.unlock();
+
+        auto nextDeadline = next.queue->processScheduledSend();
+
+        lock.lock();
+
+        // the entry cannot have been erased while we were servicing it, remove() waits for us
+        auto& servicedEntry = _entries[next.queue];
+        servicedEntry.isBeingServiced = false;
+
+        if (servicedEntry.isBeingRemoved) {
+            _serviceCompleteCondition.notify_all();
+            continue;
+        }
+
+        if (servicedEntry.hasPendingWake) {
+            servicedEntry.hasPendingWake = false;
+            nextDeadline = p_high_resolution_clock::now();
+        }
+
+        scheduleLocked(next.queue, servicedEntry, nextDeadline);
+
+        // another sender thread may be sleeping on a deadline later than the one we just pushed
+        _deadlineCondition.notify_one();
+    }
+}
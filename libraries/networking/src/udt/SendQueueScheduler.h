@@ -0,0 +1,102 @@
+//
+//  SendQueueScheduler.h
+//  libraries/networking/src/udt
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_SendQueueScheduler_h
+#define hifi_SendQueueScheduler_h
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <PortableHighResolutionClock.h>
+
+namespace udt {
+
+class SendQueue;
+
+// Services every SendQueue that opted in from a fixed pool of sender threads.
+// Each queue is serviced by at most one thread at a time; between send events it sits in a deadline heap
+// keyed on the time its congestion control pacing (or handshake / timeout logic) wants it to run next.
+class SendQueueScheduler {
+public:
+    using TimePoint = p_high_resolution_clock::time_point;
+
+    // returned from SendQueue::processScheduledSend when the queue has nothing to do until it is woken
+    static const TimePoint NEVER;
+
+    // the shared pool is used unless HIFI_UDT_PER_CONNECTION_SEND_THREADS is set in the environment,
+    // or it has been disabled with setEnabled(false) before the first SendQueue is created
+    static bool isEnabled();
+    static void setEnabled(bool enabled);
+
+    static SendQueueScheduler& getInstance();
+
+    explicit SendQueueScheduler(int numThreads);
+    ~SendQueueScheduler();
+
+    SendQueueScheduler(const SendQueueScheduler&) = delete;
+    SendQueueScheduler& operator=(const SendQueueScheduler&) = delete;
+
+    void add(SendQueue* queue);
+
+    // blocks until no sender thread is servicing the queue, must not be called from a sender thread
+    void remove(SendQueue* queue);
+
+    // asks for the queue to be serviced as soon as possible (new packets, ACKs, losses, handshake ACK)
+    void wake(SendQueue* queue);
+
+    int getNumThreads() const { return (int)_threads.size(); }
+    int getNumQueues() const;
+
+private:
+    struct Entry {
+        uint64_t generation { 0 };
+        TimePoint deadline { NEVER };
+        bool isBeingServiced { false };
+        bool hasPendingWake { false };
+        bool isBeingRemoved { false };
+    };
+
+    struct Deadline {
+        TimePoint time;
+        SendQueue* queue;
+        uint64_t generation;
+
+        bool operator>(const Deadline& other) const { return time > other.time; }
+    };
+
+    void run();
+    void scheduleLocked(SendQueue* queue, Entry& entry, TimePoint deadline);
+
+    mutable std::mutex _mutex;
+    std::condition_variable _deadlineCondition;
+    std::condition_variable _serviceCompleteCondition;
+
+    std::unordered_map<SendQueue*, Entry> _entries;
+    std::priority_queue<Deadline, std::vector<Deadline>, std::greater<Deadline>> _deadlines;
+    uint64_t _nextGeneration { 0 };
+
+    std::vector<std::thread> _threads;
+    bool _isStopping { false };
+
+    static std::atomic<int> _enabledOverride;
+};
+
+}
+
+#endif // hifi_SendQueueScheduler_h
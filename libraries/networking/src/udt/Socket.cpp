@@ -11,10 +11,13 @@
 
 #include "Socket.h"
 
+#include <array>
+
 #ifdef Q_OS_ANDROID
 #include <sys/socket.h>
 #endif
 
+#include <QtCore/QProcessEnvironment>
 #include <QtCore/QThread>
 
 #include <shared/QtHelpers.h>
@@ -38,6 +41,95 @@ using namespace udt;
 #include <netinet/in.h>
 #endif
 
+#if defined(Q_OS_LINUX)
+#include <arpa/inet.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#define HIFI_UDT_BATCHED_IO
+#endif
+
+static const int DATAGRAM_BATCH_SIZE = 64;
+
+#ifdef HIFI_UDT_BATCHED_IO
+
+// ring of MTU sized buffers recvmmsg reads into, a buffer is handed off to the packet it was read into
+// and replaced from the PacketBufferPool before the next recvmmsg
+struct Socket::ReceiveBatch {
+    std::array<PacketBuffer, DATAGRAM_BATCH_SIZE> buffers;
+    std::array<mmsghdr, DATAGRAM_BATCH_SIZE> headers;
+    std::array<iovec, DATAGRAM_BATCH_SIZE> iovecs;
+    std::array<sockaddr_in, DATAGRAM_BATCH_SIZE> addresses;
+};
+
+struct Socket::WriteBatch {
+    Socket* socket { nullptr };
+    int depth { 0 };
+    int count { 0 };
+
+    std::array<std::array<char, MAX_PACKET_SIZE>, DATAGRAM_BATCH_SIZE> buffers;
+    std::array<mmsghdr, DATAGRAM_BATCH_SIZE> headers;
+    std::array<iovec, DATAGRAM_BATCH_SIZE> iovecs;
+    std::array<sockaddr_in, DATAGRAM_BATCH_SIZE> addresses;
+};
+
+static bool toSockAddrIn(const HifiSockAddr& sockAddr, sockaddr_in& result) {
+    bool isIPv4 = false;
+    quint32 address = sockAddr.getAddress().toIPv4Address(&isIPv4);
+    if (!isIPv4) {
+        return false;
+    }
+
+    memset(&result, 0, sizeof(result));
+    result.sin_family = AF_INET;
+    result.sin_addr.s_addr = htonl(address);
+    result.sin_port = htons(sockAddr.getPort());
+    return true;
+}
+
+#else
+
+struct Socket::ReceiveBatch {};
+struct Socket::WriteBatch {};
+
+#endif
+
+bool Socket::isBatchedIOEnabled() {
+#ifdef HIFI_UDT_BATCHED_IO
+    static const bool enabled = !QProcessEnvironment::systemEnvironment().contains("HIFI_UDT_DISABLE_BATCHED_IO");
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+std::unique_ptr<Socket::WriteBatch>& Socket::getThreadWriteBatch() {
+    static thread_local std::unique_ptr<WriteBatch> batch;
+    return batch;
+}
+
+Socket::BatchedWriteScope::BatchedWriteScope() {
+#ifdef HIFI_UDT_BATCHED_IO
+    if (isBatchedIOEnabled()) {
+        auto& batch = getThreadWriteBatch();
+        if (!batch) {
+            batch.reset(new WriteBatch());
+        }
+        ++batch->depth;
+    }
+#endif
+}
+
+Socket::BatchedWriteScope::~BatchedWriteScope() {
+#ifdef HIFI_UDT_BATCHED_IO
+    auto& batch = getThreadWriteBatch();
+    if (batch && batch->depth > 0 && --batch->depth == 0 && batch->count > 0) {
+        batch->socket->writeBatchedDatagrams(*batch);
+    }
+#endif
+}
+
 
 Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
     QObject(parent),
@@ -56,6 +148,13 @@ Socket::Socket(QObject* parent, bool shouldChangeSocketOptions) :
     const int READY_READ_BACKUP_CHECK_MSECS = 2 * 1000;
     connect(_readyReadBackupTimer, &QTimer::timeout, this, &Socket::checkForReadyReadBackup);
     _readyReadBackupTimer->start(READY_READ_BACKUP_CHECK_MSECS);
+
+    if (isBatchedIOEnabled()) {
+        _receiveBatch.reset(new ReceiveBatch());
+    }
+}
+
+Socket::~Socket() {
 }
 
 void Socket::bind(const QHostAddress& address, quint16 port) {
@@ -235,6 +334,81 @@ qint64 Socket::writeDatagram(const char* data, qint64 size, const HifiSockAddr&
 }
 
 qint64 Socket::writeDatagram(const QByteArray& datagram, const HifiSockAddr& sockAddr) {
+#ifdef HIFI_UDT_BATCHED_IO
+    auto& batch = getThreadWriteBatch();
+    if (batch && batch->depth > 0 && datagram.size() <= MAX_PACKET_SIZE
+        && _udpSocket.state() == QAbstractSocket::BoundState) {
+
+        sockaddr_in address;
+        if (toSockAddrIn(sockAddr, address)) {
+            if (batch->count > 0 && batch->socket != this) {
+                // the batch only holds datagrams for one socket
+                batch->socket->writeBatchedDatagrams(*batch);
+            }
+            batch->socket = this;
+
+            int index = batch->count++;
+            memcpy(batch->buffers[index].data(), datagram.constData(), datagram.size());
+            batch->addresses[index] = address;
+
+            auto& iov = batch->iovecs[index];
+            iov.iov_base = batch->buffers[index].data();
+            iov.iov_len = datagram.size();
+
+            auto& header = batch->headers[index];
+            memset(&header, 0, sizeof(header));
+            header.msg_hdr.msg_name = &batch->addresses[index];
+            header.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            header.msg_hdr.msg_iov = &iov;
+            header.msg_hdr.msg_iovlen = 1;
+
+            if (batch->count == DATAGRAM_BATCH_SIZE) {
+                writeBatchedDatagrams(*batch);
+            }
+
+            return datagram.size();
+        }
+    }
+#endif
+
+    ++_unbatchedWriteDatagrams;
+    return writeDatagramUnbatched(datagram, sockAddr);
+}
+
+void Socket::writeBatchedDatagrams(WriteBatch& batch) {
+#ifdef HIFI_UDT_BATCHED_IO
+    int fd = (int)_udpSocket.socketDescriptor();
+    int numSent = 0;
+
+    while (numSent < batch.count) {
+        int result = ::sendmmsg(fd, &batch.headers[numSent], batch.count - numSent, 0);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if (result <= 0) {
+            // hand whatever is left to Qt one by one, so the failure is reported the same way as it is without batching
+            for (int i = numSent; i < batch.count; ++i) {
+                HifiSockAddr sockAddr(reinterpret_cast<const sockaddr*>(&batch.addresses[i]));
+                auto datagram = QByteArray::fromRawData(batch.buffers[i].data(), (int)batch.iovecs[i].iov_len);
+
+                ++_unbatchedWriteDatagrams;
+                writeDatagramUnbatched(datagram, sockAddr);
+            }
+            break;
+        }
+
+        ++_batchedWriteCalls;
+        _batchedWriteDatagrams += result;
+        numSent += result;
+    }
+#endif
+
+    batch.count = 0;
+    batch.socket = nullptr;
+}
+
+qint64 Socket::writeDatagramUnbatched(const QByteArray& datagram, const HifiSockAddr& sockAddr) {
 
     // don't attempt to write the datagram if we're unbound.  Just drop it.
     // _udpSocket.writeDatagram will return an error anyway, but there are
@@ -394,7 +568,7 @@ void Socket::readPendingDatagrams() {
         HifiSockAddr senderSockAddr;
 
         // setup a buffer to read the packet into
-        auto buffer = std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
+        auto buffer = PacketBufferPool::allocate(packetSizeWithHeader);
 
         // pull the datagram
         auto sizeRead = _udpSocket.readDatagram(buffer.get(), packetSizeWithHeader,
@@ -410,73 +584,161 @@ void Socket::readPendingDatagrams() {
             continue;
         }
 
-        auto it = _unfilteredHandlers.find(senderSockAddr);
+        ++_unbatchedReadDatagrams;
+        processReceivedDatagram(std::move(buffer), packetSizeWithHeader, senderSockAddr, receiveTime);
+
+        if (_receiveBatch) {
+            // reading through QUdpSocket above re-armed its read notifier,
+            // drain anything else already waiting on the socket in batches
+            if (!readBatchedDatagrams(abortTime)) {
+                break;
+            }
+        }
+    }
+}
+
+bool Socket::readBatchedDatagrams(std::chrono::system_clock::time_point abortTime) {
+#ifdef HIFI_UDT_BATCHED_IO
+    using namespace std::chrono;
+
+    auto& batch = *_receiveBatch;
+    int fd = (int)_udpSocket.socketDescriptor();
 
-        if (it != _unfilteredHandlers.end()) {
-            // we have a registered unfiltered handler for this HifiSockAddr - call that and return
-            if (it->second) {
-                auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-                basePacket->setReceiveTime(receiveTime);
-                it->second(std::move(basePacket));
+    while (true) {
+        if (system_clock::now() > abortTime) {
+            return false;
+        }
+
+        for (int i = 0; i < DATAGRAM_BATCH_SIZE; ++i) {
+            if (!batch.buffers[i]) {
+                batch.buffers[i] = PacketBufferPool::allocate(MAX_PACKET_SIZE);
             }
 
+            auto& iov = batch.iovecs[i];
+            iov.iov_base = batch.buffers[i].get();
+            iov.iov_len = MAX_PACKET_SIZE;
+
+            auto& header = batch.headers[i];
+            memset(&header, 0, sizeof(header));
+            header.msg_hdr.msg_name = &batch.addresses[i];
+            header.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            header.msg_hdr.msg_iov = &iov;
+            header.msg_hdr.msg_iovlen = 1;
+        }
+
+        int numRead = ::recvmmsg(fd, batch.headers.data(), DATAGRAM_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        if (numRead < 0 && errno == EINTR) {
             continue;
         }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+        if (numRead <= 0) {
+            // EAGAIN, the socket is drained
+            return true;
+        }
+
+        ++_batchedReadCalls;
+        _batchedReadDatagrams += numRead;
 
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
+        // we're reading packets so re-start the readyRead backup timer
+        _readyReadBackupTimer->start();
 
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr, true);
+        auto receiveTime = p_high_resolution_clock::now();
 
-            if (connection) {
-                connection->processControl(move(controlPacket));
+        for (int i = 0; i < numRead; ++i) {
+            auto& header = batch.headers[i];
+            int size = (int)header.msg_len;
+
+            if (size <= 0 || (header.msg_hdr.msg_flags & MSG_TRUNC)) {
+                // larger than any packet we send, drop it and keep the buffer for the next read
+                continue;
             }
 
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
+            HifiSockAddr senderSockAddr(reinterpret_cast<const sockaddr*>(&batch.addresses[i]));
 
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
+            // save information for this packet, in case it is the one that sticks readyRead
+            _lastPacketSizeRead = size;
+            _lastPacketSockAddr = senderSockAddr;
 
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                auto connection = findOrCreateConnection(senderSockAddr, true);
+            processReceivedDatagram(std::move(batch.buffers[i]), size, senderSockAddr, receiveTime);
+        }
+
+        if (numRead < DATAGRAM_BATCH_SIZE) {
+            return true;
+        }
+    }
+#else
+    return true;
+#endif
+}
+
+void Socket::processReceivedDatagram(PacketBuffer buffer, int packetSizeWithHeader,
+                                     const HifiSockAddr& senderSockAddr, p_high_resolution_clock::time_point receiveTime) {
+    auto it = _unfilteredHandlers.find(senderSockAddr);
+
+    if (it != _unfilteredHandlers.end()) {
+        // we have a registered unfiltered handler for this HifiSockAddr - call that and return
+        if (it->second) {
+            auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+            basePacket->setReceiveTime(receiveTime);
+            it->second(std::move(basePacket));
+        }
+
+        return;
+    }
+
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
 
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+        controlPacket->setReceiveTime(receiveTime);
 
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr, true);
+
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
+
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+        packet->setReceiveTime(receiveTime);
+
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
+
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            auto connection = findOrCreateConnection(senderSockAddr, true);
+
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
+
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
 #ifdef UDT_CONNECTION_DEBUG
-                        qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
-                            << ", type" << NLPacket::typeInHeader(*packet);
+                    qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
+                        << ", type" << NLPacket::typeInHeader(*packet);
 #endif
-                        continue;
-                    }
-                } else if (connection) {
-                    connection->recordReceivedUnreliablePackets(packet->getWireSize(),
-                                                                packet->getPayloadSize());
+                    return;
                 }
+            } else if (connection) {
+                connection->recordReceivedUnreliablePackets(packet->getWireSize(),
+                                                            packet->getPayloadSize());
+            }
 
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr, true);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr, true);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
                 }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
             }
         }
     }
@@ -516,6 +778,17 @@ ConnectionStats::Stats Socket::sampleStatsForConnection(const HifiSockAddr& dest
     }
 }
 
+ConnectionStats::DatagramIOStats Socket::sampleDatagramIOStats() {
+    ConnectionStats::DatagramIOStats stats;
+    stats.batchedReadCalls = _batchedReadCalls.exchange(0);
+    stats.batchedReadDatagrams = _batchedReadDatagrams.exchange(0);
+    stats.batchedWriteCalls = _batchedWriteCalls.exchange(0);
+    stats.batchedWriteDatagrams = _batchedWriteDatagrams.exchange(0);
+    stats.unbatchedReadDatagrams = _unbatchedReadDatagrams.exchange(0);
+    stats.unbatchedWriteDatagrams = _unbatchedWriteDatagrams.exchange(0);
+    return stats;
+}
+
 Socket::StatsVector Socket::sampleStatsForAllConnections() {
     StatsVector result;
     Lock connectionsLock(_connectionsHashMutex);
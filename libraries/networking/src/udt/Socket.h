@@ -14,6 +14,8 @@
 #ifndef hifi_Socket_h
 #define hifi_Socket_h
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <unordered_map>
 #include <mutex>
@@ -26,6 +28,7 @@
 #include "../HifiSockAddr.h"
 #include "TCPVegasCC.h"
 #include "Connection.h"
+#include "PacketBufferPool.h"
 
 //#define UDT_CONNECTION_DEBUG
 
@@ -54,8 +57,24 @@ class Socket : public QObject {
 
 public:
     using StatsVector = std::vector<std::pair<HifiSockAddr, ConnectionStats::Stats>>;
+
+    // While a thread holds a BatchedWriteScope, the datagrams it writes are copied into a per-thread batch
+    // and flushed with sendmmsg when the outermost scope ends or the batch fills. Reliable packets are unaffected
+    // since they are sent from their SendQueue. Without batched IO (see isBatchedIOEnabled) this does nothing.
+    class BatchedWriteScope {
+    public:
+        BatchedWriteScope();
+        ~BatchedWriteScope();
+
+        BatchedWriteScope(const BatchedWriteScope&) = delete;
+        BatchedWriteScope& operator=(const BatchedWriteScope&) = delete;
+    };
+
+    // recvmmsg/sendmmsg are used on Linux unless HIFI_UDT_DISABLE_BATCHED_IO is set in the environment
+    static bool isBatchedIOEnabled();
     
     Socket(QObject* object = 0, bool shouldChangeSocketOptions = true);
+    ~Socket();
     
     quint16 localPort() const { return _udpSocket.localPort(); }
     
@@ -88,6 +107,7 @@ public:
     void messageFailed(Connection* connection, Packet::MessageNumber messageNumber);
     
     StatsVector sampleStatsForAllConnections();
+    ConnectionStats::DatagramIOStats sampleDatagramIOStats();
 
 #if (PR_BUILD || DEV_BUILD)
     void sendFakedHandshakeRequest(const HifiSockAddr& sockAddr);
@@ -109,7 +129,17 @@ private slots:
     void handleStateChanged(QAbstractSocket::SocketState socketState);
 
 private:
+    struct ReceiveBatch;
+    struct WriteBatch;
+
     void setSystemBufferSizes();
+
+    void processReceivedDatagram(PacketBuffer buffer, int size, const HifiSockAddr& senderSockAddr,
+                                 p_high_resolution_clock::time_point receiveTime);
+    bool readBatchedDatagrams(std::chrono::system_clock::time_point abortTime);
+    void writeBatchedDatagrams(WriteBatch& batch);
+    qint64 writeDatagramUnbatched(const QByteArray& datagram, const HifiSockAddr& sockAddr);
+    static std::unique_ptr<WriteBatch>& getThreadWriteBatch();
     Connection* findOrCreateConnection(const HifiSockAddr& sockAddr, bool filterCreation = false);
    
     // privatized methods used by UDTTest - they are private since they must be called on the Socket thread
@@ -137,6 +167,15 @@ private:
 
     QTimer* _readyReadBackupTimer { nullptr };
 
+    std::unique_ptr<ReceiveBatch> _receiveBatch;
+
+    std::atomic<uint64_t> _batchedReadCalls { 0 };
+    std::atomic<uint64_t> _batchedReadDatagrams { 0 };
+    std::atomic<uint64_t> _batchedWriteCalls { 0 };
+    std::atomic<uint64_t> _batchedWriteDatagrams { 0 };
+    std::atomic<uint64_t> _unbatchedReadDatagrams { 0 };
+    std::atomic<uint64_t> _unbatchedWriteDatagrams { 0 };
+
     int _maxBandwidth { -1 };
 
     std::unique_ptr<CongestionControlVirtualFactory> _ccFactory { new CongestionControlFactory<TCPVegasCC>() };
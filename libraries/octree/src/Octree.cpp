@@ -52,7 +52,7 @@
 #include "OctreeUtils.h"
 #include "OctreeEntitiesFileParser.h"
 
-QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz"};
+QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz", "bin"};
 
 Octree::Octree(bool shouldReaverage) :
     _rootElement(NULL),
@@ -676,6 +676,10 @@ bool Octree::readFromFile(const char* fileName) {
         return readJSONFromGzippedFile(qFileName);
     }
 
+    if (qFileName.endsWith(".bin")) {
+        return readFromBinaryFile(qFileName);
+    }
+
     QFile file(qFileName);
 
     if (!file.open(QIODevice::ReadOnly)) {
@@ -693,6 +697,30 @@ bool Octree::readFromFile(const char* fileName) {
     return success;
 }
 
+bool Octree::readFromBinaryFile(const QString& fileName) {
+    if (!supportsBinaryPersist()) {
+        qCritical() << "Binary files are not supported by this tree:" << fileName;
+        return false;
+    }
+
+    OctreeBinaryPersist::Header header;
+    std::vector<QByteArray> items;
+    if (!OctreeBinaryPersist::read(fileName, header, items)) {
+        qCritical() << "Cannot read binary file: " << fileName;
+        return false;
+    }
+
+    // the items are in the wire format, which only reads its own version
+    if (header.bitstreamVersion != expectedVersion()) {
+        qCritical() << "Binary file" << fileName << "is from another version:" << header.bitstreamVersion;
+        return false;
+    }
+
+    _persistID = header.id;
+    _persistDataVersion = header.dataVersion;
+    return readFromBinaryPersistItems(items, header.bitstreamVersion);
+}
+
 bool Octree::readJSONFromGzippedFile(QString qFileName) {
     QFile file(qFileName);
     if (!file.open(QIODevice::ReadOnly)) {
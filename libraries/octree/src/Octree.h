@@ -15,6 +15,7 @@
 #include <memory>
 #include <set>
 #include <stdint.h>
+#include <vector>
 
 #include <QHash>
 #include <QObject>
@@ -24,6 +25,7 @@
 #include <SimpleMovingAverage.h>
 #include <ViewFrustum.h>
 
+#include "OctreeBinaryPersist.h"
 #include "OctreeElement.h"
 #include "OctreeElementBag.h"
 #include "OctreePacketData.h"
@@ -138,6 +140,21 @@ public:
     virtual bool handlesEditPacketType(PacketType packetType) const { return false; }
     virtual int processEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
                                       const SharedNodePointer& sourceNode) { return 0; }
+
+    // Edit packets of the types that canDecodeEditPacketType() accepts can also be processed in two steps, so that a
+    // batch of them is decoded outside the tree lock, and then applied under a single write lock.
+    class DecodedEdit {
+    public:
+        virtual ~DecodedEdit() { }
+    };
+    using DecodedEditPointer = std::unique_ptr<DecodedEdit>;
+
+    virtual bool canDecodeEditPacketType(PacketType packetType) const { return false; }
+    /// Doesn't need the tree lock, and can be called from several threads at once. Returns the bytes read.
+    virtual int decodeEditPacketData(ReceivedMessage& message, const unsigned char* editData, int maxLength,
+                                     const SharedNodePointer& sourceNode, DecodedEditPointer& edit) { return 0; }
+    /// Needs the write lock. Applies the edits in order, and returns how many were applied after coalescing.
+    virtual int processDecodedEdits(std::vector<DecodedEditPointer>& edits) { return 0; }
     virtual void processChallengeOwnershipRequestPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) { return; }
     virtual void processChallengeOwnershipReplyPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) { return; }
     virtual void processChallengeOwnershipPacket(ReceivedMessage& message, const SharedNodePointer& sourceNode) { return; }
@@ -221,8 +238,18 @@ public:
     bool readSVOFromStream(uint64_t streamLength, QDataStream& inputStream);
     bool readJSONFromStream(uint64_t streamLength, QDataStream& inputStream, const QString& marketplaceID="");
     bool readJSONFromGzippedFile(QString qFileName);
+    bool readFromBinaryFile(const QString& fileName);
     virtual bool readFromMap(QVariantMap& entityDescription) = 0;
 
+    // Binary persistence, see OctreeBinaryPersist
+    virtual bool supportsBinaryPersist() const { return false; }
+    /// Collects the encoding of the items changed since the last call, or of every item if allItems is true, and the IDs
+    /// of the items removed since then.
+    virtual void collectBinaryPersistChanges(bool allItems, OctreeBinaryPersist::Changes& changes) { }
+    virtual bool readFromBinaryPersistItems(const std::vector<QByteArray>& items, PacketVersion bitstreamVersion) {
+        return false;
+    }
+
     uint64_t getOctreeElementsCount();
 
     bool getShouldReaverage() const { return _shouldReaverage; }
@@ -260,6 +287,8 @@ public:
     virtual quint64 getAverageFilterTime() const { return 0; }
 
     void incrementPersistDataVersion() { _persistDataVersion++; }
+    QUuid getPersistID() const { return _persistID; }
+    int64_t getPersistDataVersion() const { return _persistDataVersion; }
 
 
 protected:
@@ -0,0 +1,247 @@
+//
+//  OctreeBinaryPersist.cpp
+//  libraries/octree/src
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeBinaryPersist.h"
+
+#include <algorithm>
+
+#include <QDataStream>
+#include <QFile>
+#include <QHash>
+#include <QSaveFile>
+
+#include "OctreeLogging.h"
+
+namespace {
+    const quint32 SNAPSHOT_MAGIC = 0x48464f53; // "HFOS"
+    const quint32 JOURNAL_MAGIC = 0x48464f4a; // "HFOJ"
+    const quint32 FORMAT_VERSION = 1;
+
+    enum RecordType : quint8 {
+        Update = 1,
+        Remove = 2,
+        Commit = 3
+    };
+
+    bool readSnapshotHeader(QDataStream& stream, OctreeBinaryPersist::Header& header, quint32& numItems) {
+        quint32 magic { 0 };
+        quint32 formatVersion { 0 };
+        stream >> magic >> formatVersion;
+        if (magic != SNAPSHOT_MAGIC || formatVersion != FORMAT_VERSION) {
+            return false;
+        }
+
+        qint64 dataVersion;
+        stream >> header.bitstreamVersion >> header.id >> dataVersion >> numItems;
+        header.dataVersion = dataVersion;
+        return stream.status() == QDataStream::Ok;
+    }
+
+    // calls applyBatch for every committed batch of a journal that extends the snapshot described by snapshotHeader
+    template <typename F>
+    void readJournal(const QString& filename, const OctreeBinaryPersist::Header& snapshotHeader, F applyBatch) {
+        QFile file(filename);
+        if (!file.open(QIODevice::ReadOnly)) {
+            return;
+        }
+
+        QDataStream stream(&file);
+        quint32 magic { 0 };
+        quint32 formatVersion { 0 };
+        QUuid snapshotID;
+        qint64 snapshotDataVersion { 0 };
+        stream >> magic >> formatVersion >> snapshotID >> snapshotDataVersion;
+        if (stream.status() != QDataStream::Ok || magic != JOURNAL_MAGIC || formatVersion != FORMAT_VERSION) {
+            qCWarning(octree) << "Ignoring unreadable journal" << filename;
+            return;
+        }
+
+        // a journal left behind by an older snapshot, the new snapshot already has its changes
+        if (snapshotID != snapshotHeader.id || snapshotDataVersion != snapshotHeader.dataVersion) {
+            return;
+        }
+
+        OctreeBinaryPersist::Changes batch;
+        while (!stream.atEnd()) {
+            quint8 type { 0 };
+            stream >> type;
+
+            if (type == Update) {
+                QUuid id;
+                QByteArray data;
+                stream >> id >> data;
+                batch.updated.emplace_back(id, data);
+            } else if (type == Remove) {
+                QUuid id;
+                stream >> id;
+                batch.removed.push_back(id);
+            } else if (type == Commit) {
+                PacketVersion bitstreamVersion { 0 };
+                qint64 dataVersion { 0 };
+                stream >> bitstreamVersion >> dataVersion;
+                if (stream.status() != QDataStream::Ok) {
+                    break;
+                }
+                if (bitstreamVersion != snapshotHeader.bitstreamVersion) {
+                    qCWarning(octree) << "Journal" << filename << "changes bitstream version, ignoring the rest of it";
+                    return;
+                }
+                applyBatch(batch, dataVersion);
+                batch = OctreeBinaryPersist::Changes();
+                continue;
+            } else {
+                break;
+            }
+
+            if (stream.status() != QDataStream::Ok) {
+                break;
+            }
+        }
+
+        if (!batch.isEmpty() || !stream.atEnd()) {
+            qCWarning(octree) << "Dropped the last, incomplete, save of journal" << filename;
+        }
+    }
+}
+
+QString OctreeBinaryPersist::journalFilenameFor(const QString& snapshotFilename) {
+    return snapshotFilename + ".journal";
+}
+
+qint64 OctreeBinaryPersist::writeSnapshot(const QString& filename, const Header& header, const Changes& items) {
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(octree) << "Could not open" << filename << "for writing:" << file.errorString();
+        return -1;
+    }
+
+    QDataStream stream(&file);
+    stream << SNAPSHOT_MAGIC << FORMAT_VERSION << header.bitstreamVersion << header.id << (qint64)header.dataVersion
+           << (quint32)items.updated.size();
+    for (const auto& item : items.updated) {
+        stream << item.first << item.second;
+    }
+
+    qint64 size = file.size();
+    if (stream.status() != QDataStream::Ok || !file.commit()) {
+        qCWarning(octree) << "Failed to write snapshot" << filename << file.errorString();
+        return -1;
+    }
+
+    // the journal extended the previous snapshot
+    QFile::remove(journalFilenameFor(filename));
+    return size;
+}
+
+qint64 OctreeBinaryPersist::appendToJournal(const QString& filename, const Header& snapshotHeader, const Header& header,
+                                            const Changes& changes) {
+    QFile file(journalFilenameFor(filename));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCWarning(octree) << "Could not open journal of" << filename << "for writing:" << file.errorString();
+        return -1;
+    }
+
+    // write the whole batch at once, it only counts once its commit record is in
+    QByteArray batch;
+    QDataStream stream(&batch, QIODevice::WriteOnly);
+    if (file.size() == 0) {
+        stream << JOURNAL_MAGIC << FORMAT_VERSION << snapshotHeader.id << (qint64)snapshotHeader.dataVersion;
+    }
+    for (const auto& item : changes.updated) {
+        stream << (quint8)Update << item.first << item.second;
+    }
+    for (const auto& id : changes.removed) {
+        stream << (quint8)Remove << id;
+    }
+    stream << (quint8)Commit << header.bitstreamVersion << (qint64)header.dataVersion;
+
+    if (file.write(batch) != batch.size() || !file.flush()) {
+        qCWarning(octree) << "Failed to append to journal of" << filename << file.errorString();
+        return -1;
+    }
+    return file.size();
+}
+
+bool OctreeBinaryPersist::readHeader(const QString& snapshotFilename, Header& header) {
+    QFile file(snapshotFilename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    quint32 numItems;
+    if (!readSnapshotHeader(stream, header, numItems)) {
+        qCWarning(octree) << "Unreadable snapshot" << snapshotFilename;
+        return false;
+    }
+
+    Header snapshotHeader = header;
+    readJournal(journalFilenameFor(snapshotFilename), snapshotHeader, [&](const Changes& batch, int64_t dataVersion) {
+        header.dataVersion = dataVersion;
+    });
+    return true;
+}
+
+bool OctreeBinaryPersist::read(const QString& snapshotFilename, Header& header, std::vector<QByteArray>& items) {
+    QFile file(snapshotFilename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    quint32 numItems;
+    if (!readSnapshotHeader(stream, header, numItems)) {
+        qCWarning(octree) << "Unreadable snapshot" << snapshotFilename;
+        return false;
+    }
+
+    items.clear();
+    items.reserve(numItems);
+    QHash<QUuid, size_t> itemIndices;
+    itemIndices.reserve(numItems);
+
+    for (quint32 i = 0; i < numItems; ++i) {
+        QUuid id;
+        QByteArray data;
+        stream >> id >> data;
+        if (stream.status() != QDataStream::Ok) {
+            qCWarning(octree) << "Snapshot" << snapshotFilename << "is truncated after" << i << "of" << numItems << "items";
+            return false;
+        }
+        itemIndices.insert(id, items.size());
+        items.push_back(data);
+    }
+
+    Header snapshotHeader = header;
+    readJournal(journalFilenameFor(snapshotFilename), snapshotHeader, [&](const Changes& batch, int64_t dataVersion) {
+        for (const auto& item : batch.updated) {
+            auto it = itemIndices.find(item.first);
+            if (it != itemIndices.end()) {
+                items[it.value()] = item.second;
+            } else {
+                itemIndices.insert(item.first, items.size());
+                items.push_back(item.second);
+            }
+        }
+        for (const auto& id : batch.removed) {
+            auto it = itemIndices.find(id);
+            if (it != itemIndices.end()) {
+                items[it.value()].clear();
+                itemIndices.erase(it);
+            }
+        }
+        header.dataVersion = dataVersion;
+    });
+
+    items.erase(std::remove_if(items.begin(), items.end(), [](const QByteArray& data) { return data.isEmpty(); }),
+                items.end());
+    return true;
+}
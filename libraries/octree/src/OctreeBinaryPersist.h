@@ -0,0 +1,61 @@
+//
+//  OctreeBinaryPersist.h
+//  libraries/octree/src
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeBinaryPersist_h
+#define hifi_OctreeBinaryPersist_h
+
+#include <utility>
+#include <vector>
+
+#include <QByteArray>
+#include <QString>
+#include <QUuid>
+
+#include <udt/PacketHeaders.h>
+
+// The binary persist format keeps each item of the octree as its own wire encoding, keyed by its ID.
+//
+// A snapshot file holds every item, and a journal file next to it holds the items changed or removed since that
+// snapshot, appended in batches by each save. A batch only counts once its commit record is on disk, so a save
+// interrupted half way is dropped on the next load instead of corrupting it.
+namespace OctreeBinaryPersist {
+
+struct Header {
+    QUuid id;
+    int64_t dataVersion { 0 };
+    PacketVersion bitstreamVersion { 0 };
+};
+
+struct Changes {
+    std::vector<std::pair<QUuid, QByteArray>> updated;
+    std::vector<QUuid> removed;
+
+    bool isEmpty() const { return updated.empty() && removed.empty(); }
+};
+
+QString journalFilenameFor(const QString& snapshotFilename);
+
+// Replaces the snapshot, through a temporary file, with the updated items of changes. Returns the size written.
+qint64 writeSnapshot(const QString& filename, const Header& header, const Changes& items);
+
+// Appends one batch to the journal of the snapshot, starting the journal if needed. Returns the journal size.
+qint64 appendToJournal(const QString& filename, const Header& snapshotHeader, const Header& header,
+                       const Changes& changes);
+
+// Reads the id and version of the latest data, including the committed journal batches
+bool readHeader(const QString& snapshotFilename, Header& header);
+
+// Reads the snapshot and replays its journal, leaving the encoding of every current item in items
+bool read(const QString& snapshotFilename, Header& header, std::vector<QByteArray>& items);
+
+}
+
+#endif // hifi_OctreeBinaryPersist_h
@@ -11,6 +11,8 @@
 
 #include "OctreePacketData.h"
 
+#include <limits>
+
 #include <GLMHelpers.h>
 #include <PerfStat.h>
 
@@ -58,6 +60,7 @@ void OctreePacketData::reset() {
     _compressedBytes = 0;
     _bytesInUseLastCheck = 0;
     _dirty = false;
+    _hasTruncatedValues = false;
 
     _bytesOfOctalCodes = 0;
     _bytesOfBitMasks = 0;
@@ -405,6 +408,7 @@ bool OctreePacketData::appendValue(const glm::u8vec3& color) {
 
 bool OctreePacketData::appendValue(const QVector<glm::vec3>& value) {
     uint16_t qVecSize = value.size();
+    _hasTruncatedValues |= value.size() > std::numeric_limits<uint16_t>::max();
     bool success = appendValue(qVecSize);
     if (success) {
         success = append((const unsigned char*)value.constData(), qVecSize * sizeof(glm::vec3));
@@ -418,6 +422,7 @@ bool OctreePacketData::appendValue(const QVector<glm::vec3>& value) {
 
 bool OctreePacketData::appendValue(const QVector<glm::quat>& value) {
     uint16_t qVecSize = value.size();
+    _hasTruncatedValues |= value.size() > std::numeric_limits<uint16_t>::max();
     bool success = appendValue(qVecSize);
 
     if (success) {
@@ -440,6 +445,7 @@ bool OctreePacketData::appendValue(const QVector<glm::quat>& value) {
 
 bool OctreePacketData::appendValue(const QVector<float>& value) {
     uint16_t qVecSize = value.size();
+    _hasTruncatedValues |= value.size() > std::numeric_limits<uint16_t>::max();
     bool success = appendValue(qVecSize);
     if (success) {
         success = append((const unsigned char*)value.constData(), qVecSize * sizeof(float));
@@ -453,6 +459,7 @@ bool OctreePacketData::appendValue(const QVector<float>& value) {
 
 bool OctreePacketData::appendValue(const QVector<bool>& value) {
     uint16_t qVecSize = value.size();
+    _hasTruncatedValues |= value.size() > std::numeric_limits<uint16_t>::max();
     bool success = appendValue(qVecSize);
 
     if (success) {
@@ -508,6 +515,7 @@ bool OctreePacketData::appendValue(const QString& string) {
     // TODO: make this a ByteCountCoded leading byte
     QByteArray utf8Array = string.toUtf8();
     uint16_t length = utf8Array.length(); // no NULL
+    _hasTruncatedValues |= utf8Array.length() > std::numeric_limits<uint16_t>::max();
     bool success = appendValue(length);
     if (success) {
         success = appendRawData((const unsigned char*)utf8Array.constData(), length);
@@ -532,6 +540,7 @@ bool OctreePacketData::appendValue(const QUuid& uuid) {
 bool OctreePacketData::appendValue(const QByteArray& bytes) {
     // TODO: make this a ByteCountCoded leading byte
     uint16_t length = bytes.size();
+    _hasTruncatedValues |= bytes.size() > std::numeric_limits<uint16_t>::max();
     bool success = appendValue(length);
     if (success) {
         success = appendRawData((const unsigned char*)bytes.constData(), bytes.size());
@@ -249,6 +249,9 @@ public:
 
     int getBytesAvailable() { return _bytesAvailable; }
 
+    /// true if a string, byte array or vector was too long for its 16 bit length, and was cut short
+    bool hasTruncatedValues() const { return _hasTruncatedValues; }
+
     /// displays contents for debugging
     void debugContent();
     void debugBytes();
@@ -313,6 +316,7 @@ private:
     int _compressedBytes;
     int _bytesInUseLastCheck;
     bool _dirty;
+    bool _hasTruncatedValues { false };
 
     // statistics...
     int _bytesOfOctalCodes;
@@ -11,6 +11,7 @@
 
 #include "OctreePersistThread.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -38,13 +39,21 @@
 #include "OctreeDataUtils.h"
 
 constexpr std::chrono::seconds OctreePersistThread::DEFAULT_PERSIST_INTERVAL { 30 };
+// with binary persistence the copy sent to the domain server is the only JSON export of the whole tree, so it is
+// sent at most this often instead of with every save, and once more when the server shuts down
+constexpr std::chrono::minutes OctreePersistThread::DEFAULT_BINARY_DS_UPLOAD_INTERVAL { 5 };
+const QString OctreePersistThread::BINARY_FILE_TYPE = "bin";
 constexpr std::chrono::milliseconds TIME_BETWEEN_PROCESSING { 10 };
 
 constexpr int MAX_OCTREE_REPLACEMENT_BACKUP_FILES_COUNT { 20 };
 constexpr int64_t MAX_OCTREE_REPLACEMENT_BACKUP_FILES_SIZE_BYTES { 50 * 1000 * 1000 };
 
+// the journal is folded into a new snapshot once it is larger than the snapshot itself, and at least this large
+constexpr qint64 MIN_BINARY_JOURNAL_SIZE_TO_COMPACT { 1000 * 1000 };
+
 OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& filename, std::chrono::milliseconds persistInterval,
-                                         bool debugTimestampNow, QString persistAsFileType) :
+                                         bool debugTimestampNow, QString persistAsFileType,
+                                         std::chrono::milliseconds binaryDSUploadInterval) :
     _tree(tree),
     _filename(filename),
     _persistInterval(persistInterval),
@@ -53,7 +62,8 @@ OctreePersistThread::OctreePersistThread(OctreePointer tree, const QString& file
     _loadTimeUSecs(0),
     _debugTimestampNow(debugTimestampNow),
     _lastTimeDebug(0),
-    _persistAsFileType(persistAsFileType)
+    _persistAsFileType(persistAsFileType),
+    _binaryDSUploadInterval(binaryDSUploadInterval)
 {
     // in case the persist filename has an extension that doesn't match the file type
     QString sansExt = fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS);
@@ -72,8 +82,34 @@ void OctreePersistThread::start() {
     auto packet = NLPacket::create(PacketType::OctreeDataFileRequest, -1, true, false);
 
     OctreeUtils::RawOctreeData data;
-    qCDebug(octree) << "Reading octree data from" << _filename;
-    QFile file(_filename);
+    QString jsonFilename = _filename;
+
+    if (isBinary()) {
+        OctreeBinaryPersist::Header header;
+        qCDebug(octree) << "Reading binary octree data from" << _filename;
+        if (OctreeBinaryPersist::readHeader(_filename, header) && header.bitstreamVersion == _tree->expectedVersion()) {
+            _hasBinaryData = true;
+        } else {
+            // a snapshot of another version can't be read, the DS will send its JSON copy, if it has none
+            // fall back on the JSON files that were saved before switching to the binary format
+            QString sansExt = fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS);
+            jsonFilename = findMostRecentFileExtension(sansExt + ".json.gz", { "json", "json.gz" });
+        }
+
+        if (_hasBinaryData) {
+            qCDebug(octree) << "Current octree data: ID(" << header.id << ") DataVersion(" << header.dataVersion << ")";
+            packet->writePrimitive(true);
+            packet->write(header.id.toRfc4122());
+            packet->writePrimitive((OctreeUtils::Version)header.dataVersion);
+
+            qCDebug(octree) << "Sending OctreeDataFileRequest to DS";
+            nodeList->sendPacket(std::move(packet), domainHandler.getSockAddr());
+            return;
+        }
+    }
+
+    qCDebug(octree) << "Reading octree data from" << jsonFilename;
+    QFile file(jsonFilename);
     if (file.open(QIODevice::ReadOnly)) {
         QByteArray jsonData(file.readAll());
         file.close();
@@ -93,7 +129,7 @@ void OctreePersistThread::start() {
             packet->writePrimitive(false);
         }
     } else {
-        qCWarning(octree) << "Couldn't access file" << _filename << file.errorString();
+        qCWarning(octree) << "Couldn't access file" << jsonFilename << file.errorString();
         packet->writePrimitive(false);
     }
 
@@ -114,10 +150,17 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     bool hasValidOctreeData { false };
     if (includesNewData) {
         _cachedJSONData.clear();
+        _hasBinaryData = false;
         replacementData = message->readAll();
         replaceData(replacementData);
-        hasValidOctreeData = data.readOctreeDataInfoFromFile(_filename);
+        if (isBinary()) {
+            hasValidOctreeData = data.readOctreeDataInfoFromData(_cachedJSONData);
+        } else {
+            hasValidOctreeData = data.readOctreeDataInfoFromFile(_filename);
+        }
         qDebug() << "Got OctreeDataFileReply, new data sent";
+    } else if (_hasBinaryData) {
+        qDebug() << "Got OctreeDataFileReply, current binary entity data is sufficient";
     } else {
         qDebug() << "Got OctreeDataFileReply, current entity data is sufficient";
         
@@ -125,7 +168,7 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
         qCDebug(octree) << "Reading octree data from" << _filename;
         if (data.readOctreeDataInfoFromData(_cachedJSONData)) {
             hasValidOctreeData = true;
-            if (data.id.isNull()) {
+            if (data.id.isNull() && !isBinary()) {
                 qCDebug(octree) << "Current octree data has a null id, updating";
                 data.resetIdAndVersion();
 
@@ -153,7 +196,9 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     _tree->withWriteLock([&] {
         PerformanceWarning warn(true, "Loading Octree File", true);
 
-        if (_cachedJSONData.isEmpty()) {
+        if (_hasBinaryData) {
+            persistentFileRead = _tree->readFromBinaryFile(_filename);
+        } else if (_cachedJSONData.isEmpty()) {
             persistentFileRead = _tree->readFromFile(_filename.toLocal8Bit().constData());
         } else {
             QDataStream jsonStream(_cachedJSONData);
@@ -204,7 +249,7 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
 QString OctreePersistThread::getPersistFileMimeType() const {
     if (_persistAsFileType == "json") {
         return "application/json";
-    } if (_persistAsFileType == "json.gz") {
+    } if (_persistAsFileType == "json.gz" || isBinary()) {
         return "application/zip";
     }
     return "";
@@ -213,6 +258,14 @@ QString OctreePersistThread::getPersistFileMimeType() const {
 void OctreePersistThread::replaceData(QByteArray data) {
     backupCurrentFile();
 
+    if (isBinary()) {
+        // loaded from JSON, the first save writes the snapshot
+        if (!gunzip(data, _cachedJSONData)) {
+            _cachedJSONData = data;
+        }
+        return;
+    }
+
     QFile currentFile { _filename };
     if (currentFile.open(QIODevice::WriteOnly)) {
         currentFile.write(data);
@@ -224,10 +277,24 @@ void OctreePersistThread::replaceData(QByteArray data) {
 
 // Return true if current file is backed up successfully or doesn't exist.
 bool OctreePersistThread::backupCurrentFile() {
+    static const QString FILENAME_TIMESTAMP_FORMAT = "yyyyMMdd-hhmmss";
+
+    // the journal only makes sense next to its snapshot, keep it with the backup
+    if (isBinary()) {
+        auto journalFilename = OctreeBinaryPersist::journalFilenameFor(_filename);
+        QFile journalFile { journalFilename };
+        if (journalFile.exists()) {
+            auto backupFileName = journalFilename + ".backup." + QDateTime::currentDateTime().toString(FILENAME_TIMESTAMP_FORMAT);
+            if (!journalFile.rename(backupFileName)) {
+                qWarning() << "Could not backup previous models journal to" << backupFileName;
+                journalFile.remove();
+            }
+        }
+    }
+
     // first take the current models file and move it to a different filename, appended with the timestamp
     QFile currentFile { _filename };
     if (currentFile.exists()) {
-        static const QString FILENAME_TIMESTAMP_FORMAT = "yyyyMMdd-hhmmss";
         auto backupFileName = _filename + ".backup." + QDateTime::currentDateTime().toString(FILENAME_TIMESTAMP_FORMAT);
 
         if (currentFile.rename(backupFileName)) {
@@ -253,17 +320,30 @@ void OctreePersistThread::process() {
         persist();
     }
 
+    if (_hasDataNotSentToDS && now - _lastDSUpload > _binaryDSUploadInterval) {
+        sendLatestEntityDataToDS();
+    }
+
     QTimer::singleShot(TIME_BETWEEN_PROCESSING.count(), this, &OctreePersistThread::process);
 }
 
 void OctreePersistThread::aboutToFinish() {
     qCDebug(octree) << "Persist thread about to finish...";
     persist();
+    if (_hasDataNotSentToDS) {
+        sendLatestEntityDataToDS();
+    }
     qCDebug(octree) << "Persist thread done with about to finish...";
 }
 
 QByteArray OctreePersistThread::getPersistFileContents() const {
     QByteArray fileContents;
+    if (isBinary()) {
+        // the binary format is only for the entity server, JSON stays the export format
+        _tree->toJSON(&fileContents, nullptr, true);
+        return fileContents;
+    }
+
     QFile file(_filename);
     if (file.open(QIODevice::ReadOnly)) {
         fileContents = file.readAll();
@@ -313,19 +393,70 @@ void OctreePersistThread::persist() {
         _tree->incrementPersistDataVersion();
 
         qCDebug(octree) << "Saving Octree data to:" << _filename;
-        if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
+        bool persisted = isBinary() ? persistBinary()
+                                    : _tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType);
+        if (persisted) {
             _tree->clearDirtyBit(); // tree is clean after saving
             qCDebug(octree) << "DONE persisting Octree data to" << _filename;
         } else {
             qCWarning(octree) << "Failed to persist Octree data to" << _filename;
         }
 
-        sendLatestEntityDataToDS();
+        if (isBinary()) {
+            _hasDataNotSentToDS = true;
+        } else {
+            sendLatestEntityDataToDS();
+        }
+    } else if (isBinary() && _binarySnapshotSize < 0 && _initialLoadComplete) {
+        // nothing changed since the load, but there is no snapshot of this data to journal against yet
+        persistBinary();
+    }
+}
+
+bool OctreePersistThread::persistBinary() {
+    OctreeBinaryPersist::Header header;
+    header.id = _tree->getPersistID();
+    header.dataVersion = _tree->getPersistDataVersion();
+    header.bitstreamVersion = _tree->expectedVersion();
+
+    bool writeSnapshot = _binarySnapshotSize < 0 ||
+        _binaryJournalSize > std::max(_binarySnapshotSize, MIN_BINARY_JOURNAL_SIZE_TO_COMPACT);
+
+    OctreeBinaryPersist::Changes changes;
+    _tree->collectBinaryPersistChanges(writeSnapshot, changes);
+
+    if (writeSnapshot) {
+        qint64 size = OctreeBinaryPersist::writeSnapshot(_filename, header, changes);
+        if (size < 0) {
+            return false;
+        }
+        qCDebug(octree) << "Wrote snapshot of" << changes.updated.size() << "items," << size << "bytes";
+        _binarySnapshotHeader = header;
+        _binarySnapshotSize = size;
+        _binaryJournalSize = 0;
+        return true;
     }
+
+    if (changes.isEmpty()) {
+        return true;
+    }
+
+    qint64 size = OctreeBinaryPersist::appendToJournal(_filename, _binarySnapshotHeader, header, changes);
+    if (size < 0) {
+        // the changes were collected, they can only be saved again with a new snapshot
+        _binarySnapshotSize = -1;
+        return false;
+    }
+    qCDebug(octree) << "Journaled" << changes.updated.size() << "changed and" << changes.removed.size() << "removed items";
+    _binaryJournalSize = size;
+    return true;
 }
 
 void OctreePersistThread::sendLatestEntityDataToDS() {
     qDebug() << "Sending latest entity data to DS";
+    _lastDSUpload = std::chrono::steady_clock::now();
+    _hasDataNotSentToDS = false;
+
     auto nodeList = DependencyManager::get<NodeList>();
     const DomainHandler& domainHandler = nodeList->getDomainHandler();
 
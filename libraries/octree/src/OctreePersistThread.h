@@ -31,12 +31,15 @@ public:
     };
 
     static const std::chrono::seconds DEFAULT_PERSIST_INTERVAL;
+    static const std::chrono::minutes DEFAULT_BINARY_DS_UPLOAD_INTERVAL;
+    static const QString BINARY_FILE_TYPE;
 
     OctreePersistThread(OctreePointer tree,
                         const QString& filename,
                         std::chrono::milliseconds persistInterval = DEFAULT_PERSIST_INTERVAL,
                         bool debugTimestampNow = false,
-                        QString persistAsFileType = "json.gz");
+                        QString persistAsFileType = "json.gz",
+                        std::chrono::milliseconds binaryDSUploadInterval = DEFAULT_BINARY_DS_UPLOAD_INTERVAL);
 
     bool isInitialLoadComplete() const { return _initialLoadComplete; }
     quint64 getLoadElapsedTime() const { return _loadTimeUSecs; }
@@ -45,7 +48,8 @@ public:
     QString getPersistFileMimeType() const;
     QByteArray getPersistFileContents() const;
 
-    void aboutToFinish(); /// call this to inform the persist thread that the owner is about to finish to support final persist
+    /// call this to inform the persist thread that the owner is about to finish to support final persist
+    Q_INVOKABLE void aboutToFinish();
 
 public slots:
     void start();
@@ -65,6 +69,9 @@ protected:
     void replaceData(QByteArray data);
     void sendLatestEntityDataToDS();
 
+    bool isBinary() const { return _persistAsFileType == BINARY_FILE_TYPE; }
+    bool persistBinary();
+
 private:
     OctreePointer _tree;
     QString _filename;
@@ -79,6 +86,15 @@ private:
 
     QString _persistAsFileType;
     QByteArray _cachedJSONData;
+
+    // binary persistence, see OctreeBinaryPersist
+    bool _hasBinaryData { false };
+    OctreeBinaryPersist::Header _binarySnapshotHeader;
+    qint64 _binarySnapshotSize { -1 }; // -1 until this thread has written a snapshot, the next save must write one
+    qint64 _binaryJournalSize { 0 };
+    std::chrono::milliseconds _binaryDSUploadInterval;
+    bool _hasDataNotSentToDS { false };
+    std::chrono::steady_clock::time_point _lastDSUpload;
 };
 
 #endif // hifi_OctreePersistThread_h
@@ -0,0 +1,84 @@
+//
+//  ShapeCache.cpp
+//  libraries/physics/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ShapeCache.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+
+#include "PhysicsLogging.h"
+#include "ShapeFactory.h"
+
+const std::string ShapeCache::DIRNAME { "shape_cache" };
+const std::string ShapeCache::EXT { "shape" };
+
+ShapeCache::ShapeCache(const std::string& dir, const std::string& ext) :
+    FileCache(dir, ext) { }
+
+std::string ShapeCache::getKey(const ShapeInfo& info) {
+    QCryptographicHash hasher(QCryptographicHash::Md5);
+    auto addData = [&](const void* data, size_t size) {
+        hasher.addData(static_cast<const char*>(data), (int)size);
+    };
+
+    int32_t type = (int32_t)info.getType();
+    addData(&type, sizeof(type));
+    addData(&info.getHalfExtents(), sizeof(glm::vec3));
+    addData(&info.getOffset(), sizeof(glm::vec3));
+    for (const auto& points : info.getPointCollection()) {
+        // the sizes keep the boundaries between the lists in the key
+        uint64_t numPoints = (uint64_t)points.size();
+        addData(&numPoints, sizeof(numPoints));
+        addData(points.data(), points.size() * sizeof(glm::vec3));
+    }
+    const auto& triangleIndices = info.getTriangleIndices();
+    addData(triangleIndices.data(), triangleIndices.size() * sizeof(triangleIndices[0]));
+
+    return hasher.result().toHex().toStdString();
+}
+
+const btCollisionShape* ShapeCache::loadShape(const ShapeInfo& info) {
+    if (!ShapeFactory::isSlowToBuild(info.getType())) {
+        return nullptr;
+    }
+
+    // holding the file keeps it from being evicted while we read it
+    auto file = getFile(getKey(info));
+    if (!file) {
+        return nullptr;
+    }
+
+    QFile shapeFile(QString::fromStdString(file->getFilepath()));
+    if (!shapeFile.open(QIODevice::ReadOnly)) {
+        qCWarning(physics) << "Failed to open cached shape" << file->getFilepath().c_str();
+        return nullptr;
+    }
+    QByteArray data = shapeFile.readAll();
+
+    const btCollisionShape* shape = ShapeFactory::createShapeFromData(info, data);
+    if (!shape) {
+        // it will be overwritten by the shape that gets built instead
+        qCDebug(physics) << "Ignoring stale cached shape" << file->getKey().c_str();
+    }
+    return shape;
+}
+
+void ShapeCache::saveShape(const ShapeInfo& info, const btCollisionShape* shape) {
+    if (!shape || !ShapeFactory::isSlowToBuild(info.getType())) {
+        return;
+    }
+
+    QByteArray data;
+    if (ShapeFactory::serializeShape(info, shape, data)) {
+        const bool overwrite = true;
+        writeFile(data.constData(), Metadata(getKey(info), (size_t)data.size()), overwrite);
+    }
+}
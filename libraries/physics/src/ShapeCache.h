@@ -0,0 +1,46 @@
+//
+//  ShapeCache.h
+//  libraries/physics/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ShapeCache_h
+#define hifi_ShapeCache_h
+
+#include <btBulletDynamicsCommon.h>
+
+#include <shared/FileCache.h>
+#include <ShapeInfo.h>
+
+class ShapeCache;
+using ShapeCachePointer = std::shared_ptr<ShapeCache>;
+
+// Keeps the collision shapes that are slow to build (hulls and static mesh BVHs) on disk, so that loading
+// the same model again restores its shape instead of recomputing it.
+//
+// The shapes are keyed by their contents, not by ShapeInfo::getHash, which for model shapes only covers the url
+// and would keep a stale shape around after the model changed.  Both methods are safe to call from worker threads.
+class ShapeCache : public cache::FileCache {
+    Q_OBJECT
+
+public:
+    static const std::string DIRNAME;
+    static const std::string EXT;
+
+    ShapeCache(const std::string& dir = DIRNAME, const std::string& ext = EXT);
+
+    static std::string getKey(const ShapeInfo& info);
+
+    /// \return a new shape for info restored from disk, or nullptr if there isn't a valid one
+    const btCollisionShape* loadShape(const ShapeInfo& info);
+
+    /// stores a shape that was built from info, if it is of a kind worth storing
+    void saveShape(const ShapeInfo& info, const btCollisionShape* shape);
+};
+
+#endif // hifi_ShapeCache_h
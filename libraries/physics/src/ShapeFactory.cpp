@@ -11,11 +11,31 @@
 
 #include "ShapeFactory.h"
 
+#include <vector>
+
 #include <glm/gtx/norm.hpp>
+#include <QDataStream>
 
 #include <SharedUtil.h> // for MILLIMETERS_PER_METER
 
 #include "BulletUtil.h"
+#include "ShapeCache.h"
+
+// the StaticMeshShape's vertex/index data
+static void deleteStaticMeshArray(btTriangleIndexVertexArray* dataArray) {
+    IndexedMeshArray& meshes = dataArray->getIndexedMeshArray();
+    for (int32_t i = 0; i < meshes.size(); ++i) {
+        btIndexedMesh mesh = meshes[i];
+        mesh.m_numTriangles = 0;
+        delete [] mesh.m_triangleIndexBase;
+        mesh.m_triangleIndexBase = nullptr;
+        mesh.m_numVertices = 0;
+        delete [] mesh.m_vertexBase;
+        mesh.m_vertexBase = nullptr;
+    }
+    meshes.clear();
+    delete dataArray;
+}
 
 
 class StaticMeshShape : public btBvhTriangleMeshShape {
@@ -27,26 +47,30 @@ public:
         assert(_dataArray);
     }
 
+    // takes a BVH that was deserialized in place in a btAlignedAlloc'd buffer, instead of building one
+    StaticMeshShape(btTriangleIndexVertexArray* dataArray, btOptimizedBvh* bvh)
+    :   btBvhTriangleMeshShape(dataArray, true, false), _dataArray(dataArray), _ownsBvhBuffer(true) {
+        assert(_dataArray);
+        assert(bvh);
+        setOptimizedBvh(bvh);
+    }
+
     ~StaticMeshShape() {
         assert(_dataArray);
-        IndexedMeshArray& meshes = _dataArray->getIndexedMeshArray();
-        for (int32_t i = 0; i < meshes.size(); ++i) {
-            btIndexedMesh mesh = meshes[i];
-            mesh.m_numTriangles = 0;
-            delete [] mesh.m_triangleIndexBase;
-            mesh.m_triangleIndexBase = nullptr;
-            mesh.m_numVertices = 0;
-            delete [] mesh.m_vertexBase;
-            mesh.m_vertexBase = nullptr;
-        }
-        meshes.clear();
-        delete _dataArray;
+        deleteStaticMeshArray(_dataArray);
         _dataArray = nullptr;
+        if (_ownsBvhBuffer) {
+            // the BVH lives at the start of its buffer, and the base class doesn't touch a BVH it doesn't own
+            btOptimizedBvh* bvh = getOptimizedBvh();
+            bvh->~btOptimizedBvh();
+            btAlignedFree(bvh);
+        }
     }
 
 private:
     // the StaticMeshShape owns its vertex/index data
     btTriangleIndexVertexArray* _dataArray;
+    bool _ownsBvhBuffer { false };
 };
 
 // the dataArray must be created before we create the StaticMeshShape
@@ -488,7 +512,284 @@ void ShapeFactory::deleteShape(const btCollisionShape* shape) {
     delete nonConstShape;
 }
 
+const btCollisionShape* ShapeFactory::createShapeFromInfo(const ShapeInfo& info, ShapeCache* cache) {
+    if (!cache || !isSlowToBuild(info.getType())) {
+        return createShapeFromInfo(info);
+    }
+    const btCollisionShape* shape = cache->loadShape(info);
+    if (!shape) {
+        shape = createShapeFromInfo(info);
+        cache->saveShape(info, shape);
+    }
+    return shape;
+}
+
+bool ShapeFactory::isSlowToBuild(ShapeType type) {
+    switch (type) {
+        case SHAPE_TYPE_COMPOUND:
+        case SHAPE_TYPE_SIMPLE_HULL:
+        case SHAPE_TYPE_SIMPLE_COMPOUND:
+        case SHAPE_TYPE_STATIC_MESH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static const quint32 SHAPE_DATA_MAGIC = 0x48465348; // "HFSH"
+// Whenever the serialized format changes, or the factory starts building different shapes from the same ShapeInfo,
+// this value should be incremented so that the shapes stored with the old one are rebuilt.
+static const quint32 SHAPE_DATA_VERSION = 1;
+static const int MAX_SHAPE_DATA_DEPTH = 4;
+
+static void setScalarPrecision(QDataStream& stream) {
+    stream.setFloatingPointPrecision(sizeof(btScalar) == sizeof(float) ? QDataStream::SinglePrecision : QDataStream::DoublePrecision);
+}
+
+static void writeVector(QDataStream& stream, const btVector3& vector) {
+    stream << vector.x() << vector.y() << vector.z();
+}
+
+static btVector3 readVector(QDataStream& stream) {
+    btScalar x, y, z;
+    stream >> x >> y >> z;
+    return btVector3(x, y, z);
+}
+
+static bool writeShape(QDataStream& stream, const btCollisionShape* shape) {
+    int shapeType = shape->getShapeType();
+    stream << (qint32)shapeType;
+    switch (shapeType) {
+        case COMPOUND_SHAPE_PROXYTYPE: {
+            const btCompoundShape* compound = static_cast<const btCompoundShape*>(shape);
+            int32_t numChildShapes = compound->getNumChildShapes();
+            stream << (qint32)numChildShapes;
+            for (int32_t i = 0; i < numChildShapes; ++i) {
+                // the whole basis rather than a rotation, so the child comes back bit for bit
+                const btTransform& transform = compound->getChildTransform(i);
+                for (int32_t j = 0; j < 3; ++j) {
+                    writeVector(stream, transform.getBasis()[j]);
+                }
+                writeVector(stream, transform.getOrigin());
+                if (!writeShape(stream, compound->getChildShape(i))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case CONVEX_HULL_SHAPE_PROXYTYPE: {
+            const btConvexHullShape* hull = static_cast<const btConvexHullShape*>(shape);
+            int32_t numPoints = hull->getNumPoints();
+            stream << hull->getMargin() << (qint32)numPoints;
+            const btVector3* points = hull->getUnscaledPoints();
+            for (int32_t i = 0; i < numPoints; ++i) {
+                writeVector(stream, points[i]);
+            }
+            return true;
+        }
+        case TRIANGLE_MESH_SHAPE_PROXYTYPE: {
+            // only the BVH, the vertex/index data is cheap to copy from the ShapeInfo again
+            btBvhTriangleMeshShape* mesh = const_cast<btBvhTriangleMeshShape*>(static_cast<const btBvhTriangleMeshShape*>(shape));
+            const btOptimizedBvh* bvh = mesh->getOptimizedBvh();
+            const btTriangleIndexVertexArray* dataArray = static_cast<const btTriangleIndexVertexArray*>(mesh->getMeshInterface());
+            if (!bvh || dataArray->getIndexedMeshArray().size() != 1) {
+                return false;
+            }
+            const btIndexedMesh& indexedMesh = dataArray->getIndexedMeshArray()[0];
+            stream << (qint32)indexedMesh.m_numTriangles << (qint32)indexedMesh.m_numVertices;
+
+            unsigned int bufferSize = bvh->calculateSerializeBufferSize();
+            void* buffer = btAlignedAlloc(bufferSize, 16);
+            bool success = bvh->serializeInPlace(buffer, bufferSize, false);
+            if (success) {
+                stream << QByteArray(static_cast<const char*>(buffer), (int)bufferSize);
+            }
+            btAlignedFree(buffer);
+            return success;
+        }
+        default:
+            // the primitives are quick to build, so they aren't worth serializing
+            return false;
+    }
+}
+
+// Walking a BVH follows its node and triangle indices without checks, so the ones restored from the cache are checked
+// first: every internal node is followed by its two child subtrees, which end where its escape index points, every leaf
+// names a triangle of the mesh, and every subtree header stays within the nodes.
+static bool isValidBvh(btOptimizedBvh* bvh, int numTriangles) {
+    if (!bvh->isQuantized()) {
+        return false;
+    }
+    const QuantizedNodeArray& nodes = bvh->getQuantizedNodeArray();
+    int numNodes = nodes.size();
+
+    std::vector<std::pair<int, int>> subtrees; // the [begin, end) of each subtree left to check
+    if (numNodes > 0) {
+        subtrees.emplace_back(0, numNodes);
+    }
+    while (!subtrees.empty()) {
+        int begin = subtrees.back().first;
+        int end = subtrees.back().second;
+        subtrees.pop_back();
+
+        const btQuantizedBvhNode& node = nodes[begin];
+        if (node.isLeafNode()) {
+            if (end != begin + 1 || node.getPartId() != 0 || node.getTriangleIndex() >= numTriangles) {
+                return false;
+            }
+            continue;
+        }
+        // the smallest internal node has two leaves, and the escape index is negated in the node
+        int64_t escapeIndex = -(int64_t)node.m_escapeIndexOrTriangleIndex;
+        if (escapeIndex < 3 || begin + escapeIndex != end) {
+            return false;
+        }
+        int left = begin + 1;
+        const btQuantizedBvhNode& leftNode = nodes[left];
+        int64_t leftSize = leftNode.isLeafNode() ? 1 : -(int64_t)leftNode.m_escapeIndexOrTriangleIndex;
+        if (leftSize < 1 || left + leftSize >= end) {
+            return false;
+        }
+        subtrees.emplace_back(left, left + (int)leftSize);
+        subtrees.emplace_back(left + (int)leftSize, end);
+    }
+
+    const BvhSubtreeInfoArray& subtreeHeaders = bvh->getSubtreeInfoArray();
+    for (int i = 0; i < subtreeHeaders.size(); ++i) {
+        const btBvhSubtreeInfo& header = subtreeHeaders[i];
+        if (header.m_rootNodeIndex < 0 || header.m_subtreeSize < 1 ||
+                (int64_t)header.m_rootNodeIndex + header.m_subtreeSize > numNodes) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static btCollisionShape* readShape(QDataStream& stream, const ShapeInfo& info, int depth) {
+    qint32 shapeType;
+    stream >> shapeType;
+    if (stream.status() != QDataStream::Ok || depth > MAX_SHAPE_DATA_DEPTH) {
+        return nullptr;
+    }
+    switch (shapeType) {
+        case COMPOUND_SHAPE_PROXYTYPE: {
+            qint32 numChildShapes;
+            stream >> numChildShapes;
+            auto compound = new btCompoundShape();
+            for (int32_t i = 0; i < numChildShapes && stream.status() == QDataStream::Ok; ++i) {
+                btTransform transform;
+                btVector3 rows[3];
+                for (int32_t j = 0; j < 3; ++j) {
+                    rows[j] = readVector(stream);
+                }
+                transform.getBasis().setValue(rows[0].x(), rows[0].y(), rows[0].z(),
+                                              rows[1].x(), rows[1].y(), rows[1].z(),
+                                              rows[2].x(), rows[2].y(), rows[2].z());
+                transform.setOrigin(readVector(stream));
+                btCollisionShape* childShape = readShape(stream, info, depth + 1);
+                if (!childShape) {
+                    break;
+                }
+                compound->addChildShape(transform, childShape);
+            }
+            if (stream.status() != QDataStream::Ok || compound->getNumChildShapes() != numChildShapes) {
+                ShapeFactory::deleteShape(compound);
+                return nullptr;
+            }
+            return compound;
+        }
+        case CONVEX_HULL_SHAPE_PROXYTYPE: {
+            btScalar margin;
+            qint32 numPoints;
+            stream >> margin >> numPoints;
+            btConvexHullShape* hull = new btConvexHullShape();
+            hull->setMargin(margin);
+            for (int32_t i = 0; i < numPoints && stream.status() == QDataStream::Ok; ++i) {
+                hull->addPoint(readVector(stream), false);
+            }
+            if (stream.status() != QDataStream::Ok || numPoints <= 0) {
+                delete hull;
+                return nullptr;
+            }
+            hull->recalcLocalAabb();
+            return hull;
+        }
+        case TRIANGLE_MESH_SHAPE_PROXYTYPE: {
+            qint32 numTriangles;
+            qint32 numVertices;
+            QByteArray bvhData;
+            stream >> numTriangles >> numVertices >> bvhData;
+            if (stream.status() != QDataStream::Ok || bvhData.size() < (int)sizeof(btOptimizedBvh) ||
+                    info.getType() != SHAPE_TYPE_STATIC_MESH) {
+                return nullptr;
+            }
+            btTriangleIndexVertexArray* dataArray = createStaticMeshArray(info);
+            if (!dataArray) {
+                return nullptr;
+            }
+            // the BVH indexes the triangles, so it has to have been built from a mesh just like this one
+            const btIndexedMesh& indexedMesh = dataArray->getIndexedMeshArray()[0];
+            if (indexedMesh.m_numTriangles != numTriangles || indexedMesh.m_numVertices != numVertices) {
+                deleteStaticMeshArray(dataArray);
+                return nullptr;
+            }
+            void* buffer = btAlignedAlloc(bvhData.size(), 16);
+            memcpy(buffer, bvhData.constData(), bvhData.size());
+            btOptimizedBvh* bvh = btOptimizedBvh::deSerializeInPlace(buffer, (unsigned int)bvhData.size(), false);
+            if (!bvh || !isValidBvh(bvh, numTriangles)) {
+                if (bvh) {
+                    bvh->~btOptimizedBvh();
+                }
+                btAlignedFree(buffer);
+                deleteStaticMeshArray(dataArray);
+                return nullptr;
+            }
+            return new StaticMeshShape(dataArray, bvh);
+        }
+        default:
+            return nullptr;
+    }
+}
+
+bool ShapeFactory::serializeShape(const ShapeInfo& info, const btCollisionShape* shape, QByteArray& data) {
+    assert(shape);
+    data.clear();
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    setScalarPrecision(stream);
+    // the BVH is serialized as it is in memory, so it only makes sense to the same build on the same platform
+    stream << SHAPE_DATA_MAGIC << SHAPE_DATA_VERSION << (quint32)BT_BULLET_VERSION;
+    stream << (quint8)sizeof(btScalar) << (quint8)sizeof(void*) << (quint8)(Q_BYTE_ORDER == Q_LITTLE_ENDIAN);
+    stream << (qint32)info.getType();
+    if (!writeShape(stream, shape)) {
+        data.clear();
+        return false;
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+const btCollisionShape* ShapeFactory::createShapeFromData(const ShapeInfo& info, const QByteArray& data) {
+    QDataStream stream(data);
+    setScalarPrecision(stream);
+    quint32 magic, version, bulletVersion;
+    quint8 scalarSize, pointerSize, isLittleEndian;
+    qint32 shapeType;
+    stream >> magic >> version >> bulletVersion >> scalarSize >> pointerSize >> isLittleEndian >> shapeType;
+    if (stream.status() != QDataStream::Ok || magic != SHAPE_DATA_MAGIC || version != SHAPE_DATA_VERSION ||
+            bulletVersion != (quint32)BT_BULLET_VERSION || scalarSize != sizeof(btScalar) || pointerSize != sizeof(void*) ||
+            isLittleEndian != (quint8)(Q_BYTE_ORDER == Q_LITTLE_ENDIAN) || shapeType != (qint32)info.getType()) {
+        return nullptr;
+    }
+
+    btCollisionShape* shape = readShape(stream, info, 0);
+    if (shape && !stream.atEnd()) {
+        // trailing garbage, don't trust any of it
+        ShapeFactory::deleteShape(shape);
+        shape = nullptr;
+    }
+    return shape;
+}
+
 void ShapeFactory::Worker::run() {
-    shape = ShapeFactory::createShapeFromInfo(shapeInfo);
+    shape = ShapeFactory::createShapeFromInfo(shapeInfo, cache.get());
     emit submitWork(this);
 }
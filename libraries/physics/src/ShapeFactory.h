@@ -12,19 +12,36 @@
 #ifndef hifi_ShapeFactory_h
 #define hifi_ShapeFactory_h
 
+#include <memory>
+
 #include <btBulletDynamicsCommon.h>
 #include <glm/glm.hpp>
+#include <QByteArray>
 #include <QObject>
 #include <QtCore/QRunnable>
 
 #include <ShapeInfo.h>
 
+class ShapeCache;
+
 // The ShapeFactory assembles and correctly disassembles btCollisionShapes.
 
 namespace ShapeFactory {
     const btCollisionShape* createShapeFromInfo(const ShapeInfo& info);
+    // restores the shape from the cache if it can, else builds it and adds it to the cache
+    const btCollisionShape* createShapeFromInfo(const ShapeInfo& info, ShapeCache* cache);
     void deleteShape(const btCollisionShape* shape);
 
+    // true for the shapes whose hulls or BVH are worth building off the main thread and keeping on disk
+    bool isSlowToBuild(ShapeType type);
+
+    // Writes the hulls and BVH of a shape built from info, so that createShapeFromData can restore it without
+    // computing them again.  The data is only good for this build of Bullet on this platform.
+    /// \return false if the shape can't be serialized
+    bool serializeShape(const ShapeInfo& info, const btCollisionShape* shape, QByteArray& data);
+    /// \return the shape that was serialized for info, or nullptr if the data isn't valid for info
+    const btCollisionShape* createShapeFromData(const ShapeInfo& info, const QByteArray& data);
+
     class Worker : public QObject, public QRunnable {
         Q_OBJECT
     public:
@@ -32,6 +49,7 @@ namespace ShapeFactory {
         void run() override;
         ShapeInfo shapeInfo;
         const btCollisionShape* shape;
+        std::shared_ptr<ShapeCache> cache;
     signals:
         void submitWork(Worker*);
     };
@@ -36,7 +36,7 @@ ShapeManager::~ShapeManager() {
     }
 }
 
-const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
+const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info, bool allowDeferred) {
     if (info.getType() == SHAPE_TYPE_NONE) {
         return nullptr;
     }
@@ -47,17 +47,18 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         return shapeRef->shape;
     }
     const btCollisionShape* shape = nullptr;
-    if (info.getType() == SHAPE_TYPE_STATIC_MESH) {
+    bool buildOnWorker = info.getType() == SHAPE_TYPE_STATIC_MESH || (allowDeferred && ShapeFactory::isSlowToBuild(info.getType()));
+    if (buildOnWorker) {
         uint64_t hash = info.getHash();
 
         // bump the request count to the caller knows we're 
         // starting or waiting on a thread.
         ++_workRequestCount;
 
-        const auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), hash);
-        if (itr == _pendingMeshShapes.end()) {
+        const auto itr = std::find(_pendingShapes.begin(), _pendingShapes.end(), hash);
+        if (itr == _pendingShapes.end()) {
             // start a worker
-            _pendingMeshShapes.push_back(hash);
+            _pendingShapes.push_back(hash);
             // try to recycle old deadWorker
             ShapeFactory::Worker* worker = _deadWorker;
             if (!worker) {
@@ -66,6 +67,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
                 worker->shapeInfo = info;
                 _deadWorker = nullptr;
             }
+            worker->cache = _shapeCache;
             // we will delete worker manually later
             worker->setAutoDelete(false);
             QObject::connect(worker, &ShapeFactory::Worker::submitWork, this, &ShapeManager::acceptWork);
@@ -73,7 +75,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         }
         // else we're still waiting for the shape to be created on another thread
     } else {
-        shape = ShapeFactory::createShapeFromInfo(info);
+        shape = ShapeFactory::createShapeFromInfo(info, _shapeCache.get());
         if (shape) {
             ShapeReference newRef;
             newRef.refCount = 1;
@@ -208,8 +210,8 @@ bool ShapeManager::hasShape(const btCollisionShape* shape) const {
 
 // slot: called when ShapeFactory::Worker is done building shape
 void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
-    auto itr = std::find(_pendingMeshShapes.begin(), _pendingMeshShapes.end(), worker->shapeInfo.getHash());
-    if (itr == _pendingMeshShapes.end()) {
+    auto itr = std::find(_pendingShapes.begin(), _pendingShapes.end(), worker->shapeInfo.getHash());
+    if (itr == _pendingShapes.end()) {
         // we've received a shape but don't remember asking for it
         // (should not fall in here, but if we do: delete the unwanted shape)
         if (worker->shape) {
@@ -217,11 +219,14 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
         }
     } else {
         // clear pending status
-        *itr = _pendingMeshShapes.back();
-        _pendingMeshShapes.pop_back();
+        *itr = _pendingShapes.back();
+        _pendingShapes.pop_back();
 
-        // cache the new shape
-        if (worker->shape) {
+        if (worker->shape && _shapeMap.find(HashKey(worker->shapeInfo.getHash()))) {
+            // a caller that couldn't wait built the same shape in the meantime
+            ShapeFactory::deleteShape(worker->shape);
+        } else if (worker->shape) {
+            // cache the new shape
             ShapeReference newRef;
             // refCount is zero because nothing is using the shape yet
             newRef.refCount = 0;
@@ -277,6 +282,7 @@ void ShapeManager::acceptWork(ShapeFactory::Worker* worker) {
     // save this dead worker for later
     worker->shapeInfo.clear();
     worker->shape = nullptr;
+    worker->cache.reset();
     _deadWorker = worker;
     ++_workDeliveryCount;
 }
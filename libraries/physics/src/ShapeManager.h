@@ -22,6 +22,7 @@
 
 #include <ShapeInfo.h>
 
+#include "ShapeCache.h"
 #include "ShapeFactory.h"
 #include "HashKey.h"
 
@@ -46,6 +47,11 @@
 // doesn't delete it right away.  Instead it puts the shape's key on a list delete
 // later.  When that list grows big enough the ShapeManager will remove any matching
 // entries that still have zero ref-count.
+//
+// Static mesh shapes are always built on a worker thread, and so are the other shapes that are slow to build
+// (hulls) when the caller can wait for them.  While a shape is being built getShape() returns nullptr and bumps
+// the work request count, and the work delivery count is bumped when it arrives.  When the ShapeManager has a
+// ShapeCache the slow shapes are restored from disk instead of built, and stored there once they are built.
 
 
 class ShapeManager : public QObject {
@@ -55,8 +61,11 @@ public:
     ShapeManager();
     ~ShapeManager();
 
-    /// \return pointer to shape
-    const btCollisionShape* getShape(const ShapeInfo& info);
+    void setShapeCache(const ShapeCachePointer& cache) { _shapeCache = cache; }
+
+    /// \return pointer to shape, or nullptr while it is being built on a worker thread
+    /// \param allowDeferred true if the caller can wait for a shape that is slow to build
+    const btCollisionShape* getShape(const ShapeInfo& info, bool allowDeferred = false);
     const btCollisionShape* getShapeByKey(uint64_t key);
     bool hasShapeWithKey(uint64_t key) const;
 
@@ -100,9 +109,10 @@ private:
     // btHashMap is required because it supports memory alignment of the btCollisionShapes
     btHashMap<HashKey, ShapeReference> _shapeMap;
     std::vector<uint64_t> _garbageRing;
-    std::vector<uint64_t> _pendingMeshShapes;
+    std::vector<uint64_t> _pendingShapes;
     std::vector<KeyExpiry> _orphans;
     ShapeFactory::Worker* _deadWorker { nullptr };
+    ShapeCachePointer _shapeCache;
     TimePoint _nextOrphanExpiry;
     uint32_t _ringIndex { 0 };
     std::atomic_uint _workRequestCount { 0 };
@@ -402,4 +402,10 @@ inline bool operator<(const glm::vec3& lhs, const glm::vec3& rhs) {
            );
 }
 
+// spreads the cells of a grid over the hash space, the coordinates are multiplied as unsigned so the products wrap
+// instead of overflowing
+inline uint32_t hashGridCell(const glm::ivec3& cell) {
+    return ((uint32_t)cell.x * 73856093u) ^ ((uint32_t)cell.y * 19349663u) ^ ((uint32_t)cell.z * 83492791u);
+}
+
 #endif // hifi_GLMHelpers_h
@@ -0,0 +1,533 @@
+//
+//  JointDeltas.cpp
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JointDeltas.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace JointDeltas {
+
+namespace {
+    // the three smallest components of a unit quaternion are within +/- 1/sqrt(2)
+    const float ROTATION_RANGE = 0.70710678f;
+    const int32_t ROTATION_MAX = (1 << 14) - 1;
+
+    const float TRANSLATION_STEP = 1.0f / 16384.0f; // meters
+    const int64_t TRANSLATION_MAX = (1 << 30) - 1;
+
+    // A rotation residual is three varints, the low bit of the first one telling whether the largest component
+    // stayed the same: then they are the differences of the three smallest components, of up to 3 bytes each,
+    // otherwise the new largest component and its three smallest components in full.
+    const int MAX_ROTATION_SIZE = 10;
+    const int MAX_TRANSLATION_SIZE = 15;
+
+    const QuantizedJoint ZERO_JOINT;
+
+    int bitVectorSize(int numBits) {
+        return (numBits + 7) / 8;
+    }
+
+    uint32_t zigzag(int32_t value) {
+        return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    }
+
+    int32_t unzigzag(uint32_t value) {
+        return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+    }
+
+    int writeVarint(uint8_t* destination, uint32_t value) {
+        int size = 0;
+        while (value >= 0x80) {
+            destination[size++] = (uint8_t)(value | 0x80);
+            value >>= 7;
+        }
+        destination[size++] = (uint8_t)value;
+        return size;
+    }
+
+    // returns the bytes read, -1 if the varint runs past the end or past 32 bits
+    int readVarint(const uint8_t* source, const uint8_t* end, uint32_t& value) {
+        const int MAX_VARINT_SIZE = 5;
+        value = 0;
+        for (int i = 0; i < MAX_VARINT_SIZE && source + i < end; ++i) {
+            value |= (uint32_t)(source[i] & 0x7f) << (7 * i);
+            if (!(source[i] & 0x80)) {
+                return i + 1;
+            }
+        }
+        return -1;
+    }
+
+    const QuantizedJoint& baselineJoint(const SharedPose& baseline, int joint) {
+        return (baseline && joint < (int)baseline->size()) ? (*baseline)[joint] : ZERO_JOINT;
+    }
+
+    bool sameRotation(const QuantizedJoint& a, const QuantizedJoint& b) {
+        return a.largestComponent == b.largestComponent &&
+            a.rotation[0] == b.rotation[0] && a.rotation[1] == b.rotation[1] && a.rotation[2] == b.rotation[2];
+    }
+
+    bool sameTranslation(const QuantizedJoint& a, const QuantizedJoint& b) {
+        return a.translation[0] == b.translation[0] && a.translation[1] == b.translation[1] &&
+            a.translation[2] == b.translation[2];
+    }
+
+    int writeRotation(uint8_t* destination, const QuantizedJoint& joint, const QuantizedJoint& base) {
+        int size = 0;
+        if (joint.largestComponent == base.largestComponent) {
+            size += writeVarint(destination, zigzag(joint.rotation[0] - base.rotation[0]) << 1);
+            size += writeVarint(destination + size, zigzag(joint.rotation[1] - base.rotation[1]));
+            size += writeVarint(destination + size, zigzag(joint.rotation[2] - base.rotation[2]));
+        } else {
+            size += writeVarint(destination, ((uint32_t)joint.largestComponent << 1) | 1);
+            for (int i = 0; i < 3; ++i) {
+                size += writeVarint(destination + size, zigzag(joint.rotation[i]));
+            }
+        }
+        return size;
+    }
+
+    int readRotation(const uint8_t* source, const uint8_t* end, const QuantizedJoint& base, QuantizedJoint& joint) {
+        const uint8_t* cursor = source;
+        uint32_t values[3];
+        for (int i = 0; i < 3; ++i) {
+            int size = readVarint(cursor, end, values[i]);
+            if (size < 0) {
+                return -1;
+            }
+            cursor += size;
+        }
+
+        int32_t components[3];
+        if (values[0] & 1) {
+            uint32_t largestComponent = values[0] >> 1;
+            if (largestComponent > 3) {
+                return -1;
+            }
+            joint.largestComponent = (uint8_t)largestComponent;
+
+            // the prefix is followed by the three components in full, two of which are read already
+            uint32_t value;
+            int size = readVarint(cursor, end, value);
+            if (size < 0) {
+                return -1;
+            }
+            cursor += size;
+            components[0] = unzigzag(values[1]);
+            components[1] = unzigzag(values[2]);
+            components[2] = unzigzag(value);
+        } else {
+            joint.largestComponent = base.largestComponent;
+            components[0] = base.rotation[0] + unzigzag(values[0] >> 1);
+            components[1] = base.rotation[1] + unzigzag(values[1]);
+            components[2] = base.rotation[2] + unzigzag(values[2]);
+        }
+
+        for (int i = 0; i < 3; ++i) {
+            if (components[i] < -ROTATION_MAX || components[i] > ROTATION_MAX) {
+                return -1;
+            }
+            joint.rotation[i] = (int16_t)components[i];
+        }
+        return (int)(cursor - source);
+    }
+
+    int writeTranslation(uint8_t* destination, const QuantizedJoint& joint, const QuantizedJoint& base) {
+        int size = 0;
+        for (int i = 0; i < 3; ++i) {
+            size += writeVarint(destination + size, zigzag(joint.translation[i] - base.translation[i]));
+        }
+        return size;
+    }
+
+    int readTranslation(const uint8_t* source, const uint8_t* end, const QuantizedJoint& base, QuantizedJoint& joint) {
+        const uint8_t* cursor = source;
+        for (int i = 0; i < 3; ++i) {
+            uint32_t value;
+            int size = readVarint(cursor, end, value);
+            if (size < 0) {
+                return -1;
+            }
+            cursor += size;
+
+            int64_t component = (int64_t)base.translation[i] + unzigzag(value);
+            if (component < -TRANSLATION_MAX || component > TRANSLATION_MAX) {
+                return -1;
+            }
+            joint.translation[i] = (int32_t)component;
+        }
+        return (int)(cursor - source);
+    }
+}
+
+bool QuantizedJoint::operator==(const QuantizedJoint& other) const {
+    return sameRotation(*this, other) && sameTranslation(*this, other);
+}
+
+QuantizedJoint quantize(const JointData& joint) {
+    QuantizedJoint quantized;
+
+    glm::quat rotation = glm::normalize(joint.rotation);
+    float components[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+    int largest = 0;
+    for (int i = 1; i < 4; ++i) {
+        if (fabsf(components[i]) > fabsf(components[largest])) {
+            largest = i;
+        }
+    }
+    quantized.largestComponent = (uint8_t)largest;
+
+    // q and -q are the same rotation, pick the one with a positive largest component
+    float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+    int next = 0;
+    for (int i = 0; i < 4; ++i) {
+        if (i != largest) {
+            float component = glm::clamp(sign * components[i] / ROTATION_RANGE, -1.0f, 1.0f);
+            quantized.rotation[next++] = (int16_t)lroundf(component * ROTATION_MAX);
+        }
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        int64_t component = llroundf(joint.translation[i] / TRANSLATION_STEP);
+        quantized.translation[i] = (int32_t)std::max(-TRANSLATION_MAX, std::min(component, TRANSLATION_MAX));
+    }
+    return quantized;
+}
+
+void dequantize(const QuantizedJoint& joint, JointData& data) {
+    float components[4];
+    float sumOfSquares = 0.0f;
+    int next = 0;
+    for (int i = 0; i < 4; ++i) {
+        if (i != joint.largestComponent) {
+            components[i] = (float)joint.rotation[next++] / ROTATION_MAX * ROTATION_RANGE;
+            sumOfSquares += components[i] * components[i];
+        }
+    }
+    components[joint.largestComponent] = sqrtf(std::max(0.0f, 1.0f - sumOfSquares));
+    data.rotation = glm::normalize(glm::quat(components[3], components[0], components[1], components[2]));
+
+    data.translation = glm::vec3(joint.translation[0], joint.translation[1], joint.translation[2]) * TRANSLATION_STEP;
+}
+
+SharedPose quantizePose(const QVector<JointData>& joints) {
+    auto pose = std::make_shared<Pose>();
+    pose->reserve(joints.size());
+    for (const auto& joint : joints) {
+        pose->push_back(quantize(joint));
+    }
+    return pose;
+}
+
+SharedPose cullPose(const SharedPose& pose, const SharedPose& baseline, float minRotationDot, float minTranslation) {
+    if (!baseline) {
+        return pose;
+    }
+
+    std::shared_ptr<Pose> culled;
+    int numCulled = 0;
+    int numChanged = 0;
+    for (int joint = 0; joint < (int)pose->size(); ++joint) {
+        const QuantizedJoint& current = (*pose)[joint];
+        if (joint >= (int)baseline->size() || current == (*baseline)[joint]) {
+            continue;
+        }
+        const QuantizedJoint& base = (*baseline)[joint];
+        ++numChanged;
+
+        JointData currentData;
+        JointData baseData;
+        dequantize(current, currentData);
+        dequantize(base, baseData);
+        bool keepRotation = !sameRotation(current, base) &&
+            fabsf(glm::dot(currentData.rotation, baseData.rotation)) >= minRotationDot;
+        bool keepTranslation = !sameTranslation(current, base) &&
+            glm::distance(currentData.translation, baseData.translation) <= minTranslation;
+        if (!keepRotation && !keepTranslation) {
+            continue;
+        }
+
+        if (!culled) {
+            culled = std::make_shared<Pose>(*pose);
+        }
+        QuantizedJoint& culledJoint = (*culled)[joint];
+        if (keepRotation) {
+            culledJoint.largestComponent = base.largestComponent;
+            memcpy(culledJoint.rotation, base.rotation, sizeof(base.rotation));
+        }
+        if (keepTranslation) {
+            memcpy(culledJoint.translation, base.translation, sizeof(base.translation));
+        }
+        if (culledJoint == base) {
+            ++numCulled;
+        }
+    }
+
+    if (!culled) {
+        return pose;
+    }
+    if (numCulled == numChanged && pose->size() == baseline->size()) {
+        return baseline;
+    }
+    return culled;
+}
+
+bool isNewer(Sequence a, Sequence b) {
+    return (int16_t)(a - b) > 0;
+}
+
+Sequence nextSequence(Sequence sequence) {
+    ++sequence;
+    return sequence == NO_BASELINE ? sequence + 1 : sequence;
+}
+
+int maxSectionSize(int numJoints) {
+    return MIN_SECTION_SIZE + 2 * bitVectorSize(numJoints) + numJoints * (MAX_ROTATION_SIZE + MAX_TRANSLATION_SIZE);
+}
+
+int writeSection(uint8_t* destination, int maxSize, const Encoding& encoding, int firstJoint, int& nextJoint) {
+    const Pose& pose = *encoding.pose;
+    const int numJoints = (int)pose.size();
+    assert(numJoints <= 255 && firstJoint <= numJoints && maxSize >= MIN_SECTION_SIZE);
+
+    // the residuals are gathered first, the bit vectors in front of them are sized by how many joints fit
+    std::vector<uint8_t> changedJoints;
+    std::vector<uint8_t> rotations;
+    std::vector<uint8_t> translations;
+    uint8_t rotation[MAX_ROTATION_SIZE];
+    uint8_t translation[MAX_TRANSLATION_SIZE];
+
+    const uint8_t ROTATION_CHANGED = 1;
+    const uint8_t TRANSLATION_CHANGED = 2;
+
+    int joint = firstJoint;
+    for (; joint < numJoints; ++joint) {
+        const QuantizedJoint& current = pose[joint];
+        const QuantizedJoint& base = baselineJoint(encoding.baseline, joint);
+
+        uint8_t changed = 0;
+        int rotationSize = 0;
+        if (!sameRotation(current, base)) {
+            changed |= ROTATION_CHANGED;
+            rotationSize = writeRotation(rotation, current, base);
+        }
+        int translationSize = 0;
+        if (!sameTranslation(current, base)) {
+            changed |= TRANSLATION_CHANGED;
+            translationSize = writeTranslation(translation, current, base);
+        }
+
+        int numSectionJoints = joint - firstJoint + 1;
+        int size = MIN_SECTION_SIZE + 2 * bitVectorSize(numSectionJoints) + (int)rotations.size() + rotationSize +
+            (int)translations.size() + translationSize;
+        if (size > maxSize) {
+            break;
+        }
+
+        changedJoints.push_back(changed);
+        rotations.insert(rotations.end(), rotation, rotation + rotationSize);
+        translations.insert(translations.end(), translation, translation + translationSize);
+    }
+    nextJoint = joint;
+
+    const int numSectionJoints = (int)changedJoints.size();
+    uint8_t* cursor = destination;
+    *cursor++ = (uint8_t)numJoints;
+    memcpy(cursor, &encoding.sequence, sizeof(Sequence));
+    cursor += sizeof(Sequence);
+    memcpy(cursor, &encoding.baselineSequence, sizeof(Sequence));
+    cursor += sizeof(Sequence);
+    *cursor++ = (uint8_t)firstJoint;
+    *cursor++ = (uint8_t)numSectionJoints;
+
+    const int bitsSize = bitVectorSize(numSectionJoints);
+    memset(cursor, 0, 2 * bitsSize);
+    for (int i = 0; i < numSectionJoints; ++i) {
+        if (changedJoints[i] & ROTATION_CHANGED) {
+            cursor[i / 8] |= 1 << (i % 8);
+        }
+        if (changedJoints[i] & TRANSLATION_CHANGED) {
+            cursor[bitsSize + i / 8] |= 1 << (i % 8);
+        }
+    }
+    cursor += 2 * bitsSize;
+
+    if (!rotations.empty()) {
+        memcpy(cursor, rotations.data(), rotations.size());
+        cursor += rotations.size();
+    }
+    if (!translations.empty()) {
+        memcpy(cursor, translations.data(), translations.size());
+        cursor += translations.size();
+    }
+    return (int)(cursor - destination);
+}
+
+void PoseHistory::add(Sequence sequence, const SharedPose& pose) {
+    auto it = std::find_if(_poses.begin(), _poses.end(), [&](const std::pair<Sequence, SharedPose>& entry) {
+        return entry.first == sequence;
+    });
+    if (it != _poses.end()) {
+        _poses.erase(it);
+    }
+
+    _poses.emplace_back(sequence, pose);
+    while (_poses.size() > _capacity) {
+        _poses.pop_front();
+    }
+}
+
+SharedPose PoseHistory::find(Sequence sequence) const {
+    for (auto it = _poses.rbegin(); it != _poses.rend(); ++it) {
+        if (it->first == sequence) {
+            return it->second;
+        }
+    }
+    return SharedPose();
+}
+
+int Receiver::readSection(const uint8_t* source, int size, QVector<JointData>& joints) {
+    const uint8_t* cursor = source;
+    const uint8_t* end = source + size;
+    if (size < MIN_SECTION_SIZE) {
+        return -1;
+    }
+
+    const int numJoints = *cursor++;
+    Sequence sequence;
+    memcpy(&sequence, cursor, sizeof(Sequence));
+    cursor += sizeof(Sequence);
+    Sequence baselineSequence;
+    memcpy(&baselineSequence, cursor, sizeof(Sequence));
+    cursor += sizeof(Sequence);
+    const int firstJoint = *cursor++;
+    const int numSectionJoints = *cursor++;
+
+    const int bitsSize = bitVectorSize(numSectionJoints);
+    if (sequence == NO_BASELINE || firstJoint + numSectionJoints > numJoints || end - cursor < 2 * bitsSize) {
+        return -1;
+    }
+    const uint8_t* rotationBits = cursor;
+    const uint8_t* translationBits = cursor + bitsSize;
+    cursor += 2 * bitsSize;
+
+    // the sender encodes against poses we acknowledged, which may have left the recent ones already
+    SharedPose baseline;
+    if (baselineSequence != NO_BASELINE) {
+        baseline = _history.find(baselineSequence);
+        if (!baseline) {
+            baseline = _acknowledgedPoses.find(baselineSequence);
+        }
+    }
+    const bool hasBaseline = baselineSequence == NO_BASELINE || baseline;
+
+    bool isNewPose = !_hasPendingPose || sequence != _pendingSequence || baselineSequence != _pendingBaselineSequence ||
+        numJoints != (int)_pendingPose.size();
+    if (isNewPose) {
+        _hasPendingPose = true;
+        _pendingSequence = sequence;
+        _pendingBaselineSequence = baselineSequence;
+        _pendingPose.resize(numJoints);
+        for (int i = 0; i < numJoints; ++i) {
+            _pendingPose[i] = baselineJoint(baseline, i);
+        }
+        _receivedJoints.assign(numJoints, false);
+        _numPendingJoints = 0;
+    }
+
+    // the residuals are read whether or not there is a baseline to add them to
+    for (int i = 0; i < numSectionJoints; ++i) {
+        if (rotationBits[i / 8] & (1 << (i % 8))) {
+            int joint = firstJoint + i;
+            int rotationSize = readRotation(cursor, end, baselineJoint(baseline, joint), _pendingPose[joint]);
+            if (rotationSize < 0) {
+                _hasPendingPose = false;
+                return -1;
+            }
+            cursor += rotationSize;
+        }
+    }
+    for (int i = 0; i < numSectionJoints; ++i) {
+        if (translationBits[i / 8] & (1 << (i % 8))) {
+            int joint = firstJoint + i;
+            int translationSize = readTranslation(cursor, end, baselineJoint(baseline, joint), _pendingPose[joint]);
+            if (translationSize < 0) {
+                _hasPendingPose = false;
+                return -1;
+            }
+            cursor += translationSize;
+        }
+    }
+
+    if (!hasBaseline) {
+        _hasPendingPose = false;
+        _needsKeyFrame = true;
+        return (int)(cursor - source);
+    }
+
+    for (int joint = firstJoint; joint < firstJoint + numSectionJoints; ++joint) {
+        if (!_receivedJoints[joint]) {
+            _receivedJoints[joint] = true;
+            ++_numPendingJoints;
+        }
+    }
+
+    // sections can arrive out of order, don't step back to an older pose
+    if (!_hasAppliedPose || !isNewer(_appliedSequence, sequence)) {
+        _hasAppliedPose = true;
+        _appliedSequence = sequence;
+        if (joints.size() != numJoints) {
+            joints.resize(numJoints);
+        }
+        for (int joint = firstJoint; joint < firstJoint + numSectionJoints; ++joint) {
+            dequantize(_pendingPose[joint], joints[joint]);
+        }
+    }
+
+    if (_numPendingJoints == numJoints) {
+        _history.add(sequence, std::make_shared<Pose>(_pendingPose));
+        _hasPendingPose = false;
+        _lastCompleteSequence = sequence;
+        _lastBaselineSequence = baselineSequence;
+        _needsKeyFrame = false;
+    }
+    return (int)(cursor - source);
+}
+
+bool Receiver::takeAcknowledgement(quint64 now, Sequence& sequence) {
+    if (now - _lastAcknowledgementTime < ACKNOWLEDGEMENT_INTERVAL_USECS) {
+        return false;
+    }
+
+    if (_needsKeyFrame) {
+        sequence = NO_BASELINE;
+    } else if (_lastCompleteSequence != NO_BASELINE && (_lastCompleteSequence != _lastAcknowledgedSequence ||
+                                                        _lastBaselineSequence != _lastAcknowledgedSequence)) {
+        // a new pose, or the sender hasn't moved on to the one we acknowledged yet
+        sequence = _lastCompleteSequence;
+        _acknowledgedPoses.add(sequence, _history.find(sequence));
+    } else {
+        return false;
+    }
+
+    _lastAcknowledgedSequence = sequence;
+    _lastAcknowledgementTime = now;
+    return true;
+}
+
+void Receiver::reset() {
+    *this = Receiver();
+}
+
+}
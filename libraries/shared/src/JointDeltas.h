@@ -0,0 +1,135 @@
+//
+//  JointDeltas.h
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_JointDeltas_h
+#define hifi_JointDeltas_h
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <QVector>
+
+#include "JointData.h"
+
+// Joint poses delta encoded against a pose the receiver acknowledged.
+//
+// Both ends work on the same quantized pose: rotations as their three smallest components, the largest one following
+// from the unit norm, and translations on a fixed grid. A pose rebuilt from residuals is then the sender's pose bit for
+// bit and errors never build up from one delta to the next. Every pose the sender quantizes gets a sequence number,
+// the receiver acknowledges the last pose it rebuilt in full and the sender encodes the following ones against it.
+namespace JointDeltas {
+
+using Sequence = uint16_t;
+
+// the baseline of a key frame, which is encoded against the all zero pose
+const Sequence NO_BASELINE = 0;
+
+// how many poses the receiver keeps to decode against, the sender should keep at least as many
+const size_t HISTORY_SIZE = 32;
+
+// how often the receiver acknowledges a new pose of a sender
+const quint64 ACKNOWLEDGEMENT_INTERVAL_USECS = 100 * 1000;
+
+struct QuantizedJoint {
+    int32_t translation[3] { 0, 0, 0 };
+    int16_t rotation[3] { 0, 0, 0 };
+    uint8_t largestComponent { 0 };
+
+    bool operator==(const QuantizedJoint& other) const;
+    bool operator!=(const QuantizedJoint& other) const { return !(*this == other); }
+};
+
+using Pose = std::vector<QuantizedJoint>;
+using SharedPose = std::shared_ptr<const Pose>;
+
+QuantizedJoint quantize(const JointData& joint);
+// sets the rotation and translation of data, leaving its default pose flags alone
+void dequantize(const QuantizedJoint& joint, JointData& data);
+SharedPose quantizePose(const QVector<JointData>& joints);
+
+// The pose with the joints that changed less than the limits since the baseline left as they are in the baseline, so
+// that they aren't sent. Returns the pose itself, or the baseline, when culling doesn't make a new pose.
+SharedPose cullPose(const SharedPose& pose, const SharedPose& baseline, float minRotationDot, float minTranslation);
+
+// sequences wrap around, a is newer than b if it is less than half the range ahead of it
+bool isNewer(Sequence a, Sequence b);
+Sequence nextSequence(Sequence sequence);
+
+// one pose of a sender and the acknowledged pose it is encoded against, null for a key frame
+struct Encoding {
+    Sequence sequence { NO_BASELINE };
+    SharedPose pose;
+    Sequence baselineSequence { NO_BASELINE };
+    SharedPose baseline;
+};
+
+// the header of a section, a section with no joints is valid
+const int MIN_SECTION_SIZE = 7;
+int maxSectionSize(int numJoints);
+
+// Writes the joints of the encoding from firstJoint on, as many as fit in maxSize bytes, at least MIN_SECTION_SIZE.
+// Returns the bytes written and sets nextJoint to the first joint left for another section, the number of joints of
+// the pose once they are all written.
+int writeSection(uint8_t* destination, int maxSize, const Encoding& encoding, int firstJoint, int& nextJoint);
+
+// The recent poses of a sender, by sequence
+class PoseHistory {
+public:
+    explicit PoseHistory(size_t capacity = HISTORY_SIZE) : _capacity(capacity) {}
+
+    void add(Sequence sequence, const SharedPose& pose);
+    SharedPose find(Sequence sequence) const;
+    void clear() { _poses.clear(); }
+
+private:
+    size_t _capacity;
+    std::deque<std::pair<Sequence, SharedPose>> _poses;
+};
+
+// Rebuilds the poses of one sender from its sections and decides what to acknowledge
+class Receiver {
+public:
+    // Reads a section and applies its joints to the joints, resized to the sender's pose, unless they are older
+    // than what was applied already. Returns the bytes read, -1 if the section is malformed.
+    int readSection(const uint8_t* source, int size, QVector<JointData>& joints);
+
+    // the sequence to acknowledge at this time, if any, NO_BASELINE asks the sender for a key frame
+    bool takeAcknowledgement(quint64 now, Sequence& sequence);
+
+    void reset();
+
+private:
+    PoseHistory _history;
+    PoseHistory _acknowledgedPoses { 2 }; // the sender may still use the one before the last we acknowledged
+
+    // the pose being rebuilt, sections of it can come in several packets
+    bool _hasPendingPose { false };
+    Sequence _pendingSequence { NO_BASELINE };
+    Sequence _pendingBaselineSequence { NO_BASELINE };
+    Pose _pendingPose;
+    std::vector<bool> _receivedJoints;
+    int _numPendingJoints { 0 };
+
+    bool _hasAppliedPose { false };
+    Sequence _appliedSequence { NO_BASELINE };
+
+    Sequence _lastCompleteSequence { NO_BASELINE };
+    Sequence _lastBaselineSequence { NO_BASELINE };
+    bool _needsKeyFrame { false };
+
+    Sequence _lastAcknowledgedSequence { NO_BASELINE };
+    quint64 _lastAcknowledgementTime { 0 };
+};
+
+}
+
+#endif // hifi_JointDeltas_h
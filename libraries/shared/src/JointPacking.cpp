@@ -0,0 +1,176 @@
+//
+//  JointPacking.cpp
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JointPacking.h"
+
+#include <string.h>
+
+#include "GLMHelpers.h"
+
+using namespace JointPacking;
+
+void Rotations::resize(int size) {
+    x.resize(size);
+    y.resize(size);
+    z.resize(size);
+    w.resize(size);
+}
+
+void Rotations::append(const glm::quat& rotation) {
+    x.push_back(rotation.x);
+    y.push_back(rotation.y);
+    z.push_back(rotation.z);
+    w.push_back(rotation.w);
+}
+
+void Translations::resize(int size) {
+    x.resize(size);
+    y.resize(size);
+    z.resize(size);
+}
+
+void Translations::append(const glm::vec3& translation) {
+    x.push_back(translation.x);
+    y.push_back(translation.y);
+    z.push_back(translation.z);
+}
+
+//
+// Portable reference code, one joint at a time through the scalar packing of GLMHelpers
+//
+static void packRotations_ref(const float* x, const float* y, const float* z, const float* w,
+                              uint8_t* destination, int count) {
+    for (int i = 0; i < count; i++) {
+        destination += packOrientationQuatToSixBytes(destination, glm::quat(w[i], x[i], y[i], z[i]));
+    }
+}
+
+static void unpackRotations_ref(const uint8_t* source, float* x, float* y, float* z, float* w, int count) {
+    for (int i = 0; i < count; i++) {
+        glm::quat rotation;
+        source += unpackOrientationQuatFromSixBytes(source, rotation);
+        x[i] = rotation.x;
+        y[i] = rotation.y;
+        z[i] = rotation.z;
+        w[i] = rotation.w;
+    }
+}
+
+static void packTranslations_ref(const float* x, const float* y, const float* z, float scale, int radix,
+                                 uint8_t* destination, int count) {
+    for (int i = 0; i < count; i++) {
+        destination += packFloatVec3ToSignedTwoByteFixed(destination, glm::vec3(x[i], y[i], z[i]) / scale, radix);
+    }
+}
+
+static void unpackTranslations_ref(const uint8_t* source, float scale, int radix, float* x, float* y, float* z, int count) {
+    for (int i = 0; i < count; i++) {
+        glm::vec3 translation;
+        source += unpackFloatVec3FromSignedTwoByteFixed(source, translation, radix);
+        translation *= scale;
+        x[i] = translation.x;
+        y[i] = translation.y;
+        z[i] = translation.z;
+    }
+}
+
+static void packValidityBits_ref(const uint8_t* flags, int count, uint8_t* bits) {
+    memset(bits, 0, (count + 7) / 8);
+    for (int i = 0; i < count; i++) {
+        if (flags[i]) {
+            bits[i / 8] |= 1 << (i % 8);
+        }
+    }
+}
+
+static int unpackValidityBits_ref(const uint8_t* bits, int count, uint8_t* flags) {
+    int numSet = 0;
+    for (int i = 0; i < count; i++) {
+        flags[i] = (bits[i / 8] >> (i % 8)) & 1;
+        numSet += flags[i];
+    }
+    return numSet;
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void packRotations_SSE41(const float* x, const float* y, const float* z, const float* w, uint8_t* destination, int count);
+void unpackRotations_SSE41(const uint8_t* source, float* x, float* y, float* z, float* w, int count);
+void packTranslations_SSE41(const float* x, const float* y, const float* z, float scale, int radix,
+                            uint8_t* destination, int count);
+void unpackTranslations_SSE41(const uint8_t* source, float scale, int radix, float* x, float* y, float* z, int count);
+void packValidityBits_SSE41(const uint8_t* flags, int count, uint8_t* bits);
+int unpackValidityBits_SSE41(const uint8_t* bits, int count, uint8_t* flags);
+
+void packRotations_AVX2(const float* x, const float* y, const float* z, const float* w, uint8_t* destination, int count);
+void unpackRotations_AVX2(const uint8_t* source, float* x, float* y, float* z, float* w, int count);
+void packTranslations_AVX2(const float* x, const float* y, const float* z, float scale, int radix,
+                           uint8_t* destination, int count);
+void unpackTranslations_AVX2(const uint8_t* source, float scale, int radix, float* x, float* y, float* z, int count);
+void packValidityBits_AVX2(const uint8_t* flags, int count, uint8_t* bits);
+int unpackValidityBits_AVX2(const uint8_t* bits, int count, uint8_t* flags);
+
+static bool _cpuSupportsAVX2 = cpuSupportsAVX2();
+static bool _cpuSupportsSSE41 = cpuSupportsSSE41();
+
+static auto packRotationsKernel = _cpuSupportsAVX2 ? &packRotations_AVX2 :
+                                  _cpuSupportsSSE41 ? &packRotations_SSE41 : &packRotations_ref;
+static auto unpackRotationsKernel = _cpuSupportsAVX2 ? &unpackRotations_AVX2 :
+                                    _cpuSupportsSSE41 ? &unpackRotations_SSE41 : &unpackRotations_ref;
+static auto packTranslationsKernel = _cpuSupportsAVX2 ? &packTranslations_AVX2 :
+                                     _cpuSupportsSSE41 ? &packTranslations_SSE41 : &packTranslations_ref;
+static auto unpackTranslationsKernel = _cpuSupportsAVX2 ? &unpackTranslations_AVX2 :
+                                       _cpuSupportsSSE41 ? &unpackTranslations_SSE41 : &unpackTranslations_ref;
+static auto packValidityBitsKernel = _cpuSupportsAVX2 ? &packValidityBits_AVX2 :
+                                     _cpuSupportsSSE41 ? &packValidityBits_SSE41 : &packValidityBits_ref;
+static auto unpackValidityBitsKernel = _cpuSupportsAVX2 ? &unpackValidityBits_AVX2 :
+                                       _cpuSupportsSSE41 ? &unpackValidityBits_SSE41 : &unpackValidityBits_ref;
+
+#else   // portable reference code
+static auto packRotationsKernel = &packRotations_ref;
+static auto unpackRotationsKernel = &unpackRotations_ref;
+static auto packTranslationsKernel = &packTranslations_ref;
+static auto unpackTranslationsKernel = &unpackTranslations_ref;
+static auto packValidityBitsKernel = &packValidityBits_ref;
+static auto unpackValidityBitsKernel = &unpackValidityBits_ref;
+#endif
+
+void JointPacking::packRotations(const Rotations& rotations, uint8_t* destination) {
+    packRotationsKernel(rotations.x.data(), rotations.y.data(), rotations.z.data(), rotations.w.data(),
+                        destination, rotations.size());
+}
+
+void JointPacking::unpackRotations(const uint8_t* source, Rotations& rotations) {
+    unpackRotationsKernel(source, rotations.x.data(), rotations.y.data(), rotations.z.data(), rotations.w.data(),
+                          rotations.size());
+}
+
+void JointPacking::packTranslations(const Translations& translations, float scale, int radix, uint8_t* destination) {
+    packTranslationsKernel(translations.x.data(), translations.y.data(), translations.z.data(), scale, radix,
+                           destination, translations.size());
+}
+
+void JointPacking::unpackTranslations(const uint8_t* source, float scale, int radix, Translations& translations) {
+    unpackTranslationsKernel(source, scale, radix, translations.x.data(), translations.y.data(), translations.z.data(),
+                             translations.size());
+}
+
+void JointPacking::packValidityBits(const uint8_t* flags, int count, uint8_t* bits) {
+    packValidityBitsKernel(flags, count, bits);
+}
+
+int JointPacking::unpackValidityBits(const uint8_t* bits, int count, uint8_t* flags) {
+    return unpackValidityBitsKernel(bits, count, flags);
+}
@@ -0,0 +1,69 @@
+//
+//  JointPacking.h
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_JointPacking_h
+#define hifi_JointPacking_h
+
+#include <stdint.h>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Packs and unpacks whole arrays of joints at once, byte for byte in the formats of packOrientationQuatToSixBytes,
+// packFloatVec3ToSignedTwoByteFixed and the joint validity bit vectors of the avatar packets. The joints are kept as
+// structures of arrays, so that a kernel loads one component of several joints at a time, and the SSE4.1 or AVX2
+// kernels are picked at runtime.
+namespace JointPacking {
+
+const int PACKED_ROTATION_SIZE = 6;
+const int PACKED_TRANSLATION_SIZE = 6;
+
+struct Rotations {
+    int size() const { return (int)x.size(); }
+    void resize(int size);
+    void clear() { resize(0); }
+    void append(const glm::quat& rotation);
+    glm::quat at(int index) const { return glm::quat(w[index], x[index], y[index], z[index]); }
+
+    std::vector<float> x, y, z, w;
+};
+
+struct Translations {
+    int size() const { return (int)x.size(); }
+    void resize(int size);
+    void clear() { resize(0); }
+    void append(const glm::vec3& translation);
+    glm::vec3 at(int index) const { return glm::vec3(x[index], y[index], z[index]); }
+
+    std::vector<float> x, y, z;
+};
+
+// writes rotations.size() * PACKED_ROTATION_SIZE bytes
+void packRotations(const Rotations& rotations, uint8_t* destination);
+// reads as many rotations as rotations.size()
+void unpackRotations(const uint8_t* source, Rotations& rotations);
+
+// writes translations.size() * PACKED_TRANSLATION_SIZE bytes, each translation divided by scale and with radix bits of
+// fraction, like packFloatVec3ToSignedTwoByteFixed(destination, translation / scale, radix)
+void packTranslations(const Translations& translations, float scale, int radix, uint8_t* destination);
+// reads as many translations as translations.size() and multiplies them by scale
+void unpackTranslations(const uint8_t* source, float scale, int radix, Translations& translations);
+
+// sets bit i of the bit vector, the low bit of each byte first, for each non zero flag, writes calcBitVectorSize(count)
+// bytes
+void packValidityBits(const uint8_t* flags, int count, uint8_t* bits);
+// sets each flag to 0 or 1 from the bit vector, returns the number of flags set
+int unpackValidityBits(const uint8_t* bits, int count, uint8_t* flags);
+
+}
+
+#endif // hifi_JointPacking_h
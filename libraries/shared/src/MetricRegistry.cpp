@@ -0,0 +1,297 @@
+//
+//  MetricRegistry.cpp
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MetricRegistry.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <QDataStream>
+#include <QMap>
+#include <QRegularExpression>
+
+#include "SharedLogging.h"
+
+namespace {
+    int64_t bitsOf(double value) {
+        int64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    double doubleOf(int64_t bits) {
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    size_t numValuesOf(MetricRegistry::Type type, size_t numBucketBounds) {
+        return type == MetricRegistry::Type::Histogram ? numBucketBounds + 2 : 1;
+    }
+}
+
+MetricRegistry::Metric::Metric(const QString& name, const QString& help, Type type,
+                               const std::vector<int64_t>& bucketBounds, size_t firstValue) :
+    name(name),
+    help(help),
+    type(type),
+    bucketBounds(bucketBounds),
+    firstValue(firstValue),
+    numValues(numValuesOf(type, bucketBounds.size())),
+    values(new std::atomic<int64_t>[numValues])
+{
+    for (size_t i = 0; i < numValues; ++i) {
+        values[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void MetricRegistry::Counter::increment(int64_t amount) {
+    if (_metric) {
+        _metric->values[0].fetch_add(amount, std::memory_order_relaxed);
+    }
+}
+
+int64_t MetricRegistry::Counter::get() const {
+    return _metric ? _metric->values[0].load(std::memory_order_relaxed) : 0;
+}
+
+void MetricRegistry::Gauge::set(double value) {
+    if (_metric) {
+        _metric->values[0].store(bitsOf(value), std::memory_order_relaxed);
+    }
+}
+
+double MetricRegistry::Gauge::get() const {
+    return _metric ? doubleOf(_metric->values[0].load(std::memory_order_relaxed)) : 0.0;
+}
+
+void MetricRegistry::Histogram::record(int64_t value) {
+    if (_metric) {
+        // the first bucket whose bound is at least the value, or the one past every bound
+        const auto& bounds = _metric->bucketBounds;
+        size_t bucket = std::lower_bound(bounds.begin(), bounds.end(), value) - bounds.begin();
+        _metric->values[bucket].fetch_add(1, std::memory_order_relaxed);
+        _metric->values[_metric->numValues - 1].fetch_add(value, std::memory_order_relaxed);
+    }
+}
+
+MetricRegistry& MetricRegistry::getInstance() {
+    static MetricRegistry instance;
+    return instance;
+}
+
+bool MetricRegistry::isValidName(const QString& name) {
+    static const QRegularExpression NAME_REGEX("^[a-zA-Z_:][a-zA-Z0-9_:]*$");
+    return NAME_REGEX.match(name).hasMatch();
+}
+
+MetricRegistry::Counter MetricRegistry::counter(const QString& name, const QString& help) {
+    return Counter(registerMetric(name, help, Type::Counter, {}));
+}
+
+MetricRegistry::Gauge MetricRegistry::gauge(const QString& name, const QString& help) {
+    return Gauge(registerMetric(name, help, Type::Gauge, {}));
+}
+
+MetricRegistry::Histogram MetricRegistry::histogram(const QString& name, const QString& help,
+                                                    const std::vector<int64_t>& bucketBounds) {
+    std::vector<int64_t> sortedBounds = bucketBounds;
+    std::sort(sortedBounds.begin(), sortedBounds.end());
+    sortedBounds.erase(std::unique(sortedBounds.begin(), sortedBounds.end()), sortedBounds.end());
+    return Histogram(registerMetric(name, help, Type::Histogram, sortedBounds));
+}
+
+MetricRegistry::Metric* MetricRegistry::registerMetric(const QString& name, const QString& help, Type type,
+                                                       const std::vector<int64_t>& bucketBounds) {
+    if (!isValidName(name)) {
+        qCWarning(shared) << "Ignoring metric with invalid name" << name;
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = std::find_if(_metrics.begin(), _metrics.end(), [&](const Metric& metric) { return metric.name == name; });
+    if (it != _metrics.end()) {
+        if (it->type != type) {
+            qCWarning(shared) << "Metric" << name << "is already registered with another type";
+            return nullptr;
+        }
+        return &(*it);
+    }
+
+    _metrics.emplace_back(name, help, type, bucketBounds, _numValues);
+    _numValues += _metrics.back().numValues;
+    return &_metrics.back();
+}
+
+QByteArray MetricRegistry::writeChanges(Encoder& encoder) {
+    QByteArray changes;
+    QDataStream stream(&changes, QIODevice::WriteOnly);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    bool isFull = encoder._numSentMetrics == 0;
+    stream << isFull;
+
+    // the definitions of the metrics registered since the last write
+    stream << (quint16)(_metrics.size() - encoder._numSentMetrics);
+    for (size_t i = encoder._numSentMetrics; i < _metrics.size(); ++i) {
+        const auto& metric = _metrics[i];
+        stream << metric.name << metric.help << (quint8)metric.type << (quint32)metric.bucketBounds.size();
+        for (auto bound : metric.bucketBounds) {
+            stream << (qint64)bound;
+        }
+    }
+    encoder._numSentMetrics = _metrics.size();
+    encoder._sentValues.resize(_numValues, 0);
+
+    // then the metrics that changed, counters and histograms as the difference to what was sent
+    std::vector<quint16> changedMetrics;
+    std::vector<int64_t> values;
+    for (size_t i = 0; i < _metrics.size(); ++i) {
+        const auto& metric = _metrics[i];
+        bool changed = false;
+        for (size_t v = 0; v < metric.numValues; ++v) {
+            if (metric.values[v].load(std::memory_order_relaxed) != encoder._sentValues[metric.firstValue + v]) {
+                changed = true;
+                break;
+            }
+        }
+        if (changed) {
+            changedMetrics.push_back((quint16)i);
+        }
+    }
+
+    stream << (quint16)changedMetrics.size();
+    for (auto index : changedMetrics) {
+        const auto& metric = _metrics[index];
+        stream << index;
+        for (size_t v = 0; v < metric.numValues; ++v) {
+            int64_t value = metric.values[v].load(std::memory_order_relaxed);
+            int64_t& sentValue = encoder._sentValues[metric.firstValue + v];
+            stream << (qint64)(metric.type == Type::Gauge ? value : value - sentValue);
+            sentValue = value;
+        }
+    }
+
+    return changes;
+}
+
+bool MetricSet::readChanges(const QByteArray& changes) {
+    QDataStream stream(changes);
+
+    bool isFull { false };
+    stream >> isFull;
+    if (isFull) {
+        _metrics.clear();
+        _isComplete = true;
+    } else if (!_isComplete) {
+        return false;
+    }
+
+    quint16 numNewMetrics { 0 };
+    stream >> numNewMetrics;
+    for (quint16 i = 0; i < numNewMetrics; ++i) {
+        Metric metric;
+        quint8 type;
+        quint32 numBucketBounds;
+        stream >> metric.name >> metric.help >> type >> numBucketBounds;
+        if (stream.status() != QDataStream::Ok || type > (quint8)MetricRegistry::Type::Histogram ||
+            numBucketBounds > (quint32)(changes.size() / sizeof(qint64))) {
+            clear();
+            return false;
+        }
+
+        metric.type = (MetricRegistry::Type)type;
+        metric.bucketBounds.resize(numBucketBounds);
+        for (auto& bound : metric.bucketBounds) {
+            qint64 value;
+            stream >> value;
+            bound = value;
+        }
+        metric.values.resize(numValuesOf(metric.type, numBucketBounds), 0);
+        _metrics.push_back(std::move(metric));
+    }
+
+    quint16 numChangedMetrics { 0 };
+    stream >> numChangedMetrics;
+    for (quint16 i = 0; i < numChangedMetrics; ++i) {
+        quint16 index;
+        stream >> index;
+        if (stream.status() != QDataStream::Ok || index >= _metrics.size()) {
+            clear();
+            return false;
+        }
+
+        auto& metric = _metrics[index];
+        for (auto& value : metric.values) {
+            qint64 change;
+            stream >> change;
+            if (metric.type == MetricRegistry::Type::Gauge) {
+                value = change;
+            } else {
+                value += change;
+            }
+        }
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+void MetricSet::writePrometheus(QTextStream& out, const std::vector<std::pair<QString, const MetricSet*>>& labelledSets) {
+    // the samples of a metric have to follow each other, whatever set they come from
+    QMap<QString, std::vector<std::pair<QString, const Metric*>>> metricsByName;
+    for (const auto& labelledSet : labelledSets) {
+        for (const auto& metric : labelledSet.second->_metrics) {
+            auto& samples = metricsByName[metric.name];
+            if (samples.empty() || samples.front().second->type == metric.type) {
+                samples.emplace_back(labelledSet.first, &metric);
+            }
+        }
+    }
+
+    for (auto it = metricsByName.cbegin(); it != metricsByName.cend(); ++it) {
+        const QString& name = it.key();
+        const Metric* first = it.value().front().second;
+
+        static const char* TYPE_NAMES[] = { "counter", "gauge", "histogram" };
+        QString help = first->help;
+        out << "# HELP " << name << " " << help.replace('\\', "\\\\").replace('\n', "\\n") << "\n";
+        out << "# TYPE " << name << " " << TYPE_NAMES[(int)first->type] << "\n";
+
+        for (const auto& sample : it.value()) {
+            const QString& labels = sample.first;
+            const Metric* metric = sample.second;
+
+            if (metric->type == MetricRegistry::Type::Counter) {
+                out << name << "{" << labels << "} " << metric->values[0] << "\n";
+            } else if (metric->type == MetricRegistry::Type::Gauge) {
+                out << name << "{" << labels << "} " << doubleOf(metric->values[0]) << "\n";
+            } else {
+                QString separator = labels.isEmpty() ? "" : ",";
+                int64_t count = 0;
+                for (size_t i = 0; i < metric->bucketBounds.size(); ++i) {
+                    count += metric->values[i];
+                    out << name << "_bucket{" << labels << separator << "le=\"" << metric->bucketBounds[i] << "\"} "
+                        << count << "\n";
+                }
+                count += metric->values[metric->bucketBounds.size()];
+                out << name << "_bucket{" << labels << separator << "le=\"+Inf\"} " << count << "\n";
+                out << name << "_sum{" << labels << "} " << metric->values.back() << "\n";
+                out << name << "_count{" << labels << "} " << count << "\n";
+            }
+        }
+    }
+}
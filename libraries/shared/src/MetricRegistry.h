@@ -0,0 +1,144 @@
+//
+//  MetricRegistry.h
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MetricRegistry_h
+#define hifi_MetricRegistry_h
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QByteArray>
+#include <QString>
+#include <QTextStream>
+
+// Counters, gauges and histograms that any thread can update with a relaxed atomic, and that are shipped as binary
+// deltas to be read back by a MetricSet.
+//
+// A metric is registered once by name, usually into a static handle, and lives as long as the process:
+//
+//     static auto packetsReceived = MetricRegistry::getInstance().counter("audio_mixer_packets_received", "...");
+//     packetsReceived.increment();
+class MetricRegistry {
+public:
+    enum class Type : quint8 {
+        Counter,
+        Gauge,
+        Histogram
+    };
+
+    class Metric {
+    public:
+        Metric(const QString& name, const QString& help, Type type, const std::vector<int64_t>& bucketBounds,
+               size_t firstValue);
+
+        QString name;
+        QString help;
+        Type type;
+        std::vector<int64_t> bucketBounds;
+        size_t firstValue; // index of this metric's first value among all the values of the registry
+
+        // a counter has its count, a gauge the bits of its double and a histogram the count of each bucket,
+        // one more for the values above every bound, and then their sum
+        size_t numValues;
+        std::unique_ptr<std::atomic<int64_t>[]> values;
+    };
+
+    class Counter {
+    public:
+        Counter() {}
+        explicit Counter(Metric* metric) : _metric(metric) {}
+        void increment(int64_t amount = 1);
+        int64_t get() const;
+    private:
+        Metric* _metric { nullptr };
+    };
+
+    class Gauge {
+    public:
+        Gauge() {}
+        explicit Gauge(Metric* metric) : _metric(metric) {}
+        void set(double value);
+        double get() const;
+    private:
+        Metric* _metric { nullptr };
+    };
+
+    class Histogram {
+    public:
+        Histogram() {}
+        explicit Histogram(Metric* metric) : _metric(metric) {}
+        void record(int64_t value);
+    private:
+        Metric* _metric { nullptr };
+    };
+
+    // the state of one receiver of writeChanges, what it was last sent
+    class Encoder {
+    public:
+        void reset() { _numSentMetrics = 0; _sentValues.clear(); }
+    private:
+        friend class MetricRegistry;
+        size_t _numSentMetrics { 0 };
+        std::vector<int64_t> _sentValues;
+    };
+
+    static MetricRegistry& getInstance();
+
+    // names follow the Prometheus rules, registering an existing name returns the existing metric of that type
+    Counter counter(const QString& name, const QString& help);
+    Gauge gauge(const QString& name, const QString& help);
+    Histogram histogram(const QString& name, const QString& help, const std::vector<int64_t>& bucketBounds);
+
+    // writes the metrics registered and the values changed since the last call for this encoder,
+    // or everything after a reset of the encoder
+    QByteArray writeChanges(Encoder& encoder);
+
+    static bool isValidName(const QString& name);
+
+private:
+    Metric* registerMetric(const QString& name, const QString& help, Type type, const std::vector<int64_t>& bucketBounds);
+
+    std::mutex _mutex;
+    std::deque<Metric> _metrics; // a deque so that the handles stay valid as metrics are added
+    size_t _numValues { 0 };
+};
+
+// The metrics of one sender, as rebuilt from what its MetricRegistry wrote
+class MetricSet {
+public:
+    // returns false, and leaves the set empty, if the changes don't follow the ones read before.  Until the next full
+    // write is read the changes are then refused, the sender has to be asked to reset its encoder.
+    bool readChanges(const QByteArray& changes);
+
+    bool isEmpty() const { return _metrics.empty(); }
+    void clear() { _metrics.clear(); _isComplete = false; }
+
+    // writes the metrics of several sets in the Prometheus text format, the samples of each set with its labels
+    // (e.g. node_type="audio-mixer"), grouping the samples of a metric found in several sets
+    static void writePrometheus(QTextStream& out, const std::vector<std::pair<QString, const MetricSet*>>& labelledSets);
+
+private:
+    struct Metric {
+        QString name;
+        QString help;
+        MetricRegistry::Type type;
+        std::vector<int64_t> bucketBounds;
+        std::vector<int64_t> values;
+    };
+
+    std::vector<Metric> _metrics;
+    bool _isComplete { false }; // a full write was read, and every change since
+};
+
+#endif // hifi_MetricRegistry_h
@@ -133,6 +133,25 @@ quint64 usecTimestampNow(bool wantDebug) {
     return duration_cast<microseconds>(system_clock::now() - unixEpoch).count() + usecTimestampNowAdjust;
 }
 
+quint64 usecThreadCPUTimeNow() {
+#ifdef Q_OS_WIN
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return 0;
+    }
+    // in units of 100 nsecs
+    quint64 kernel = ((quint64)kernelTime.dwHighDateTime << 32) | kernelTime.dwLowDateTime;
+    quint64 user = ((quint64)userTime.dwHighDateTime << 32) | userTime.dwLowDateTime;
+    return (kernel + user) / 10;
+#else
+    timespec time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+        return 0;
+    }
+    return (quint64)time.tv_sec * USECS_PER_SECOND + (quint64)time.tv_nsec / NSECS_PER_USEC;
+#endif
+}
+
 float secTimestampNow() {
     static const auto START_TIME = usecTimestampNow();
     const auto nowUsecs = usecTimestampNow() - START_TIME;
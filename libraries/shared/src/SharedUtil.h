@@ -88,6 +88,9 @@ const QByteArray HIGH_FIDELITY_USER_AGENT = "Mozilla/5.0 (HighFidelityInterface)
 quint64 usecTimestampNow(bool wantDebug = false);
 void usecTimestampNowForceClockSkew(qint64 clockSkew);
 
+// the CPU time used by the calling thread, in usecs, or 0 where it isn't known
+quint64 usecThreadCPUTimeNow();
+
 inline bool afterUsecs(quint64& startUsecs, quint64 maxIntervalUecs) {
     auto now = usecTimestampNow();
     auto interval = now - startUsecs;
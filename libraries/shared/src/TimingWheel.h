@@ -0,0 +1,166 @@
+//
+//  TimingWheel.h
+//  libraries/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TimingWheel_h
+#define hifi_TimingWheel_h
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "SharedUtil.h"
+
+// A hierarchical timing wheel of items with deadlines, in usecs. Each advance only visits the items that are due, and
+// the items that cascade down from a coarser wheel, instead of every item.
+//
+// Deadlines are rounded to ticks of TICK_USECS, and an item is due in the tick of its deadline, so it can be due up to
+// one tick early. A deadline that moves later keeps the item where it is, to avoid churning the wheel when a deadline
+// is renewed often. So whoever advances the wheel checks the real deadline of each due item, and schedules it again
+// if it isn't due yet.
+//
+// The wheel holds weak pointers, and skips the items that are gone. It isn't thread safe.
+template <typename T>
+class TimingWheel {
+public:
+    using Pointer = std::shared_ptr<T>;
+
+    static const int TICK_BITS = 14; // 16.4 msecs
+    static const uint64_t TICK_USECS = 1ULL << TICK_BITS;
+
+    TimingWheel() { clear(); }
+
+    // schedules the item, or makes its deadline earlier
+    void schedule(const Pointer& item, uint64_t deadline) {
+        uint64_t tick = deadline >> TICK_BITS;
+        if (tick < _nextTick) {
+            tick = _nextTick;
+        }
+
+        auto itr = _scheduled.find(item.get());
+        if (itr != _scheduled.end()) {
+            if (itr->second <= tick) {
+                return;
+            }
+            // the entry at the later tick is stale now
+            itr->second = tick;
+        } else {
+            _scheduled[item.get()] = tick;
+        }
+        insert({ item, tick });
+        _numEntries++;
+    }
+
+    void remove(const Pointer& item) { _scheduled.erase(item.get()); }
+    bool contains(const Pointer& item) const { return _scheduled.find(item.get()) != _scheduled.end(); }
+
+    size_t size() const { return _scheduled.size(); }
+    bool empty() const { return _scheduled.empty(); }
+
+    void clear() {
+        _scheduled.clear();
+        if (_numEntries > 0) {
+            for (auto& wheel : _wheels) {
+                for (auto& slot : wheel) {
+                    slot.clear();
+                }
+            }
+            _numEntries = 0;
+        }
+        _nextTick = usecTimestampNow() >> TICK_BITS;
+    }
+
+    // Appends the items due by now to due, and removes them from the wheel. Returns the number of entries visited,
+    // including the stale ones and the ones cascaded to a finer wheel.
+    size_t advance(uint64_t now, std::vector<Pointer>& due) {
+        uint64_t lastTick = now >> TICK_BITS;
+        size_t visited = 0;
+        while (_nextTick <= lastTick && !_scheduled.empty()) {
+            uint64_t tick = _nextTick;
+            // cascade the coarser wheels whose slot starts at this tick, coarsest first
+            int level = 0;
+            while (level < NUM_LEVELS - 1 && (tick & (((uint64_t)1 << (SLOT_BITS * (level + 1))) - 1)) == 0) {
+                level++;
+            }
+            for (; level > 0; level--) {
+                visited += cascade(level, tick);
+            }
+
+            Slot slot;
+            slot.swap(_wheels[0][tick & SLOT_MASK]);
+            visited += slot.size();
+            _numEntries -= slot.size();
+            for (auto& entry : slot) {
+                Pointer item = entry.item.lock();
+                if (!item) {
+                    continue;
+                }
+                auto itr = _scheduled.find(item.get());
+                if (itr != _scheduled.end() && itr->second == entry.tick) {
+                    _scheduled.erase(itr);
+                    due.push_back(item);
+                }
+            }
+            _nextTick++;
+        }
+        if (_nextTick <= lastTick) {
+            // nothing is scheduled, so forget the stale entries rather than visit them
+            clear();
+            _nextTick = lastTick + 1;
+        }
+        return visited;
+    }
+
+private:
+    static const int SLOT_BITS = 8;
+    static const uint64_t NUM_SLOTS = 1ULL << SLOT_BITS;
+    static const uint64_t SLOT_MASK = NUM_SLOTS - 1;
+    static const int NUM_LEVELS = 4; // 2^32 ticks is over two years
+
+    struct Entry {
+        std::weak_ptr<T> item;
+        uint64_t tick;
+    };
+    using Slot = std::vector<Entry>;
+
+    void insert(Entry entry) {
+        uint64_t delta = entry.tick - _nextTick;
+        const uint64_t MAX_DELTA = (1ULL << (SLOT_BITS * NUM_LEVELS)) - 1;
+        uint64_t tick = entry.tick;
+        if (delta > MAX_DELTA) {
+            // too far to hold, so hold it as far as possible and it will cascade back to here
+            tick = _nextTick + MAX_DELTA;
+            delta = MAX_DELTA;
+        }
+        int level = 0;
+        while (level < NUM_LEVELS - 1 && delta >= (1ULL << (SLOT_BITS * (level + 1)))) {
+            level++;
+        }
+        _wheels[level][(tick >> (SLOT_BITS * level)) & SLOT_MASK].push_back(std::move(entry));
+    }
+
+    size_t cascade(int level, uint64_t tick) {
+        Slot slot;
+        slot.swap(_wheels[level][(tick >> (SLOT_BITS * level)) & SLOT_MASK]);
+        for (auto& entry : slot) {
+            insert(std::move(entry));
+        }
+        return slot.size();
+    }
+
+    std::array<std::array<Slot, NUM_SLOTS>, NUM_LEVELS> _wheels;
+    std::unordered_map<const T*, uint64_t> _scheduled; // the tick of the live entry of each item
+    size_t _numEntries { 0 }; // live and stale
+    uint64_t _nextTick { 0 }; // the ticks before this have been advanced past
+};
+
+#endif // hifi_TimingWheel_h
@@ -0,0 +1,358 @@
+//
+//  JointPacking_avx2.cpp
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifdef __AVX2__
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <immintrin.h>
+
+// the constants of packOrientationQuatToSixBytes, computed the same way so that the results match bit for bit
+static const float MAGNITUDE = 1.0f / sqrtf(2.0f);
+static const float RANGE = (float)((1 << 15) - 1);
+
+//
+// 8 joints per block, two blocks of 4 joints (24 bytes) in the two 128-bit lanes
+//
+
+static inline void packRotations8(const float* x, const float* y, const float* z, const float* w, uint8_t* destination) {
+    const __m256 SIGN = _mm256_set1_ps(-0.0f);
+
+    __m256 q0 = _mm256_loadu_ps(x);
+    __m256 q1 = _mm256_loadu_ps(y);
+    __m256 q2 = _mm256_loadu_ps(z);
+    __m256 q3 = _mm256_loadu_ps(w);
+
+    // find largest component, the first one on ties
+    __m256i largest = _mm256_setzero_si256();
+    __m256 largestValue = q0;
+    __m256 largestAbs = _mm256_andnot_ps(SIGN, q0);
+
+    __m256 a = _mm256_andnot_ps(SIGN, q1);
+    __m256 mask = _mm256_cmp_ps(a, largestAbs, _CMP_GT_OQ);
+    largest = _mm256_blendv_epi8(largest, _mm256_set1_epi32(1), _mm256_castps_si256(mask));
+    largestValue = _mm256_blendv_ps(largestValue, q1, mask);
+    largestAbs = _mm256_blendv_ps(largestAbs, a, mask);
+
+    a = _mm256_andnot_ps(SIGN, q2);
+    mask = _mm256_cmp_ps(a, largestAbs, _CMP_GT_OQ);
+    largest = _mm256_blendv_epi8(largest, _mm256_set1_epi32(2), _mm256_castps_si256(mask));
+    largestValue = _mm256_blendv_ps(largestValue, q2, mask);
+    largestAbs = _mm256_blendv_ps(largestAbs, a, mask);
+
+    a = _mm256_andnot_ps(SIGN, q3);
+    mask = _mm256_cmp_ps(a, largestAbs, _CMP_GT_OQ);
+    largest = _mm256_blendv_epi8(largest, _mm256_set1_epi32(3), _mm256_castps_si256(mask));
+    largestValue = _mm256_blendv_ps(largestValue, q3, mask);
+
+    // ensure that the sign of the dropped component is always negative
+    __m256 negate = _mm256_and_ps(_mm256_cmp_ps(largestValue, _mm256_setzero_ps(), _CMP_GT_OQ), SIGN);
+    q0 = _mm256_xor_ps(q0, negate);
+    q1 = _mm256_xor_ps(q1, negate);
+    q2 = _mm256_xor_ps(q2, negate);
+    q3 = _mm256_xor_ps(q3, negate);
+
+    // the smallest three components, in order
+    __m256 isFirst = _mm256_castsi256_ps(_mm256_cmpeq_epi32(largest, _mm256_setzero_si256()));
+    __m256 isFirstTwo = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(2), largest));
+    __m256 isFirstThree = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(3), largest));
+    __m256 s0 = _mm256_blendv_ps(q0, q1, isFirst);
+    __m256 s1 = _mm256_blendv_ps(q1, q2, isFirstTwo);
+    __m256 s2 = _mm256_blendv_ps(q2, q3, isFirstThree);
+
+    // quantize the smallest three components into integers
+    const __m256 magnitude = _mm256_set1_ps(MAGNITUDE);
+    const __m256 twoMagnitude = _mm256_set1_ps(2.0f * MAGNITUDE);
+    const __m256 range = _mm256_set1_ps(RANGE);
+    __m256i c0 = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_div_ps(_mm256_add_ps(s0, magnitude), twoMagnitude), range));
+    __m256i c1 = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_div_ps(_mm256_add_ps(s1, magnitude), twoMagnitude), range));
+    __m256i c2 = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_div_ps(_mm256_add_ps(s2, magnitude), twoMagnitude), range));
+
+    // encode the largest component into the high bits of the first two components
+    const __m256i LOW_15_BITS = _mm256_set1_epi32(0x7fff);
+    c0 = _mm256_or_si256(_mm256_and_si256(c0, LOW_15_BITS),
+                         _mm256_slli_epi32(_mm256_and_si256(largest, _mm256_set1_epi32(0x01)), 15));
+    c1 = _mm256_or_si256(_mm256_and_si256(c1, LOW_15_BITS),
+                         _mm256_slli_epi32(_mm256_and_si256(largest, _mm256_set1_epi32(0x02)), 14));
+    c2 = _mm256_and_si256(c2, _mm256_set1_epi32(0xffff));
+
+    // interleave to 6 big-endian bytes per joint
+    __m256i c01 = _mm256_packus_epi32(c0, c1);  // c0[0..3] c1[0..3] per lane
+    __m256i c22 = _mm256_packus_epi32(c2, c2);  // c2[0..3] c2[0..3] per lane
+
+    __m256i head = _mm256_or_si256(
+        _mm256_shuffle_epi8(c01, _mm256_setr_epi8(1,0, 9,8, -1,-1, 3,2, 11,10, -1,-1, 5,4, 13,12,
+                                                  1,0, 9,8, -1,-1, 3,2, 11,10, -1,-1, 5,4, 13,12)),
+        _mm256_shuffle_epi8(c22, _mm256_setr_epi8(-1,-1, -1,-1, 1,0, -1,-1, -1,-1, 3,2, -1,-1, -1,-1,
+                                                  -1,-1, -1,-1, 1,0, -1,-1, -1,-1, 3,2, -1,-1, -1,-1)));
+    __m256i tail = _mm256_or_si256(
+        _mm256_shuffle_epi8(c01, _mm256_setr_epi8(-1,-1, 7,6, 15,14, -1,-1, -1,-1,-1,-1,-1,-1,-1,-1,
+                                                  -1,-1, 7,6, 15,14, -1,-1, -1,-1,-1,-1,-1,-1,-1,-1)),
+        _mm256_shuffle_epi8(c22, _mm256_setr_epi8(5,4, -1,-1, -1,-1, 7,6, -1,-1,-1,-1,-1,-1,-1,-1,
+                                                  5,4, -1,-1, -1,-1, 7,6, -1,-1,-1,-1,-1,-1,-1,-1)));
+
+    _mm_storeu_si128((__m128i*)(destination + 0), _mm256_castsi256_si128(head));
+    _mm_storel_epi64((__m128i*)(destination + 16), _mm256_castsi256_si128(tail));
+    _mm_storeu_si128((__m128i*)(destination + 24), _mm256_extracti128_si256(head, 1));
+    _mm_storel_epi64((__m128i*)(destination + 40), _mm256_extracti128_si256(tail, 1));
+}
+
+static inline void unpackRotations8(const uint8_t* source, float* x, float* y, float* z, float* w) {
+    // bytes 0..15 and 8..23 of each block of 4 joints
+    __m256i head = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(source + 0))),
+                                           _mm_loadu_si128((const __m128i*)(source + 24)), 1);
+    __m256i tail = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(source + 8))),
+                                           _mm_loadu_si128((const __m128i*)(source + 32)), 1);
+
+    // deinterleave the big-endian components
+    __m256i c0 = _mm256_or_si256(
+        _mm256_shuffle_epi8(head, _mm256_setr_epi8(1,0,-1,-1, 7,6,-1,-1, 13,12,-1,-1, -1,-1,-1,-1,
+                                                   1,0,-1,-1, 7,6,-1,-1, 13,12,-1,-1, -1,-1,-1,-1)),
+        _mm256_shuffle_epi8(tail, _mm256_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, 11,10,-1,-1,
+                                                   -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, 11,10,-1,-1)));
+    __m256i c1 = _mm256_or_si256(
+        _mm256_shuffle_epi8(head, _mm256_setr_epi8(3,2,-1,-1, 9,8,-1,-1, 15,14,-1,-1, -1,-1,-1,-1,
+                                                   3,2,-1,-1, 9,8,-1,-1, 15,14,-1,-1, -1,-1,-1,-1)),
+        _mm256_shuffle_epi8(tail, _mm256_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, 13,12,-1,-1,
+                                                   -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, 13,12,-1,-1)));
+    __m256i c2 = _mm256_or_si256(
+        _mm256_shuffle_epi8(head, _mm256_setr_epi8(5,4,-1,-1, 11,10,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1,
+                                                   5,4,-1,-1, 11,10,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1)),
+        _mm256_shuffle_epi8(tail, _mm256_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, 9,8,-1,-1, 15,14,-1,-1,
+                                                   -1,-1,-1,-1, -1,-1,-1,-1, 9,8,-1,-1, 15,14,-1,-1)));
+
+    // largestComponent is encoded into the highest bits of the first 2 components
+    __m256i largest = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(c0, 15), _mm256_set1_epi32(0x01)),
+                                      _mm256_and_si256(_mm256_srli_epi32(c1, 14), _mm256_set1_epi32(0x02)));
+
+    const __m256i LOW_15_BITS = _mm256_set1_epi32(0x7fff);
+    const __m256 magnitude = _mm256_set1_ps(MAGNITUDE);
+    const __m256 twoMagnitude = _mm256_set1_ps(2.0f * MAGNITUDE);
+    const __m256 range = _mm256_set1_ps(RANGE);
+    __m256 f0 = _mm256_cvtepi32_ps(_mm256_and_si256(c0, LOW_15_BITS));
+    __m256 f1 = _mm256_cvtepi32_ps(_mm256_and_si256(c1, LOW_15_BITS));
+    __m256 f2 = _mm256_cvtepi32_ps(_mm256_and_si256(c2, LOW_15_BITS));
+    f0 = _mm256_sub_ps(_mm256_mul_ps(_mm256_div_ps(f0, range), twoMagnitude), magnitude);
+    f1 = _mm256_sub_ps(_mm256_mul_ps(_mm256_div_ps(f1, range), twoMagnitude), magnitude);
+    f2 = _mm256_sub_ps(_mm256_mul_ps(_mm256_div_ps(f2, range), twoMagnitude), magnitude);
+
+    // missing component is always negative
+    __m256 missing = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(f0, f0));
+    missing = _mm256_sub_ps(missing, _mm256_mul_ps(f1, f1));
+    missing = _mm256_sub_ps(missing, _mm256_mul_ps(f2, f2));
+    missing = _mm256_xor_ps(_mm256_sqrt_ps(missing), _mm256_set1_ps(-0.0f));
+
+    // put the missing component back in place
+    __m256 is0 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(largest, _mm256_set1_epi32(0)));
+    __m256 is1 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(largest, _mm256_set1_epi32(1)));
+    __m256 is2 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(largest, _mm256_set1_epi32(2)));
+    __m256 is3 = _mm256_castsi256_ps(_mm256_cmpeq_epi32(largest, _mm256_set1_epi32(3)));
+    __m256 isFirstTwo = _mm256_or_ps(is0, is1);
+
+    _mm256_storeu_ps(x, _mm256_blendv_ps(f0, missing, is0));
+    _mm256_storeu_ps(y, _mm256_blendv_ps(_mm256_blendv_ps(f1, missing, is1), f0, is0));
+    _mm256_storeu_ps(z, _mm256_blendv_ps(_mm256_blendv_ps(f2, missing, is2), f1, isFirstTwo));
+    _mm256_storeu_ps(w, _mm256_blendv_ps(f2, missing, is3));
+}
+
+static inline void packTranslations8(const float* x, const float* y, const float* z, __m256 scale, __m256 fraction,
+                                     uint8_t* destination) {
+    const __m256 MIN = _mm256_set1_ps((float)INT16_MIN);
+    const __m256 MAX = _mm256_set1_ps((float)INT16_MAX);
+
+    __m256i tx = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_div_ps(_mm256_loadu_ps(x), scale), fraction), MIN), MAX));
+    __m256i ty = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_div_ps(_mm256_loadu_ps(y), scale), fraction), MIN), MAX));
+    __m256i tz = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_div_ps(_mm256_loadu_ps(z), scale), fraction), MIN), MAX));
+
+    // interleave to 6 little-endian bytes per joint
+    __m256i txy = _mm256_packs_epi32(tx, ty);   // x[0..3] y[0..3] per lane
+    __m256i tzz = _mm256_packs_epi32(tz, tz);   // z[0..3] z[0..3] per lane
+
+    __m256i head = _mm256_or_si256(
+        _mm256_shuffle_epi8(txy, _mm256_setr_epi8(0,1, 8,9, -1,-1, 2,3, 10,11, -1,-1, 4,5, 12,13,
+                                                  0,1, 8,9, -1,-1, 2,3, 10,11, -1,-1, 4,5, 12,13)),
+        _mm256_shuffle_epi8(tzz, _mm256_setr_epi8(-1,-1, -1,-1, 0,1, -1,-1, -1,-1, 2,3, -1,-1, -1,-1,
+                                                  -1,-1, -1,-1, 0,1, -1,-1, -1,-1, 2,3, -1,-1, -1,-1)));
+    __m256i tail = _mm256_or_si256(
+        _mm256_shuffle_epi8(txy, _mm256_setr_epi8(-1,-1, 6,7, 14,15, -1,-1, -1,-1,-1,-1,-1,-1,-1,-1,
+                                                  -1,-1, 6,7, 14,15, -1,-1, -1,-1,-1,-1,-1,-1,-1,-1)),
+        _mm256_shuffle_epi8(tzz, _mm256_setr_epi8(4,5, -1,-1, -1,-1, 6,7, -1,-1,-1,-1,-1,-1,-1,-1,
+                                                  4,5, -1,-1, -1,-1, 6,7, -1,-1,-1,-1,-1,-1,-1,-1)));
+
+    _mm_storeu_si128((__m128i*)(destination + 0), _mm256_castsi256_si128(head));
+    _mm_storel_epi64((__m128i*)(destination + 16), _mm256_castsi256_si128(tail));
+    _mm_storeu_si128((__m128i*)(destination + 24), _mm256_extracti128_si256(head, 1));
+    _mm_storel_epi64((__m128i*)(destination + 40), _mm256_extracti128_si256(tail, 1));
+}
+
+static inline void unpackTranslations8(const uint8_t* source, __m256 scale, __m256 fraction, float* x, float* y, float* z) {
+    __m256i head = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(source + 0))),
+                                           _mm_loadu_si128((const __m128i*)(source + 24)), 1);
+    __m256i tail = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(source + 8))),
+                                           _mm_loadu_si128((const __m128i*)(source + 32)), 1);
+
+    // deinterleave into the high halves, then sign extend
+    __m256i tx = _mm256_or_si256(
+        _mm256_shuffle_epi8(head, _mm256_setr_epi8(-1,-1,0,1, -1,-1,6,7, -1,-1,12,13, -1,-1,-1,-1,
+                                                   -1,-1,0,1, -1,-1,6,7, -1,-1,12,13, -1,-1,-1,-1)),
+        _mm256_shuffle_epi8(tail, _mm256_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,10,11,
+                                                   -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,10,11)));
+    __m256i ty = _mm256_or_si256(
+        _mm256_shuffle_epi8(head, _mm256_setr_epi8(-1,-1,2,3, -1,-1,8,9, -1,-1,14,15, -1,-1,-1,-1,
+                                                   -1,-1,2,3, -1,-1,8,9, -1,-1,14,15, -1,-1,-1,-1)),
+        _mm256_shuffle_epi8(tail, _mm256_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,12,13,
+                                                   -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,12,13)));
+    __m256i tz = _mm256_or_si256(
+        _mm256_shuffle_epi8(head, _mm256_setr_epi8(-1,-1,4,5, -1,-1,10,11, -1,-1,-1,-1, -1,-1,-1,-1,
+                                                   -1,-1,4,5, -1,-1,10,11, -1,-1,-1,-1, -1,-1,-1,-1)),
+        _mm256_shuffle_epi8(tail, _mm256_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,8,9, -1,-1,14,15,
+                                                   -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,8,9, -1,-1,14,15)));
+
+    __m256 fx = _mm256_cvtepi32_ps(_mm256_srai_epi32(tx, 16));
+    __m256 fy = _mm256_cvtepi32_ps(_mm256_srai_epi32(ty, 16));
+    __m256 fz = _mm256_cvtepi32_ps(_mm256_srai_epi32(tz, 16));
+
+    _mm256_storeu_ps(x, _mm256_mul_ps(_mm256_div_ps(fx, fraction), scale));
+    _mm256_storeu_ps(y, _mm256_mul_ps(_mm256_div_ps(fy, fraction), scale));
+    _mm256_storeu_ps(z, _mm256_mul_ps(_mm256_div_ps(fz, fraction), scale));
+}
+
+void packRotations_AVX2(const float* x, const float* y, const float* z, const float* w, uint8_t* destination, int count) {
+    int i = 0;
+    for (; i < count - 7; i += 8) {
+        packRotations8(x + i, y + i, z + i, w + i, destination + 6 * i);
+    }
+
+    // the remaining joints through a padded block
+    if (i < count) {
+        int remaining = count - i;
+        float q[4][8] = {};
+        uint8_t packed[6 * 8];
+        memcpy(q[0], x + i, remaining * sizeof(float));
+        memcpy(q[1], y + i, remaining * sizeof(float));
+        memcpy(q[2], z + i, remaining * sizeof(float));
+        memcpy(q[3], w + i, remaining * sizeof(float));
+        packRotations8(q[0], q[1], q[2], q[3], packed);
+        memcpy(destination + 6 * i, packed, 6 * remaining);
+    }
+}
+
+void unpackRotations_AVX2(const uint8_t* source, float* x, float* y, float* z, float* w, int count) {
+    int i = 0;
+    for (; i < count - 7; i += 8) {
+        unpackRotations8(source + 6 * i, x + i, y + i, z + i, w + i);
+    }
+
+    if (i < count) {
+        int remaining = count - i;
+        uint8_t packed[6 * 8] = {};
+        float q[4][8];
+        memcpy(packed, source + 6 * i, 6 * remaining);
+        unpackRotations8(packed, q[0], q[1], q[2], q[3]);
+        memcpy(x + i, q[0], remaining * sizeof(float));
+        memcpy(y + i, q[1], remaining * sizeof(float));
+        memcpy(z + i, q[2], remaining * sizeof(float));
+        memcpy(w + i, q[3], remaining * sizeof(float));
+    }
+}
+
+void packTranslations_AVX2(const float* x, const float* y, const float* z, float scale, int radix,
+                           uint8_t* destination, int count) {
+    __m256 scales = _mm256_set1_ps(scale);
+    __m256 fraction = _mm256_set1_ps((float)(1 << radix));
+
+    int i = 0;
+    for (; i < count - 7; i += 8) {
+        packTranslations8(x + i, y + i, z + i, scales, fraction, destination + 6 * i);
+    }
+
+    if (i < count) {
+        int remaining = count - i;
+        float t[3][8] = {};
+        uint8_t packed[6 * 8];
+        memcpy(t[0], x + i, remaining * sizeof(float));
+        memcpy(t[1], y + i, remaining * sizeof(float));
+        memcpy(t[2], z + i, remaining * sizeof(float));
+        packTranslations8(t[0], t[1], t[2], scales, fraction, packed);
+        memcpy(destination + 6 * i, packed, 6 * remaining);
+    }
+}
+
+void unpackTranslations_AVX2(const uint8_t* source, float scale, int radix, float* x, float* y, float* z, int count) {
+    __m256 scales = _mm256_set1_ps(scale);
+    __m256 fraction = _mm256_set1_ps((float)(1 << radix));
+
+    int i = 0;
+    for (; i < count - 7; i += 8) {
+        unpackTranslations8(source + 6 * i, scales, fraction, x + i, y + i, z + i);
+    }
+
+    if (i < count) {
+        int remaining = count - i;
+        uint8_t packed[6 * 8] = {};
+        float t[3][8];
+        memcpy(packed, source + 6 * i, 6 * remaining);
+        unpackTranslations8(packed, scales, fraction, t[0], t[1], t[2]);
+        memcpy(x + i, t[0], remaining * sizeof(float));
+        memcpy(y + i, t[1], remaining * sizeof(float));
+        memcpy(z + i, t[2], remaining * sizeof(float));
+    }
+}
+
+void packValidityBits_AVX2(const uint8_t* flags, int count, uint8_t* bits) {
+    int i = 0;
+    for (; i < count - 31; i += 32) {
+        __m256i isZero = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(flags + i)), _mm256_setzero_si256());
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(isZero);
+        memcpy(bits + i / 8, &mask, sizeof(mask));     // little-endian, flag i in the low bit
+    }
+
+    if (i < count) {
+        memset(bits + i / 8, 0, (count - i + 7) / 8);
+        for (; i < count; i++) {
+            if (flags[i]) {
+                bits[i / 8] |= 1 << (i % 8);
+            }
+        }
+    }
+}
+
+int unpackValidityBits_AVX2(const uint8_t* bits, int count, uint8_t* flags) {
+    // byte i of a block takes bit i % 8 of byte i / 8
+    const __m256i SPREAD = _mm256_setr_epi8(0,0,0,0,0,0,0,0, 1,1,1,1,1,1,1,1, 2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3);
+    const __m256i BITS = _mm256_setr_epi8(1,2,4,8,16,32,64,-128, 1,2,4,8,16,32,64,-128,
+                                          1,2,4,8,16,32,64,-128, 1,2,4,8,16,32,64,-128);
+    const __m256i ONE = _mm256_set1_epi8(1);
+    __m256i sums = _mm256_setzero_si256();
+
+    int i = 0;
+    for (; i < count - 31; i += 32) {
+        uint32_t mask;
+        memcpy(&mask, bits + i / 8, sizeof(mask));
+
+        // the shuffle stays within 128-bit lanes, each of which has the 4 bytes of the mask
+        __m256i spread = _mm256_shuffle_epi8(_mm256_set1_epi32((int)mask), SPREAD);
+        __m256i set = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(spread, BITS), BITS), ONE);
+        _mm256_storeu_si256((__m256i*)(flags + i), set);
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(set, _mm256_setzero_si256()));
+    }
+
+    int numSet = _mm256_extract_epi32(sums, 0) + _mm256_extract_epi32(sums, 2) +
+                 _mm256_extract_epi32(sums, 4) + _mm256_extract_epi32(sums, 6);
+
+    for (; i < count; i++) {
+        flags[i] = (bits[i / 8] >> (i % 8)) & 1;
+        numSet += flags[i];
+    }
+    return numSet;
+}
+
+#endif
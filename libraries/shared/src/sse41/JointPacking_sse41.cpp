@@ -0,0 +1,325 @@
+//
+//  JointPacking_sse41.cpp
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64)))
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <smmintrin.h>
+
+// the constants of packOrientationQuatToSixBytes, computed the same way so that the results match bit for bit
+static const float MAGNITUDE = 1.0f / sqrtf(2.0f);
+static const float RANGE = (float)((1 << 15) - 1);
+
+//
+// 4 joints (24 bytes) per block
+//
+
+static inline void packRotations4(const float* x, const float* y, const float* z, const float* w, uint8_t* destination) {
+    const __m128 SIGN = _mm_set1_ps(-0.0f);
+
+    __m128 q0 = _mm_loadu_ps(x);
+    __m128 q1 = _mm_loadu_ps(y);
+    __m128 q2 = _mm_loadu_ps(z);
+    __m128 q3 = _mm_loadu_ps(w);
+
+    // find largest component, the first one on ties
+    __m128i largest = _mm_setzero_si128();
+    __m128 largestValue = q0;
+    __m128 largestAbs = _mm_andnot_ps(SIGN, q0);
+
+    __m128 a = _mm_andnot_ps(SIGN, q1);
+    __m128 mask = _mm_cmpgt_ps(a, largestAbs);
+    largest = _mm_blendv_epi8(largest, _mm_set1_epi32(1), _mm_castps_si128(mask));
+    largestValue = _mm_blendv_ps(largestValue, q1, mask);
+    largestAbs = _mm_blendv_ps(largestAbs, a, mask);
+
+    a = _mm_andnot_ps(SIGN, q2);
+    mask = _mm_cmpgt_ps(a, largestAbs);
+    largest = _mm_blendv_epi8(largest, _mm_set1_epi32(2), _mm_castps_si128(mask));
+    largestValue = _mm_blendv_ps(largestValue, q2, mask);
+    largestAbs = _mm_blendv_ps(largestAbs, a, mask);
+
+    a = _mm_andnot_ps(SIGN, q3);
+    mask = _mm_cmpgt_ps(a, largestAbs);
+    largest = _mm_blendv_epi8(largest, _mm_set1_epi32(3), _mm_castps_si128(mask));
+    largestValue = _mm_blendv_ps(largestValue, q3, mask);
+
+    // ensure that the sign of the dropped component is always negative
+    __m128 negate = _mm_and_ps(_mm_cmpgt_ps(largestValue, _mm_setzero_ps()), SIGN);
+    q0 = _mm_xor_ps(q0, negate);
+    q1 = _mm_xor_ps(q1, negate);
+    q2 = _mm_xor_ps(q2, negate);
+    q3 = _mm_xor_ps(q3, negate);
+
+    // the smallest three components, in order
+    __m128 isFirst = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_setzero_si128()));
+    __m128 isFirstTwo = _mm_castsi128_ps(_mm_cmplt_epi32(largest, _mm_set1_epi32(2)));
+    __m128 isFirstThree = _mm_castsi128_ps(_mm_cmplt_epi32(largest, _mm_set1_epi32(3)));
+    __m128 s0 = _mm_blendv_ps(q0, q1, isFirst);
+    __m128 s1 = _mm_blendv_ps(q1, q2, isFirstTwo);
+    __m128 s2 = _mm_blendv_ps(q2, q3, isFirstThree);
+
+    // quantize the smallest three components into integers
+    const __m128 magnitude = _mm_set1_ps(MAGNITUDE);
+    const __m128 twoMagnitude = _mm_set1_ps(2.0f * MAGNITUDE);
+    const __m128 range = _mm_set1_ps(RANGE);
+    __m128i c0 = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(s0, magnitude), twoMagnitude), range));
+    __m128i c1 = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(s1, magnitude), twoMagnitude), range));
+    __m128i c2 = _mm_cvttps_epi32(_mm_mul_ps(_mm_div_ps(_mm_add_ps(s2, magnitude), twoMagnitude), range));
+
+    // encode the largest component into the high bits of the first two components
+    const __m128i LOW_15_BITS = _mm_set1_epi32(0x7fff);
+    c0 = _mm_or_si128(_mm_and_si128(c0, LOW_15_BITS), _mm_slli_epi32(_mm_and_si128(largest, _mm_set1_epi32(0x01)), 15));
+    c1 = _mm_or_si128(_mm_and_si128(c1, LOW_15_BITS), _mm_slli_epi32(_mm_and_si128(largest, _mm_set1_epi32(0x02)), 14));
+    c2 = _mm_and_si128(c2, _mm_set1_epi32(0xffff));
+
+    // interleave to 6 big-endian bytes per joint
+    __m128i c01 = _mm_packus_epi32(c0, c1);     // c0[0..3] c1[0..3]
+    __m128i c22 = _mm_packus_epi32(c2, c2);     // c2[0..3] c2[0..3]
+
+    __m128i head = _mm_or_si128(
+        _mm_shuffle_epi8(c01, _mm_setr_epi8(1,0, 9,8, -1,-1, 3,2, 11,10, -1,-1, 5,4, 13,12)),
+        _mm_shuffle_epi8(c22, _mm_setr_epi8(-1,-1, -1,-1, 1,0, -1,-1, -1,-1, 3,2, -1,-1, -1,-1)));
+    __m128i tail = _mm_or_si128(
+        _mm_shuffle_epi8(c01, _mm_setr_epi8(-1,-1, 7,6, 15,14, -1,-1, -1,-1,-1,-1,-1,-1,-1,-1)),
+        _mm_shuffle_epi8(c22, _mm_setr_epi8(5,4, -1,-1, -1,-1, 7,6, -1,-1,-1,-1,-1,-1,-1,-1)));
+
+    _mm_storeu_si128((__m128i*)(destination + 0), head);
+    _mm_storel_epi64((__m128i*)(destination + 16), tail);
+}
+
+static inline void unpackRotations4(const uint8_t* source, float* x, float* y, float* z, float* w) {
+    // bytes 0..15 and 8..23 of the block
+    __m128i head = _mm_loadu_si128((const __m128i*)(source + 0));
+    __m128i tail = _mm_loadu_si128((const __m128i*)(source + 8));
+
+    // deinterleave the big-endian components
+    __m128i c0 = _mm_or_si128(
+        _mm_shuffle_epi8(head, _mm_setr_epi8(1,0,-1,-1, 7,6,-1,-1, 13,12,-1,-1, -1,-1,-1,-1)),
+        _mm_shuffle_epi8(tail, _mm_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, 11,10,-1,-1)));
+    __m128i c1 = _mm_or_si128(
+        _mm_shuffle_epi8(head, _mm_setr_epi8(3,2,-1,-1, 9,8,-1,-1, 15,14,-1,-1, -1,-1,-1,-1)),
+        _mm_shuffle_epi8(tail, _mm_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, 13,12,-1,-1)));
+    __m128i c2 = _mm_or_si128(
+        _mm_shuffle_epi8(head, _mm_setr_epi8(5,4,-1,-1, 11,10,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1)),
+        _mm_shuffle_epi8(tail, _mm_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, 9,8,-1,-1, 15,14,-1,-1)));
+
+    // largestComponent is encoded into the highest bits of the first 2 components
+    __m128i largest = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(c0, 15), _mm_set1_epi32(0x01)),
+                                   _mm_and_si128(_mm_srli_epi32(c1, 14), _mm_set1_epi32(0x02)));
+
+    const __m128i LOW_15_BITS = _mm_set1_epi32(0x7fff);
+    const __m128 magnitude = _mm_set1_ps(MAGNITUDE);
+    const __m128 twoMagnitude = _mm_set1_ps(2.0f * MAGNITUDE);
+    const __m128 range = _mm_set1_ps(RANGE);
+    __m128 f0 = _mm_cvtepi32_ps(_mm_and_si128(c0, LOW_15_BITS));
+    __m128 f1 = _mm_cvtepi32_ps(_mm_and_si128(c1, LOW_15_BITS));
+    __m128 f2 = _mm_cvtepi32_ps(_mm_and_si128(c2, LOW_15_BITS));
+    f0 = _mm_sub_ps(_mm_mul_ps(_mm_div_ps(f0, range), twoMagnitude), magnitude);
+    f1 = _mm_sub_ps(_mm_mul_ps(_mm_div_ps(f1, range), twoMagnitude), magnitude);
+    f2 = _mm_sub_ps(_mm_mul_ps(_mm_div_ps(f2, range), twoMagnitude), magnitude);
+
+    // missing component is always negative
+    __m128 missing = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(f0, f0));
+    missing = _mm_sub_ps(missing, _mm_mul_ps(f1, f1));
+    missing = _mm_sub_ps(missing, _mm_mul_ps(f2, f2));
+    missing = _mm_xor_ps(_mm_sqrt_ps(missing), _mm_set1_ps(-0.0f));
+
+    // put the missing component back in place
+    __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(0)));
+    __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(1)));
+    __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(2)));
+    __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(3)));
+    __m128 isFirstTwo = _mm_or_ps(is0, is1);
+
+    _mm_storeu_ps(x, _mm_blendv_ps(f0, missing, is0));
+    _mm_storeu_ps(y, _mm_blendv_ps(_mm_blendv_ps(f1, missing, is1), f0, is0));
+    _mm_storeu_ps(z, _mm_blendv_ps(_mm_blendv_ps(f2, missing, is2), f1, isFirstTwo));
+    _mm_storeu_ps(w, _mm_blendv_ps(f2, missing, is3));
+}
+
+static inline void packTranslations4(const float* x, const float* y, const float* z, __m128 scale, __m128 fraction,
+                                     uint8_t* destination) {
+    const __m128 MIN = _mm_set1_ps((float)INT16_MIN);
+    const __m128 MAX = _mm_set1_ps((float)INT16_MAX);
+
+    __m128i tx = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_div_ps(_mm_loadu_ps(x), scale), fraction), MIN), MAX));
+    __m128i ty = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_div_ps(_mm_loadu_ps(y), scale), fraction), MIN), MAX));
+    __m128i tz = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_div_ps(_mm_loadu_ps(z), scale), fraction), MIN), MAX));
+
+    // interleave to 6 little-endian bytes per joint
+    __m128i txy = _mm_packs_epi32(tx, ty);      // x[0..3] y[0..3]
+    __m128i tzz = _mm_packs_epi32(tz, tz);      // z[0..3] z[0..3]
+
+    __m128i head = _mm_or_si128(
+        _mm_shuffle_epi8(txy, _mm_setr_epi8(0,1, 8,9, -1,-1, 2,3, 10,11, -1,-1, 4,5, 12,13)),
+        _mm_shuffle_epi8(tzz, _mm_setr_epi8(-1,-1, -1,-1, 0,1, -1,-1, -1,-1, 2,3, -1,-1, -1,-1)));
+    __m128i tail = _mm_or_si128(
+        _mm_shuffle_epi8(txy, _mm_setr_epi8(-1,-1, 6,7, 14,15, -1,-1, -1,-1,-1,-1,-1,-1,-1,-1)),
+        _mm_shuffle_epi8(tzz, _mm_setr_epi8(4,5, -1,-1, -1,-1, 6,7, -1,-1,-1,-1,-1,-1,-1,-1)));
+
+    _mm_storeu_si128((__m128i*)(destination + 0), head);
+    _mm_storel_epi64((__m128i*)(destination + 16), tail);
+}
+
+static inline void unpackTranslations4(const uint8_t* source, __m128 scale, __m128 fraction, float* x, float* y, float* z) {
+    __m128i head = _mm_loadu_si128((const __m128i*)(source + 0));
+    __m128i tail = _mm_loadu_si128((const __m128i*)(source + 8));
+
+    // deinterleave into the high halves, then sign extend
+    __m128i tx = _mm_or_si128(
+        _mm_shuffle_epi8(head, _mm_setr_epi8(-1,-1,0,1, -1,-1,6,7, -1,-1,12,13, -1,-1,-1,-1)),
+        _mm_shuffle_epi8(tail, _mm_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,10,11)));
+    __m128i ty = _mm_or_si128(
+        _mm_shuffle_epi8(head, _mm_setr_epi8(-1,-1,2,3, -1,-1,8,9, -1,-1,14,15, -1,-1,-1,-1)),
+        _mm_shuffle_epi8(tail, _mm_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,-1,-1, -1,-1,12,13)));
+    __m128i tz = _mm_or_si128(
+        _mm_shuffle_epi8(head, _mm_setr_epi8(-1,-1,4,5, -1,-1,10,11, -1,-1,-1,-1, -1,-1,-1,-1)),
+        _mm_shuffle_epi8(tail, _mm_setr_epi8(-1,-1,-1,-1, -1,-1,-1,-1, -1,-1,8,9, -1,-1,14,15)));
+
+    __m128 fx = _mm_cvtepi32_ps(_mm_srai_epi32(tx, 16));
+    __m128 fy = _mm_cvtepi32_ps(_mm_srai_epi32(ty, 16));
+    __m128 fz = _mm_cvtepi32_ps(_mm_srai_epi32(tz, 16));
+
+    _mm_storeu_ps(x, _mm_mul_ps(_mm_div_ps(fx, fraction), scale));
+    _mm_storeu_ps(y, _mm_mul_ps(_mm_div_ps(fy, fraction), scale));
+    _mm_storeu_ps(z, _mm_mul_ps(_mm_div_ps(fz, fraction), scale));
+}
+
+void packRotations_SSE41(const float* x, const float* y, const float* z, const float* w, uint8_t* destination, int count) {
+    int i = 0;
+    for (; i < count - 3; i += 4) {
+        packRotations4(x + i, y + i, z + i, w + i, destination + 6 * i);
+    }
+
+    // the remaining joints through a padded block
+    if (i < count) {
+        int remaining = count - i;
+        float q[4][4] = {};
+        uint8_t packed[6 * 4];
+        memcpy(q[0], x + i, remaining * sizeof(float));
+        memcpy(q[1], y + i, remaining * sizeof(float));
+        memcpy(q[2], z + i, remaining * sizeof(float));
+        memcpy(q[3], w + i, remaining * sizeof(float));
+        packRotations4(q[0], q[1], q[2], q[3], packed);
+        memcpy(destination + 6 * i, packed, 6 * remaining);
+    }
+}
+
+void unpackRotations_SSE41(const uint8_t* source, float* x, float* y, float* z, float* w, int count) {
+    int i = 0;
+    for (; i < count - 3; i += 4) {
+        unpackRotations4(source + 6 * i, x + i, y + i, z + i, w + i);
+    }
+
+    if (i < count) {
+        int remaining = count - i;
+        uint8_t packed[6 * 4] = {};
+        float q[4][4];
+        memcpy(packed, source + 6 * i, 6 * remaining);
+        unpackRotations4(packed, q[0], q[1], q[2], q[3]);
+        memcpy(x + i, q[0], remaining * sizeof(float));
+        memcpy(y + i, q[1], remaining * sizeof(float));
+        memcpy(z + i, q[2], remaining * sizeof(float));
+        memcpy(w + i, q[3], remaining * sizeof(float));
+    }
+}
+
+void packTranslations_SSE41(const float* x, const float* y, const float* z, float scale, int radix,
+                            uint8_t* destination, int count) {
+    __m128 scales = _mm_set1_ps(scale);
+    __m128 fraction = _mm_set1_ps((float)(1 << radix));
+
+    int i = 0;
+    for (; i < count - 3; i += 4) {
+        packTranslations4(x + i, y + i, z + i, scales, fraction, destination + 6 * i);
+    }
+
+    if (i < count) {
+        int remaining = count - i;
+        float t[3][4] = {};
+        uint8_t packed[6 * 4];
+        memcpy(t[0], x + i, remaining * sizeof(float));
+        memcpy(t[1], y + i, remaining * sizeof(float));
+        memcpy(t[2], z + i, remaining * sizeof(float));
+        packTranslations4(t[0], t[1], t[2], scales, fraction, packed);
+        memcpy(destination + 6 * i, packed, 6 * remaining);
+    }
+}
+
+void unpackTranslations_SSE41(const uint8_t* source, float scale, int radix, float* x, float* y, float* z, int count) {
+    __m128 scales = _mm_set1_ps(scale);
+    __m128 fraction = _mm_set1_ps((float)(1 << radix));
+
+    int i = 0;
+    for (; i < count - 3; i += 4) {
+        unpackTranslations4(source + 6 * i, scales, fraction, x + i, y + i, z + i);
+    }
+
+    if (i < count) {
+        int remaining = count - i;
+        uint8_t packed[6 * 4] = {};
+        float t[3][4];
+        memcpy(packed, source + 6 * i, 6 * remaining);
+        unpackTranslations4(packed, scales, fraction, t[0], t[1], t[2]);
+        memcpy(x + i, t[0], remaining * sizeof(float));
+        memcpy(y + i, t[1], remaining * sizeof(float));
+        memcpy(z + i, t[2], remaining * sizeof(float));
+    }
+}
+
+void packValidityBits_SSE41(const uint8_t* flags, int count, uint8_t* bits) {
+    int i = 0;
+    for (; i < count - 15; i += 16) {
+        __m128i isZero = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(flags + i)), _mm_setzero_si128());
+        uint16_t mask = (uint16_t)~_mm_movemask_epi8(isZero);
+        memcpy(bits + i / 8, &mask, sizeof(mask));     // little-endian, flag i in the low bit
+    }
+
+    if (i < count) {
+        memset(bits + i / 8, 0, (count - i + 7) / 8);
+        for (; i < count; i++) {
+            if (flags[i]) {
+                bits[i / 8] |= 1 << (i % 8);
+            }
+        }
+    }
+}
+
+int unpackValidityBits_SSE41(const uint8_t* bits, int count, uint8_t* flags) {
+    // byte i of a block takes bit i % 8 of byte i / 8
+    const __m128i SPREAD = _mm_setr_epi8(0,0,0,0,0,0,0,0, 1,1,1,1,1,1,1,1);
+    const __m128i BITS = _mm_setr_epi8(1,2,4,8,16,32,64,-128, 1,2,4,8,16,32,64,-128);
+    const __m128i ONE = _mm_set1_epi8(1);
+    __m128i sums = _mm_setzero_si128();
+
+    int i = 0;
+    for (; i < count - 15; i += 16) {
+        uint16_t mask;
+        memcpy(&mask, bits + i / 8, sizeof(mask));
+
+        __m128i spread = _mm_shuffle_epi8(_mm_set1_epi16((short)mask), SPREAD);
+        __m128i set = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(spread, BITS), BITS), ONE);
+        _mm_storeu_si128((__m128i*)(flags + i), set);
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(set, _mm_setzero_si128()));
+    }
+
+    int numSet = _mm_extract_epi32(sums, 0) + _mm_extract_epi32(sums, 2);
+
+    for (; i < count; i++) {
+        flags[i] = (bits[i / 8] >> (i % 8)) & 1;
+        numSet += flags[i];
+    }
+    return numSet;
+}
+
+#endif
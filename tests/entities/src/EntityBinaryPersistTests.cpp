@@ -0,0 +1,134 @@
+//
+//  EntityBinaryPersistTests.cpp
+//  tests/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityBinaryPersistTests.h"
+
+#include <DependencyManager.h>
+#include <EntityItemProperties.h>
+#include <NodeList.h>
+#include <OctreeBinaryPersist.h>
+
+QTEST_MAIN(EntityBinaryPersistTests)
+
+void EntityBinaryPersistTests::initTestCase() {
+    // the tree adds entities only with a node list
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<NodeList>(NodeType::EntityServer, INVALID_PORT);
+}
+
+EntityTreePointer EntityBinaryPersistTests::createTree() {
+    auto tree = std::make_shared<EntityTree>();
+    tree->createRootElement();
+    tree->setIsServer(true);
+    return tree;
+}
+
+EntityItemID EntityBinaryPersistTests::addEntity(const EntityTreePointer& tree, const EntityItemProperties& properties) {
+    EntityItemID id = QUuid::createUuid();
+    tree->withWriteLock([&] {
+        QVERIFY(tree->addEntity(id, properties));
+    });
+    return id;
+}
+
+void EntityBinaryPersistTests::roundTrip() {
+    auto source = createTree();
+
+    EntityItemProperties box;
+    box.setType(EntityTypes::Box);
+    box.setName("box");
+    box.setPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+    box.setDimensions(glm::vec3(0.5f, 1.0f, 2.0f));
+    box.setColor(glm::u8vec3(10, 20, 30));
+    box.setUserData("{\"key\":\"value\"}");
+    auto boxID = addEntity(source, box);
+
+    EntityItemProperties model;
+    model.setType(EntityTypes::Model);
+    model.setName("model");
+    model.setModelURL("http://example.com/model.fbx");
+    model.setParentID(boxID);
+    model.setLocalPosition(glm::vec3(0.0f, 1.0f, 0.0f));
+    auto modelID = addEntity(source, model);
+
+    // too long for the wire encoding, saved as JSON
+    EntityItemProperties large;
+    large.setType(EntityTypes::Box);
+    large.setName("large");
+    large.setUserData(QString(100 * 1000, 'x'));
+    auto largeID = addEntity(source, large);
+
+    OctreeBinaryPersist::Changes changes;
+    source->collectBinaryPersistChanges(true, changes);
+    QCOMPARE((int)changes.updated.size(), 3);
+    QVERIFY(changes.removed.empty());
+
+    std::vector<QByteArray> items;
+    for (const auto& item : changes.updated) {
+        items.push_back(item.second);
+    }
+
+    auto destination = createTree();
+    destination->withWriteLock([&] {
+        QVERIFY(destination->readFromBinaryPersistItems(items, versionForPacketType(PacketType::EntityData)));
+    });
+
+    for (const auto& id : { boxID, modelID, largeID }) {
+        auto sourceEntity = source->findEntityByEntityItemID(id);
+        auto destinationEntity = destination->findEntityByEntityItemID(id);
+        QVERIFY(sourceEntity);
+        QVERIFY(destinationEntity);
+
+        auto expected = sourceEntity->getProperties();
+        auto actual = destinationEntity->getProperties();
+        QCOMPARE(actual.getType(), expected.getType());
+        QCOMPARE(actual.getName(), expected.getName());
+        QCOMPARE(actual.getPosition(), expected.getPosition());
+        QCOMPARE(actual.getDimensions(), expected.getDimensions());
+        QCOMPARE(actual.getParentID(), expected.getParentID());
+        QCOMPARE(actual.getUserData(), expected.getUserData());
+        QCOMPARE(actual.getModelURL(), expected.getModelURL());
+        QCOMPARE(actual.getColor(), expected.getColor());
+        QCOMPARE(actual.getLastEdited(), expected.getLastEdited());
+    }
+}
+
+void EntityBinaryPersistTests::collectChanges() {
+    auto tree = createTree();
+
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    auto keptID = addEntity(tree, properties);
+    auto editedID = addEntity(tree, properties);
+    auto removedID = addEntity(tree, properties);
+
+    OctreeBinaryPersist::Changes changes;
+    tree->collectBinaryPersistChanges(true, changes);
+    QCOMPARE((int)changes.updated.size(), 3);
+
+    // the next collect starts after this one
+    QTest::qSleep(1);
+
+    EntityItemProperties edit;
+    edit.setName("edited");
+    tree->withWriteLock([&] {
+        QVERIFY(tree->updateEntity(editedID, edit));
+        tree->deleteEntity(removedID, true, true);
+    });
+
+    changes = OctreeBinaryPersist::Changes();
+    tree->collectBinaryPersistChanges(false, changes);
+    QCOMPARE((int)changes.updated.size(), 1);
+    QCOMPARE(changes.updated[0].first, QUuid(editedID));
+    QCOMPARE((int)changes.removed.size(), 1);
+    QCOMPARE(changes.removed[0], QUuid(removedID));
+    QVERIFY(tree->findEntityByEntityItemID(keptID));
+}
@@ -0,0 +1,34 @@
+//
+//  EntityBinaryPersistTests.h
+//  tests/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityBinaryPersistTests_h
+#define hifi_EntityBinaryPersistTests_h
+
+#include <QtTest/QtTest>
+
+#include <EntityTree.h>
+
+class EntityBinaryPersistTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+
+    // the entities collected from a tree read back into another one with the same properties
+    void roundTrip();
+    // a save after the first one only collects the changed and removed entities
+    void collectChanges();
+
+private:
+    EntityTreePointer createTree();
+    EntityItemID addEntity(const EntityTreePointer& tree, const EntityItemProperties& properties);
+};
+
+#endif // hifi_EntityBinaryPersistTests_h
@@ -0,0 +1,181 @@
+//
+//  EntityEditBatchTests.cpp
+//  tests/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityEditBatchTests.h"
+
+#include <DependencyManager.h>
+#include <EntityEditFilters.h>
+#include <EntityItemProperties.h>
+#include <NodeList.h>
+#include <ReceivedMessage.h>
+
+QTEST_MAIN(EntityEditBatchTests)
+
+void EntityEditBatchTests::initTestCase() {
+    // the tree adds entities only with a node list
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<NodeList>(NodeType::EntityServer, INVALID_PORT);
+}
+
+void EntityEditBatchTests::init() {
+    _tree = std::make_shared<EntityTree>();
+    _tree->createRootElement();
+    _tree->setIsServer(true);
+
+    // may rez, but not bypass the filters
+    NodePermissions permissions;
+    permissions.set(NodePermissions::Permission::canRezPermanentEntities);
+    _sender = SharedNodePointer(new Node(QUuid::createUuid(), NodeType::Agent, HifiSockAddr(), HifiSockAddr()));
+    _sender->setPermissions(permissions);
+}
+
+void EntityEditBatchTests::cleanup() {
+    DependencyManager::destroy<EntityEditFilters>();
+    _tree.reset();
+    _sender.reset();
+}
+
+Octree::DecodedEditPointer EntityEditBatchTests::decode(PacketType type, const QByteArray& buffer) {
+    ReceivedMessage message(buffer, type, versionForPacketType(type), HifiSockAddr());
+    Octree::DecodedEditPointer edit;
+    _tree->decodeEditPacketData(message, reinterpret_cast<const unsigned char*>(message.getRawMessage()),
+                                (int)message.getSize(), _sender, edit);
+    return edit;
+}
+
+Octree::DecodedEditPointer EntityEditBatchTests::decodeEdit(PacketType type, const EntityItemID& id,
+                                                            EntityItemProperties properties) {
+    // each edit is newer than the one before
+    static quint64 lastEdited = usecTimestampNow();
+    properties.setLastEdited(++lastEdited);
+
+    QByteArray buffer(NLPacket::maxPayloadSize(type) * 10, 0);
+    EntityPropertyFlags didntFitProperties;
+    EntityItemProperties::encodeEntityEditPacket(type, id, properties, buffer, properties.getChangedProperties(),
+                                                 didntFitProperties);
+    return decode(type, buffer);
+}
+
+Octree::DecodedEditPointer EntityEditBatchTests::decodeClone(const EntityItemID& idToClone, const EntityItemID& newID) {
+    QByteArray buffer(NLPacket::maxPayloadSize(PacketType::EntityClone), 0);
+    EntityItemProperties::encodeCloneEntityMessage(idToClone, newID, buffer);
+    return decode(PacketType::EntityClone, buffer);
+}
+
+int EntityEditBatchTests::apply(std::vector<Octree::DecodedEditPointer>& edits) {
+    int applied = 0;
+    _tree->withWriteLock([&] {
+        applied = _tree->processDecodedEdits(edits);
+    });
+    return applied;
+}
+
+EntityItemID EntityEditBatchTests::addEntity(const QString& name, bool cloneable) {
+    EntityItemID id = QUuid::createUuid();
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setName(name);
+    properties.setCloneable(cloneable);
+    _tree->withWriteLock([&] {
+        _tree->addEntity(id, properties);
+    });
+    return id;
+}
+
+void EntityEditBatchTests::addThenEdit() {
+    EntityItemID id = QUuid::createUuid();
+
+    EntityItemProperties added;
+    added.setType(EntityTypes::Box);
+    added.setName("added");
+    EntityItemProperties edited;
+    edited.setName("edited");
+
+    std::vector<Octree::DecodedEditPointer> edits;
+    edits.push_back(decodeEdit(PacketType::EntityAdd, id, added));
+    edits.push_back(decodeEdit(PacketType::EntityEdit, id, edited));
+    QCOMPARE(apply(edits), 2);
+
+    auto entity = _tree->findEntityByEntityItemID(id);
+    QVERIFY(entity);
+    QCOMPARE(entity->getName(), QString("edited"));
+}
+
+void EntityEditBatchTests::coalesceAdjacentEdits() {
+    auto first = addEntity("first");
+    auto second = addEntity("second");
+
+    EntityItemProperties named;
+    named.setName("named");
+    EntityItemProperties described;
+    described.setDescription("described");
+    EntityItemProperties renamed;
+    renamed.setName("renamed");
+
+    std::vector<Octree::DecodedEditPointer> edits;
+    edits.push_back(decodeEdit(PacketType::EntityEdit, first, named));
+    edits.push_back(decodeEdit(PacketType::EntityEdit, first, described));
+    edits.push_back(decodeEdit(PacketType::EntityEdit, second, named));
+    edits.push_back(decodeEdit(PacketType::EntityEdit, first, renamed));
+    QCOMPARE(apply(edits), 3);
+
+    auto entity = _tree->findEntityByEntityItemID(first);
+    QCOMPARE(entity->getName(), QString("renamed"));
+    QCOMPARE(entity->getDescription(), QString("described"));
+    QCOMPARE(_tree->findEntityByEntityItemID(second)->getName(), QString("named"));
+}
+
+void EntityEditBatchTests::keepOrder() {
+    auto original = addEntity("original", true);
+    EntityItemID clone = QUuid::createUuid();
+
+    EntityItemProperties renamed;
+    renamed.setName("renamed");
+    EntityItemProperties notCloneable;
+    notCloneable.setCloneable(false);
+
+    // the clone is made while the entity can still be cloned
+    std::vector<Octree::DecodedEditPointer> edits;
+    edits.push_back(decodeEdit(PacketType::EntityEdit, original, renamed));
+    edits.push_back(decodeClone(original, clone));
+    edits.push_back(decodeEdit(PacketType::EntityEdit, original, notCloneable));
+    QCOMPARE(apply(edits), 3);
+
+    QVERIFY(_tree->findEntityByEntityItemID(clone));
+    auto entity = _tree->findEntityByEntityItemID(original);
+    QCOMPARE(entity->getName(), QString("renamed"));
+    QVERIFY(!entity->getCloneable());
+}
+
+void EntityEditBatchTests::filterRejectsOneEdit() {
+    auto filters = DependencyManager::set<EntityEditFilters>(_tree);
+    QJsonObject rules {
+        { "filterTypes", QJsonArray { "edit" } },
+        { "deniedProperties", QJsonArray { "script" } }
+    };
+    QVERIFY(filters->addFilterRules(EntityItemID(), "test", rules));
+
+    auto id = addEntity("original");
+
+    EntityItemProperties renamed;
+    renamed.setName("renamed");
+    EntityItemProperties scripted;
+    scripted.setScript("http://example.com/script.js");
+
+    std::vector<Octree::DecodedEditPointer> edits;
+    edits.push_back(decodeEdit(PacketType::EntityEdit, id, renamed));
+    edits.push_back(decodeEdit(PacketType::EntityEdit, id, scripted));
+    QCOMPARE(apply(edits), 2);
+
+    auto entity = _tree->findEntityByEntityItemID(id);
+    QCOMPARE(entity->getName(), QString("renamed"));
+    QVERIFY(entity->getScript().isEmpty());
+}
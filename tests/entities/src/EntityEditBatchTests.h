@@ -0,0 +1,47 @@
+//
+//  EntityEditBatchTests.h
+//  tests/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityEditBatchTests_h
+#define hifi_EntityEditBatchTests_h
+
+#include <QtTest/QtTest>
+
+#include <EntityTree.h>
+#include <Node.h>
+
+class EntityEditBatchTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    // an entity added and edited in the same batch gets the edit
+    void addThenEdit();
+    // adjacent edits of an entity are applied as one, edits with another edit between them aren't
+    void coalesceAdjacentEdits();
+    // an edit is applied after the edits that came before it in the batch
+    void keepOrder();
+    // a filter rejecting an edit keeps the edits it accepted
+    void filterRejectsOneEdit();
+
+private:
+    Octree::DecodedEditPointer decode(PacketType type, const QByteArray& buffer);
+    Octree::DecodedEditPointer decodeEdit(PacketType type, const EntityItemID& id, EntityItemProperties properties);
+    Octree::DecodedEditPointer decodeClone(const EntityItemID& idToClone, const EntityItemID& newID);
+    int apply(std::vector<Octree::DecodedEditPointer>& edits);
+    EntityItemID addEntity(const QString& name, bool cloneable = false);
+
+    EntityTreePointer _tree;
+    SharedNodePointer _sender;
+};
+
+#endif // hifi_EntityEditBatchTests_h
@@ -0,0 +1,97 @@
+//
+//  EntitySharedEncodingTests.cpp
+//  tests/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntitySharedEncodingTests.h"
+
+#include <DependencyManager.h>
+#include <EntityItemProperties.h>
+#include <EntityTypes.h>
+#include <NodeList.h>
+
+QTEST_MAIN(EntitySharedEncodingTests)
+
+void EntitySharedEncodingTests::initTestCase() {
+    // the encoding asks the node list who we are
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<NodeList>(NodeType::EntityServer, INVALID_PORT);
+}
+
+void EntitySharedEncodingTests::init() {
+    EntityItemProperties properties;
+    properties.setName("entity");
+    properties.setLastEdited(usecTimestampNow());
+    _entity = EntityTypes::constructEntityItem(EntityTypes::Box, QUuid::createUuid(), properties);
+    QVERIFY(_entity);
+
+    _encodedData = _entity->getSharedEncodedData();
+    QVERIFY(!_encodedData.isEmpty());
+}
+
+void EntitySharedEncodingTests::cleanup() {
+    // the last changes of each test mustn't be served from the old encoding
+    QVERIFY(_entity->getSharedEncodedData() != _encodedData);
+    _entity.reset();
+}
+
+void EntitySharedEncodingTests::unchanged() {
+    QCOMPARE(_entity->getSharedEncodedData(), _encodedData);
+
+    // cleanup() expects a change
+    _entity->setName("changed");
+}
+
+void EntitySharedEncodingTests::setProperties() {
+    EntityItemProperties properties;
+    properties.setName("changed");
+    QVERIFY(_entity->setProperties(properties));
+}
+
+void EntitySharedEncodingTests::plainSetter() {
+    _entity->setUserData("changed");
+}
+
+void EntitySharedEncodingTests::position() {
+    _entity->setWorldPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+}
+
+void EntitySharedEncodingTests::velocity() {
+    _entity->setVelocity(glm::vec3(1.0f, 0.0f, 0.0f));
+    QVERIFY(_entity->getSharedEncodedData() != _encodedData);
+
+    _encodedData = _entity->getSharedEncodedData();
+    _entity->setAngularVelocity(glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+void EntitySharedEncodingTests::parent() {
+    _entity->setParentID(QUuid::createUuid());
+}
+
+void EntitySharedEncodingTests::simulationOwner() {
+    _entity->setSimulationOwner(QUuid::createUuid(), SCRIPT_GRAB_SIMULATION_PRIORITY);
+    QVERIFY(_entity->getSharedEncodedData() != _encodedData);
+
+    _encodedData = _entity->getSharedEncodedData();
+    _entity->clearSimulationOwnership();
+}
+
+void EntitySharedEncodingTests::readFromBuffer() {
+    // the same entity, with another name
+    EntityItemProperties properties = _entity->getProperties();
+    properties.setName("changed");
+    auto source = EntityTypes::constructEntityItem(EntityTypes::Box, _entity->getEntityItemID(), properties);
+    QByteArray sourceData = source->getSharedEncodedData();
+    QVERIFY(!sourceData.isEmpty());
+
+    ReadBitstreamToTreeParams args;
+    QCOMPARE(_entity->readEntityDataFromBuffer(reinterpret_cast<const unsigned char*>(sourceData.constData()),
+                                               sourceData.size(), args), sourceData.size());
+    QCOMPARE(_entity->getName(), QString("changed"));
+}
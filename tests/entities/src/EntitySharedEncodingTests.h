@@ -0,0 +1,42 @@
+//
+//  EntitySharedEncodingTests.h
+//  tests/entities/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntitySharedEncodingTests_h
+#define hifi_EntitySharedEncodingTests_h
+
+#include <QtTest/QtTest>
+
+#include <EntityItem.h>
+
+class EntitySharedEncodingTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    // an unchanged entity keeps its encoding
+    void unchanged();
+    // each way of changing an entity re-encodes it
+    void setProperties();
+    void plainSetter();
+    void position();
+    void velocity();
+    void parent();
+    void simulationOwner();
+    void readFromBuffer();
+
+private:
+    EntityItemPointer _entity;
+    QByteArray _encodedData;
+};
+
+#endif // hifi_EntitySharedEncodingTests_h
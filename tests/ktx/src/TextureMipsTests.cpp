@@ -0,0 +1,162 @@
+//
+//  TextureMipsTests.cpp
+//  tests/ktx/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TextureMipsTests.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <QElapsedTimer>
+
+#include <gpu/Format.h>
+#include <image/TextureMips.h>
+#include <image/TextureProcessing.h>
+
+QTEST_GUILESS_MAIN(TextureMipsTests)
+
+static const int BENCHMARK_SIZE = 2048;
+
+static std::vector<glm::vec4> randomPixels(size_t count) {
+    std::vector<glm::vec4> pixels(count);
+    for (auto& pixel : pixels) {
+        // mostly in range, with some that have to be clamped either way
+        for (int i = 0; i < 3; i++) {
+            pixel[i] = std::exp2(((float)rand() / RAND_MAX) * 40.0f - 20.0f);
+            if (rand() % 16 == 0) {
+                pixel[i] = -pixel[i];
+            }
+        }
+        pixel.a = 1.0f;
+    }
+    return pixels;
+}
+
+static glm::vec4 averageQuad(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c, const glm::vec4& d) {
+    return ((a + b) + (c + d)) * 0.25f;
+}
+
+// the mip below, one pixel at a time
+static std::vector<glm::vec4> referenceDownsample(const std::vector<glm::vec4>& source, int width, int height) {
+    const int destWidth = std::max(1, width / 2);
+    const int destHeight = std::max(1, height / 2);
+    std::vector<glm::vec4> dest((size_t)destWidth * destHeight);
+    for (int y = 0; y < destHeight; y++) {
+        const int y0 = height > 1 ? 2 * y : 0;
+        const int y1 = height > 1 ? 2 * y + 1 : 0;
+        for (int x = 0; x < destWidth; x++) {
+            const int x0 = width > 1 ? 2 * x : 0;
+            const int x1 = width > 1 ? 2 * x + 1 : 0;
+            dest[y * destWidth + x] = averageQuad(source[y0 * width + x0], source[y0 * width + x1],
+                                                  source[y1 * width + x0], source[y1 * width + x1]);
+        }
+    }
+    return dest;
+}
+
+void TextureMipsTests::packTest() {
+    const float NaN = std::numeric_limits<float>::quiet_NaN();
+    const float INF = std::numeric_limits<float>::infinity();
+    const float EDGE_VALUES[] = { 0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 6.0e-5f, 6.10e-5f, 6.2e-5f, 1.0e-30f,
+                                  6.50e4f, 6.6e4f, 1.0e10f, NaN, INF, -INF };
+    const int NUM_EDGE_VALUES = sizeof(EDGE_VALUES) / sizeof(EDGE_VALUES[0]);
+
+    std::vector<glm::vec4> pixels;
+    for (int r = 0; r < NUM_EDGE_VALUES; r++) {
+        for (int g = 0; g < NUM_EDGE_VALUES; g++) {
+            pixels.emplace_back(EDGE_VALUES[r], EDGE_VALUES[g], EDGE_VALUES[(r + g) % NUM_EDGE_VALUES], 1.0f);
+        }
+    }
+    auto randomOnes = randomPixels(100000);
+    pixels.insert(pixels.end(), randomOnes.begin(), randomOnes.end());
+
+    const gpu::Element FORMATS[] = { gpu::Element::COLOR_R11G11B10, gpu::Element::COLOR_RGB9E5, gpu::Element::COLOR_SRGBA_32 };
+    for (const auto& format : FORMATS) {
+        auto packFunc = image::getHDRPackingFunction(format);
+        // every length of the remainder, and batches large enough to be split across cores
+        for (size_t count : { (size_t)1, (size_t)2, (size_t)3, (size_t)4, (size_t)5, (size_t)7, pixels.size() }) {
+            std::vector<gpu::uint32> packed(count + 1, 0xdeadbeef);
+            image::packHDRPixels(pixels.data(), count, packed.data(), format);
+            for (size_t i = 0; i < count; i++) {
+                QCOMPARE(packed[i], packFunc(glm::vec3(pixels[i])));
+            }
+            QCOMPARE(packed.back(), (gpu::uint32)0xdeadbeef);
+        }
+    }
+}
+
+void TextureMipsTests::downsampleTest() {
+    const glm::ivec2 SIZES[] = { { 2, 2 }, { 8, 4 }, { 4, 16 }, { 1, 8 }, { 32, 1 }, { 512, 512 } };
+    for (const auto& size : SIZES) {
+        int width = size.x;
+        int height = size.y;
+        auto mip = randomPixels((size_t)width * height);
+        while (width > 1 || height > 1) {
+            auto expected = referenceDownsample(mip, width, height);
+            std::vector<glm::vec4> downsampled(expected.size());
+            image::downsampleMip(mip.data(), width, height, downsampled.data());
+            QVERIFY(memcmp(downsampled.data(), expected.data(), expected.size() * sizeof(glm::vec4)) == 0);
+
+            mip = downsampled;
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+    }
+}
+
+void TextureMipsTests::benchmark() {
+    auto pixels = randomPixels((size_t)BENCHMARK_SIZE * BENCHMARK_SIZE);
+    std::vector<gpu::uint32> packed(pixels.size());
+    // the whole chain is a third bigger than the top mip
+    const double megapixels = (double)pixels.size() * 4.0 / 3.0 / 1.0e6;
+
+    {
+        auto packFunc = image::getHDRPackingFunction();
+        QElapsedTimer timer;
+        timer.start();
+        std::vector<glm::vec4> mip = pixels;
+        int width = BENCHMARK_SIZE;
+        int height = BENCHMARK_SIZE;
+        while (true) {
+            for (size_t i = 0; i < mip.size(); i++) {
+                packed[i] = packFunc(glm::vec3(mip[i]));
+            }
+            if (width == 1 && height == 1) {
+                break;
+            }
+            mip = referenceDownsample(mip, width, height);
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+        qDebug() << "Mips per pixel" << timer.elapsed() << "msecs," << megapixels / (timer.nsecsElapsed() / 1.0e9) << "megapixels/s";
+    }
+
+    {
+        QElapsedTimer timer;
+        timer.start();
+        std::vector<glm::vec4> mip = pixels;
+        std::vector<glm::vec4> nextMip;
+        int width = BENCHMARK_SIZE;
+        int height = BENCHMARK_SIZE;
+        while (true) {
+            image::packHDRPixels(mip.data(), (size_t)width * height, packed.data(), gpu::Element::COLOR_R11G11B10);
+            if (width == 1 && height == 1) {
+                break;
+            }
+            nextMip.resize((size_t)std::max(1, width / 2) * std::max(1, height / 2));
+            image::downsampleMip(mip.data(), width, height, nextMip.data());
+            mip.swap(nextMip);
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+        qDebug() << "Mips batched" << timer.elapsed() << "msecs," << megapixels / (timer.nsecsElapsed() / 1.0e9) << "megapixels/s";
+    }
+}
@@ -0,0 +1,29 @@
+//
+//  TextureMipsTests.h
+//  tests/ktx/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TextureMipsTests_h
+#define hifi_TextureMipsTests_h
+
+#include <QtTest/QtTest>
+
+class TextureMipsTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    // packed pixels are bit for bit those of the per pixel packing functions, edge values and remainders included
+    void packTest();
+    // downsampled mips are the 2x2 average of the mip above, including the mips that are one pixel wide or high
+    void downsampleTest();
+    // times building and packing a mip chain against the per pixel path, in megapixels per second
+    void benchmark();
+};
+
+#endif // hifi_TextureMipsTests_h
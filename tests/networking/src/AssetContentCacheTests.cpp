@@ -0,0 +1,121 @@
+//
+//  AssetContentCacheTests.cpp
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetContentCacheTests.h"
+
+#include <AssetContentCache.h>
+
+QTEST_GUILESS_MAIN(AssetContentCacheTests)
+
+static const qint64 KB = 1024;
+
+static void admit(AssetContentCache& cache, const QString& hash, qint64 size) {
+    cache.shouldAdmit(hash, size);
+    QVERIFY(cache.shouldAdmit(hash, size));
+    cache.insert(hash, QByteArray((int)size, 'a'));
+}
+
+void AssetContentCacheTests::admitOnRepeat() {
+    AssetContentCache cache;
+    cache.setMaxSize(100 * KB);
+
+    QVERIFY(cache.find("a").isNull());
+    QVERIFY(!cache.shouldAdmit("a", KB));
+    QVERIFY(cache.shouldAdmit("a", KB));
+    cache.insert("a", QByteArray((int)KB, 'a'));
+
+    QCOMPARE(cache.find("a").size(), (int)KB);
+
+    auto stats = cache.getStats();
+    QCOMPARE(stats.hits, (quint64)1);
+    QCOMPARE(stats.misses, (quint64)1);
+    QCOMPARE(stats.numEntries, 1);
+    QCOMPARE(stats.size, KB);
+}
+
+void AssetContentCacheTests::entrySizeLimit() {
+    AssetContentCache cache;
+    cache.setMaxSize(100 * KB);
+
+    QVERIFY(cache.canCache(25 * KB));
+    QVERIFY(!cache.canCache(25 * KB + 1));
+    QVERIFY(!cache.shouldAdmit("a", 30 * KB));
+    QVERIFY(!cache.shouldAdmit("a", 30 * KB));
+
+    // insert checks the size as well
+    cache.insert("a", QByteArray((int)(30 * KB), 'a'));
+    QCOMPARE(cache.getStats().numEntries, 0);
+
+    cache.setMaxSize(4 * AssetContentCache::MAX_ENTRY_SIZE + 4 * KB);
+    QVERIFY(cache.canCache(AssetContentCache::MAX_ENTRY_SIZE));
+    QVERIFY(!cache.canCache(AssetContentCache::MAX_ENTRY_SIZE + 1));
+}
+
+void AssetContentCacheTests::evictLeastRecent() {
+    AssetContentCache cache;
+    cache.setMaxSize(100 * KB);
+
+    admit(cache, "a", 25 * KB);
+    admit(cache, "b", 25 * KB);
+    admit(cache, "c", 25 * KB);
+    admit(cache, "d", 25 * KB);
+    QCOMPARE(cache.getStats().size, 100 * KB);
+
+    // "a" is used again, so "b" is the least recent
+    QVERIFY(!cache.find("a").isNull());
+    admit(cache, "e", 10 * KB);
+
+    QVERIFY(cache.find("b").isNull());
+    QVERIFY(!cache.find("a").isNull());
+    QVERIFY(!cache.find("c").isNull());
+    QVERIFY(!cache.find("e").isNull());
+
+    auto stats = cache.getStats();
+    QCOMPARE(stats.numEntries, 4);
+    QCOMPARE(stats.size, 85 * KB);
+}
+
+void AssetContentCacheTests::shrinkCache() {
+    AssetContentCache cache;
+    cache.setMaxSize(100 * KB);
+
+    admit(cache, "a", 20 * KB);
+    admit(cache, "b", 20 * KB);
+    admit(cache, "c", 20 * KB);
+
+    cache.setMaxSize(50 * KB);
+    auto stats = cache.getStats();
+    QCOMPARE(stats.numEntries, 2);
+    QCOMPARE(stats.size, 40 * KB);
+    QVERIFY(cache.find("a").isNull());
+
+    cache.setMaxSize(0);
+    stats = cache.getStats();
+    QCOMPARE(stats.numEntries, 0);
+    QCOMPARE(stats.size, (qint64)0);
+    QVERIFY(!cache.shouldAdmit("a", 1));
+}
+
+void AssetContentCacheTests::removeAsset() {
+    AssetContentCache cache;
+    cache.setMaxSize(100 * KB);
+
+    admit(cache, "a", KB);
+    cache.remove("a");
+    QVERIFY(cache.find("a").isNull());
+    QCOMPARE(cache.getStats().size, (qint64)0);
+
+    // a file that was only asked for once has to be asked for twice again after it is removed
+    QVERIFY(!cache.shouldAdmit("b", KB));
+    cache.remove("b");
+    QVERIFY(!cache.shouldAdmit("b", KB));
+    QVERIFY(cache.shouldAdmit("b", KB));
+}
@@ -0,0 +1,32 @@
+//
+//  AssetContentCacheTests.h
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetContentCacheTests_h
+#define hifi_AssetContentCacheTests_h
+
+#include <QtTest/QtTest>
+
+class AssetContentCacheTests : public QObject {
+    Q_OBJECT
+private slots:
+    // a file is only admitted the second time it is asked for
+    void admitOnRepeat();
+    // files over the entry size or a quarter of the cache are never admitted
+    void entrySizeLimit();
+    // the least recently used entries are evicted to stay within the budget
+    void evictLeastRecent();
+    // shrinking the cache evicts down to the new size
+    void shrinkCache();
+    // a removed asset is dropped along with its admission request
+    void removeAsset();
+};
+
+#endif // hifi_AssetContentCacheTests_h
@@ -0,0 +1,82 @@
+//
+//  DomainListVersionTrackerTests.cpp
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DomainListVersionTrackerTests.h"
+
+#include <DomainListVersionTracker.h>
+
+QTEST_GUILESS_MAIN(DomainListVersionTrackerTests)
+
+static void receivePacket(DomainListVersionTracker& version, quint32 listVersion, quint32 baseVersion,
+                          quint32 numListEntries, quint32 entriesInPacket, int numRemovedNodes = 0) {
+    version.beginPacket(listVersion, baseVersion, numListEntries);
+    for (int i = 0; i < numRemovedNodes; ++i) {
+        version.nodeKilled();
+    }
+    for (quint32 i = 0; i < entriesInPacket; ++i) {
+        version.addEntry();
+    }
+    version.endPacket();
+}
+
+void DomainListVersionTrackerTests::acknowledgeLists() {
+    DomainListVersionTracker version;
+    QCOMPARE(version.get(), (quint32)0);
+
+    receivePacket(version, 1, 0, 3, 3);
+    QCOMPARE(version.get(), (quint32)1);
+
+    receivePacket(version, 2, 1, 1, 1);
+    QCOMPARE(version.get(), (quint32)2);
+
+    version.reset();
+    QCOMPARE(version.get(), (quint32)0);
+}
+
+void DomainListVersionTrackerTests::splitList() {
+    DomainListVersionTracker version;
+
+    receivePacket(version, 1, 0, 5, 3);
+    QCOMPARE(version.get(), (quint32)0);
+
+    receivePacket(version, 1, 0, 5, 2);
+    QCOMPARE(version.get(), (quint32)1);
+}
+
+void DomainListVersionTrackerTests::unknownBaseVersion() {
+    DomainListVersionTracker version;
+    receivePacket(version, 1, 0, 2, 2);
+
+    receivePacket(version, 3, 2, 1, 1);
+    QCOMPARE(version.get(), (quint32)1);
+}
+
+void DomainListVersionTrackerTests::localNodeKill() {
+    DomainListVersionTracker version;
+    receivePacket(version, 1, 0, 3, 3);
+
+    // the domain server removes a node, and sends nothing else
+    receivePacket(version, 2, 1, 0, 0, 1);
+    QCOMPARE(version.get(), (quint32)2);
+
+    // a node goes silent and is dropped here, while the domain server still lists it
+    version.nodeKilled();
+    QCOMPARE(version.get(), (quint32)0);
+
+    // so the next check-in asks for a complete list, which has the node again
+    receivePacket(version, 3, 0, 2, 2);
+    QCOMPARE(version.get(), (quint32)3);
+
+    // and the changes sent before that complete list arrived don't get acknowledged in between
+    version.nodeKilled();
+    receivePacket(version, 4, 3, 1, 1);
+    QCOMPARE(version.get(), (quint32)0);
+}
@@ -0,0 +1,30 @@
+//
+//  DomainListVersionTrackerTests.h
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_DomainListVersionTrackerTests_h
+#define hifi_DomainListVersionTrackerTests_h
+
+#include <QtTest/QtTest>
+
+class DomainListVersionTrackerTests : public QObject {
+    Q_OBJECT
+private slots:
+    // a complete list, and the changes to it, are acknowledged
+    void acknowledgeLists();
+    // a list split over several packets is acknowledged once all of it arrived
+    void splitList();
+    // the changes to a list we don't have aren't acknowledged
+    void unknownBaseVersion();
+    // a node removed by the domain server keeps the version, one dropped on our own asks for it again
+    void localNodeKill();
+};
+
+#endif // hifi_DomainListVersionTrackerTests_h
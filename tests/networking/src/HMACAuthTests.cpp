@@ -0,0 +1,128 @@
+//
+//  HMACAuthTests.cpp
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "HMACAuthTests.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <QUuid>
+
+#include <HMACAuth.h>
+
+QTEST_MAIN(HMACAuthTests)
+
+static const int PACKET_PAYLOAD_SIZE = 1400;
+static const int PACKETS_PER_THREAD = 20000;
+
+static QByteArray toByteArray(const HMACAuth::HMACHash& hash) {
+    return QByteArray((const char*)hash.data(), (int)hash.size());
+}
+
+// hashes the way HMACAuth::calculateHash did before it stopped sharing the context: one lock for the whole hash
+static HMACAuth::HMACHash lockedHash(HMACAuth& hmacAuth, QMutex& mutex, const char* data, int dataLen) {
+    QMutexLocker lock(&mutex);
+    hmacAuth.addData(data, dataLen);
+    return hmacAuth.result();
+}
+
+template <typename F>
+static void hashOnEveryCore(F hashPacket) {
+    int numThreads = std::max(QThread::idealThreadCount(), 2);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&] {
+            QByteArray payload(PACKET_PAYLOAD_SIZE, 'x');
+            for (int j = 0; j < PACKETS_PER_THREAD; ++j) {
+                hashPacket(payload);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void HMACAuthTests::knownHashTest() {
+    HMACAuth hmacAuth;
+    QByteArray key(16, 0x0b);
+    QVERIFY(hmacAuth.setKey(key.constData(), key.size()));
+
+    HMACAuth::HMACHash hash;
+    QByteArray data("Hi There");
+    QVERIFY(hmacAuth.calculateHash(hash, data.constData(), data.size()));
+    QCOMPARE(toByteArray(hash).toHex(), QByteArray("9294727a3638bb1c13f48ef8158bfc9d"));
+}
+
+void HMACAuthTests::incrementalHashTest() {
+    HMACAuth hmacAuth;
+    QByteArray data(PACKET_PAYLOAD_SIZE, 'y');
+
+    for (int i = 0; i < 2; ++i) {
+        QVERIFY(hmacAuth.setKey(QUuid::createUuid()));
+
+        HMACAuth::HMACHash oneShot;
+        QVERIFY(hmacAuth.calculateHash(oneShot, data.constData(), data.size()));
+
+        hmacAuth.addData(data.constData(), 100);
+        hmacAuth.addData(data.constData() + 100, data.size() - 100);
+        QCOMPARE(toByteArray(hmacAuth.result()), toByteArray(oneShot));
+
+        // the context is ready for the next hash
+        HMACAuth::HMACHash again;
+        QVERIFY(hmacAuth.calculateHash(again, data.constData(), data.size()));
+        QCOMPARE(toByteArray(again), toByteArray(oneShot));
+    }
+}
+
+void HMACAuthTests::concurrentHashTest() {
+    HMACAuth hmacAuth;
+    hmacAuth.setKey(QUuid::createUuid());
+
+    QByteArray payload(PACKET_PAYLOAD_SIZE, 'x');
+    HMACAuth::HMACHash expected;
+    QVERIFY(hmacAuth.calculateHash(expected, payload.constData(), payload.size()));
+
+    std::atomic<int> mismatches { 0 };
+    hashOnEveryCore([&](const QByteArray& data) {
+        HMACAuth::HMACHash hash;
+        if (!hmacAuth.calculateHash(hash, data.constData(), data.size()) || hash != expected) {
+            ++mismatches;
+        }
+    });
+    QCOMPARE(mismatches.load(), 0);
+}
+
+void HMACAuthTests::lockedHashBenchmark() {
+    HMACAuth hmacAuth;
+    hmacAuth.setKey(QUuid::createUuid());
+    QMutex mutex;
+
+    QBENCHMARK {
+        hashOnEveryCore([&](const QByteArray& data) {
+            lockedHash(hmacAuth, mutex, data.constData(), data.size());
+        });
+    }
+}
+
+void HMACAuthTests::threadContextHashBenchmark() {
+    HMACAuth hmacAuth;
+    hmacAuth.setKey(QUuid::createUuid());
+
+    QBENCHMARK {
+        hashOnEveryCore([&](const QByteArray& data) {
+            HMACAuth::HMACHash hash;
+            hmacAuth.calculateHash(hash, data.constData(), data.size());
+        });
+    }
+}
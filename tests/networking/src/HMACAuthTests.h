@@ -0,0 +1,36 @@
+//
+//  HMACAuthTests.h
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_HMACAuthTests_h
+#define hifi_HMACAuthTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+class HMACAuthTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test against the RFC 2104 HMAC-MD5 vector
+    void knownHashTest();
+
+    // Test the one shot and incremental hashes agree, also after a new key
+    void incrementalHashTest();
+
+    // Test concurrent hashes with one HMACAuth all come out right
+    void concurrentHashTest();
+
+    // Compare hashing packets from every core through the shared locked context and through calculateHash
+    void lockedHashBenchmark();
+    void threadContextHashBenchmark();
+};
+
+#endif // hifi_HMACAuthTests_h
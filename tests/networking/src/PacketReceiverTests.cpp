@@ -0,0 +1,85 @@
+//
+//  PacketReceiverTests.cpp
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketReceiverTests.h"
+
+#include <PacketReceiver.h>
+
+QTEST_MAIN(PacketReceiverTests)
+
+// a non sourced type, so dispatching does not need a node list
+static const PacketType TEST_PACKET_TYPE = PacketType::DomainServerPathQuery;
+
+static std::unique_ptr<NLPacket> createReceivedPacket(const QByteArray& payload) {
+    auto packet = NLPacket::create(TEST_PACKET_TYPE);
+    packet->write(payload);
+
+    auto size = packet->getDataSize();
+    auto data = std::unique_ptr<char[]>(new char[size]);
+    memcpy(data.get(), packet->getData(), size);
+    return NLPacket::fromReceivedPacket(std::move(data), size, HifiSockAddr());
+}
+
+void PacketReceiverTests::handlerTest() {
+    PacketReceiver receiver;
+    QObject context;
+
+    int numHandled = 0;
+    QByteArray received;
+    bool hadNotifier = true;
+    receiver.registerHandler(TEST_PACKET_TYPE, &context,
+                             [&](QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
+        ++numHandled;
+        QVERIFY(message->isComplete());
+        QVERIFY(!node);
+        hadNotifier = message->getNotifier() != nullptr;
+        received = message->readAll();
+    });
+
+    const QByteArray payload("/some/path");
+    receiver.handleVerifiedPacket(createReceivedPacket(payload));
+
+    QCOMPARE(numHandled, 1);
+    QCOMPARE(received, payload);
+    QVERIFY(!hadNotifier);
+}
+
+void PacketReceiverTests::unregisterHandlerTest() {
+    PacketReceiver receiver;
+    QObject context;
+
+    int numHandled = 0;
+    receiver.registerHandlerForTypes({ TEST_PACKET_TYPE }, &context,
+                                     [&](QSharedPointer<ReceivedMessage>, SharedNodePointer) {
+        ++numHandled;
+    });
+
+    receiver.handleVerifiedPacket(createReceivedPacket("first"));
+    receiver.unregisterListener(&context);
+    receiver.handleVerifiedPacket(createReceivedPacket("second"));
+
+    QCOMPARE(numHandled, 1);
+}
+
+void PacketReceiverTests::destroyedContextTest() {
+    PacketReceiver receiver;
+    auto context = new QObject();
+
+    int numHandled = 0;
+    receiver.registerHandler(TEST_PACKET_TYPE, context, [&](QSharedPointer<ReceivedMessage>, SharedNodePointer) {
+        ++numHandled;
+    });
+
+    delete context;
+    receiver.handleVerifiedPacket(createReceivedPacket("dropped"));
+
+    QCOMPARE(numHandled, 0);
+}
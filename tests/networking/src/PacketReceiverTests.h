@@ -0,0 +1,32 @@
+//
+//  PacketReceiverTests.h
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PacketReceiverTests_h
+#define hifi_PacketReceiverTests_h
+
+#pragma once
+
+#include <QtTest/QtTest>
+
+class PacketReceiverTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test a registered handler gets a complete single packet message
+    void handlerTest();
+
+    // Test handlers are dropped with unregisterListener
+    void unregisterHandlerTest();
+
+    // Test handlers are dropped once their context is destroyed
+    void destroyedContextTest();
+};
+
+#endif // hifi_PacketReceiverTests_h
@@ -13,6 +13,7 @@
 #include <test-utils/QTestExtensions.h>
 
 #include <NLPacket.h>
+#include <udt/PacketBufferPool.h>
 
 QTEST_MAIN(PacketTests)
 
@@ -180,3 +181,30 @@ void PacketTests::primitiveTest() {
     QCOMPARE(recvPacket->peekPrimitive(&noValue), 0);
     QCOMPARE(recvPacket->readPrimitive(&noValue), 0);
 }
+
+void PacketTests::bufferRecyclingTest() {
+    auto packet = NLPacket::create(PacketType::Unknown);
+    packet->write("somedata");
+    const char* firstBuffer = packet->getData();
+    packet.reset();
+
+    auto statsBefore = udt::PacketBufferPool::getStats();
+
+    // the slab we just freed is on top of this thread's cache
+    auto recycledPacket = NLPacket::create(PacketType::Unknown);
+    QCOMPARE(recycledPacket->getData(), firstBuffer);
+
+    auto statsAfter = udt::PacketBufferPool::getStats();
+    QCOMPARE(statsAfter.threadCacheAllocations, statsBefore.threadCacheAllocations + 1);
+    QCOMPARE(statsAfter.heapAllocations, statsBefore.heapAllocations);
+
+    // recycled buffers are zeroed like freshly allocated ones
+    QCOMPARE(recycledPacket->getPayloadSize(), 0);
+    for (qint64 i = 0; i < recycledPacket->getPayloadCapacity(); ++i) {
+        QCOMPARE(recycledPacket->getPayload()[i], (char)0);
+    }
+
+    // buffers bigger than a slab come straight from the heap
+    auto oversized = udt::PacketBufferPool::allocate(udt::PacketBufferPool::SLAB_SIZE + 1);
+    QVERIFY(!oversized.get_deleter().isPooled);
+}
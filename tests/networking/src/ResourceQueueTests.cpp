@@ -0,0 +1,182 @@
+//
+//  ResourceQueueTests.cpp
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "ResourceQueueTests.h"
+
+#include <limits>
+
+#include <DependencyManager.h>
+#include <ResourceCache.h>
+
+QTEST_MAIN(ResourceQueueTests)
+
+static QSharedPointer<Resource> makeResource(const QString& url) {
+    auto resource = QSharedPointer<Resource>::create(QUrl(url));
+    resource->setSelf(resource);
+    return resource;
+}
+
+void ResourceQueueTests::initTestCase() {
+    DependencyManager::set<ResourceCacheSharedItems>();
+}
+
+void ResourceQueueTests::init() {
+    // with no request slots, every request waits in the queue
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    sharedItems->clear();
+    sharedItems->setRequestLimit(0);
+}
+
+void ResourceQueueTests::highestPriorityFirst() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    QObject owner;
+
+    auto low = makeResource("http://example.com/low");
+    auto high = makeResource("http://example.com/high");
+    auto tiedFirst = makeResource("http://example.com/tiedFirst");
+    auto tiedSecond = makeResource("http://example.com/tiedSecond");
+    low->setLoadPriority(&owner, 1.0f);
+    high->setLoadPriority(&owner, 10.0f);
+    tiedFirst->setLoadPriority(&owner, 5.0f);
+    tiedSecond->setLoadPriority(&owner, 5.0f);
+
+    QVERIFY(!sharedItems->appendRequest(low));
+    QVERIFY(!sharedItems->appendRequest(tiedFirst));
+    QVERIFY(!sharedItems->appendRequest(high));
+    QVERIFY(!sharedItems->appendRequest(tiedSecond));
+    QCOMPARE(sharedItems->getPendingRequestsCount(), 4u);
+
+    // among equal priorities the later request goes first
+    QCOMPARE(sharedItems->getHighestPendingRequest(), high);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), tiedSecond);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), tiedFirst);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), low);
+    QVERIFY(sharedItems->getHighestPendingRequest().isNull());
+    QCOMPARE(sharedItems->getPendingRequestsCount(), 0u);
+}
+
+void ResourceQueueTests::filesFirst() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    QObject owner;
+
+    auto remote = makeResource("http://example.com/remote");
+    auto file = makeResource("file:///tmp/local");
+    remote->setLoadPriority(&owner, 100.0f);
+    file->setLoadPriority(&owner, -100.0f);
+
+    sharedItems->appendRequest(remote);
+    sharedItems->appendRequest(file);
+
+    QCOMPARE(sharedItems->getHighestPendingRequest(), file);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), remote);
+}
+
+void ResourceQueueTests::reprioritize() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    QObject owner;
+
+    const int NUM_RESOURCES = 100;
+    QList<QSharedPointer<Resource>> resources;
+    for (int i = 0; i < NUM_RESOURCES; ++i) {
+        auto resource = makeResource(QString("http://example.com/%1").arg(i));
+        resource->setLoadPriority(&owner, (float)i);
+        sharedItems->appendRequest(resource);
+        resources.append(resource);
+    }
+
+    // reversing the priorities of the queued requests reverses the order they come out in
+    for (int i = 0; i < NUM_RESOURCES; ++i) {
+        resources[i]->setLoadPriority(&owner, (float)(NUM_RESOURCES - i));
+    }
+    for (int i = 0; i < NUM_RESOURCES; ++i) {
+        QCOMPARE(sharedItems->getHighestPendingRequest(), resources[i]);
+    }
+}
+
+void ResourceQueueTests::ownerGone() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    QObject owner;
+    auto goneOwner = new QObject();
+
+    auto kept = makeResource("http://example.com/kept");
+    auto orphaned = makeResource("http://example.com/orphaned");
+    kept->setLoadPriority(&owner, 1.0f);
+    orphaned->setLoadPriority(goneOwner, 10.0f);
+    sharedItems->appendRequest(kept);
+    sharedItems->appendRequest(orphaned);
+
+    // the orphaned request falls back to no priority, without being told
+    delete goneOwner;
+    QCOMPARE(sharedItems->getHighestPendingRequest(), kept);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), orphaned);
+}
+
+void ResourceQueueTests::requestFreed() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    QObject owner;
+
+    auto kept = makeResource("http://example.com/kept");
+    auto freed = makeResource("http://example.com/freed");
+    kept->setLoadPriority(&owner, 1.0f);
+    freed->setLoadPriority(&owner, 10.0f);
+    sharedItems->appendRequest(kept);
+    sharedItems->appendRequest(freed);
+
+    freed.reset();
+    sharedItems->refreshPendingRequests();
+    QCOMPARE(sharedItems->getPendingRequestsCount(), 1u);
+    QCOMPARE(sharedItems->getPendingRequests().size(), 1);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), kept);
+}
+
+void ResourceQueueTests::nonFinitePriority() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    QObject owner;
+    QObject otherOwner;
+
+    auto low = makeResource("http://example.com/low");
+    auto high = makeResource("http://example.com/high");
+    low->setLoadPriority(&owner, 1.0f);
+    high->setLoadPriority(&owner, 10.0f);
+    sharedItems->appendRequest(low);
+    sharedItems->appendRequest(high);
+
+    // the non-finite priorities are ignored, and the queue still drains
+    high->setLoadPriority(&owner, std::numeric_limits<float>::quiet_NaN());
+    low->setLoadPriority(&otherOwner, std::numeric_limits<float>::infinity());
+    QCOMPARE(high->getLoadPriority(), 10.0f);
+    QCOMPARE(low->getLoadPriority(), 1.0f);
+
+    QCOMPARE(sharedItems->getHighestPendingRequest(), high);
+    QCOMPARE(sharedItems->getHighestPendingRequest(), low);
+    QVERIFY(sharedItems->getHighestPendingRequest().isNull());
+}
+
+void ResourceQueueTests::adaptiveLimit() {
+    auto sharedItems = DependencyManager::get<ResourceCacheSharedItems>();
+    sharedItems->setRequestLimit(4);
+    QCOMPARE(sharedItems->getRequestLimit(), 4u);
+
+    sharedItems->setAdaptiveRequestLimit(8, 16);
+    QCOMPARE(sharedItems->getRequestLimit(), 8u);
+    sharedItems->setAdaptiveRequestLimit(2, 6);
+    QCOMPARE(sharedItems->getRequestLimit(), 6u);
+
+    // a fixed limit stops the adapting
+    sharedItems->setRequestLimit(3);
+    QCOMPARE(sharedItems->getRequestLimit(), 3u);
+    sharedItems->refreshPendingRequests();
+    QCOMPARE(sharedItems->getRequestLimit(), 3u);
+}
+
+void ResourceQueueTests::cleanupTestCase() {
+    DependencyManager::get<ResourceCacheSharedItems>()->clear();
+}
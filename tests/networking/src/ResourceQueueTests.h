@@ -0,0 +1,32 @@
+//
+//  ResourceQueueTests.h
+//  tests/networking/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_ResourceQueueTests_h
+#define hifi_ResourceQueueTests_h
+
+#include <QtTest/QtTest>
+
+class ResourceQueueTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void init();
+    void highestPriorityFirst();
+    void filesFirst();
+    void reprioritize();
+    void ownerGone();
+    void requestFreed();
+    void nonFinitePriority();
+    void adaptiveLimit();
+    void cleanupTestCase();
+};
+
+#endif // hifi_ResourceQueueTests_h
@@ -0,0 +1,206 @@
+//
+//  EntityEditFilterRulesTests.cpp
+//  tests/octree/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityEditFilterRulesTests.h"
+
+#include <QJsonDocument>
+
+#include <EntityEditFilterRules.h>
+#include <NumericalConstants.h>
+
+QTEST_MAIN(EntityEditFilterRulesTests)
+
+using Result = EntityEditFilterRules::Result;
+
+namespace {
+    std::shared_ptr<EntityEditFilterRules> compile(const char* json) {
+        QString error;
+        auto rules = EntityEditFilterRules::compile(QJsonDocument::fromJson(json).object(), error);
+        if (!rules) {
+            qDebug() << error;
+        }
+        return rules;
+    }
+}
+
+void EntityEditFilterRulesTests::invalidRules() {
+    QString error;
+    QVERIFY(!EntityEditFilterRules::compile(QJsonDocument::fromJson("{ \"unknown\": true }").object(), error));
+    QVERIFY(!error.isEmpty());
+    QVERIFY(!compile("{ \"allowedProperties\": [ \"notAProperty\" ] }"));
+    QVERIFY(!compile("{ \"clamp\": { \"name\": { \"max\": 1 } } }"));
+    QVERIFY(!compile("{ \"clamp\": { \"dimensions\": { \"max\": [ 1, 2 ] } } }"));
+    QVERIFY(!compile("{ \"filterTypes\": [ \"move\" ] }"));
+    QVERIFY(!compile("{ \"zoneBounds\": \"wrap\" }"));
+    QVERIFY(!compile("{ \"rateLimit\": { \"perSecond\": 0 } }"));
+    QVERIFY(!compile("{ \"rateLimit\": { \"perSecond\": 1, \"filterTypes\": [ \"move\" ] } }"));
+    QVERIFY(compile("{}"));
+}
+
+void EntityEditFilterRulesTests::filterTypes() {
+    auto rules = compile("{ \"filterTypes\": [ \"edit\" ], \"rejectAll\": true }");
+    QVERIFY(rules);
+
+    EntityItemProperties properties;
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, 0), Result::Rejected);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Add, nullptr, nullptr, 0), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Delete, nullptr, nullptr, 0), Result::Accepted);
+}
+
+void EntityEditFilterRulesTests::allowedAndDeniedProperties() {
+    auto allowed = compile("{ \"allowedProperties\": [ \"position\", \"rotation\" ] }");
+    QVERIFY(allowed);
+
+    EntityItemProperties moved;
+    moved.setPosition(glm::vec3(1.0f));
+    moved.setRotation(glm::quat());
+    moved.setLastEditedBy(QUuid::createUuid());
+    QCOMPARE(allowed->filter(moved, EntityTree::FilterType::Edit, nullptr, nullptr, 0), Result::Accepted);
+
+    EntityItemProperties renamed = moved;
+    renamed.setName("renamed");
+    QCOMPARE(allowed->filter(renamed, EntityTree::FilterType::Edit, nullptr, nullptr, 0), Result::Rejected);
+
+    auto denied = compile("{ \"deniedProperties\": [ \"script\" ] }");
+    QVERIFY(denied);
+    QCOMPARE(denied->filter(renamed, EntityTree::FilterType::Edit, nullptr, nullptr, 0), Result::Accepted);
+
+    EntityItemProperties scripted;
+    scripted.setScript("http://example.com/script.js");
+    QCOMPARE(denied->filter(scripted, EntityTree::FilterType::Add, nullptr, nullptr, 0), Result::Rejected);
+}
+
+void EntityEditFilterRulesTests::clamps() {
+    auto rules = compile("{ \"clamp\": { \"dimensions\": { \"min\": 0.5, \"max\": [ 10, 4, 10 ] }, "
+                         "\"lifetime\": { \"max\": 3600 } } }");
+    QVERIFY(rules);
+
+    EntityItemProperties inside;
+    inside.setDimensions(glm::vec3(1.0f, 2.0f, 3.0f));
+    inside.setLifetime(60.0f);
+    QCOMPARE(rules->filter(inside, EntityTree::FilterType::Add, nullptr, nullptr, 0), Result::Accepted);
+    QVERIFY(inside.getDimensions() == glm::vec3(1.0f, 2.0f, 3.0f));
+
+    EntityItemProperties outside;
+    outside.setDimensions(glm::vec3(0.1f, 20.0f, 3.0f));
+    outside.setLifetime(-1.0f);
+    QCOMPARE(rules->filter(outside, EntityTree::FilterType::Add, nullptr, nullptr, 0), Result::Changed);
+    QVERIFY(outside.getDimensions() == glm::vec3(0.5f, 4.0f, 3.0f));
+    QCOMPARE(outside.getLifetime(), -1.0f);
+
+    EntityItemProperties immortal;
+    immortal.setLifetime(100000.0f);
+    QCOMPARE(rules->filter(immortal, EntityTree::FilterType::Edit, nullptr, nullptr, 0), Result::Changed);
+    QCOMPARE(immortal.getLifetime(), 3600.0f);
+    QVERIFY(!immortal.dimensionsChanged());
+}
+
+void EntityEditFilterRulesTests::zoneBounds() {
+    auto clamping = compile("{ \"zoneBounds\": \"clamp\" }");
+    auto rejecting = compile("{ \"zoneBounds\": \"reject\" }");
+    QVERIFY(clamping && rejecting);
+    AABox zoneBox(glm::vec3(0.0f), 10.0f);
+
+    EntityItemProperties outside;
+    outside.setPosition(glm::vec3(5.0f, 20.0f, -1.0f));
+    EntityItemProperties rejected = outside;
+    QCOMPARE(rejecting->filter(rejected, EntityTree::FilterType::Edit, nullptr, &zoneBox, 0), Result::Rejected);
+    QCOMPARE(clamping->filter(outside, EntityTree::FilterType::Edit, nullptr, &zoneBox, 0), Result::Changed);
+    QVERIFY(outside.getPosition() == glm::vec3(5.0f, 10.0f, 0.0f));
+
+    // the global filter has no zone
+    EntityItemProperties global;
+    global.setPosition(glm::vec3(100.0f));
+    QCOMPARE(rejecting->filter(global, EntityTree::FilterType::Edit, nullptr, nullptr, 0), Result::Accepted);
+
+    // positions relative to a parent aren't bounded
+    EntityItemProperties parented;
+    parented.setPosition(glm::vec3(100.0f));
+    parented.setParentID(QUuid::createUuid());
+    QCOMPARE(rejecting->filter(parented, EntityTree::FilterType::Edit, nullptr, &zoneBox, 0), Result::Accepted);
+}
+
+void EntityEditFilterRulesTests::rateLimit() {
+    auto rules = compile("{ \"rateLimit\": { \"perSecond\": 2, \"burst\": 3 } }");
+    QVERIFY(rules);
+    EntityItemProperties properties;
+
+    quint64 now = USECS_PER_SECOND;
+    for (int i = 0; i < 3; i++) {
+        QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now), Result::Accepted);
+    }
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now), Result::Rejected);
+
+    // half a second earns one more message
+    now += USECS_PER_SECOND / 2;
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now), Result::Rejected);
+
+    // and never more than the burst
+    now += 10 * USECS_PER_SECOND;
+    for (int i = 0; i < 3; i++) {
+        QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now), Result::Accepted);
+    }
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now), Result::Rejected);
+}
+
+void EntityEditFilterRulesTests::rateLimitPerSender() {
+    auto rules = compile("{ \"rateLimit\": { \"perSecond\": 1, \"burst\": 2 } }");
+    QVERIFY(rules);
+    EntityItemProperties properties;
+    QUuid flooder = QUuid::createUuid();
+    QUuid other = QUuid::createUuid();
+
+    quint64 now = USECS_PER_SECOND;
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, flooder), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, flooder), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, flooder), Result::Rejected);
+
+    // one sender using up its rate doesn't limit another
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, other), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, other), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, other), Result::Rejected);
+
+    // the buckets of senders that went quiet are dropped, and they get a whole burst again
+    now += 20 * USECS_PER_SECOND;
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, flooder), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, flooder), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, flooder), Result::Rejected);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, other), Result::Accepted);
+}
+
+void EntityEditFilterRulesTests::rateLimitFilterTypes() {
+    EntityItemProperties properties;
+    QUuid sender = QUuid::createUuid();
+    quint64 now = USECS_PER_SECOND;
+
+    // physics results aren't limited by default
+    auto rules = compile("{ \"rateLimit\": { \"perSecond\": 1, \"burst\": 1 } }");
+    QVERIFY(rules);
+    for (int i = 0; i < 10; i++) {
+        QCOMPARE(rules->filter(properties, EntityTree::FilterType::Physics, nullptr, nullptr, now, sender),
+                 Result::Accepted);
+    }
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, sender), Result::Accepted);
+    QCOMPARE(rules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, sender), Result::Rejected);
+
+    // unless the rule asks for them
+    auto physicsRules = compile("{ \"rateLimit\": { \"perSecond\": 1, \"burst\": 1, \"filterTypes\": [ \"physics\" ] } }");
+    QVERIFY(physicsRules);
+    QCOMPARE(physicsRules->filter(properties, EntityTree::FilterType::Physics, nullptr, nullptr, now, sender),
+             Result::Accepted);
+    QCOMPARE(physicsRules->filter(properties, EntityTree::FilterType::Physics, nullptr, nullptr, now, sender),
+             Result::Rejected);
+    QCOMPARE(physicsRules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, sender),
+             Result::Accepted);
+    QCOMPARE(physicsRules->filter(properties, EntityTree::FilterType::Edit, nullptr, nullptr, now, sender),
+             Result::Accepted);
+}
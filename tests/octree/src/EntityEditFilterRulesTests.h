@@ -0,0 +1,31 @@
+//
+//  EntityEditFilterRulesTests.h
+//  tests/octree/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityEditFilterRulesTests_h
+#define hifi_EntityEditFilterRulesTests_h
+
+#include <QtTest/QtTest>
+
+class EntityEditFilterRulesTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void invalidRules();
+    void filterTypes();
+    void allowedAndDeniedProperties();
+    void clamps();
+    void zoneBounds();
+    void rateLimit();
+    void rateLimitPerSender();
+    void rateLimitFilterTypes();
+};
+
+#endif // hifi_EntityEditFilterRulesTests_h
@@ -0,0 +1,133 @@
+//
+//  OctreeBinaryPersistTests.cpp
+//  tests/octree/src
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeBinaryPersistTests.h"
+
+#include <OctreeBinaryPersist.h>
+
+QTEST_MAIN(OctreeBinaryPersistTests)
+
+namespace {
+    const PacketVersion BITSTREAM_VERSION = 42;
+
+    OctreeBinaryPersist::Header makeHeader(const QUuid& id, int64_t dataVersion) {
+        OctreeBinaryPersist::Header header;
+        header.id = id;
+        header.dataVersion = dataVersion;
+        header.bitstreamVersion = BITSTREAM_VERSION;
+        return header;
+    }
+}
+
+void OctreeBinaryPersistTests::init() {
+    _dir.reset(new QTemporaryDir());
+    QVERIFY(_dir->isValid());
+    _filename = _dir->filePath("models.bin");
+}
+
+void OctreeBinaryPersistTests::snapshotRoundTrip() {
+    auto header = makeHeader(QUuid::createUuid(), 7);
+    OctreeBinaryPersist::Changes items;
+    items.updated.emplace_back(QUuid::createUuid(), QByteArray("first"));
+    items.updated.emplace_back(QUuid::createUuid(), QByteArray(100000, 'x'));
+
+    QVERIFY(OctreeBinaryPersist::writeSnapshot(_filename, header, items) > 0);
+
+    OctreeBinaryPersist::Header readHeader;
+    std::vector<QByteArray> readItems;
+    QVERIFY(OctreeBinaryPersist::read(_filename, readHeader, readItems));
+    QCOMPARE(readHeader.id, header.id);
+    QCOMPARE(readHeader.dataVersion, (int64_t)7);
+    QCOMPARE(readHeader.bitstreamVersion, BITSTREAM_VERSION);
+    QCOMPARE((int)readItems.size(), 2);
+    QCOMPARE(readItems[0], QByteArray("first"));
+    QCOMPARE(readItems[1], QByteArray(100000, 'x'));
+}
+
+void OctreeBinaryPersistTests::journalReplay() {
+    QUuid first = QUuid::createUuid();
+    QUuid second = QUuid::createUuid();
+    QUuid third = QUuid::createUuid();
+
+    auto snapshotHeader = makeHeader(QUuid::createUuid(), 1);
+    OctreeBinaryPersist::Changes items;
+    items.updated.emplace_back(first, QByteArray("first"));
+    items.updated.emplace_back(second, QByteArray("second"));
+    QVERIFY(OctreeBinaryPersist::writeSnapshot(_filename, snapshotHeader, items) > 0);
+
+    OctreeBinaryPersist::Changes changes;
+    changes.updated.emplace_back(second, QByteArray("second, edited"));
+    changes.updated.emplace_back(third, QByteArray("third"));
+    QVERIFY(OctreeBinaryPersist::appendToJournal(_filename, snapshotHeader, makeHeader(snapshotHeader.id, 2), changes) > 0);
+
+    changes = OctreeBinaryPersist::Changes();
+    changes.removed.push_back(first);
+    QVERIFY(OctreeBinaryPersist::appendToJournal(_filename, snapshotHeader, makeHeader(snapshotHeader.id, 3), changes) > 0);
+
+    OctreeBinaryPersist::Header header;
+    QVERIFY(OctreeBinaryPersist::readHeader(_filename, header));
+    QCOMPARE(header.dataVersion, (int64_t)3);
+
+    std::vector<QByteArray> readItems;
+    QVERIFY(OctreeBinaryPersist::read(_filename, header, readItems));
+    QCOMPARE(header.dataVersion, (int64_t)3);
+    QCOMPARE((int)readItems.size(), 2);
+    QCOMPARE(readItems[0], QByteArray("second, edited"));
+    QCOMPARE(readItems[1], QByteArray("third"));
+}
+
+void OctreeBinaryPersistTests::incompleteJournalBatch() {
+    auto snapshotHeader = makeHeader(QUuid::createUuid(), 1);
+    OctreeBinaryPersist::Changes items;
+    items.updated.emplace_back(QUuid::createUuid(), QByteArray("first"));
+    QVERIFY(OctreeBinaryPersist::writeSnapshot(_filename, snapshotHeader, items) > 0);
+
+    OctreeBinaryPersist::Changes changes;
+    changes.updated.emplace_back(QUuid::createUuid(), QByteArray("second"));
+    QVERIFY(OctreeBinaryPersist::appendToJournal(_filename, snapshotHeader, makeHeader(snapshotHeader.id, 2), changes) > 0);
+    qint64 size = OctreeBinaryPersist::appendToJournal(_filename, snapshotHeader, makeHeader(snapshotHeader.id, 3), changes);
+    QVERIFY(size > 0);
+
+    // cut the last batch short, as if the server had stopped while writing it
+    QFile journal(OctreeBinaryPersist::journalFilenameFor(_filename));
+    QVERIFY(journal.resize(size - 4));
+
+    OctreeBinaryPersist::Header header;
+    std::vector<QByteArray> readItems;
+    QVERIFY(OctreeBinaryPersist::read(_filename, header, readItems));
+    QCOMPARE(header.dataVersion, (int64_t)2);
+    QCOMPARE((int)readItems.size(), 2);
+}
+
+void OctreeBinaryPersistTests::staleJournal() {
+    auto snapshotHeader = makeHeader(QUuid::createUuid(), 1);
+    OctreeBinaryPersist::Changes items;
+    items.updated.emplace_back(QUuid::createUuid(), QByteArray("first"));
+    QVERIFY(OctreeBinaryPersist::writeSnapshot(_filename, snapshotHeader, items) > 0);
+
+    OctreeBinaryPersist::Changes changes;
+    changes.updated.emplace_back(QUuid::createUuid(), QByteArray("second"));
+    QVERIFY(OctreeBinaryPersist::appendToJournal(_filename, snapshotHeader, makeHeader(snapshotHeader.id, 2), changes) > 0);
+    QString journalFilename = OctreeBinaryPersist::journalFilenameFor(_filename);
+    QVERIFY(QFile::copy(journalFilename, journalFilename + ".old"));
+
+    // a new snapshot replaces the journal, one left behind by a crash must not be replayed on top of it
+    auto newSnapshotHeader = makeHeader(snapshotHeader.id, 2);
+    QVERIFY(OctreeBinaryPersist::writeSnapshot(_filename, newSnapshotHeader, items) > 0);
+    QVERIFY(!QFile::exists(journalFilename));
+    QVERIFY(QFile::rename(journalFilename + ".old", journalFilename));
+
+    OctreeBinaryPersist::Header header;
+    std::vector<QByteArray> readItems;
+    QVERIFY(OctreeBinaryPersist::read(_filename, header, readItems));
+    QCOMPARE(header.dataVersion, (int64_t)2);
+    QCOMPARE((int)readItems.size(), 1);
+}
@@ -0,0 +1,36 @@
+//
+//  OctreeBinaryPersistTests.h
+//  tests/octree/src
+//
+//  Created by High Fidelity on 2026-10-15.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeBinaryPersistTests_h
+#define hifi_OctreeBinaryPersistTests_h
+
+#include <memory>
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+
+class OctreeBinaryPersistTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    void snapshotRoundTrip();
+    void journalReplay();
+    void incompleteJournalBatch();
+    void staleJournal();
+
+private:
+    QString _filename;
+    std::unique_ptr<QTemporaryDir> _dir;
+};
+
+#endif // hifi_OctreeBinaryPersistTests_h
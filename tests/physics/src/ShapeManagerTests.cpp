@@ -11,6 +11,8 @@
 
 #include "ShapeManagerTests.h"
 
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 
 #include <ShapeManager.h>
@@ -19,6 +21,103 @@
 
 QTEST_MAIN(ShapeManagerTests)
 
+static ShapeInfo makeCompoundInfo(float scale) {
+    // tetrahedral hulls, offset so the children have transforms to restore
+    ShapeInfo::PointCollection pointCollection;
+    const int NUM_HULLS = 3;
+    for (int i = 0; i < NUM_HULLS; ++i) {
+        glm::vec3 center((float)i, 0.0f, 0.0f);
+        ShapeInfo::PointList pointList;
+        pointList.push_back(center + scale * glm::vec3(1.0f, 1.0f, 1.0f));
+        pointList.push_back(center + scale * glm::vec3(1.0f, -1.0f, -1.0f));
+        pointList.push_back(center + scale * glm::vec3(-1.0f, 1.0f, -1.0f));
+        pointList.push_back(center + scale * glm::vec3(-1.0f, -1.0f, 1.0f));
+        pointCollection.push_back(pointList);
+    }
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_COMPOUND, glm::vec3(2.0f, 1.0f, 1.0f), "http://example.com/compound.fbx");
+    info.setPointCollection(pointCollection);
+    info.setOffset(glm::vec3(0.5f, 0.25f, 0.0f));
+    return info;
+}
+
+static ShapeInfo makeStaticMeshInfo(float height) {
+    // a grid of triangles, big enough to have a BVH with some depth
+    const int NUM_SIDE_POINTS = 20;
+    ShapeInfo::PointList points;
+    for (int z = 0; z < NUM_SIDE_POINTS; ++z) {
+        for (int x = 0; x < NUM_SIDE_POINTS; ++x) {
+            points.push_back(glm::vec3((float)x, height * (float)((x * z) % 3), (float)z));
+        }
+    }
+    ShapeInfo info;
+    info.setParams(SHAPE_TYPE_STATIC_MESH, glm::vec3(0.5f * NUM_SIDE_POINTS), "http://example.com/mesh.fbx");
+    info.setPointCollection(ShapeInfo::PointCollection(1, points));
+    ShapeInfo::TriangleIndices& indices = info.getTriangleIndices();
+    for (int z = 0; z < NUM_SIDE_POINTS - 1; ++z) {
+        for (int x = 0; x < NUM_SIDE_POINTS - 1; ++x) {
+            int32_t corner = z * NUM_SIDE_POINTS + x;
+            indices.push_back(corner);
+            indices.push_back(corner + NUM_SIDE_POINTS);
+            indices.push_back(corner + 1);
+            indices.push_back(corner + 1);
+            indices.push_back(corner + NUM_SIDE_POINTS);
+            indices.push_back(corner + NUM_SIDE_POINTS + 1);
+        }
+    }
+    return info;
+}
+
+static void verifyRoundTrip(const ShapeInfo& info) {
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info);
+    QVERIFY(shape != nullptr);
+
+    QByteArray data;
+    QVERIFY(ShapeFactory::serializeShape(info, shape, data));
+    const btCollisionShape* restoredShape = ShapeFactory::createShapeFromData(info, data);
+    QVERIFY(restoredShape != nullptr);
+    QCOMPARE(restoredShape->getShapeType(), shape->getShapeType());
+
+    // everything that was serialized came back bit for bit
+    QByteArray restoredData;
+    QVERIFY(ShapeFactory::serializeShape(info, restoredShape, restoredData));
+    QCOMPARE(restoredData, data);
+
+    btTransform identity;
+    identity.setIdentity();
+    btVector3 minCorner, maxCorner, restoredMinCorner, restoredMaxCorner;
+    shape->getAabb(identity, minCorner, maxCorner);
+    restoredShape->getAabb(identity, restoredMinCorner, restoredMaxCorner);
+    QVERIFY(restoredMinCorner == minCorner);
+    QVERIFY(restoredMaxCorner == maxCorner);
+
+    // truncated data
+    QCOMPARE(ShapeFactory::createShapeFromData(info, data.left(data.size() - 1)), (const btCollisionShape*)nullptr);
+    // trailing data
+    QCOMPARE(ShapeFactory::createShapeFromData(info, data + QByteArray(1, 'x')), (const btCollisionShape*)nullptr);
+    // data for a shape of another type
+    ShapeInfo otherInfo;
+    otherInfo.setParams(info.getType() == SHAPE_TYPE_COMPOUND ? SHAPE_TYPE_SIMPLE_COMPOUND : SHAPE_TYPE_COMPOUND, glm::vec3(1.0f));
+    QCOMPARE(ShapeFactory::createShapeFromData(otherInfo, data), (const btCollisionShape*)nullptr);
+
+    ShapeFactory::deleteShape(restoredShape);
+    ShapeFactory::deleteShape(shape);
+}
+
+static btOptimizedBvh* getBvh(const btCollisionShape* shape) {
+    return const_cast<btBvhTriangleMeshShape*>(static_cast<const btBvhTriangleMeshShape*>(shape))->getOptimizedBvh();
+}
+
+// overwrites the escape or triangle index of a node of the BVH, which is serialized last and in place
+static QByteArray setBvhNodeIndex(const btCollisionShape* shape, const QByteArray& data, int nodeIndex, int32_t value) {
+    int bvhOffset = data.size() - (int)getBvh(shape)->calculateSerializeBufferSize();
+    int offset = bvhOffset + (int)sizeof(btQuantizedBvh) + nodeIndex * (int)sizeof(btQuantizedBvhNode) +
+        (int)offsetof(btQuantizedBvhNode, m_escapeIndexOrTriangleIndex);
+    QByteArray result = data;
+    memcpy(result.data() + offset, &value, sizeof(value));
+    return result;
+}
+
 void ShapeManagerTests::testShapeAccounting() {
     ShapeManager shapeManager;
     ShapeInfo info;
@@ -244,3 +343,92 @@ void ShapeManagerTests::addCompoundShape() {
     QCOMPARE(shapeManager.getNumShapes(), 0);
     QCOMPARE(shapeManager.getNumReferences(info), 0);
 }
+
+void ShapeManagerTests::serializeCompoundShape() {
+    verifyRoundTrip(makeCompoundInfo(1.0f));
+}
+
+void ShapeManagerTests::serializeStaticMeshShape() {
+    ShapeInfo info = makeStaticMeshInfo(1.0f);
+    verifyRoundTrip(info);
+
+    // a BVH doesn't restore onto a mesh with a different number of triangles
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info);
+    QByteArray data;
+    QVERIFY(ShapeFactory::serializeShape(info, shape, data));
+    info.getTriangleIndices().resize(info.getTriangleIndices().size() - 3);
+    QCOMPARE(ShapeFactory::createShapeFromData(info, data), (const btCollisionShape*)nullptr);
+    ShapeFactory::deleteShape(shape);
+}
+
+void ShapeManagerTests::corruptedStaticMeshBvh() {
+    ShapeInfo info = makeStaticMeshInfo(1.0f);
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info);
+    QVERIFY(shape != nullptr);
+    QByteArray data;
+    QVERIFY(ShapeFactory::serializeShape(info, shape, data));
+
+    int numNodes = getBvh(shape)->getQuantizedNodeArray().size();
+    int numTriangles = (int)info.getTriangleIndices().size() / 3;
+    QVERIFY(numNodes > 3);
+
+    // the root's escape index past the last node, and short of it
+    QCOMPARE(ShapeFactory::createShapeFromData(info, setBvhNodeIndex(shape, data, 0, -(numNodes + 1))),
+             (const btCollisionShape*)nullptr);
+    QCOMPARE(ShapeFactory::createShapeFromData(info, setBvhNodeIndex(shape, data, 0, -(numNodes - 1))),
+             (const btCollisionShape*)nullptr);
+    // the last node is a leaf, pointing it past the last triangle
+    QCOMPARE(ShapeFactory::createShapeFromData(info, setBvhNodeIndex(shape, data, numNodes - 1, numTriangles)),
+             (const btCollisionShape*)nullptr);
+
+    // the untouched data still restores
+    const btCollisionShape* restoredShape = ShapeFactory::createShapeFromData(info, data);
+    QVERIFY(restoredShape != nullptr);
+
+    ShapeFactory::deleteShape(restoredShape);
+    ShapeFactory::deleteShape(shape);
+}
+
+void ShapeManagerTests::shapeCacheTest() {
+    QTemporaryDir cacheDir;
+    auto cache = std::make_shared<ShapeCache>(cacheDir.path().toStdString(), ShapeCache::EXT);
+    cache->initialize();
+
+    ShapeInfo info = makeStaticMeshInfo(1.0f);
+    QCOMPARE(cache->loadShape(info), (const btCollisionShape*)nullptr);
+
+    // built and saved on the first load, restored on the second
+    const btCollisionShape* shape = ShapeFactory::createShapeFromInfo(info, cache.get());
+    QVERIFY(shape != nullptr);
+    const btCollisionShape* cachedShape = cache->loadShape(info);
+    QVERIFY(cachedShape != nullptr);
+    QVERIFY(cachedShape != shape);
+    QCOMPARE(cachedShape->getShapeType(), shape->getShapeType());
+    ShapeFactory::deleteShape(cachedShape);
+
+    // the same url with different contents has the same hash, but not the same key
+    ShapeInfo changedInfo = makeStaticMeshInfo(2.0f);
+    QCOMPARE(changedInfo.getHash(), info.getHash());
+    QVERIFY(ShapeCache::getKey(changedInfo) != ShapeCache::getKey(info));
+    QCOMPARE(cache->loadShape(changedInfo), (const btCollisionShape*)nullptr);
+
+    // the primitives aren't worth caching
+    ShapeInfo boxInfo;
+    boxInfo.setBox(glm::vec3(1.0f));
+    const btCollisionShape* box = ShapeFactory::createShapeFromInfo(boxInfo, cache.get());
+    QVERIFY(box != nullptr);
+    QCOMPARE(cache->loadShape(boxInfo), (const btCollisionShape*)nullptr);
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)1);
+
+    // the ShapeManager restores the slow shapes it builds on the spot from the cache too
+    ShapeManager shapeManager;
+    shapeManager.setShapeCache(cache);
+    ShapeInfo compoundInfo = makeCompoundInfo(1.0f);
+    const btCollisionShape* compound = shapeManager.getShape(compoundInfo);
+    QVERIFY(compound != nullptr);
+    QCOMPARE(cache->getNumTotalFiles(), (size_t)2);
+    shapeManager.releaseShape(compound);
+
+    ShapeFactory::deleteShape(box);
+    ShapeFactory::deleteShape(shape);
+}
@@ -25,6 +25,13 @@ private slots:
     void addCylinderShape();
     void addCapsuleShape();
     void addCompoundShape();
+    // serialized hulls and BVHs restore to shapes that serialize the same, and bad data restores to nothing
+    void serializeCompoundShape();
+    void serializeStaticMeshShape();
+    // a BVH with node or triangle indices out of range doesn't restore
+    void corruptedStaticMeshBvh();
+    // shapes saved to the ShapeCache load back by their contents, even when the ShapeInfo hash is the same
+    void shapeCacheTest();
 };
 
 #endif // hifi_ShapeManagerTests_h
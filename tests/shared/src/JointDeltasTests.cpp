@@ -0,0 +1,247 @@
+//
+//  JointDeltasTests.cpp
+//  tests/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JointDeltasTests.h"
+
+#include <JointDeltas.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+QTEST_MAIN(JointDeltasTests)
+
+static const int NUM_JOINTS = 60;
+
+static QVector<JointData> randomJoints(int numJoints) {
+    QVector<JointData> joints(numJoints);
+    for (auto& joint : joints) {
+        joint.rotation = glm::normalize(glm::quat(randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f),
+                                                  randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f)));
+        joint.translation = glm::vec3(randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f),
+                                      randFloatInRange(-1.0f, 1.0f));
+    }
+    return joints;
+}
+
+static void compareToPose(const QVector<JointData>& joints, const JointDeltas::Pose& pose) {
+    QCOMPARE(joints.size(), (int)pose.size());
+    for (int i = 0; i < joints.size(); ++i) {
+        QVERIFY(JointDeltas::quantize(joints[i]) == pose[i]);
+    }
+}
+
+static int writePose(const JointDeltas::Encoding& encoding, QByteArray& section) {
+    section.resize(JointDeltas::maxSectionSize((int)encoding.pose->size()));
+    int nextJoint;
+    int size = JointDeltas::writeSection(reinterpret_cast<uint8_t*>(section.data()), section.size(), encoding, 0, nextJoint);
+    section.resize(size);
+    return nextJoint;
+}
+
+static int readSection(JointDeltas::Receiver& receiver, const QByteArray& section, QVector<JointData>& joints) {
+    return receiver.readSection(reinterpret_cast<const uint8_t*>(section.data()), section.size(), joints);
+}
+
+void JointDeltasTests::quantizeTest() {
+    const float MAX_ROTATION_ERROR = 0.0001f; // per quaternion component
+    const float MAX_TRANSLATION_ERROR = 0.5f / 16384.0f + EPSILON;
+
+    auto joints = randomJoints(1000);
+    for (const auto& joint : joints) {
+        JointData result;
+        JointDeltas::dequantize(JointDeltas::quantize(joint), result);
+
+        // q and -q are the same rotation
+        glm::quat rotation = glm::dot(joint.rotation, result.rotation) < 0.0f ? -result.rotation : result.rotation;
+        QVERIFY(fabsf(joint.rotation.x - rotation.x) < MAX_ROTATION_ERROR);
+        QVERIFY(fabsf(joint.rotation.y - rotation.y) < MAX_ROTATION_ERROR);
+        QVERIFY(fabsf(joint.rotation.z - rotation.z) < MAX_ROTATION_ERROR);
+        QVERIFY(fabsf(joint.rotation.w - rotation.w) < MAX_ROTATION_ERROR);
+        QVERIFY(fabsf(joint.translation.x - result.translation.x) < MAX_TRANSLATION_ERROR);
+        QVERIFY(fabsf(joint.translation.y - result.translation.y) < MAX_TRANSLATION_ERROR);
+        QVERIFY(fabsf(joint.translation.z - result.translation.z) < MAX_TRANSLATION_ERROR);
+    }
+}
+
+void JointDeltasTests::keyFrameTest() {
+    JointDeltas::Encoding encoding;
+    encoding.sequence = 7;
+    encoding.pose = JointDeltas::quantizePose(randomJoints(NUM_JOINTS));
+
+    QByteArray section;
+    QCOMPARE(writePose(encoding, section), NUM_JOINTS);
+
+    JointDeltas::Receiver receiver;
+    QVector<JointData> joints;
+    QCOMPARE(readSection(receiver, section, joints), section.size());
+    compareToPose(joints, *encoding.pose);
+
+    JointDeltas::Sequence sequence;
+    QVERIFY(receiver.takeAcknowledgement(usecTimestampNow(), sequence));
+    QCOMPARE(sequence, (JointDeltas::Sequence)7);
+}
+
+void JointDeltasTests::deltaTest() {
+    auto sentJoints = randomJoints(NUM_JOINTS);
+
+    JointDeltas::Encoding keyFrame;
+    keyFrame.sequence = 1;
+    keyFrame.pose = JointDeltas::quantizePose(sentJoints);
+
+    QByteArray keyFrameSection;
+    writePose(keyFrame, keyFrameSection);
+
+    JointDeltas::Receiver receiver;
+    QVector<JointData> joints;
+    readSection(receiver, keyFrameSection, joints);
+
+    // nudge a couple of joints
+    sentJoints[3].rotation = glm::normalize(sentJoints[3].rotation * glm::angleAxis(0.01f, glm::vec3(0.0f, 1.0f, 0.0f)));
+    sentJoints[42].translation += glm::vec3(0.001f, 0.0f, -0.002f);
+
+    JointDeltas::Encoding delta;
+    delta.sequence = 2;
+    delta.pose = JointDeltas::quantizePose(sentJoints);
+    delta.baselineSequence = keyFrame.sequence;
+    delta.baseline = keyFrame.pose;
+
+    QByteArray deltaSection;
+    writePose(delta, deltaSection);
+    QVERIFY(deltaSection.size() < 40);
+    QVERIFY(deltaSection.size() * 10 < keyFrameSection.size());
+
+    QCOMPARE(readSection(receiver, deltaSection, joints), deltaSection.size());
+    compareToPose(joints, *delta.pose);
+}
+
+void JointDeltasTests::splitSectionsTest() {
+    JointDeltas::Encoding encoding;
+    encoding.sequence = 100;
+    encoding.pose = JointDeltas::quantizePose(randomJoints(NUM_JOINTS));
+
+    const int MAX_SECTION_SIZE = 200;
+    std::vector<QByteArray> sections;
+    int firstJoint = 0;
+    while (firstJoint < NUM_JOINTS) {
+        QByteArray section(MAX_SECTION_SIZE, 0);
+        int nextJoint;
+        int size = JointDeltas::writeSection(reinterpret_cast<uint8_t*>(section.data()), section.size(), encoding,
+                                             firstJoint, nextJoint);
+        QVERIFY(size <= MAX_SECTION_SIZE);
+        QVERIFY(nextJoint > firstJoint);
+        section.resize(size);
+        sections.push_back(section);
+        firstJoint = nextJoint;
+    }
+    QVERIFY(sections.size() > 1);
+
+    // the last section first, nothing is complete until the others are in
+    JointDeltas::Receiver receiver;
+    QVector<JointData> joints;
+    JointDeltas::Sequence sequence;
+    quint64 now = usecTimestampNow();
+    QCOMPARE(readSection(receiver, sections.back(), joints), sections.back().size());
+    QVERIFY(!receiver.takeAcknowledgement(now, sequence));
+
+    for (size_t i = 0; i < sections.size() - 1; ++i) {
+        QCOMPARE(readSection(receiver, sections[i], joints), sections[i].size());
+    }
+    compareToPose(joints, *encoding.pose);
+    QVERIFY(receiver.takeAcknowledgement(now, sequence));
+    QCOMPARE(sequence, encoding.sequence);
+}
+
+void JointDeltasTests::missingBaselineTest() {
+    auto baseline = JointDeltas::quantizePose(randomJoints(NUM_JOINTS));
+
+    JointDeltas::Encoding delta;
+    delta.sequence = 12;
+    delta.pose = JointDeltas::quantizePose(randomJoints(NUM_JOINTS));
+    delta.baselineSequence = 11;
+    delta.baseline = baseline;
+
+    QByteArray section;
+    writePose(delta, section);
+
+    // the section is read through, but can't be applied
+    JointDeltas::Receiver receiver;
+    QVector<JointData> joints;
+    QCOMPARE(readSection(receiver, section, joints), section.size());
+    QVERIFY(joints.isEmpty());
+
+    JointDeltas::Sequence sequence;
+    QVERIFY(receiver.takeAcknowledgement(usecTimestampNow(), sequence));
+    QCOMPARE(sequence, JointDeltas::NO_BASELINE);
+}
+
+void JointDeltasTests::cullTest() {
+    // culled as from 50 m away, the 15 degree level of AvatarData::getDistanceBasedMinRotationDOT
+    const float MIN_ROTATION_DOT = cosf(glm::radians(15.0f) / 2.0f);
+    const float MIN_TRANSLATION = 0.0001f;
+    const glm::vec3 AXIS = glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f));
+
+    auto joints = randomJoints(NUM_JOINTS);
+    auto baseline = JointDeltas::quantizePose(joints);
+
+    // one joint turns a little, one a lot, and one moves by a centimeter
+    auto moved = joints;
+    moved[0].rotation = glm::angleAxis(glm::radians(1.0f), AXIS) * moved[0].rotation;
+    moved[1].rotation = glm::angleAxis(glm::radians(30.0f), AXIS) * moved[1].rotation;
+    moved[2].translation += glm::vec3(0.01f, 0.0f, 0.0f);
+    auto pose = JointDeltas::quantizePose(moved);
+
+    auto culled = JointDeltas::cullPose(pose, baseline, MIN_ROTATION_DOT, MIN_TRANSLATION);
+    QVERIFY(culled != pose && culled != baseline);
+    QVERIFY((*culled)[0] == (*baseline)[0]);
+    QVERIFY((*culled)[1] == (*pose)[1]);
+    QVERIFY((*culled)[2] == (*pose)[2]);
+
+    // nothing to cull, or nothing left
+    QVERIFY(JointDeltas::cullPose(pose, baseline, 2.0f, -1.0f) == pose);
+    QVERIFY(JointDeltas::cullPose(pose, nullptr, MIN_ROTATION_DOT, MIN_TRANSLATION) == pose);
+    auto small = joints;
+    small[0].rotation = moved[0].rotation;
+    QVERIFY(JointDeltas::cullPose(JointDeltas::quantizePose(small), baseline, MIN_ROTATION_DOT, MIN_TRANSLATION) ==
+            baseline);
+
+    // small turns are culled against the acknowledged culled pose until they add up to one that is sent
+    auto turning = joints;
+    auto acknowledged = baseline;
+    int steps = 0;
+    while ((*acknowledged)[0] == (*baseline)[0] && steps < 30) {
+        turning[0].rotation = glm::angleAxis(glm::radians(1.0f), AXIS) * turning[0].rotation;
+        acknowledged = JointDeltas::cullPose(JointDeltas::quantizePose(turning), acknowledged, MIN_ROTATION_DOT,
+                                             MIN_TRANSLATION);
+        ++steps;
+    }
+    QVERIFY(steps >= 14 && steps <= 16);
+
+    // every joint turning a little, as a far away avatar idles
+    auto idling = joints;
+    for (auto& joint : idling) {
+        joint.rotation = glm::angleAxis(glm::radians(2.0f), AXIS) * joint.rotation;
+    }
+    JointDeltas::Encoding encoding;
+    encoding.sequence = 2;
+    encoding.baselineSequence = 1;
+    encoding.baseline = baseline;
+    encoding.pose = JointDeltas::quantizePose(idling);
+    QByteArray section;
+    writePose(encoding, section);
+    int deltaSize = section.size();
+
+    encoding.pose = JointDeltas::cullPose(encoding.pose, baseline, MIN_ROTATION_DOT, MIN_TRANSLATION);
+    writePose(encoding, section);
+    int culledSize = section.size();
+
+    qDebug() << NUM_JOINTS << "joints turned by 2 degrees:" << deltaSize << "bytes of deltas," << culledSize
+             << "bytes culled";
+    QVERIFY(culledSize < deltaSize);
+}
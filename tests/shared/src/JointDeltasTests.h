@@ -0,0 +1,35 @@
+//
+//  JointDeltasTests.h
+//  tests/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_JointDeltasTests_h
+#define hifi_JointDeltasTests_h
+
+#include <QtTest/QtTest>
+
+class JointDeltasTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    // quantized joints come back within the precision of the grid
+    void quantizeTest();
+    // a key frame rebuilds the sender's quantized pose exactly, and is acknowledged
+    void keyFrameTest();
+    // a delta against an acknowledged pose only carries the joints that changed
+    void deltaTest();
+    // a pose split across sections is only complete once every section is in
+    void splitSectionsTest();
+    // a delta against a pose the receiver doesn't have makes it ask for a key frame
+    void missingBaselineTest();
+    // culling leaves small changes at the baseline until they add up, and saves their bytes
+    void cullTest();
+};
+
+#endif // hifi_JointDeltasTests_h
@@ -0,0 +1,330 @@
+//
+//  JointPackingTests.cpp
+//  tests/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "JointPackingTests.h"
+
+#include <vector>
+
+#include <QElapsedTimer>
+
+#include <test-utils/GLMTestUtils.h>
+#include <test-utils/QTestExtensions.h>
+
+#include <GLMHelpers.h>
+#include <JointPacking.h>
+#include <SharedUtil.h>
+
+QTEST_MAIN(JointPackingTests)
+
+// covers full blocks of 4 and 8 joints and every length of the remainder
+static const int MAX_NUM_JOINTS = 100;
+static const int TRANSLATION_RADIX = 14;
+static const float TRANSLATION_SCALE = 1.7f;
+
+static JointPacking::Rotations randomRotations(int numJoints) {
+    JointPacking::Rotations rotations;
+    for (int i = 0; i < numJoints; i++) {
+        if (i % 7 == 3) {
+            // ties between the largest components
+            rotations.append(glm::quat(0.5f, 0.5f, -0.5f, -0.5f));
+        } else {
+            rotations.append(glm::normalize(glm::quat(randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f),
+                                                      randFloatInRange(-1.0f, 1.0f), randFloatInRange(-1.0f, 1.0f))));
+        }
+    }
+    return rotations;
+}
+
+static JointPacking::Translations randomTranslations(int numJoints) {
+    JointPacking::Translations translations;
+    for (int i = 0; i < numJoints; i++) {
+        // some beyond the range of the scale, to be clamped
+        translations.append(glm::vec3(randFloatInRange(-2.0f, 2.0f), randFloatInRange(-2.0f, 2.0f),
+                                      randFloatInRange(-2.0f, 2.0f)));
+    }
+    return translations;
+}
+
+// The batch kernels, each tested on its own against the scalar path rather than only the one dispatched to
+struct Kernels {
+    const char* name;
+    void (*packRotations)(const float* x, const float* y, const float* z, const float* w, uint8_t* destination,
+                          int count);
+    void (*unpackRotations)(const uint8_t* source, float* x, float* y, float* z, float* w, int count);
+    void (*packTranslations)(const float* x, const float* y, const float* z, float scale, int radix,
+                             uint8_t* destination, int count);
+    void (*unpackTranslations)(const uint8_t* source, float scale, int radix, float* x, float* y, float* z, int count);
+    void (*packValidityBits)(const uint8_t* flags, int count, uint8_t* bits);
+    int (*unpackValidityBits)(const uint8_t* bits, int count, uint8_t* flags);
+};
+
+static void packRotations_dispatch(const float* x, const float* y, const float* z, const float* w, uint8_t* destination,
+                                   int count) {
+    JointPacking::Rotations rotations;
+    for (int i = 0; i < count; i++) {
+        rotations.append(glm::quat(w[i], x[i], y[i], z[i]));
+    }
+    JointPacking::packRotations(rotations, destination);
+}
+
+static void unpackRotations_dispatch(const uint8_t* source, float* x, float* y, float* z, float* w, int count) {
+    JointPacking::Rotations rotations;
+    rotations.resize(count);
+    JointPacking::unpackRotations(source, rotations);
+    for (int i = 0; i < count; i++) {
+        x[i] = rotations.x[i];
+        y[i] = rotations.y[i];
+        z[i] = rotations.z[i];
+        w[i] = rotations.w[i];
+    }
+}
+
+static void packTranslations_dispatch(const float* x, const float* y, const float* z, float scale, int radix,
+                                      uint8_t* destination, int count) {
+    JointPacking::Translations translations;
+    for (int i = 0; i < count; i++) {
+        translations.append(glm::vec3(x[i], y[i], z[i]));
+    }
+    JointPacking::packTranslations(translations, scale, radix, destination);
+}
+
+static void unpackTranslations_dispatch(const uint8_t* source, float scale, int radix, float* x, float* y, float* z,
+                                        int count) {
+    JointPacking::Translations translations;
+    translations.resize(count);
+    JointPacking::unpackTranslations(source, scale, radix, translations);
+    for (int i = 0; i < count; i++) {
+        x[i] = translations.x[i];
+        y[i] = translations.y[i];
+        z[i] = translations.z[i];
+    }
+}
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+//
+// Runtime CPU dispatch
+//
+#include <CPUDetect.h>
+
+void packRotations_SSE41(const float* x, const float* y, const float* z, const float* w, uint8_t* destination, int count);
+void unpackRotations_SSE41(const uint8_t* source, float* x, float* y, float* z, float* w, int count);
+void packTranslations_SSE41(const float* x, const float* y, const float* z, float scale, int radix,
+                            uint8_t* destination, int count);
+void unpackTranslations_SSE41(const uint8_t* source, float scale, int radix, float* x, float* y, float* z, int count);
+void packValidityBits_SSE41(const uint8_t* flags, int count, uint8_t* bits);
+int unpackValidityBits_SSE41(const uint8_t* bits, int count, uint8_t* flags);
+
+void packRotations_AVX2(const float* x, const float* y, const float* z, const float* w, uint8_t* destination, int count);
+void unpackRotations_AVX2(const uint8_t* source, float* x, float* y, float* z, float* w, int count);
+void packTranslations_AVX2(const float* x, const float* y, const float* z, float scale, int radix,
+                           uint8_t* destination, int count);
+void unpackTranslations_AVX2(const uint8_t* source, float scale, int radix, float* x, float* y, float* z, int count);
+void packValidityBits_AVX2(const uint8_t* flags, int count, uint8_t* bits);
+int unpackValidityBits_AVX2(const uint8_t* bits, int count, uint8_t* flags);
+
+static std::vector<Kernels> availableKernels() {
+    std::vector<Kernels> kernels {
+        { "dispatch", &packRotations_dispatch, &unpackRotations_dispatch, &packTranslations_dispatch,
+          &unpackTranslations_dispatch, &JointPacking::packValidityBits, &JointPacking::unpackValidityBits }
+    };
+    if (cpuSupportsSSE41()) {
+        kernels.push_back({ "SSE4.1", &packRotations_SSE41, &unpackRotations_SSE41, &packTranslations_SSE41,
+                            &unpackTranslations_SSE41, &packValidityBits_SSE41, &unpackValidityBits_SSE41 });
+    } else {
+        qDebug() << "No SSE4.1, its kernels aren't tested";
+    }
+    if (cpuSupportsAVX2()) {
+        kernels.push_back({ "AVX2", &packRotations_AVX2, &unpackRotations_AVX2, &packTranslations_AVX2,
+                            &unpackTranslations_AVX2, &packValidityBits_AVX2, &unpackValidityBits_AVX2 });
+    } else {
+        qDebug() << "No AVX2, its kernels aren't tested";
+    }
+    return kernels;
+}
+
+#else   // portable reference code
+static std::vector<Kernels> availableKernels() {
+    return {
+        { "dispatch", &packRotations_dispatch, &unpackRotations_dispatch, &packTranslations_dispatch,
+          &unpackTranslations_dispatch, &JointPacking::packValidityBits, &JointPacking::unpackValidityBits }
+    };
+}
+#endif
+
+void JointPackingTests::rotationsTest() {
+    for (const auto& kernels : availableKernels()) {
+        qDebug() << "Testing" << kernels.name;
+        for (int numJoints = 0; numJoints < MAX_NUM_JOINTS; numJoints++) {
+            JointPacking::Rotations rotations = randomRotations(numJoints);
+
+            std::vector<uint8_t> expected(numJoints * JointPacking::PACKED_ROTATION_SIZE);
+            for (int i = 0; i < numJoints; i++) {
+                packOrientationQuatToSixBytes(&expected[i * JointPacking::PACKED_ROTATION_SIZE], rotations.at(i));
+            }
+
+            // one more byte to catch writes past the end
+            std::vector<uint8_t> packed(expected.size() + 1, 0xaa);
+            kernels.packRotations(rotations.x.data(), rotations.y.data(), rotations.z.data(), rotations.w.data(),
+                                  packed.data(), numJoints);
+            QVERIFY(memcmp(packed.data(), expected.data(), expected.size()) == 0);
+            QCOMPARE(packed.back(), (uint8_t)0xaa);
+
+            // one more float each to catch writes past the end
+            JointPacking::Rotations unpacked;
+            unpacked.resize(numJoints + 1);
+            unpacked.x[numJoints] = unpacked.y[numJoints] = unpacked.z[numJoints] = unpacked.w[numJoints] = -2.0f;
+            kernels.unpackRotations(packed.data(), unpacked.x.data(), unpacked.y.data(), unpacked.z.data(),
+                                    unpacked.w.data(), numJoints);
+            for (int i = 0; i < numJoints; i++) {
+                glm::quat rotation;
+                unpackOrientationQuatFromSixBytes(&expected[i * JointPacking::PACKED_ROTATION_SIZE], rotation);
+                // allow for fused multiply-adds in the kernels
+                QCOMPARE_WITH_ABS_ERROR(unpacked.at(i), rotation, 1.0e-6f);
+            }
+            QVERIFY(unpacked.at(numJoints) == glm::quat(-2.0f, -2.0f, -2.0f, -2.0f));
+        }
+    }
+}
+
+void JointPackingTests::translationsTest() {
+    for (const auto& kernels : availableKernels()) {
+        qDebug() << "Testing" << kernels.name;
+        for (int numJoints = 0; numJoints < MAX_NUM_JOINTS; numJoints++) {
+            JointPacking::Translations translations = randomTranslations(numJoints);
+
+            std::vector<uint8_t> expected(numJoints * JointPacking::PACKED_TRANSLATION_SIZE);
+            for (int i = 0; i < numJoints; i++) {
+                packFloatVec3ToSignedTwoByteFixed(&expected[i * JointPacking::PACKED_TRANSLATION_SIZE],
+                                                  translations.at(i) / TRANSLATION_SCALE, TRANSLATION_RADIX);
+            }
+
+            std::vector<uint8_t> packed(expected.size() + 1, 0xaa);
+            kernels.packTranslations(translations.x.data(), translations.y.data(), translations.z.data(),
+                                     TRANSLATION_SCALE, TRANSLATION_RADIX, packed.data(), numJoints);
+            QVERIFY(memcmp(packed.data(), expected.data(), expected.size()) == 0);
+            QCOMPARE(packed.back(), (uint8_t)0xaa);
+
+            JointPacking::Translations unpacked;
+            unpacked.resize(numJoints + 1);
+            unpacked.x[numJoints] = unpacked.y[numJoints] = unpacked.z[numJoints] = -2.0f;
+            kernels.unpackTranslations(packed.data(), TRANSLATION_SCALE, TRANSLATION_RADIX, unpacked.x.data(),
+                                       unpacked.y.data(), unpacked.z.data(), numJoints);
+            for (int i = 0; i < numJoints; i++) {
+                glm::vec3 translation;
+                unpackFloatVec3FromSignedTwoByteFixed(&expected[i * JointPacking::PACKED_TRANSLATION_SIZE], translation,
+                                                      TRANSLATION_RADIX);
+                QVERIFY(unpacked.at(i) == translation * TRANSLATION_SCALE);
+            }
+            QVERIFY(unpacked.at(numJoints) == glm::vec3(-2.0f));
+        }
+    }
+}
+
+void JointPackingTests::validityBitsTest() {
+    for (const auto& kernels : availableKernels()) {
+        qDebug() << "Testing" << kernels.name;
+        for (int numJoints = 0; numJoints < MAX_NUM_JOINTS; numJoints++) {
+            std::vector<uint8_t> flags(numJoints);
+            std::vector<uint8_t> expected((numJoints + 7) / 8, 0);
+            int numSet = 0;
+            for (int i = 0; i < numJoints; i++) {
+                // any non zero value is set
+                flags[i] = (rand() % 3 == 0) ? (uint8_t)(1 + rand() % 255) : 0;
+                if (flags[i]) {
+                    expected[i / 8] |= 1 << (i % 8);
+                    numSet++;
+                }
+            }
+
+            std::vector<uint8_t> bits(expected.size() + 1, 0xaa);
+            kernels.packValidityBits(flags.data(), numJoints, bits.data());
+            QVERIFY(memcmp(bits.data(), expected.data(), expected.size()) == 0);
+            QCOMPARE(bits.back(), (uint8_t)0xaa);
+
+            std::vector<uint8_t> unpacked(numJoints + 1, 0xaa);
+            QCOMPARE(kernels.unpackValidityBits(bits.data(), numJoints, unpacked.data()), numSet);
+            for (int i = 0; i < numJoints; i++) {
+                QCOMPARE(unpacked[i], (uint8_t)(flags[i] ? 1 : 0));
+            }
+            QCOMPARE(unpacked.back(), (uint8_t)0xaa);
+        }
+    }
+}
+
+void JointPackingTests::benchmark() {
+    // a full avatar, sent to a hundred peers for a hundred frames
+    const int NUM_JOINTS = 120;
+    const int LOOPS = 10000;
+
+    JointPacking::Rotations rotations = randomRotations(NUM_JOINTS);
+    JointPacking::Translations translations = randomTranslations(NUM_JOINTS);
+    std::vector<glm::quat> quats(NUM_JOINTS);
+    std::vector<glm::vec3> vecs(NUM_JOINTS);
+    for (int i = 0; i < NUM_JOINTS; i++) {
+        quats[i] = rotations.at(i);
+        vecs[i] = translations.at(i);
+    }
+    std::vector<uint8_t> packedRotations(NUM_JOINTS * JointPacking::PACKED_ROTATION_SIZE);
+    std::vector<uint8_t> packedTranslations(NUM_JOINTS * JointPacking::PACKED_TRANSLATION_SIZE);
+
+    {
+        QElapsedTimer timer;
+        timer.start();
+        for (int loop = 0; loop < LOOPS; loop++) {
+            uint8_t* destination = packedRotations.data();
+            for (int i = 0; i < NUM_JOINTS; i++) {
+                destination += packOrientationQuatToSixBytes(destination, quats[i]);
+            }
+            destination = packedTranslations.data();
+            for (int i = 0; i < NUM_JOINTS; i++) {
+                destination += packFloatVec3ToSignedTwoByteFixed(destination, vecs[i] / TRANSLATION_SCALE, TRANSLATION_RADIX);
+            }
+        }
+        qDebug() << "Pack scalar" << timer.elapsed() << "msecs";
+    }
+
+    {
+        QElapsedTimer timer;
+        timer.start();
+        for (int loop = 0; loop < LOOPS; loop++) {
+            JointPacking::packRotations(rotations, packedRotations.data());
+            JointPacking::packTranslations(translations, TRANSLATION_SCALE, TRANSLATION_RADIX, packedTranslations.data());
+        }
+        qDebug() << "Pack batch" << timer.elapsed() << "msecs";
+    }
+
+    {
+        QElapsedTimer timer;
+        timer.start();
+        for (int loop = 0; loop < LOOPS; loop++) {
+            const uint8_t* source = packedRotations.data();
+            for (int i = 0; i < NUM_JOINTS; i++) {
+                source += unpackOrientationQuatFromSixBytes(source, quats[i]);
+            }
+            source = packedTranslations.data();
+            for (int i = 0; i < NUM_JOINTS; i++) {
+                source += unpackFloatVec3FromSignedTwoByteFixed(source, vecs[i], TRANSLATION_RADIX);
+                vecs[i] *= TRANSLATION_SCALE;
+            }
+        }
+        qDebug() << "Unpack scalar" << timer.elapsed() << "msecs";
+    }
+
+    {
+        QElapsedTimer timer;
+        timer.start();
+        for (int loop = 0; loop < LOOPS; loop++) {
+            JointPacking::unpackRotations(packedRotations.data(), rotations);
+            JointPacking::unpackTranslations(packedTranslations.data(), TRANSLATION_SCALE, TRANSLATION_RADIX, translations);
+        }
+        qDebug() << "Unpack batch" << timer.elapsed() << "msecs";
+    }
+}
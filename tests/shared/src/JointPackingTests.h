@@ -0,0 +1,33 @@
+//
+//  JointPackingTests.h
+//  tests/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_JointPackingTests_h
+#define hifi_JointPackingTests_h
+
+#include <QtTest/QtTest>
+
+class JointPackingTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    // rotations packed by each kernel the CPU has are byte for byte those of packOrientationQuatToSixBytes, and unpack
+    // the same
+    void rotationsTest();
+    // translations packed by each kernel the CPU has are byte for byte those of packFloatVec3ToSignedTwoByteFixed, and
+    // unpack the same
+    void translationsTest();
+    // validity bits round trip through each kernel the CPU has, and are counted, for any number of joints
+    void validityBitsTest();
+    // times the batch kernels against the scalar path, one joint at a time
+    void benchmark();
+};
+
+#endif // hifi_JointPackingTests_h
@@ -0,0 +1,141 @@
+//
+//  MetricRegistryTests.cpp
+//  tests/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "MetricRegistryTests.h"
+
+#include <MetricRegistry.h>
+
+QTEST_MAIN(MetricRegistryTests)
+
+static QString prometheusText(const MetricSet& metrics) {
+    QString text;
+    QTextStream stream(&text);
+    MetricSet::writePrometheus(stream, { { "node_type=\"test\"", &metrics } });
+    stream.flush();
+    return text;
+}
+
+void MetricRegistryTests::counterChangesTest() {
+    auto& registry = MetricRegistry::getInstance();
+    auto counter = registry.counter("test_counter_changes_total", "A counter");
+
+    MetricRegistry::Encoder encoder;
+    MetricSet received;
+
+    counter.increment(3);
+    QVERIFY(received.readChanges(registry.writeChanges(encoder)));
+    QVERIFY(prometheusText(received).contains("test_counter_changes_total{node_type=\"test\"} 3\n"));
+
+    counter.increment(4);
+    QVERIFY(received.readChanges(registry.writeChanges(encoder)));
+    QVERIFY(prometheusText(received).contains("# TYPE test_counter_changes_total counter\n"));
+    QVERIFY(prometheusText(received).contains("test_counter_changes_total{node_type=\"test\"} 7\n"));
+}
+
+void MetricRegistryTests::unchangedTest() {
+    auto& registry = MetricRegistry::getInstance();
+    auto gauge = registry.gauge("test_unchanged_gauge", "A gauge");
+    gauge.set(1.5);
+
+    MetricRegistry::Encoder encoder;
+    MetricSet received;
+    QVERIFY(received.readChanges(registry.writeChanges(encoder)));
+
+    // the flag, no new metric and no changed metric
+    const int NUM_EMPTY_CHANGES_BYTES = 1 + 2 + 2;
+    QByteArray changes = registry.writeChanges(encoder);
+    QCOMPARE(changes.size(), NUM_EMPTY_CHANGES_BYTES);
+    QVERIFY(received.readChanges(changes));
+    QVERIFY(prometheusText(received).contains("test_unchanged_gauge{node_type=\"test\"} 1.5\n"));
+}
+
+void MetricRegistryTests::resetEncoderTest() {
+    auto& registry = MetricRegistry::getInstance();
+    auto counter = registry.counter("test_reset_total", "A counter");
+    counter.increment(2);
+
+    MetricRegistry::Encoder encoder;
+    MetricSet received;
+    QVERIFY(received.readChanges(registry.writeChanges(encoder)));
+
+    // a new receiver, e.g. a restarted domain server, only gets the full metrics after a reset
+    MetricSet newReceived;
+    counter.increment();
+    QVERIFY(!newReceived.readChanges(registry.writeChanges(encoder)));
+
+    encoder.reset();
+    QVERIFY(newReceived.readChanges(registry.writeChanges(encoder)));
+    QVERIFY(prometheusText(newReceived).contains("test_reset_total{node_type=\"test\"} 3\n"));
+}
+
+void MetricRegistryTests::histogramPrometheusTest() {
+    auto& registry = MetricRegistry::getInstance();
+    auto histogram = registry.histogram("test_histogram", "A histogram", { 100, 10 });
+    histogram.record(5);
+    histogram.record(10);
+    histogram.record(50);
+    histogram.record(1000);
+
+    MetricRegistry::Encoder encoder;
+    MetricSet received;
+    QVERIFY(received.readChanges(registry.writeChanges(encoder)));
+
+    QString text = prometheusText(received);
+    QVERIFY(text.contains("# TYPE test_histogram histogram\n"));
+    QVERIFY(text.contains("test_histogram_bucket{node_type=\"test\",le=\"10\"} 2\n"));
+    QVERIFY(text.contains("test_histogram_bucket{node_type=\"test\",le=\"100\"} 3\n"));
+    QVERIFY(text.contains("test_histogram_bucket{node_type=\"test\",le=\"+Inf\"} 4\n"));
+    QVERIFY(text.contains("test_histogram_sum{node_type=\"test\"} 1065\n"));
+    QVERIFY(text.contains("test_histogram_count{node_type=\"test\"} 4\n"));
+}
+
+void MetricRegistryTests::unknownMetricTest() {
+    auto& registry = MetricRegistry::getInstance();
+    auto counter = registry.counter("test_unknown_total", "A counter");
+
+    MetricRegistry::Encoder encoder;
+    MetricSet received;
+    QVERIFY(received.readChanges(registry.writeChanges(encoder)));
+
+    // changes read by another set, that never saw the metric definitions
+    counter.increment();
+    MetricSet otherReceived;
+    QVERIFY(!otherReceived.readChanges(registry.writeChanges(encoder)));
+    QVERIFY(otherReceived.isEmpty());
+
+    // registering the name again returns the same counter
+    QCOMPARE(registry.counter("test_unknown_total", "A counter").get(), (int64_t)1);
+    QVERIFY(!MetricRegistry::isValidName("invalid-name"));
+}
+
+void MetricRegistryTests::resyncTest() {
+    auto& registry = MetricRegistry::getInstance();
+    auto counter = registry.counter("test_resync_total", "A counter");
+    counter.increment();
+
+    MetricRegistry::Encoder encoder;
+    MetricSet received;
+    QVERIFY(received.readChanges(registry.writeChanges(encoder)));
+
+    // a corrupt write empties the set
+    QVERIFY(!received.readChanges(QByteArray(1, '\0')));
+    QVERIFY(received.isEmpty());
+
+    // changes that would apply to the empty set are refused as well, even without changed metrics
+    QVERIFY(!received.readChanges(registry.writeChanges(encoder)));
+    counter.increment();
+    QVERIFY(!received.readChanges(registry.writeChanges(encoder)));
+    QVERIFY(received.isEmpty());
+
+    encoder.reset();
+    QVERIFY(received.readChanges(registry.writeChanges(encoder)));
+    QVERIFY(prometheusText(received).contains("test_resync_total{node_type=\"test\"} 2\n"));
+}
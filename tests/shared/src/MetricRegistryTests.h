@@ -0,0 +1,35 @@
+//
+//  MetricRegistryTests.h
+//  tests/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_MetricRegistryTests_h
+#define hifi_MetricRegistryTests_h
+
+#include <QtTest/QtTest>
+
+class MetricRegistryTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    // the receiver adds up the counter changes it is sent
+    void counterChangesTest();
+    // unchanged metrics are left out of the changes
+    void unchangedTest();
+    // a reset encoder sends every metric again, and the receiver starts over
+    void resetEncoderTest();
+    // histograms are written with cumulative buckets, a sum and a count
+    void histogramPrometheusTest();
+    // changes that don't follow the ones read before are refused
+    void unknownMetricTest();
+    // after refusing changes a set only reads a full write again
+    void resyncTest();
+};
+
+#endif // hifi_MetricRegistryTests_h
@@ -0,0 +1,166 @@
+//
+//  TimingWheelTests.cpp
+//  tests/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "TimingWheelTests.h"
+
+#include <QElapsedTimer>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <TimingWheel.h>
+
+QTEST_MAIN(TimingWheelTests)
+
+namespace {
+    struct Item {
+        uint64_t deadline;
+    };
+    using ItemPointer = std::shared_ptr<Item>;
+    using Wheel = TimingWheel<Item>;
+
+    ItemPointer randomItem(uint64_t now, int maxSeconds) {
+        int msecs = randIntInRange(0, maxSeconds * MSECS_PER_SECOND);
+        return std::make_shared<Item>(Item { now + (uint64_t)msecs * USECS_PER_MSEC });
+    }
+
+    // advances in steps of a frame, and checks that nothing is due late or early by more than a tick
+    size_t advanceTo(Wheel& wheel, uint64_t& now, uint64_t end, std::vector<ItemPointer>& due) {
+        const uint64_t FRAME_USECS = USECS_PER_SECOND / 60;
+        size_t numDue = 0;
+        while (now < end) {
+            now = std::min(now + FRAME_USECS, end);
+            due.clear();
+            wheel.advance(now, due);
+            for (auto& item : due) {
+                if (item->deadline > now + Wheel::TICK_USECS || item->deadline + Wheel::TICK_USECS + FRAME_USECS < now) {
+                    return (size_t)-1;
+                }
+            }
+            numDue += due.size();
+        }
+        return numDue;
+    }
+}
+
+void TimingWheelTests::dueInOrder() {
+    Wheel wheel;
+    uint64_t now = usecTimestampNow();
+    std::vector<ItemPointer> items;
+    for (int i = 0; i < 1000; i++) {
+        items.push_back(randomItem(now, 10));
+        wheel.schedule(items.back(), items.back()->deadline);
+    }
+    QCOMPARE(wheel.size(), (size_t)1000);
+
+    std::vector<ItemPointer> due;
+    size_t firstHalf = advanceTo(wheel, now, now + 5 * USECS_PER_SECOND, due);
+    QVERIFY(firstHalf != (size_t)-1);
+    QCOMPARE(firstHalf + wheel.size(), (size_t)1000);
+    size_t secondHalf = advanceTo(wheel, now, now + 6 * USECS_PER_SECOND, due);
+    QCOMPARE(firstHalf + secondHalf, (size_t)1000);
+    QVERIFY(wheel.empty());
+}
+
+void TimingWheelTests::reschedule() {
+    Wheel wheel;
+    uint64_t now = usecTimestampNow();
+    auto item = std::make_shared<Item>(Item { now + 10 * USECS_PER_SECOND });
+    wheel.schedule(item, item->deadline);
+
+    // later, so it stays where it was
+    wheel.schedule(item, now + 20 * USECS_PER_SECOND);
+    QCOMPARE(wheel.size(), (size_t)1);
+
+    // earlier moves it
+    item->deadline = now + USECS_PER_SECOND;
+    wheel.schedule(item, item->deadline);
+    QCOMPARE(wheel.size(), (size_t)1);
+
+    std::vector<ItemPointer> due;
+    QCOMPARE(advanceTo(wheel, now, now + 2 * USECS_PER_SECOND, due), (size_t)1);
+    QVERIFY(wheel.empty());
+
+    // and the stale entry is never due
+    QCOMPARE(advanceTo(wheel, now, now + 20 * USECS_PER_SECOND, due), (size_t)0);
+}
+
+void TimingWheelTests::removeAndExpire() {
+    Wheel wheel;
+    uint64_t now = usecTimestampNow();
+    auto removed = std::make_shared<Item>(Item { now + USECS_PER_SECOND });
+    auto released = std::make_shared<Item>(Item { now + USECS_PER_SECOND });
+    auto kept = std::make_shared<Item>(Item { now + USECS_PER_SECOND });
+    wheel.schedule(removed, removed->deadline);
+    wheel.schedule(released, released->deadline);
+    wheel.schedule(kept, kept->deadline);
+
+    wheel.remove(removed);
+    QVERIFY(!wheel.contains(removed));
+    QVERIFY(wheel.contains(kept));
+    // an item that is gone is skipped
+    released.reset();
+
+    std::vector<ItemPointer> due;
+    wheel.advance(now + 2 * USECS_PER_SECOND, due);
+    QCOMPARE(due.size(), (size_t)1);
+    QVERIFY(due[0] == kept);
+}
+
+void TimingWheelTests::farDeadlines() {
+    Wheel wheel;
+    uint64_t now = usecTimestampNow();
+    // past the first, second and third levels
+    const uint64_t DELAYS[] = { 3 * USECS_PER_SECOND, 600 * USECS_PER_SECOND, 4 * 3600 * USECS_PER_SECOND };
+    std::vector<ItemPointer> items;
+    for (auto delay : DELAYS) {
+        items.push_back(std::make_shared<Item>(Item { now + delay }));
+        wheel.schedule(items.back(), items.back()->deadline);
+    }
+
+    std::vector<ItemPointer> due;
+    for (auto& item : items) {
+        // just before, then just after
+        uint64_t before = item->deadline - 2 * Wheel::TICK_USECS;
+        QCOMPARE(advanceTo(wheel, now, before, due), (size_t)0);
+        QCOMPARE(advanceTo(wheel, now, before + 4 * Wheel::TICK_USECS, due), (size_t)1);
+    }
+    QVERIFY(wheel.empty());
+}
+
+void TimingWheelTests::benchmark() {
+    const int NUM_ITEMS = 100000;
+    const int NUM_FRAMES = 600;
+    const uint64_t FRAME_USECS = USECS_PER_SECOND / 60;
+
+    Wheel wheel;
+    uint64_t now = usecTimestampNow();
+    std::vector<ItemPointer> items;
+    for (int i = 0; i < NUM_ITEMS; i++) {
+        // lifetimes of up to a minute
+        items.push_back(randomItem(now, 60));
+        wheel.schedule(items.back(), items.back()->deadline);
+    }
+
+    std::vector<ItemPointer> due;
+    size_t visited = 0;
+    size_t numDue = 0;
+    QElapsedTimer timer;
+    timer.start();
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+        now += FRAME_USECS;
+        due.clear();
+        visited += wheel.advance(now, due);
+        numDue += due.size();
+    }
+    qDebug() << "Advanced" << NUM_FRAMES << "frames in" << timer.elapsed() << "msecs, visiting" << visited
+             << "entries for" << numDue << "due, rather than" << (size_t)NUM_ITEMS * NUM_FRAMES;
+    QVERIFY(visited < (size_t)NUM_ITEMS * NUM_FRAMES / 10);
+}
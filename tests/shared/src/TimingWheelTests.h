@@ -0,0 +1,32 @@
+//
+//  TimingWheelTests.h
+//  tests/shared/src
+//
+//  Created by High Fidelity on 2026-10-16.
+//  Copyright 2026 High Fidelity, Inc.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_TimingWheelTests_h
+#define hifi_TimingWheelTests_h
+
+#include <QtTest/QtTest>
+
+class TimingWheelTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    // items are due in the tick of their deadline, never before it
+    void dueInOrder();
+    // earlier deadlines move an item, later ones leave it due early
+    void reschedule();
+    void removeAndExpire();
+    // deadlines that cascade down from every level
+    void farDeadlines();
+    // work is proportional to the items due, not the items held
+    void benchmark();
+};
+
+#endif // hifi_TimingWheelTests_h